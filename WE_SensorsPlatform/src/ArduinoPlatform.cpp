@@ -0,0 +1,779 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2019 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "ArduinoPlatform.h"
+
+#include <string.h>
+
+#if defined(ARDUINO)
+#include <Wire.h>
+#define DEFAULT_TRANSPORT (&WE_wireTransport)
+#elif defined(__linux__)
+#define DEFAULT_TRANSPORT (&WE_linuxI2CTransport)
+#else
+#define DEFAULT_TRANSPORT NULL
+#endif
+
+#if defined(ARDUINO)
+
+/**
+ * @brief  Get the Wire bus a sensor is attached to
+ * @param  Pointer to sensor interface
+ * @retval TwoWire instance, Wire if no handle is set
+ */
+
+static TwoWire *WireBus(WE_sensorInterface_t *sensorInterface)
+{
+	return (NULL != sensorInterface->handle) ? (TwoWire *)sensorInterface->handle : &Wire;
+}
+
+/**
+ * @brief  Initialize the Wire bus of a sensor
+ * @param  Pointer to sensor interface
+ * @retval Error Code
+ */
+
+static int WireInit(WE_sensorInterface_t *sensorInterface)
+{
+	uint32_t timeout = (uint32_t)(TIMEOUT_MS * 1000);  /* timeout in us */
+	bool reset_on_timeout = false;
+	TwoWire *bus = WireBus(sensorInterface);
+
+	bus->setWireTimeout(timeout, reset_on_timeout);
+    bus->begin();
+
+    return WE_SUCCESS;
+}
+
+/**
+ * @brief   Read data starting from the addressed register
+ * @param  -sensorInterface : pointer to sensor interface
+ *         -RegAdr : register address to read from
+ *         -NumByteToRead : number of bytes to read
+ *         -pointer Data : address stores the data
+ * @retval Error Code
+ */
+
+static int WireReadReg(WE_sensorInterface_t *sensorInterface, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+{
+	TwoWire *bus = WireBus(sensorInterface);
+
+    bus->beginTransmission(sensorInterface->address);
+    bus->write(RegAdr);
+	bus->endTransmission();
+
+    int n = bus->requestFrom((int)sensorInterface->address, NumByteToRead);
+	if (n != NumByteToRead) /* also includes: if n == 0 */
+	{
+		return WE_FAIL;
+	}
+
+    for (int i = 0; i < n; i++)
+    {
+        Data[i] = bus->read();
+    }
+
+    return WE_SUCCESS;
+}
+
+/**
+ * @brief  Write data starting from the addressed register
+ * @param  -sensorInterface : pointer to sensor interface
+ *         -RegAdr : address to write in
+ *         -NumByteToWrite : number of bytes to write
+ *         -pointer Data : address of the data to be written
+ * @retval Error Code
+ */
+
+static int WireWriteReg(WE_sensorInterface_t *sensorInterface, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data)
+{
+	TwoWire *bus = WireBus(sensorInterface);
+
+    bus->beginTransmission(sensorInterface->address);
+    bus->write(RegAdr);
+
+	for (int i = 0; i < NumByteToWrite; i++)
+    {
+        bus->write(Data[i]);
+    }
+
+	if (bus->endTransmission()) /* slave ack or nack */
+    {
+        return WE_FAIL;
+    }
+
+    return WE_SUCCESS;
+}
+
+ /**
+ * @brief   Read data from a sensor without addressing a register
+ * @param  -sensorInterface : pointer to sensor interface
+ *         -pointer Data : the address store the data
+ *         -NumByteToRead : number of bytes to read
+ * @retval Error Code
+ */
+
+static int WireRead(WE_sensorInterface_t *sensorInterface, uint8_t *data, int bytesToRead)
+{
+	TwoWire *bus = WireBus(sensorInterface);
+
+	bus->beginTransmission(sensorInterface->address);
+    int n = bus->requestFrom((int)sensorInterface->address, bytesToRead); // request Bytes
+
+	if (n != bytesToRead) /* also includes: if n == 0 */
+	{
+		return WE_FAIL;
+	}
+
+	for(int index = 0; index < bytesToRead; index++)
+	{
+		data[index] = bus->read();
+	}
+
+    return WE_SUCCESS;
+}
+
+const WE_transport_t WE_wireTransport = {
+	WireInit,
+	WireReadReg,
+	WireWriteReg,
+	WireRead
+};
+
+#endif /* ARDUINO */
+
+#if defined(WE_BUS_STATISTICS)
+
+static WE_busStatistics_t busStatistics[WE_BUS_STATISTICS_DEVICES];
+static int busStatisticsDevices = 0;
+
+/**
+ * @brief  Add one transport call to the statistics of a device
+ * @param  -address : I2C address of the device
+ *         -bytesRead : number of data bytes read
+ *         -bytesWritten : number of data bytes written
+ *         -result : result of the transport call
+ *         -start : micros() at the start of the call
+ * @retval None, devices beyond WE_BUS_STATISTICS_DEVICES are not counted
+ */
+
+static void BusStatisticsAdd(uint8_t address, int bytesRead, int bytesWritten, int result, unsigned long start)
+{
+	uint32_t elapsed = (uint32_t)(micros() - start);
+	WE_busStatistics_t *entry = NULL;
+
+	for (int i = 0; i < busStatisticsDevices; i++)
+	{
+		if (busStatistics[i].address == address)
+		{
+			entry = &busStatistics[i];
+			break;
+		}
+	}
+
+	if (NULL == entry)
+	{
+		if (busStatisticsDevices >= WE_BUS_STATISTICS_DEVICES)
+		{
+			return;
+		}
+		entry = &busStatistics[busStatisticsDevices++];
+		memset(entry, 0, sizeof(*entry));
+		entry->address = address;
+	}
+
+	entry->transactions++;
+	if (WE_SUCCESS == result)
+	{
+		entry->bytesRead += (uint32_t)bytesRead;
+		entry->bytesWritten += (uint32_t)bytesWritten;
+	}
+	else
+	{
+		entry->failures++;
+	}
+	entry->micros += elapsed;
+}
+
+/**
+ * @brief  Get the bus statistics of a device
+ * @param  -address : I2C address of the device
+ *         -statistics : pointer to statistics to fill
+ * @retval Error Code, WE_FAIL if the device had no traffic
+ */
+
+int WE_getBusStatistics(uint8_t address, WE_busStatistics_t *statistics)
+{
+	for (int i = 0; i < busStatisticsDevices; i++)
+	{
+		if (busStatistics[i].address == address)
+		{
+			*statistics = busStatistics[i];
+			return WE_SUCCESS;
+		}
+	}
+
+	return WE_FAIL;
+}
+
+/**
+ * @brief  Get the bus statistics of all devices
+ * @param  -snapshot : array to fill, in order of the first access of each device
+ *         -maxDevices : size of the array
+ * @retval Number of devices copied
+ */
+
+int WE_getBusStatisticsSnapshot(WE_busStatistics_t *snapshot, int maxDevices)
+{
+	int count = (busStatisticsDevices < maxDevices) ? busStatisticsDevices : maxDevices;
+
+	for (int i = 0; i < count; i++)
+	{
+		snapshot[i] = busStatistics[i];
+	}
+
+	return count;
+}
+
+/**
+ * @brief  Clear the bus statistics of all devices
+ */
+
+void WE_resetBusStatistics(void)
+{
+	busStatisticsDevices = 0;
+}
+
+#endif /* WE_BUS_STATISTICS */
+
+/**
+ * @brief  Get the index of a register in a register cache
+ * @param  -cache : pointer to register cache
+ *         -reg : register address
+ * @retval Index, -1 if the register is not cached
+ */
+
+static int CacheIndex(const WE_registerCache_t *cache, uint8_t reg)
+{
+	for (int i = 0; i < cache->count; i++)
+	{
+		if (cache->registers[i].reg == reg)
+		{
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * @brief  Read registers from a register cache
+ * @param  -cache : pointer to register cache
+ *         -RegAdr : first register
+ *         -NumByteToRead : number of registers
+ *         -pointer Data : address stores the data
+ * @retval Error Code, WE_FAIL unless all registers are cached and valid
+ */
+
+static int CacheRead(const WE_registerCache_t *cache, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+{
+	for (int i = 0; i < NumByteToRead; i++)
+	{
+		int index = CacheIndex(cache, (uint8_t)(RegAdr + i));
+
+		if ((index < 0) || (0 == (cache->valid & ((uint32_t)1 << index))))
+		{
+			return WE_FAIL;
+		}
+	}
+
+	for (int i = 0; i < NumByteToRead; i++)
+	{
+		Data[i] = cache->values[CacheIndex(cache, (uint8_t)(RegAdr + i))];
+	}
+
+	return WE_SUCCESS;
+}
+
+/**
+ * @brief  Update a register cache with values read from the sensor
+ * @param  -cache : pointer to register cache
+ *         -RegAdr : first register
+ *         -NumByteToRead : number of registers
+ *         -pointer Data : values read
+ *
+ * Only the cached registers at the start of the access are updated: beyond
+ * the first register that is not cached the address may wrap around (e.g.
+ * output registers while the FIFO is read), so the bytes that follow are
+ * not known to belong to the registers after it.
+ */
+
+static void CacheStore(WE_registerCache_t *cache, uint8_t RegAdr, int NumByteToRead, const uint8_t *Data)
+{
+	for (int i = 0; i < NumByteToRead; i++)
+	{
+		int index = CacheIndex(cache, (uint8_t)(RegAdr + i));
+
+		if (index < 0)
+		{
+			break;
+		}
+
+		/* a pending self-clearing bit will change, don't keep it */
+		if (0 != (Data[i] & (cache->registers[index].selfClearing | cache->registers[index].reset)))
+		{
+			cache->valid &= ~((uint32_t)1 << index);
+		}
+		else
+		{
+			cache->values[index] = Data[i];
+			cache->valid |= (uint32_t)1 << index;
+		}
+	}
+}
+
+/**
+ * @brief  Update a register cache with values written to the sensor
+ * @param  -cache : pointer to register cache
+ *         -RegAdr : first register
+ *         -NumByteToWrite : number of registers
+ *         -pointer Data : values written
+ */
+
+static void CacheWrite(WE_registerCache_t *cache, uint8_t RegAdr, int NumByteToWrite, const uint8_t *Data)
+{
+	for (int i = 0; i < NumByteToWrite; i++)
+	{
+		int index = CacheIndex(cache, (uint8_t)(RegAdr + i));
+
+		if ((index >= 0) && (0 != (Data[i] & cache->registers[index].reset)))
+		{
+			cache->valid = 0;
+			return;
+		}
+	}
+
+	CacheStore(cache, RegAdr, NumByteToWrite, Data);
+}
+
+/**
+ * @brief  Set up a register cache, all values start out invalid
+ * @param  -cache : pointer to register cache
+ *         -registers : cached registers, ascending
+ *         -count : number of registers, max. 32
+ *         -incrementFlag : OR-ed into the register address of multi-byte reads, 0 if not needed
+ *         -values : storage for count values
+ */
+
+void WE_initRegisterCache(WE_registerCache_t *cache, const WE_cachedRegister_t *registers, uint8_t count,
+		uint8_t incrementFlag, uint8_t *values)
+{
+	cache->registers = registers;
+	cache->count = (count > 32) ? 32 : count;
+	cache->incrementFlag = incrementFlag;
+	cache->values = values;
+	cache->valid = 0;
+	cache->dirty = 0;
+	cache->configuring = false;
+}
+
+/**
+ * @brief  Drop all cached values of a sensor, e.g. after a power cycle
+ * @param  Pointer to sensor interface
+ */
+
+void WE_invalidateRegisterCache(WE_sensorInterface_t *sensorInterface)
+{
+	if ((NULL != sensorInterface) && (NULL != sensorInterface->cache))
+	{
+		sensorInterface->cache->valid = 0;
+		sensorInterface->cache->dirty = 0;
+	}
+}
+
+/**
+ * @brief  Reload all cached registers of a sensor, one read per block of adjacent registers
+ * @param  Pointer to sensor interface
+ * @retval Error Code
+ */
+
+int WE_resyncRegisterCache(WE_sensorInterface_t *sensorInterface)
+{
+	WE_registerCache_t *cache;
+	uint8_t data[32];
+	int first = 0;
+
+	if ((NULL == sensorInterface) || (NULL == sensorInterface->cache))
+	{
+		return WE_FAIL;
+	}
+
+	cache = sensorInterface->cache;
+	cache->valid = 0;
+	cache->dirty = 0;
+
+	while (first < cache->count)
+	{
+		uint8_t reg = cache->registers[first].reg;
+		int count = 1;
+
+		while ((first + count < cache->count) && (cache->registers[first + count].reg == (uint8_t)(reg + count)))
+		{
+			count++;
+		}
+
+		if (WE_SUCCESS != ReadReg(sensorInterface, (count > 1) ? (uint8_t)(reg | cache->incrementFlag) : reg, count, data))
+		{
+			return WE_FAIL;
+		}
+		CacheStore(cache, reg, count, data);
+
+		first += count;
+	}
+
+	return WE_SUCCESS;
+}
+
+/**
+ * @brief  Collect a write in the register cache instead of sending it
+ * @param  -cache : pointer to register cache
+ *         -RegAdr : first register
+ *         -NumByteToWrite : number of registers
+ *         -pointer Data : values to write
+ * @retval Error Code, WE_FAIL if the write must go to the sensor now
+ */
+
+static int CacheDefer(WE_registerCache_t *cache, uint8_t RegAdr, int NumByteToWrite, const uint8_t *Data)
+{
+	for (int i = 0; i < NumByteToWrite; i++)
+	{
+		int index = CacheIndex(cache, (uint8_t)(RegAdr + i));
+
+		/* self-clearing bits trigger an action, they are not configuration */
+		if ((index < 0) || (0 != (Data[i] & (cache->registers[index].selfClearing | cache->registers[index].reset))))
+		{
+			return WE_FAIL;
+		}
+	}
+
+	for (int i = 0; i < NumByteToWrite; i++)
+	{
+		int index = CacheIndex(cache, (uint8_t)(RegAdr + i));
+
+		cache->values[index] = Data[i];
+		cache->valid |= (uint32_t)1 << index;
+		cache->dirty |= (uint32_t)1 << index;
+	}
+
+	return WE_SUCCESS;
+}
+
+/**
+ * @brief  Write all collected register values of a sensor
+ * @param  Pointer to sensor interface
+ * @retval Error Code
+ *
+ * Each block of adjacent registers from the first to the last changed one
+ * is written in one burst. Unchanged registers within a block are written
+ * with their cached value.
+ */
+
+static int CacheFlush(WE_sensorInterface_t *sensorInterface)
+{
+	WE_registerCache_t *cache = sensorInterface->cache;
+	bool configuring = cache->configuring;
+	int result = WE_SUCCESS;
+	int first = 0;
+
+	cache->configuring = false;
+
+	while ((WE_SUCCESS == result) && (first < cache->count))
+	{
+		uint8_t reg = cache->registers[first].reg;
+		int last = first;
+
+		if (0 == (cache->dirty & ((uint32_t)1 << first)))
+		{
+			first++;
+			continue;
+		}
+
+		for (int next = first + 1; (next < cache->count) && (cache->registers[next].reg == (uint8_t)(reg + next - first)); next++)
+		{
+			if (0 != (cache->dirty & ((uint32_t)1 << next)))
+			{
+				last = next;
+			}
+			else if (0 == (cache->valid & ((uint32_t)1 << next)))
+			{
+				break;
+			}
+		}
+
+		for (int i = first; i <= last; i++)
+		{
+			cache->dirty &= ~((uint32_t)1 << i);
+		}
+
+		int count = last - first + 1;
+		result = WriteReg(sensorInterface, (count > 1) ? (uint8_t)(reg | cache->incrementFlag) : reg, count, &cache->values[first]);
+
+		first = last + 1;
+	}
+
+	cache->configuring = configuring;
+
+	return result;
+}
+
+/**
+ * @brief  Start collecting configuration changes of a sensor
+ * @param  Pointer to sensor interface
+ * @retval Error Code, WE_FAIL if the sensor has no register cache
+ *
+ * Until WE_commitConfiguration(), writes to cached registers only update the
+ * cache. Other writes, and writes triggering a one-shot, boot or reset, go
+ * to the sensor right away, after everything collected before them.
+ */
+
+int WE_beginConfiguration(WE_sensorInterface_t *sensorInterface)
+{
+	if ((NULL == sensorInterface) || (NULL == sensorInterface->cache))
+	{
+		return WE_FAIL;
+	}
+
+	sensorInterface->cache->configuring = true;
+
+	return WE_SUCCESS;
+}
+
+/**
+ * @brief  Write the configuration changes collected since WE_beginConfiguration()
+ * @param  Pointer to sensor interface
+ * @retval Error Code
+ */
+
+int WE_commitConfiguration(WE_sensorInterface_t *sensorInterface)
+{
+	if ((NULL == sensorInterface) || (NULL == sensorInterface->cache))
+	{
+		return WE_FAIL;
+	}
+
+	sensorInterface->cache->configuring = false;
+
+	return CacheFlush(sensorInterface);
+}
+
+/**
+ * @brief  Drop the configuration changes collected since WE_beginConfiguration()
+ * @param  Pointer to sensor interface
+ */
+
+void WE_abortConfiguration(WE_sensorInterface_t *sensorInterface)
+{
+	if ((NULL != sensorInterface) && (NULL != sensorInterface->cache))
+	{
+		WE_registerCache_t *cache = sensorInterface->cache;
+
+		cache->valid &= ~cache->dirty;
+		cache->dirty = 0;
+		cache->configuring = false;
+	}
+}
+
+/**
+ * @brief  Get the transport of a sensor
+ * @param  Pointer to sensor interface
+ * @retval Transport, the platform default if none is set, NULL if there is none
+ */
+
+static const WE_transport_t *Transport(WE_sensorInterface_t *sensorInterface)
+{
+	if (NULL == sensorInterface)
+	{
+		return NULL;
+	}
+	return (NULL != sensorInterface->transport) ? sensorInterface->transport : DEFAULT_TRANSPORT;
+}
+
+/**
+ * @brief  Initialize the I2C Interface
+ * @param  -sensorInterface : pointer to sensor interface
+ *         -address : I2C address
+ * @retval Error Code
+ */
+
+int I2CInit(WE_sensorInterface_t *sensorInterface, int address)
+{
+	const WE_transport_t *transport = Transport(sensorInterface);
+
+	if (NULL == transport)
+	{
+		return WE_FAIL;
+	}
+
+    sensorInterface->address = (uint8_t)address;
+    return transport->init(sensorInterface);
+}
+
+/**
+ * @brief  Set I2C bus Address
+ * @param  -sensorInterface : pointer to sensor interface
+ *         -address : I2C address
+ */
+
+void I2CSetAddress(WE_sensorInterface_t *sensorInterface, int address)
+{
+	sensorInterface->address = (uint8_t)address;
+}
+
+/**
+ * @brief   Read data starting from the addressed register
+ * @param  -sensorInterface : pointer to sensor interface
+ *         -RegAdr : register address to read from
+ *         -NumByteToRead : number of bytes to read
+ *         -pointer Data : address stores the data
+ * @retval Error Code
+ */
+
+int ReadReg(WE_sensorInterface_t *sensorInterface, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+{
+	const WE_transport_t *transport = Transport(sensorInterface);
+	int result;
+
+	if ((NULL == transport) || (0 == NumByteToRead))
+	{
+		return WE_FAIL;
+	}
+
+	if ((NULL != sensorInterface->cache) && (WE_SUCCESS == CacheRead(sensorInterface->cache, RegAdr, NumByteToRead, Data)))
+	{
+		return WE_SUCCESS;
+	}
+
+#if defined(WE_BUS_STATISTICS)
+	unsigned long start = micros();
+#endif
+	result = transport->readReg(sensorInterface, RegAdr, NumByteToRead, Data);
+#if defined(WE_BUS_STATISTICS)
+	BusStatisticsAdd(sensorInterface->address, NumByteToRead, 0, result, start);
+#endif
+
+	if ((WE_SUCCESS == result) && (NULL != sensorInterface->cache))
+	{
+		CacheStore(sensorInterface->cache, RegAdr, NumByteToRead, Data);
+	}
+
+	return result;
+}
+
+/**
+ * @brief  Write data starting from the addressed register
+ * @param  -sensorInterface : pointer to sensor interface
+ *         -RegAdr : address to write in
+ *         -NumByteToWrite : number of bytes to write
+ *         -pointer Data : address of the data to be written
+ * @retval Error Code
+ */
+
+int WriteReg(WE_sensorInterface_t *sensorInterface, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data)
+{
+	const WE_transport_t *transport = Transport(sensorInterface);
+	int result;
+
+	if ((NULL == transport) || (0 == NumByteToWrite))
+	{
+		return WE_FAIL;
+	}
+
+	if ((NULL != sensorInterface->cache) && sensorInterface->cache->configuring)
+	{
+		if (WE_SUCCESS == CacheDefer(sensorInterface->cache, RegAdr, NumByteToWrite, Data))
+		{
+			return WE_SUCCESS;
+		}
+		/* keep the order of the writes */
+		if (WE_SUCCESS != CacheFlush(sensorInterface))
+		{
+			return WE_FAIL;
+		}
+	}
+
+#if defined(WE_BUS_STATISTICS)
+	unsigned long start = micros();
+#endif
+	result = transport->writeReg(sensorInterface, RegAdr, NumByteToWrite, Data);
+#if defined(WE_BUS_STATISTICS)
+	BusStatisticsAdd(sensorInterface->address, 0, NumByteToWrite, result, start);
+#endif
+
+	if (NULL != sensorInterface->cache)
+	{
+		if (WE_SUCCESS == result)
+		{
+			CacheWrite(sensorInterface->cache, RegAdr, NumByteToWrite, Data);
+		}
+		else
+		{
+			/* unknown what reached the sensor */
+			sensorInterface->cache->valid = 0;
+			sensorInterface->cache->dirty = 0;
+		}
+	}
+
+	return result;
+}
+
+ /**
+ * @brief   Read data from a sensor without addressing a register
+ * @param  -sensorInterface : pointer to sensor interface
+ *         -pointer Data : the address store the data
+ *         -NumByteToRead : number of bytes to read
+ * @retval Error Code
+ */
+
+int I2C_read(WE_sensorInterface_t *sensorInterface, uint8_t *data, int bytesToRead)
+{
+	const WE_transport_t *transport = Transport(sensorInterface);
+	int result;
+
+	if ((NULL == transport) || (0 == bytesToRead))
+	{
+		return WE_FAIL;
+	}
+
+#if defined(WE_BUS_STATISTICS)
+	unsigned long start = micros();
+#endif
+	result = transport->read(sensorInterface, data, bytesToRead);
+#if defined(WE_BUS_STATISTICS)
+	BusStatisticsAdd(sensorInterface->address, bytesToRead, 0, result, start);
+#endif
+
+	return result;
+}
+/**         EOF         */
@@ -0,0 +1,191 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#ifndef ARDUINOPLATFORM_H
+#define ARDUINOPLATFORM_H
+
+#define TIMEOUT_MS (uint16_t)100		/* 100ms */
+
+/* Max. number of bytes per ReadReg() or I2C_read() */
+#ifndef WE_MAX_READ_LENGTH
+#if defined(ARDUINO)
+#define WE_MAX_READ_LENGTH 32			/* receive buffer of the AVR Wire library, may be raised for other cores */
+#else
+#define WE_MAX_READ_LENGTH 255
+#endif
+#endif
+
+/**         Includes         **/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+#include <stdbool.h>
+
+#define WE_SUCCESS 0
+#define WE_FAIL -1
+
+//Use SDA1 and SCL1 on Arduino Due
+#if defined(__SAM3X8E__)
+#define Wire Wire1
+#endif
+
+/**         Type definitions         **/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct WE_sensorInterface WE_sensorInterface_t;
+
+/**
+ * @brief Bus transport used to reach a sensor.
+ *
+ * A transport implements the raw bus accesses for one kind of bus. The bus
+ * instance it works on is the handle stored in the sensor interface.
+ */
+typedef struct
+{
+	int (*init)(WE_sensorInterface_t *sensorInterface);
+	int (*readReg)(WE_sensorInterface_t *sensorInterface, uint8_t RegAdr, int NumByteToRead, uint8_t *Data);
+	int (*writeReg)(WE_sensorInterface_t *sensorInterface, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data);
+	int (*read)(WE_sensorInterface_t *sensorInterface, uint8_t *data, int bytesToRead);
+} WE_transport_t;
+
+/**
+ * @brief Register held in a register cache.
+ */
+typedef struct
+{
+	uint8_t reg;				/* register address */
+	uint8_t selfClearing;		/* bits cleared by the device (e.g. one-shot), writing one drops the cached value */
+	uint8_t reset;				/* bits reloading the registers (boot, soft reset), writing one drops the whole cache */
+} WE_cachedRegister_t;
+
+/**
+ * @brief Shadow copy of the control registers of a sensor.
+ *
+ * ReadReg() serves accesses that lie entirely within valid cached registers
+ * without a bus transfer, so a read-modify-write of a control register costs
+ * a single write. Writes go through to the sensor and update the cache.
+ * Values are picked up from every read of a cached register; multi-byte
+ * accesses are assumed to auto-increment. Set up with WE_initRegisterCache().
+ *
+ * Between WE_beginConfiguration() and WE_commitConfiguration(), writes to
+ * cached registers only change the cache. The commit writes every changed
+ * block of adjacent registers in one burst.
+ */
+typedef struct
+{
+	const WE_cachedRegister_t *registers;	/* cached registers, ascending */
+	uint8_t count;							/* number of registers, max. 32 */
+	uint8_t incrementFlag;					/* OR-ed into the register address of bursts, 0 if not needed */
+	uint8_t *values;						/* one value per register */
+	uint32_t valid;							/* bit n set: values[n] is valid */
+	uint32_t dirty;							/* bit n set: values[n] is not written yet */
+	bool configuring;						/* writes are collected until WE_commitConfiguration() */
+} WE_registerCache_t;
+
+/**
+ * @brief Bus context of a single sensor.
+ *
+ * Every driver function takes the interface of the sensor it talks to, so
+ * several sensors (or two parts of the same type at different addresses)
+ * can be driven back-to-back on one bus without re-addressing.
+ */
+struct WE_sensorInterface
+{
+	uint8_t address;					/* I2C address of the sensor */
+	void *handle;						/* bus instance used by the transport, NULL selects the default bus */
+	const WE_transport_t *transport;	/* NULL selects the default transport of the platform */
+	WE_registerCache_t *cache;			/* shadow registers, NULL for none */
+};
+
+/* Transport using the Arduino Wire library, handle is a TwoWire instance (default on Arduino) */
+extern const WE_transport_t WE_wireTransport;
+
+/* Transport using Linux i2c-dev, handle is a WE_linuxI2CBus_t (default on Linux), see LinuxPlatform.h */
+extern const WE_transport_t WE_linuxI2CTransport;
+
+#if defined(WE_BUS_STATISTICS)
+
+#ifndef WE_BUS_STATISTICS_DEVICES
+#define WE_BUS_STATISTICS_DEVICES 8		/* max. number of devices counted */
+#endif
+
+/**
+ * @brief Bus traffic of one device.
+ *
+ * Counted by ReadReg(), WriteReg() and I2C_read() if WE_BUS_STATISTICS is
+ * defined. Without it, no counting code or data is compiled in.
+ */
+typedef struct
+{
+	uint8_t address;		/* I2C address of the device */
+	uint32_t transactions;	/* ReadReg(), WriteReg() and I2C_read() calls */
+	uint32_t bytesRead;		/* data bytes read */
+	uint32_t bytesWritten;	/* data bytes written, without register address */
+	uint32_t failures;		/* calls failed by NACK or timeout */
+	uint32_t micros;		/* cumulative time spent in the transport */
+} WE_busStatistics_t;
+
+#endif /* WE_BUS_STATISTICS */
+
+/**         Functions definition         **/
+
+int I2CInit(WE_sensorInterface_t *sensorInterface, int address);
+void I2CSetAddress(WE_sensorInterface_t *sensorInterface, int address);
+int ReadReg(WE_sensorInterface_t *sensorInterface, uint8_t RegAdr, int NumByteToRead, uint8_t *Data);
+int WriteReg(WE_sensorInterface_t *sensorInterface, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data);
+int I2C_read(WE_sensorInterface_t *sensorInterface, uint8_t *data, int bytesToRead);
+
+void WE_initRegisterCache(WE_registerCache_t *cache, const WE_cachedRegister_t *registers, uint8_t count,
+		uint8_t incrementFlag, uint8_t *values);
+void WE_invalidateRegisterCache(WE_sensorInterface_t *sensorInterface);
+int WE_resyncRegisterCache(WE_sensorInterface_t *sensorInterface);
+int WE_beginConfiguration(WE_sensorInterface_t *sensorInterface);
+int WE_commitConfiguration(WE_sensorInterface_t *sensorInterface);
+void WE_abortConfiguration(WE_sensorInterface_t *sensorInterface);
+
+#if defined(WE_BUS_STATISTICS)
+int WE_getBusStatistics(uint8_t address, WE_busStatistics_t *statistics);
+int WE_getBusStatisticsSnapshot(WE_busStatistics_t *snapshot, int maxDevices);
+void WE_resetBusStatistics(void);
+#endif
+
+#if !defined(ARDUINO)
+void delay(unsigned long ms);
+unsigned long micros(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARDUINOPLATFORM_H */
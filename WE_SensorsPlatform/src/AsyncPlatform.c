@@ -0,0 +1,382 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+/**
+ * Queue of bus requests, executed one at a time by WE_asyncPoll().
+ *
+ * On AVR, requests to a sensor on the default Wire bus drive the TWI
+ * hardware directly: each poll advances the transfer by at most one bus
+ * event (start, address, data byte, stop) and never waits for the bus.
+ * Requests touching the register cache, and all requests on other cores
+ * and transports, run as one blocking ReadReg(), WriteReg() or I2C_read()
+ * per poll step. Only the blocking requests count in the bus statistics.
+ *
+ * Call WE_asyncPoll() from the main loop between other work, never from an
+ * interrupt: polling must not overlap a synchronous driver call on the same
+ * bus. On AVR a transfer spans several polls, so make synchronous driver
+ * calls only once WE_asyncPending() has returned 0. Submitting and polling
+ * must each be done from one context; the queue is single producer, single
+ * consumer.
+ */
+
+#include "AsyncPlatform.h"
+
+#if defined(ARDUINO) && defined(__AVR__) && defined(TWCR)
+#include <util/twi.h>
+#define ASYNC_TWI
+#endif
+
+#if (WE_ASYNC_QUEUE_LENGTH & (WE_ASYNC_QUEUE_LENGTH - 1)) || (WE_ASYNC_QUEUE_LENGTH > 128)
+#error "WE_ASYNC_QUEUE_LENGTH must be a power of two up to 128"
+#endif
+
+#define QUEUE_MASK (WE_ASYNC_QUEUE_LENGTH - 1)
+
+static WE_asyncRequest_t *queue[WE_ASYNC_QUEUE_LENGTH];
+static volatile uint8_t queueHead = 0;		/* next slot to fill */
+static volatile uint8_t queueTail = 0;		/* next request to run */
+
+/**
+ * @brief  Queue a prepared request
+ * @param  Pointer to request, must stay valid until it has completed
+ * @retval Error Code, WE_FAIL if the queue is full
+ */
+
+int WE_asyncSubmit(WE_asyncRequest_t *request)
+{
+	uint8_t head = queueHead;
+
+	if ((NULL == request) || (NULL == request->sensorInterface) || (0 >= request->count))
+	{
+		return WE_FAIL;
+	}
+	if ((uint8_t)(head - queueTail) >= WE_ASYNC_QUEUE_LENGTH)
+	{
+		return WE_FAIL;
+	}
+
+	request->status = WE_ASYNC_PENDING;
+	request->phase = 0;
+	request->done = 0;
+	queue[head & QUEUE_MASK] = request;
+	queueHead = (uint8_t)(head + 1);
+
+	return WE_SUCCESS;
+}
+
+/**
+ * @brief  Fill in and queue a request
+ * @retval Error Code
+ */
+
+static int Submit(WE_asyncRequest_t *request, WE_sensorInterface_t *sensorInterface, WE_asyncOperation_t operation,
+		uint8_t reg, int count, uint8_t *data, WE_asyncCallback_t callback, void *context)
+{
+	if (NULL == request)
+	{
+		return WE_FAIL;
+	}
+
+	request->sensorInterface = sensorInterface;
+	request->operation = operation;
+	request->reg = reg;
+	request->count = count;
+	request->data = data;
+	request->callback = callback;
+	request->context = context;
+
+	return WE_asyncSubmit(request);
+}
+
+/**
+ * @brief  Queue a read starting from the addressed register
+ * @param  -request : request to fill in, must stay valid until it has completed
+ *         -sensorInterface : pointer to sensor interface
+ *         -RegAdr : register address to read from
+ *         -NumByteToRead : number of bytes to read
+ *         -pointer Data : address stores the data
+ *         -callback : called on completion, may be NULL
+ *         -context : free for the caller
+ * @retval Error Code, WE_FAIL if the queue is full
+ */
+
+int WE_asyncReadReg(WE_asyncRequest_t *request, WE_sensorInterface_t *sensorInterface, uint8_t RegAdr,
+		int NumByteToRead, uint8_t *Data, WE_asyncCallback_t callback, void *context)
+{
+	return Submit(request, sensorInterface, WE_asyncReadRegister, RegAdr, NumByteToRead, Data, callback, context);
+}
+
+/**
+ * @brief  Queue a write starting from the addressed register
+ * @param  -request : request to fill in, must stay valid until it has completed
+ *         -sensorInterface : pointer to sensor interface
+ *         -RegAdr : address to write in
+ *         -NumByteToWrite : number of bytes to write
+ *         -pointer Data : address of the data to be written, read when the request runs
+ *         -callback : called on completion, may be NULL
+ *         -context : free for the caller
+ * @retval Error Code, WE_FAIL if the queue is full
+ */
+
+int WE_asyncWriteReg(WE_asyncRequest_t *request, WE_sensorInterface_t *sensorInterface, uint8_t RegAdr,
+		int NumByteToWrite, uint8_t *Data, WE_asyncCallback_t callback, void *context)
+{
+	return Submit(request, sensorInterface, WE_asyncWriteRegister, RegAdr, NumByteToWrite, Data, callback, context);
+}
+
+/**
+ * @brief  Queue a read without addressing a register
+ * @param  -request : request to fill in, must stay valid until it has completed
+ *         -sensorInterface : pointer to sensor interface
+ *         -pointer data : the address store the data
+ *         -bytesToRead : number of bytes to read
+ *         -callback : called on completion, may be NULL
+ *         -context : free for the caller
+ * @retval Error Code, WE_FAIL if the queue is full
+ */
+
+int WE_asyncRead(WE_asyncRequest_t *request, WE_sensorInterface_t *sensorInterface,
+		uint8_t *data, int bytesToRead, WE_asyncCallback_t callback, void *context)
+{
+	return Submit(request, sensorInterface, WE_asyncReadData, 0, bytesToRead, data, callback, context);
+}
+
+#if defined(ASYNC_TWI)
+
+/* Phases of a TWI transfer */
+#define PHASE_IDLE          0
+#define PHASE_START         1       /* (repeated) start sent, address for writing next */
+#define PHASE_REGISTER      2       /* address for writing sent, register address next */
+#define PHASE_WRITE         3       /* register address or data byte sent */
+#define PHASE_RESTART       4       /* (repeated) start sent, address for reading next */
+#define PHASE_ADDRESS_READ  5       /* address for reading sent */
+#define PHASE_READ          6       /* data byte received */
+
+/* TWCR of the Wire library while idle */
+#define TWCR_IDLE ((uint8_t)(_BV(TWEN) | _BV(TWIE) | _BV(TWEA)))
+
+/**
+ * @brief  Check whether a request can drive the TWI hardware directly
+ * @param  Pointer to request
+ * @retval true for requests on the default Wire bus that leave the register cache alone
+ */
+
+static bool TwiUsable(WE_asyncRequest_t *request)
+{
+	WE_sensorInterface_t *sensorInterface = request->sensorInterface;
+	WE_registerCache_t *cache = sensorInterface->cache;
+
+	if ((NULL != sensorInterface->handle) ||
+		((NULL != sensorInterface->transport) && (&WE_wireTransport != sensorInterface->transport)))
+	{
+		return false;
+	}
+	if ((NULL == cache) || (WE_asyncReadData == request->operation))
+	{
+		return true;
+	}
+	if (cache->configuring)
+	{
+		return false;
+	}
+	for (uint8_t i = 0; i < cache->count; i++)
+	{
+		uint8_t reg = (uint8_t)(request->reg & ~cache->incrementFlag);
+		if ((cache->registers[i].reg >= reg) && (cache->registers[i].reg < reg + request->count))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief  Send a stop condition, the Wire library takes over the idle bus
+ */
+
+static void TwiStop(void)
+{
+	TWCR = (uint8_t)(TWCR_IDLE | _BV(TWINT) | _BV(TWSTO));
+}
+
+/**
+ * @brief  Advance the TWI transfer of a request by at most one bus event
+ * @param  Pointer to request
+ * @retval WE_ASYNC_PENDING while in progress, then WE_SUCCESS or WE_FAIL
+ */
+
+static int TwiStep(WE_asyncRequest_t *request)
+{
+	uint8_t address = (uint8_t)(request->sensorInterface->address << 1);
+
+	if (PHASE_IDLE == request->phase)
+	{
+		/* the stop of the previous transfer is still going out */
+		if (TWCR & _BV(TWSTO))
+		{
+			return WE_ASYNC_PENDING;
+		}
+		request->started = micros();
+		request->phase = (WE_asyncReadData == request->operation) ? PHASE_RESTART : PHASE_START;
+		TWCR = (uint8_t)(_BV(TWEN) | _BV(TWINT) | _BV(TWSTA));
+		return WE_ASYNC_PENDING;
+	}
+
+	if (0 == (TWCR & _BV(TWINT)))
+	{
+		if ((uint32_t)(micros() - request->started) > TIMEOUT_MS * 1000UL)
+		{
+			/* release a stuck bus */
+			TWCR = 0;
+			TWCR = TWCR_IDLE;
+			return WE_FAIL;
+		}
+		return WE_ASYNC_PENDING;
+	}
+
+	switch (TW_STATUS)
+	{
+	case TW_START:
+	case TW_REP_START:
+		TWDR = (PHASE_START == request->phase) ? (uint8_t)(address | TW_WRITE) : (uint8_t)(address | TW_READ);
+		request->phase = (PHASE_START == request->phase) ? PHASE_REGISTER : PHASE_ADDRESS_READ;
+		TWCR = (uint8_t)(_BV(TWEN) | _BV(TWINT));
+		return WE_ASYNC_PENDING;
+
+	case TW_MT_SLA_ACK:
+		TWDR = request->reg;
+		request->phase = PHASE_WRITE;
+		TWCR = (uint8_t)(_BV(TWEN) | _BV(TWINT));
+		return WE_ASYNC_PENDING;
+
+	case TW_MT_DATA_ACK:
+		if (WE_asyncReadRegister == request->operation)
+		{
+			request->phase = PHASE_RESTART;
+			TWCR = (uint8_t)(_BV(TWEN) | _BV(TWINT) | _BV(TWSTA));
+			return WE_ASYNC_PENDING;
+		}
+		if (request->done < request->count)
+		{
+			TWDR = request->data[request->done++];
+			TWCR = (uint8_t)(_BV(TWEN) | _BV(TWINT));
+			return WE_ASYNC_PENDING;
+		}
+		TwiStop();
+		return WE_SUCCESS;
+
+	case TW_MR_SLA_ACK:
+		/* acknowledge all bytes but the last */
+		request->phase = PHASE_READ;
+		TWCR = (uint8_t)(_BV(TWEN) | _BV(TWINT) | ((request->count > 1) ? _BV(TWEA) : 0));
+		return WE_ASYNC_PENDING;
+
+	case TW_MR_DATA_ACK:
+		request->data[request->done++] = TWDR;
+		TWCR = (uint8_t)(_BV(TWEN) | _BV(TWINT) | ((request->done < request->count - 1) ? _BV(TWEA) : 0));
+		return WE_ASYNC_PENDING;
+
+	case TW_MR_DATA_NACK:
+		request->data[request->done++] = TWDR;
+		TwiStop();
+		return WE_SUCCESS;
+
+	default:
+		/* address or data not acknowledged, arbitration lost */
+		TwiStop();
+		return WE_FAIL;
+	}
+}
+
+#endif /* ASYNC_TWI */
+
+/**
+ * @brief  Advance the oldest queued request and report its completion
+ * @retval Number of requests still queued, including one in progress
+ */
+
+int WE_asyncPoll(void)
+{
+	uint8_t tail = queueTail;
+	WE_asyncRequest_t *request;
+	int result;
+
+	if (tail == queueHead)
+	{
+		return 0;
+	}
+
+	request = queue[tail & QUEUE_MASK];
+
+#if defined(ASYNC_TWI)
+	if ((PHASE_IDLE != request->phase) || TwiUsable(request))
+	{
+		result = TwiStep(request);
+		if (WE_ASYNC_PENDING == result)
+		{
+			return WE_asyncPending();
+		}
+	}
+	else
+#endif
+	switch (request->operation)
+	{
+	case WE_asyncReadRegister:
+		result = ReadReg(request->sensorInterface, request->reg, request->count, request->data);
+		break;
+	case WE_asyncWriteRegister:
+		result = WriteReg(request->sensorInterface, request->reg, request->count, request->data);
+		break;
+	case WE_asyncReadData:
+		result = I2C_read(request->sensorInterface, request->data, request->count);
+		break;
+	default:
+		result = WE_FAIL;
+		break;
+	}
+
+	/* free the slot first, so that the callback can queue the next request */
+	queueTail = (uint8_t)(tail + 1);
+	request->status = result;
+
+	if (NULL != request->callback)
+	{
+		request->callback(request);
+	}
+
+	return WE_asyncPending();
+}
+
+/**
+ * @brief  Get the number of queued requests
+ * @retval Number of requests not yet run
+ */
+
+int WE_asyncPending(void)
+{
+	return (uint8_t)(queueHead - queueTail);
+}
+
+/**         EOF         */
@@ -0,0 +1,99 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#ifndef ASYNCPLATFORM_H
+#define ASYNCPLATFORM_H
+
+/**         Includes         **/
+
+#include "ArduinoPlatform.h"
+
+#ifndef WE_ASYNC_QUEUE_LENGTH
+#define WE_ASYNC_QUEUE_LENGTH 8		/* max. number of queued requests, power of two */
+#endif
+
+#define WE_ASYNC_PENDING 1			/* status of a request until it has completed */
+
+/**         Type definitions         **/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef enum
+{
+	WE_asyncReadRegister,		/* ReadReg() */
+	WE_asyncWriteRegister,		/* WriteReg() */
+	WE_asyncReadData			/* I2C_read() */
+} WE_asyncOperation_t;
+
+typedef struct WE_asyncRequest WE_asyncRequest_t;
+
+/* Called by WE_asyncPoll() when a request has completed */
+typedef void (*WE_asyncCallback_t)(WE_asyncRequest_t *request);
+
+/**
+ * @brief Queued bus request.
+ *
+ * The request is owned by the caller and must stay valid until it has
+ * completed. Its status works as a future: WE_ASYNC_PENDING while queued
+ * or in progress, then the result of the transfer (WE_SUCCESS or WE_FAIL).
+ */
+struct WE_asyncRequest
+{
+	WE_sensorInterface_t *sensorInterface;
+	WE_asyncOperation_t operation;
+	uint8_t reg;					/* register address, unused by WE_asyncReadData */
+	int count;						/* number of bytes */
+	uint8_t *data;					/* bytes to write or buffer for the bytes read */
+	WE_asyncCallback_t callback;	/* may be NULL */
+	void *context;					/* free for the caller */
+	volatile int status;
+
+	/* progress of the transfer, kept by WE_asyncPoll() */
+	uint8_t phase;
+	int done;						/* bytes transferred */
+	uint32_t started;				/* micros() at the start of the transfer */
+};
+
+/**         Functions definition         **/
+
+int WE_asyncSubmit(WE_asyncRequest_t *request);
+int WE_asyncReadReg(WE_asyncRequest_t *request, WE_sensorInterface_t *sensorInterface, uint8_t RegAdr,
+		int NumByteToRead, uint8_t *Data, WE_asyncCallback_t callback, void *context);
+int WE_asyncWriteReg(WE_asyncRequest_t *request, WE_sensorInterface_t *sensorInterface, uint8_t RegAdr,
+		int NumByteToWrite, uint8_t *Data, WE_asyncCallback_t callback, void *context);
+int WE_asyncRead(WE_asyncRequest_t *request, WE_sensorInterface_t *sensorInterface,
+		uint8_t *data, int bytesToRead, WE_asyncCallback_t callback, void *context);
+
+int WE_asyncPoll(void);
+int WE_asyncPending(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ASYNCPLATFORM_H */
@@ -0,0 +1,253 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#if defined(__linux__) && !defined(ARDUINO)
+
+#define _POSIX_C_SOURCE 200809L	/* nanosleep(), clock_gettime() */
+
+#include "LinuxPlatform.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+static WE_linuxI2CBus_t defaultBus = WE_LINUX_I2C_BUS(WE_LINUX_I2C_DEFAULT_DEVICE);
+
+/**
+ * @brief  Get the i2c-dev bus a sensor is attached to
+ * @param  Pointer to sensor interface
+ * @retval Bus, the default bus if no handle is set
+ */
+
+static WE_linuxI2CBus_t *LinuxBus(WE_sensorInterface_t *sensorInterface)
+{
+	return (NULL != sensorInterface->handle) ? (WE_linuxI2CBus_t *)sensorInterface->handle : &defaultBus;
+}
+
+/**
+ * @brief  Open an i2c-dev bus
+ * @param  Pointer to bus
+ * @retval Error Code
+ */
+
+int WE_linuxI2COpen(WE_linuxI2CBus_t *bus)
+{
+	if (bus->fd >= 0)
+	{
+		return WE_SUCCESS;
+	}
+
+	bus->fd = open(bus->device, O_RDWR);
+	if (bus->fd < 0)
+	{
+		return WE_FAIL;
+	}
+
+	/* I2C_TIMEOUT is given in units of 10 ms */
+	ioctl(bus->fd, I2C_TIMEOUT, (unsigned long)(TIMEOUT_MS / 10));
+
+	return WE_SUCCESS;
+}
+
+/**
+ * @brief  Close an i2c-dev bus
+ * @param  Pointer to bus
+ */
+
+void WE_linuxI2CClose(WE_linuxI2CBus_t *bus)
+{
+	if (bus->fd >= 0)
+	{
+		close(bus->fd);
+		bus->fd = -1;
+	}
+}
+
+/**
+ * @brief  Run I2C messages as one combined transfer
+ * @param  -bus : pointer to bus
+ *         -msgs : messages, separated by repeated starts
+ *         -count : number of messages
+ * @retval Error Code
+ */
+
+static int LinuxTransfer(WE_linuxI2CBus_t *bus, struct i2c_msg *msgs, int count)
+{
+	struct i2c_rdwr_ioctl_data transfer;
+
+	transfer.msgs = msgs;
+	transfer.nmsgs = count;
+
+	if (ioctl(bus->fd, I2C_RDWR, &transfer) != count)
+	{
+		return WE_FAIL;
+	}
+
+	return WE_SUCCESS;
+}
+
+/**
+ * @brief  Initialize the i2c-dev bus of a sensor
+ * @param  Pointer to sensor interface
+ * @retval Error Code
+ */
+
+static int LinuxInit(WE_sensorInterface_t *sensorInterface)
+{
+	return WE_linuxI2COpen(LinuxBus(sensorInterface));
+}
+
+/**
+ * @brief   Read data starting from the addressed register
+ *
+ * The register address and the data are transferred as one combined
+ * write + repeated start + read message, i.e. with a single syscall.
+ *
+ * @param  -sensorInterface : pointer to sensor interface
+ *         -RegAdr : register address to read from
+ *         -NumByteToRead : number of bytes to read
+ *         -pointer Data : address stores the data
+ * @retval Error Code
+ */
+
+static int LinuxReadReg(WE_sensorInterface_t *sensorInterface, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+{
+	struct i2c_msg msgs[2];
+
+	msgs[0].addr = sensorInterface->address;
+	msgs[0].flags = 0;
+	msgs[0].len = 1;
+	msgs[0].buf = &RegAdr;
+
+	msgs[1].addr = sensorInterface->address;
+	msgs[1].flags = I2C_M_RD;
+	msgs[1].len = (uint16_t)NumByteToRead;
+	msgs[1].buf = Data;
+
+	return LinuxTransfer(LinuxBus(sensorInterface), msgs, 2);
+}
+
+/**
+ * @brief  Write data starting from the addressed register
+ * @param  -sensorInterface : pointer to sensor interface
+ *         -RegAdr : address to write in
+ *         -NumByteToWrite : number of bytes to write
+ *         -pointer Data : address of the data to be written
+ * @retval Error Code
+ */
+
+static int LinuxWriteReg(WE_sensorInterface_t *sensorInterface, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data)
+{
+	uint8_t buffer[1 + WE_LINUX_I2C_MAX_WRITE];
+	struct i2c_msg msg;
+
+	if (NumByteToWrite > WE_LINUX_I2C_MAX_WRITE)
+	{
+		return WE_FAIL;
+	}
+
+	buffer[0] = RegAdr;
+	memcpy(&buffer[1], Data, NumByteToWrite);
+
+	msg.addr = sensorInterface->address;
+	msg.flags = 0;
+	msg.len = (uint16_t)(NumByteToWrite + 1);
+	msg.buf = buffer;
+
+	return LinuxTransfer(LinuxBus(sensorInterface), &msg, 1);
+}
+
+/**
+ * @brief   Read data from a sensor without addressing a register
+ * @param  -sensorInterface : pointer to sensor interface
+ *         -pointer Data : the address store the data
+ *         -NumByteToRead : number of bytes to read
+ * @retval Error Code
+ */
+
+static int LinuxRead(WE_sensorInterface_t *sensorInterface, uint8_t *data, int bytesToRead)
+{
+	struct i2c_msg msg;
+
+	msg.addr = sensorInterface->address;
+	msg.flags = I2C_M_RD;
+	msg.len = (uint16_t)bytesToRead;
+	msg.buf = data;
+
+	return LinuxTransfer(LinuxBus(sensorInterface), &msg, 1);
+}
+
+const WE_transport_t WE_linuxI2CTransport = {
+	LinuxInit,
+	LinuxReadReg,
+	LinuxWriteReg,
+	LinuxRead
+};
+
+/**
+ * @brief  Wait for the given time
+ * @param  Time in ms
+ */
+
+void delay(unsigned long ms)
+{
+	struct timespec ts;
+
+	ts.tv_sec = (time_t)(ms / 1000);
+	ts.tv_nsec = (long)(ms % 1000) * 1000000L;
+
+	while ((nanosleep(&ts, &ts) != 0) && (EINTR == errno))
+	{
+	}
+}
+
+/**
+ * @brief  Get the time since an arbitrary start point
+ *
+ * Truncated to 32 bits, so it wraps after about 71 minutes like the Arduino
+ * micros() also where unsigned long has 64 bits.
+ *
+ * @retval Time in us
+ */
+
+unsigned long micros(void)
+{
+	struct timespec ts;
+	uint64_t us;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	us = (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000L);
+
+	return (unsigned long)(uint32_t)us;
+}
+
+#endif /* __linux__ && !ARDUINO */
+/**         EOF         */
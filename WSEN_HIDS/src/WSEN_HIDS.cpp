@@ -29,11 +29,26 @@
 /**
    @brief  Initialize the I2C Interface
    @param  I2C address
+   @param  Bus instance of the transport, NULL selects the default bus
+   @param  Transport, NULL selects the default transport of the platform
    @retval Error Code
 */
-int Sensor_HIDS::init(int address)
+int Sensor_HIDS::init(int address, void *handle, const WE_transport_t *transport)
 {
-    return I2CInit(address);
+    sensorInterface.handle = handle;
+    sensorInterface.transport = transport;
+    WE_initRegisterCache(&registerCache, HIDS_cachedRegisters, HIDS_CACHED_REGISTERS, 0x80, cacheValues);
+    sensorInterface.cache = &registerCache;
+    return I2CInit(&sensorInterface, address);
+}
+
+/**
+   @brief  Get the bus interface of the sensor, e.g. to queue asynchronous requests
+   @retval Pointer to sensor interface
+*/
+WE_sensorInterface_t *Sensor_HIDS::get_Interface()
+{
+    return &sensorInterface;
 }
 
 /**
@@ -45,7 +60,7 @@ int Sensor_HIDS::get_DeviceID()
 {
     uint8_t devID;
 
-    if (HIDS_getDeviceID(&devID) == WE_SUCCESS)
+    if (HIDS_getDeviceID(&sensorInterface, &devID) == WE_SUCCESS)
     {
         return devID;
     }
@@ -64,25 +79,25 @@ int Sensor_HIDS::select_ODR()
     {
         case 0:
         {
-            status = HIDS_setOdr(oneShot);
+            status = HIDS_setOdr(&sensorInterface, oneShot);
             break;
         }
 
         case 1:
         {
-            status = HIDS_setOdr(odr1HZ);
+            status = HIDS_setOdr(&sensorInterface, odr1HZ);
             break;
         }
 
         case 2:
         {
-            status = HIDS_setOdr(odr7HZ);
+            status = HIDS_setOdr(&sensorInterface, odr7HZ);
             break;
         }
 
         case 3:
         {
-            status = HIDS_setOdr(odr12_5HZ);
+            status = HIDS_setOdr(&sensorInterface, odr12_5HZ);
             break;
         }
 
@@ -112,7 +127,7 @@ int Sensor_HIDS::select_ODR()
 uint16_t Sensor_HIDS::get_H_T_out()
 {
 	uint16_t H_T_out = 0;
-	H_T_out= HIDS_get_H_T_out();
+	H_T_out= HIDS_get_H_T_out(&sensorInterface);
 	return H_T_out;
 }
 
@@ -124,7 +139,7 @@ uint16_t Sensor_HIDS::get_H_T_out()
 uint16_t Sensor_HIDS::get_T_OUT()
 {
 	uint16_t T_out = 0;
-	T_out= HIDS_get_T_OUT();
+	T_out= HIDS_get_T_OUT(&sensorInterface);
 	return T_out;
 }
 
@@ -139,7 +154,7 @@ uint16_t Sensor_HIDS::get_T_OUT()
 uint16_t Sensor_HIDS::get_H0_T0_out()
 {
 	uint16_t H0_T0_out = 0;
-	H0_T0_out= HIDS_get_H0_T0_out();
+	H0_T0_out= HIDS_get_H0_T0_out(&sensorInterface);
 	return H0_T0_out;
 }
 
@@ -152,7 +167,7 @@ uint16_t Sensor_HIDS::get_H0_T0_out()
 uint16_t Sensor_HIDS::get_H1_T0_out()
 {
 	uint16_t H1_T0_out = 0;
-	H1_T0_out= HIDS_get_H1_T0_out();
+	H1_T0_out= HIDS_get_H1_T0_out(&sensorInterface);
 	return H1_T0_out;
 }
 
@@ -166,7 +181,7 @@ uint16_t Sensor_HIDS::get_H1_T0_out()
 uint16_t Sensor_HIDS::get_H0_rh()
 {
 	uint16_t H0_rh = 0;
-	H0_rh= HIDS_get_H0_rh();
+	H0_rh= HIDS_get_H0_rh(&sensorInterface);
 	return H0_rh;
 }
 
@@ -179,7 +194,7 @@ uint16_t Sensor_HIDS::get_H0_rh()
 uint16_t Sensor_HIDS::get_H1_rh()
 {
 	uint16_t H1_rh = 0;
-	H1_rh= HIDS_get_H1_rh();
+	H1_rh= HIDS_get_H1_rh(&sensorInterface);
 	return H1_rh;
 }
 /**
@@ -191,7 +206,7 @@ uint16_t Sensor_HIDS::get_H1_rh()
 uint16_t Sensor_HIDS::get_T1_OUT()
 {
 	uint16_t T1_OUT = 0;
-	T1_OUT= HIDS_get_T1_OUT();
+	T1_OUT= HIDS_get_T1_OUT(&sensorInterface);
 	return T1_OUT;
 }
 /**
@@ -203,7 +218,7 @@ uint16_t Sensor_HIDS::get_T1_OUT()
 uint16_t Sensor_HIDS::get_T0_OUT()
 {
 	uint16_t T0_OUT = 0;
-	T0_OUT = HIDS_get_T0_OUT();
+	T0_OUT = HIDS_get_T0_OUT(&sensorInterface);
 	return T0_OUT;
 }
 /**
@@ -214,7 +229,7 @@ uint16_t Sensor_HIDS::get_T0_OUT()
 int Sensor_HIDS::get_StatusDrdy(HIDS_state_t *temp_drdy, HIDS_state_t *humidity_drdy)
 {
 
-	if (WE_FAIL == HIDS_getStatusDrdy(temp_drdy, humidity_drdy))
+	if (WE_FAIL == HIDS_getStatusDrdy(&sensorInterface, temp_drdy, humidity_drdy))
 	{
 		return WE_FAIL;
 	}	
@@ -231,7 +246,7 @@ int Sensor_HIDS::get_StatusDrdy(HIDS_state_t *temp_drdy, HIDS_state_t *humidity_
 int Sensor_HIDS::get_TempStatus()
 {	
 	HIDS_state_t temp_state;
-    if (WE_FAIL == HIDS_getTempStatus(&temp_state))
+    if (WE_FAIL == HIDS_getTempStatus(&sensorInterface, &temp_state))
 	{
 		return WE_FAIL;
 	}
@@ -249,7 +264,7 @@ int Sensor_HIDS::get_TempStatus()
 int Sensor_HIDS::get_HumStatus()
 {	
 	HIDS_state_t humidity_state;
-    if (WE_FAIL == HIDS_getHumStatus(&humidity_state))
+    if (WE_FAIL == HIDS_getHumStatus(&sensorInterface, &humidity_state))
 	{
 		return WE_FAIL;
 	}
@@ -268,7 +283,7 @@ int Sensor_HIDS::get_HumStatus()
 int Sensor_HIDS::get_Humidity(float *relHum)
 {
 	float humidity;
-	if (WE_FAIL == HIDS_getHumidity(&humidity))
+	if (WE_FAIL == HIDS_getHumidity(&sensorInterface, &humidity))
 	{
 		return WE_FAIL;
 	}
@@ -285,7 +300,7 @@ int Sensor_HIDS::get_Humidity(float *relHum)
 int Sensor_HIDS::get_Temperature(float *temperature)
 {
 	float temp;
-	if (WE_FAIL == HIDS_getTemperature(&temp))
+	if (WE_FAIL == HIDS_getTemperature(&sensorInterface, &temp))
 	{
 		return WE_FAIL;
 	}
@@ -308,7 +323,7 @@ int Sensor_HIDS::set_single_conversion()
 		return WE_FAIL;
 	}	
 	
-    if (WE_FAIL == HIDS_enOneShot(oneShot))
+    if (WE_FAIL == HIDS_enOneShot(&sensorInterface, oneShot))
 	{
 		return WE_FAIL;
 	}		
@@ -324,7 +339,7 @@ int Sensor_HIDS::set_single_conversion()
 int Sensor_HIDS::set_continuous_mode(int outputDataRate)
 {
     //Enable block data update
-    if (WE_FAIL == HIDS_setBdu(HIDS_enable))
+    if (WE_FAIL == HIDS_setBdu(&sensorInterface, HIDS_enable))
 	{
 		return WE_FAIL;
 	}	
@@ -333,7 +348,7 @@ int Sensor_HIDS::set_continuous_mode(int outputDataRate)
 	{
 		return WE_FAIL;
 	}	
-    if (WE_FAIL == HIDS_setPowerMode(activeMode))
+    if (WE_FAIL == HIDS_setPowerMode(&sensorInterface, activeMode))
 		{
 		return WE_FAIL;
 	}		
@@ -32,7 +32,8 @@ class Sensor_HIDS
 {
 
 public:
-    int init(int address);
+    int init(int address, void *handle = NULL, const WE_transport_t *transport = NULL);
+    WE_sensorInterface_t *get_Interface();
     int get_DeviceID();
 	
 	int ODR;
@@ -64,6 +65,10 @@ public:
 	int get_Humidity(float *relHum);
 	int get_Temperature(float *temperature);
 
+private:
+    WE_sensorInterface_t sensorInterface;
+    WE_registerCache_t registerCache;
+    uint8_t cacheValues[HIDS_CACHED_REGISTERS];
 };
 
 #endif
@@ -25,21 +25,47 @@
 #include <stdio.h>
 #include "WSEN_HIDS_2523020210001.h"
 
+
+/**
+* @brief  Registers held in the register cache of the sensor interface:
+*         configuration and factory calibration registers
+*/
+const WE_cachedRegister_t HIDS_cachedRegisters[HIDS_CACHED_REGISTERS] = {
+	{ HIDS_Average_REG, 0, 0 },
+	{ HIDS_CTRL_REG_1, 0, 0 },
+	{ HIDS_CTRL_REG_2, 0x01, 0x80 },	/* ONE_SHOT; BOOT */
+	{ HIDS_CTRL_REG_3, 0, 0 },
+	{ HIDS_H0_RH_X2, 0, 0 },
+	{ HIDS_H1_RH_X2, 0, 0 },
+	{ HIDS_T0_DEGC_X8, 0, 0 },
+	{ HIDS_T1_DEGC_X8, 0, 0 },
+	{ HIDS_T0_T1_DEGC_H2, 0, 0 },
+	{ HIDS_H0_T0_OUT_L, 0, 0 },
+	{ HIDS_H0_T0_OUT_H, 0, 0 },
+	{ HIDS_H1_T0_OUT_L, 0, 0 },
+	{ HIDS_H1_T0_OUT_H, 0, 0 },
+	{ HIDS_T0_OUT_L, 0, 0 },
+	{ HIDS_T0_OUT_H, 0, 0 },
+	{ HIDS_T1_OUT_L, 0, 0 },
+	{ HIDS_T1_OUT_H, 0, 0 }
+};
+
 /**
 * @brief  Set the Humidity average configuration
+* @param  Pointer to sensor interface
 * @param  Humidity average parameter
 * @retval Error code
 */
-uint8_t HIDS_setHumAvg(HIDS_average_conf_t avgH)
+uint8_t HIDS_setHumAvg(WE_sensorInterface_t *sensorInterface, HIDS_average_conf_t avgH)
 {
 	HIDS_average_config_t average_reg;
 
-	if (ReadReg((uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
 	return WE_FAIL;
 
 	average_reg.avgHum = avgH;
 
-	if (WriteReg((uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
+	if (WriteReg(sensorInterface, (uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -47,14 +73,15 @@ uint8_t HIDS_setHumAvg(HIDS_average_conf_t avgH)
 
 /**
 * @brief  Read the Humidity average configuration
+* @param  Pointer to sensor interface
 * @param  Pointer to the Humidity average configuration
 * @retval Error code
 */
-uint8_t HIDS_getHumAvg(HIDS_average_conf_t *avgH)
+uint8_t HIDS_getHumAvg(WE_sensorInterface_t *sensorInterface, HIDS_average_conf_t *avgH)
 {
 	HIDS_average_config_t average_reg;
 
-	if (ReadReg((uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
 	return WE_FAIL;
 	*avgH = (HIDS_average_conf_t)average_reg.avgHum;
 
@@ -63,19 +90,20 @@ uint8_t HIDS_getHumAvg(HIDS_average_conf_t *avgH)
 
 /**
 * @brief  Set the Temperature average configuration
+* @param  Pointer to sensor interface
 * @param  Temperature average parameter
 * @retval Error code
 */
-uint8_t HIDS_setTempAvg(HIDS_average_conf_t avgT)
+uint8_t HIDS_setTempAvg(WE_sensorInterface_t *sensorInterface, HIDS_average_conf_t avgT)
 {
 	HIDS_average_config_t average_reg;
 
-	if (ReadReg((uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
 	return WE_FAIL;
 
 	average_reg.avgTemp = avgT;
 
-	if (WriteReg((uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
+	if (WriteReg(sensorInterface, (uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -83,14 +111,15 @@ uint8_t HIDS_setTempAvg(HIDS_average_conf_t avgT)
 
 /**
 * @brief  Read the Temperature average configuration
+* @param  Pointer to sensor interface
 * @param  Pointer to the Temperature average configuration
 * @retval Error code
 */
-uint8_t HIDS_getTempAvg(HIDS_average_conf_t *avgT)
+uint8_t HIDS_getTempAvg(WE_sensorInterface_t *sensorInterface, HIDS_average_conf_t *avgT)
 {
 	HIDS_average_config_t average_reg;
 
-	if (ReadReg((uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
 	return WE_FAIL;
 	*avgT = (HIDS_average_conf_t)average_reg.avgTemp;
 
@@ -99,20 +128,21 @@ uint8_t HIDS_getTempAvg(HIDS_average_conf_t *avgT)
 
 /**
 * @brief  Set the output data rate of the sensor
+* @param  Pointer to sensor interface
 * @param  output data rate
 * @retval Error code
 */
-int8_t HIDS_setOdr(HIDS_output_data_rate_t odr)
+int8_t HIDS_setOdr(WE_sensorInterface_t *sensorInterface, HIDS_output_data_rate_t odr)
 {
 
 	HIDS_ctrl_1_t ctrl_reg_1;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.odr = odr;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (WriteReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -120,14 +150,15 @@ int8_t HIDS_setOdr(HIDS_output_data_rate_t odr)
 
 /**
 * @brief  Read the output data rate of the sensor
+* @param  Pointer to sensor interface
 * @param  Pointer to Output Data Rate
 * @retval Error code
 */
-int8_t HIDS_getOdr(HIDS_output_data_rate_t *Odr)
+int8_t HIDS_getOdr(WE_sensorInterface_t *sensorInterface, HIDS_output_data_rate_t *Odr)
 {
 	HIDS_ctrl_1_t ctrl_reg_1;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*Odr = (HIDS_output_data_rate_t)ctrl_reg_1.odr;
@@ -136,19 +167,20 @@ int8_t HIDS_getOdr(HIDS_output_data_rate_t *Odr)
 
 /**
 * @brief  Set the block data update state
+* @param  Pointer to sensor interface
 * @param  BDU state
 * @retval Error code
 */
-int8_t HIDS_setBdu(HIDS_state_t bdu)
+int8_t HIDS_setBdu(WE_sensorInterface_t *sensorInterface, HIDS_state_t bdu)
 {
 	HIDS_ctrl_1_t ctrl_reg_1;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.bdu = bdu;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (WriteReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -156,14 +188,15 @@ int8_t HIDS_setBdu(HIDS_state_t bdu)
 
 /**
 * @brief Read the block data update state
+* @param  Pointer to sensor interface
 * @param  Pointer to Block data update state
 * @retval Error code
 */
-int8_t HIDS_getBduState(HIDS_state_t *bdu)
+int8_t HIDS_getBduState(WE_sensorInterface_t *sensorInterface, HIDS_state_t *bdu)
 {
 	HIDS_ctrl_1_t ctrl_reg_1;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*bdu = (HIDS_state_t)ctrl_reg_1.bdu;
@@ -172,19 +205,20 @@ int8_t HIDS_getBduState(HIDS_state_t *bdu)
 
 /**
 * @brief  Set the Power Control Mode
+* @param  Pointer to sensor interface
 * @param  Power Control Mode
 * @retval Error code
 */
-int8_t HIDS_setPowerMode(HIDS_power_mode_t pd)
+int8_t HIDS_setPowerMode(WE_sensorInterface_t *sensorInterface, HIDS_power_mode_t pd)
 {
 	HIDS_ctrl_1_t ctrl_reg_1;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.powerControlMode = pd;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (WriteReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -192,14 +226,15 @@ int8_t HIDS_setPowerMode(HIDS_power_mode_t pd)
 
 /**
 * @brief Read the Power Control Mode
+* @param  Pointer to sensor interface
 * @param  Pointer to Power Control Mode
 * @retval Error code
 */
-int8_t HIDS_getPowerMode(HIDS_power_mode_t *pd)
+int8_t HIDS_getPowerMode(WE_sensorInterface_t *sensorInterface, HIDS_power_mode_t *pd)
 {
 	HIDS_ctrl_1_t ctrl_reg_1;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*pd = (HIDS_power_mode_t)ctrl_reg_1.powerControlMode;
@@ -208,19 +243,20 @@ int8_t HIDS_getPowerMode(HIDS_power_mode_t *pd)
 
 /**
 * @brief  enable the One Shot Mode
+* @param  Pointer to sensor interface
 * @param  One shot bit state
 * @retval Error code
 */
-int8_t HIDS_enOneShot(HIDS_state_t oneShot)
+int8_t HIDS_enOneShot(WE_sensorInterface_t *sensorInterface, HIDS_state_t oneShot)
 {
 	HIDS_ctrl_2_t ctrl_reg_2;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.oneShotBit = oneShot;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (WriteReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -228,14 +264,15 @@ int8_t HIDS_enOneShot(HIDS_state_t oneShot)
 
 /**
 * @brief Read the Power Control Mode
+* @param  Pointer to sensor interface
 * @param  Pointer to One shot bit state
 * @retval Error code
 */
-int8_t HIDS_getOneShotState(HIDS_state_t *oneShot)
+int8_t HIDS_getOneShotState(WE_sensorInterface_t *sensorInterface, HIDS_state_t *oneShot)
 {
 	HIDS_ctrl_2_t ctrl_reg_2;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*oneShot = (HIDS_state_t)ctrl_reg_2.oneShotBit;
@@ -244,19 +281,20 @@ int8_t HIDS_getOneShotState(HIDS_state_t *oneShot)
 
 /**
 * @brief  enable the Heater
+* @param  Pointer to sensor interface
 * @param  Heater state
 * @retval Error code
 */
-int8_t HIDS_enHeater(HIDS_state_t heater)
+int8_t HIDS_enHeater(WE_sensorInterface_t *sensorInterface, HIDS_state_t heater)
 {
 	HIDS_ctrl_2_t ctrl_reg_2;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.heater = heater;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (WriteReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -264,14 +302,15 @@ int8_t HIDS_enHeater(HIDS_state_t heater)
 
 /**
 * @brief Read the Heater state
+* @param  Pointer to sensor interface
 * @param  Pointer to Heater state
 * @retval Error code
 */
-int8_t HIDS_getHeaterState(HIDS_state_t *heater)
+int8_t HIDS_getHeaterState(WE_sensorInterface_t *sensorInterface, HIDS_state_t *heater)
 {
 	HIDS_ctrl_2_t ctrl_reg_2;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*heater = (HIDS_state_t)ctrl_reg_2.heater;
@@ -280,19 +319,20 @@ int8_t HIDS_getHeaterState(HIDS_state_t *heater)
 
 /**
 * @brief  enable the Memory reboot
+* @param  Pointer to sensor interface
 * @param  Reboot state
 * @retval Error code
 */
-int8_t HIDS_enRebootMemory(HIDS_state_t reboot)
+int8_t HIDS_enRebootMemory(WE_sensorInterface_t *sensorInterface, HIDS_state_t reboot)
 {
 	HIDS_ctrl_2_t ctrl_reg_2;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.rebootMemory = reboot;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (WriteReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -300,14 +340,15 @@ int8_t HIDS_enRebootMemory(HIDS_state_t reboot)
 
 /**
 * @brief Read the reboot state
+* @param  Pointer to sensor interface
 * @param  Pointer to reboot state
 * @retval Error code
 */
-int8_t HIDS_getRebootMemoryState(HIDS_state_t *reboot)
+int8_t HIDS_getRebootMemoryState(WE_sensorInterface_t *sensorInterface, HIDS_state_t *reboot)
 {
 	HIDS_ctrl_2_t ctrl_reg_2;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*reboot = (HIDS_state_t)ctrl_reg_2.rebootMemory;
@@ -316,19 +357,20 @@ int8_t HIDS_getRebootMemoryState(HIDS_state_t *reboot)
 
 /**
 * @brief  enable the data Ready
+* @param  Pointer to sensor interface
 * @param  data Ready
 * @retval Error code
 */
-int8_t HIDS_enInt(HIDS_state_t Drdy)
+int8_t HIDS_enInt(WE_sensorInterface_t *sensorInterface, HIDS_state_t Drdy)
 {
 	HIDS_ctrl_3_t ctrl_reg_3;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.enDataReady = Drdy;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (WriteReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -336,14 +378,15 @@ int8_t HIDS_enInt(HIDS_state_t Drdy)
 
 /**
 * @brief Read the data Ready state
+* @param  Pointer to sensor interface
 * @param  Pointer to data Ready state
 * @retval Error code
 */
-int8_t HIDS_getIntState(HIDS_state_t *Drdy)
+int8_t HIDS_getIntState(WE_sensorInterface_t *sensorInterface, HIDS_state_t *Drdy)
 {
 	HIDS_ctrl_3_t ctrl_reg_3;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*Drdy = (HIDS_state_t)ctrl_reg_3.enDataReady;
@@ -352,19 +395,20 @@ int8_t HIDS_getIntState(HIDS_state_t *Drdy)
 
 /**
 * @brief  set the Interrupt pin Type [push-pull / open drain]
+* @param  Pointer to sensor interface
 * @param  data Ready
 * @retval Error code
 */
-int8_t HIDS_setIntPinType(HIDS_PP_OD_t PP_OD)
+int8_t HIDS_setIntPinType(WE_sensorInterface_t *sensorInterface, HIDS_PP_OD_t PP_OD)
 {
 	HIDS_ctrl_3_t ctrl_reg_3;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.interruptPinConfig = PP_OD;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (WriteReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -372,14 +416,15 @@ int8_t HIDS_setIntPinType(HIDS_PP_OD_t PP_OD)
 
 /**
 * @brief Read the Interrupt pin Type
+* @param  Pointer to sensor interface
 * @param  Pointer to the Interrupt pin Type
 * @retval Error code
 */
-int8_t HIDS_getIntPinType(HIDS_PP_OD_t *PP_OD)
+int8_t HIDS_getIntPinType(WE_sensorInterface_t *sensorInterface, HIDS_PP_OD_t *PP_OD)
 {
 	HIDS_ctrl_3_t ctrl_reg_3;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*PP_OD = (HIDS_PP_OD_t)ctrl_reg_3.interruptPinConfig;
@@ -388,19 +433,20 @@ int8_t HIDS_getIntPinType(HIDS_PP_OD_t *PP_OD)
 
 /**
 * @brief  set the data ready output level
+* @param  Pointer to sensor interface
 * @param  data ready output level
 * @retval Error code
 */
-int8_t HIDS_setIntLevel(HIDS_active_level_t Drdy_H_L)
+int8_t HIDS_setIntLevel(WE_sensorInterface_t *sensorInterface, HIDS_active_level_t Drdy_H_L)
 {
 	HIDS_ctrl_3_t ctrl_reg_3;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.drdyOutputLevel = Drdy_H_L;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (WriteReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -408,14 +454,15 @@ int8_t HIDS_setIntLevel(HIDS_active_level_t Drdy_H_L)
 
 /**
 * @brief Read the data ready output level
+* @param  Pointer to sensor interface
 * @param  Pointer to the data ready output level
 * @retval Error code
 */
-int8_t HIDS_getIntLevel(HIDS_active_level_t *Drdy_H_L)
+int8_t HIDS_getIntLevel(WE_sensorInterface_t *sensorInterface, HIDS_active_level_t *Drdy_H_L)
 {
 	HIDS_ctrl_3_t ctrl_reg_3;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*Drdy_H_L = (HIDS_active_level_t)ctrl_reg_3.drdyOutputLevel;
@@ -424,12 +471,13 @@ int8_t HIDS_getIntLevel(HIDS_active_level_t *Drdy_H_L)
 
 /**
 * @brief  Read the device ID
+* @param  Pointer to sensor interface
 * @param  Pointer to device ID.
 * @retval Error code
 */
-int8_t HIDS_getDeviceID(uint8_t *devID)
+int8_t HIDS_getDeviceID(WE_sensorInterface_t *sensorInterface, uint8_t *devID)
 {
-	if (ReadReg((uint8_t)HIDS_DEVICE_ID_REG, 1, devID))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_DEVICE_ID_REG, 1, devID))
 	return WE_FAIL;
 
 	return WE_SUCCESS; /* expected value is HIDS_DEVICE_ID_VALUE */
@@ -437,14 +485,15 @@ int8_t HIDS_getDeviceID(uint8_t *devID)
 
 /**
 * @brief Read the humidity Data availability
+* @param  Pointer to sensor interface
 * @param  Pointer to the humidity Data availability state
 * @retval Error code
 */
-int8_t HIDS_getHumStatus(HIDS_state_t *humidity_state)
+int8_t HIDS_getHumStatus(WE_sensorInterface_t *sensorInterface, HIDS_state_t *humidity_state)
 {
 	HIDS_status_t status_reg;
 
-	if (ReadReg((uint8_t)HIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*humidity_state = (HIDS_state_t)status_reg.humDataAvailable;
@@ -453,14 +502,15 @@ int8_t HIDS_getHumStatus(HIDS_state_t *humidity_state)
 
 /**
 * @brief Read the Temperature Data availability
+* @param  Pointer to sensor interface
 * @param  Pointer to the temperature Data availability state
 * @retval Error code
 */
-int8_t HIDS_getTempStatus(HIDS_state_t *temp_state)
+int8_t HIDS_getTempStatus(WE_sensorInterface_t *sensorInterface, HIDS_state_t *temp_state)
 {
 	HIDS_status_t status_reg;
 
-	if (ReadReg((uint8_t)HIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*temp_state = (HIDS_state_t)status_reg.tempDataAvailable;
@@ -469,13 +519,14 @@ int8_t HIDS_getTempStatus(HIDS_state_t *temp_state)
 
 /**
 * @brief Read the Data availability for temeprature and humidity. Since these values get reset to '0' after reading status register, both bits need to be requested in read procedure.
+* @param  Pointer to sensor interface
 * @param  Pointer to the temperature Data availability state
 * @retval Error code
 */
-int8_t HIDS_getStatusDrdy(HIDS_state_t *temp_state, HIDS_state_t *humidity_state)
+int8_t HIDS_getStatusDrdy(WE_sensorInterface_t *sensorInterface, HIDS_state_t *temp_state, HIDS_state_t *humidity_state)
 {
 	uint8_t status_reg;
-	if (ReadReg((uint8_t)HIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	{		
 		return WE_FAIL;
 	}
@@ -503,14 +554,16 @@ int8_t HIDS_getStatusDrdy(HIDS_state_t *temp_state, HIDS_state_t *humidity_state
 
 /**
 * @brief  Read the temperature and humidity raw values
+* @param  Pointer to sensor interface
 * @param  Pointer to rawHumidity and  rawTemp
 * @retval Error code
 */
-int8_t HIDS_getRAWValues(int16_t *rawHumidity, int16_t *rawTemp)
+int8_t HIDS_getRAWValues(WE_sensorInterface_t *sensorInterface, int16_t *rawHumidity, int16_t *rawTemp)
 {
 
 	uint8_t raw[4] = {0};
-	if (ReadReg((uint8_t)HIDS_H_OUT_L_REG, 4, (uint8_t *)&raw))
+	/* MSB of the sub-address enables address auto-increment for multi-byte reads */
+	if (ReadReg(sensorInterface, (uint8_t)(HIDS_H_OUT_L_REG | 0x80), 4, (uint8_t *)&raw))
 	return WE_FAIL;
 
 	*rawHumidity = (int16_t)(raw[1] << 8);
@@ -526,19 +579,19 @@ int8_t HIDS_getRAWValues(int16_t *rawHumidity, int16_t *rawTemp)
 
 /**
 * @brief  Read the raw humidity output
-* @param  no parameter.
+* @param  Pointer to sensor interface
 * @retval Humidity Output
 */
 
-uint16_t HIDS_get_H_T_out()
+uint16_t HIDS_get_H_T_out(WE_sensorInterface_t *sensorInterface)
 {
 	uint8_t buffer;
 	uint16_t H_T_out = 0;
-	if (ReadReg(HIDS_H_OUT_H_REG, 1, &buffer))
+	if (ReadReg(sensorInterface, HIDS_H_OUT_H_REG, 1, &buffer))
 	return WE_FAIL;
 	H_T_out = (uint16_t)buffer << 8;
 
-	if (ReadReg(HIDS_H_OUT_L_REG, 1, &buffer))
+	if (ReadReg(sensorInterface, HIDS_H_OUT_L_REG, 1, &buffer))
 	return WE_FAIL;
 	H_T_out |= buffer;
 
@@ -547,18 +600,18 @@ uint16_t HIDS_get_H_T_out()
 
 /**
 * @brief  Read the H0_T0_out calibration
-* @param  no parameter.
+* @param  Pointer to sensor interface
 * @retval H0_T0_out calibration
 */
-uint16_t HIDS_get_H0_T0_out()
+uint16_t HIDS_get_H0_T0_out(WE_sensorInterface_t *sensorInterface)
 {
 	uint8_t buffer;
 	uint16_t H0_T0_out = 0;
-	if (ReadReg(HIDS_H0_T0_OUT_H, 1, &buffer))
+	if (ReadReg(sensorInterface, HIDS_H0_T0_OUT_H, 1, &buffer))
 	return WE_FAIL;
 	H0_T0_out = (((uint16_t)buffer) << 8);
 
-	if (ReadReg(HIDS_H0_T0_OUT_L, 1, &buffer))
+	if (ReadReg(sensorInterface, HIDS_H0_T0_OUT_L, 1, &buffer))
 	return WE_FAIL;
 	H0_T0_out |= buffer;
 
@@ -567,18 +620,18 @@ uint16_t HIDS_get_H0_T0_out()
 
 /**
 * @brief  Read the H1_T0_out calibration
-* @param  no parameter.
+* @param  Pointer to sensor interface
 * @retval H1_T0_out calibration
 */
-uint16_t HIDS_get_H1_T0_out()
+uint16_t HIDS_get_H1_T0_out(WE_sensorInterface_t *sensorInterface)
 {
 	uint8_t buffer;
 	uint16_t H1_T0_out = 0;
-	if (ReadReg(HIDS_H1_T0_OUT_H, 1, &buffer))
+	if (ReadReg(sensorInterface, HIDS_H1_T0_OUT_H, 1, &buffer))
 	return WE_FAIL;
 	H1_T0_out = (((uint16_t)buffer) << 8);
 
-	if (ReadReg(HIDS_H1_T0_OUT_L, 1, &buffer))
+	if (ReadReg(sensorInterface, HIDS_H1_T0_OUT_L, 1, &buffer))
 	return WE_FAIL;
 	H1_T0_out |= buffer;
 
@@ -587,15 +640,15 @@ uint16_t HIDS_get_H1_T0_out()
 
 /**
 * @brief  Read the H0_rh calibration
-* @param  no parameter.
+* @param  Pointer to sensor interface
 * @retval H0_rh calibration
 */
 
-uint16_t HIDS_get_H0_rh()
+uint16_t HIDS_get_H0_rh(WE_sensorInterface_t *sensorInterface)
 {
 	uint8_t H0_rh = 0;
 
-	if (ReadReg(HIDS_H0_RH_X2, 1, &H0_rh))
+	if (ReadReg(sensorInterface, HIDS_H0_RH_X2, 1, &H0_rh))
 	return WE_FAIL;
 
 	return H0_rh;
@@ -603,14 +656,14 @@ uint16_t HIDS_get_H0_rh()
 
 /**
 * @brief  Read the H1_rh calibration
-* @param  no parameter.
+* @param  Pointer to sensor interface
 * @retval H1_rh calibration
 */
-uint16_t HIDS_get_H1_rh()
+uint16_t HIDS_get_H1_rh(WE_sensorInterface_t *sensorInterface)
 {
 	uint8_t H1_rh = 0;
 
-	if (ReadReg((uint8_t)HIDS_H1_RH_X2, 1, &H1_rh))
+	if (ReadReg(sensorInterface, (uint8_t)HIDS_H1_RH_X2, 1, &H1_rh))
 	return WE_FAIL;
 
 	return H1_rh;
@@ -618,18 +671,18 @@ uint16_t HIDS_get_H1_rh()
 
 /**
 * @brief  Read the raw temperature output
-* @param  no parameter.
+* @param  Pointer to sensor interface
 * @retval Temperature Output
 */
-uint16_t HIDS_get_T_OUT()
+uint16_t HIDS_get_T_OUT(WE_sensorInterface_t *sensorInterface)
 {
 	uint8_t buffer;
 	uint16_t T_OUT = 0;
-	if (ReadReg(HIDS_T_OUT_H_REG, 1, &buffer))
+	if (ReadReg(sensorInterface, HIDS_T_OUT_H_REG, 1, &buffer))
 	return WE_FAIL;
 	T_OUT = (uint16_t)buffer << 8;
 
-	if (ReadReg(HIDS_T_OUT_L_REG, 1, &buffer))
+	if (ReadReg(sensorInterface, HIDS_T_OUT_L_REG, 1, &buffer))
 	return WE_FAIL;
 	T_OUT |= buffer;
 
@@ -638,19 +691,19 @@ uint16_t HIDS_get_T_OUT()
 
 /**
 * @brief  Read the T1_OUT calibration
-* @param  no parameter.
+* @param  Pointer to sensor interface
 * @retval T1_OUT calibration
 */
 
-uint16_t HIDS_get_T1_OUT()
+uint16_t HIDS_get_T1_OUT(WE_sensorInterface_t *sensorInterface)
 {
 	uint8_t buffer;
 	uint16_t T1_OUT = 0;
-	if (ReadReg(HIDS_T1_OUT_H, 1, &buffer))
+	if (ReadReg(sensorInterface, HIDS_T1_OUT_H, 1, &buffer))
 	return WE_FAIL;
 	T1_OUT = ((uint16_t)buffer) << 8;
 
-	if (ReadReg(HIDS_T1_OUT_L, 1, &buffer))
+	if (ReadReg(sensorInterface, HIDS_T1_OUT_L, 1, &buffer))
 	return WE_FAIL;
 	T1_OUT |= buffer;
 
@@ -659,18 +712,18 @@ uint16_t HIDS_get_T1_OUT()
 
 /**
 * @brief  Read the T0_OUT calibration
-* @param  no parameter.
+* @param  Pointer to sensor interface
 * @retval T0_OUT calibration
 */
-uint16_t HIDS_get_T0_OUT()
+uint16_t HIDS_get_T0_OUT(WE_sensorInterface_t *sensorInterface)
 {
 	uint8_t buffer;
 	uint16_t T0_OUT = 0;
-	if (ReadReg(HIDS_T0_OUT_H, 1, &buffer))
+	if (ReadReg(sensorInterface, HIDS_T0_OUT_H, 1, &buffer))
 	return WE_FAIL;
 	T0_OUT = ((uint16_t)buffer) << 8;
 
-	if (ReadReg(HIDS_T0_OUT_L, 1, &buffer))
+	if (ReadReg(sensorInterface, HIDS_T0_OUT_L, 1, &buffer))
 	return WE_FAIL;
 	T0_OUT |= buffer;
 
@@ -679,11 +732,12 @@ uint16_t HIDS_get_T0_OUT()
 
 /**
 * @brief  Read the Humidity data
+* @param  Pointer to sensor interface
 * @param  Pointer to the Humidity data in %
 * @retval error code
 */
 
-int8_t HIDS_getHumidity(float *humidity)
+int8_t HIDS_getHumidity(WE_sensorInterface_t *sensorInterface, float *humidity)
 {
 
 	uint16_t H0_T0_out, H1_T0_out, H_T_out;
@@ -691,19 +745,19 @@ int8_t HIDS_getHumidity(float *humidity)
 	float h_temp = 0.0;
 	float hum = 0.0;
 
-	H_T_out = HIDS_get_H_T_out();
+	H_T_out = HIDS_get_H_T_out(sensorInterface);
 
-	H0_rh = HIDS_get_H0_rh();
+	H0_rh = HIDS_get_H0_rh(sensorInterface);
 	H0_rh = H0_rh >> 1;
 
-	H1_rh = HIDS_get_H1_rh();
+	H1_rh = HIDS_get_H1_rh(sensorInterface);
 	H1_rh = H1_rh >> 1;
 
 	hum = H1_rh - H0_rh;
 
-	H0_T0_out = HIDS_get_H0_T0_out();
+	H0_T0_out = HIDS_get_H0_T0_out(sensorInterface);
 
-	H1_T0_out = HIDS_get_H1_T0_out();
+	H1_T0_out = HIDS_get_H1_T0_out(sensorInterface);
 
 	// Decode Humidity
 
@@ -721,11 +775,12 @@ int8_t HIDS_getHumidity(float *humidity)
 }
 /**
 * @brief  Read the Temperature data
+* @param  Pointer to sensor interface
 * @param  Pointer to the Temperature data on °C
 * @retval error code
 */
 
-int8_t HIDS_getTemperature(float *tempDegC)
+int8_t HIDS_getTemperature(WE_sensorInterface_t *sensorInterface, float *tempDegC)
 {
 
 	uint16_t T0_out, T1_out, T_out, T0_degC_x8_u16, T1_degC_x8_u16;
@@ -734,10 +789,10 @@ int8_t HIDS_getTemperature(float *tempDegC)
 	float t_temp = 0.0;
 	float deg = 0.0;
 
-	if (ReadReg(HIDS_T0_T1_DEGC_H2, 1, &tmp))
+	if (ReadReg(sensorInterface, HIDS_T0_T1_DEGC_H2, 1, &tmp))
 	return WE_FAIL;
 
-	if (ReadReg(HIDS_T0_DEGC_X8, 1, &buffer))
+	if (ReadReg(sensorInterface, HIDS_T0_DEGC_X8, 1, &buffer))
 	return WE_FAIL;
 
 	T0_degC_x8_u16 = (((uint16_t)(tmp & 0x03)) << 8) | ((uint16_t)buffer);
@@ -745,7 +800,7 @@ int8_t HIDS_getTemperature(float *tempDegC)
 	// remove 8x multiple
 	T0_degC = T0_degC_x8_u16 >> 3;
 
-	if (ReadReg(HIDS_T1_DEGC_X8, 1, &buffer))
+	if (ReadReg(sensorInterface, HIDS_T1_DEGC_X8, 1, &buffer))
 	return WE_FAIL;
 
 	T1_degC_x8_u16 = (((uint16_t)(tmp & 0x0C)) << 6) | ((uint16_t)buffer);
@@ -753,9 +808,9 @@ int8_t HIDS_getTemperature(float *tempDegC)
 	// remove 8x multiple
 	T1_degC = T1_degC_x8_u16 >> 3;
 
-	T0_out = HIDS_get_T0_OUT();
-	T1_out = HIDS_get_T1_OUT();
-	T_out = HIDS_get_T_OUT();
+	T0_out = HIDS_get_T0_OUT(sensorInterface);
+	T1_out = HIDS_get_T1_OUT(sensorInterface);
+	T_out = HIDS_get_T_OUT(sensorInterface);
 
 	// Decode Temperature
 
@@ -70,6 +70,8 @@ extern "C"
 #define HIDS_T1_OUT_L (uint8_t)0x3E      /* T1_OUT_LSB  calibration register*/
 #define HIDS_T1_OUT_H (uint8_t)0x3F      /* T1_OUT_H MSB calibration register*/
 
+#define HIDS_CACHED_REGISTERS (uint8_t)17 /* number of registers in HIDS_cachedRegisters */
+
 /**         Register type definitions         */
 
 /**
@@ -210,65 +212,68 @@ typedef enum
 	HIDS_openDrain = 1
 } HIDS_PP_OD_t;
 
+/* Registers held in the register cache of the sensor interface */
+extern const WE_cachedRegister_t HIDS_cachedRegisters[HIDS_CACHED_REGISTERS];
+
 /**         Functions definition         */
 
-	int8_t HIDS_getDeviceID(uint8_t *devID);
+	int8_t HIDS_getDeviceID(WE_sensorInterface_t *sensorInterface, uint8_t *devID);
 
 	/* Standard Configurations */
-	uint8_t HIDS_setHumAvg(HIDS_average_conf_t avgH);
-	uint8_t HIDS_getHumAvg(HIDS_average_conf_t *avgH);
-	uint8_t HIDS_setTempAvg(HIDS_average_conf_t avgT);
-	uint8_t HIDS_getTempAvg(HIDS_average_conf_t *avgT);
+	uint8_t HIDS_setHumAvg(WE_sensorInterface_t *sensorInterface, HIDS_average_conf_t avgH);
+	uint8_t HIDS_getHumAvg(WE_sensorInterface_t *sensorInterface, HIDS_average_conf_t *avgH);
+	uint8_t HIDS_setTempAvg(WE_sensorInterface_t *sensorInterface, HIDS_average_conf_t avgT);
+	uint8_t HIDS_getTempAvg(WE_sensorInterface_t *sensorInterface, HIDS_average_conf_t *avgT);
 
-	int8_t HIDS_setOdr(HIDS_output_data_rate_t odr);
-	int8_t HIDS_getOdr(HIDS_output_data_rate_t *odr);
+	int8_t HIDS_setOdr(WE_sensorInterface_t *sensorInterface, HIDS_output_data_rate_t odr);
+	int8_t HIDS_getOdr(WE_sensorInterface_t *sensorInterface, HIDS_output_data_rate_t *odr);
 
-	int8_t HIDS_setBdu(HIDS_state_t bdu);
-	int8_t HIDS_getBduState(HIDS_state_t *bdu);
+	int8_t HIDS_setBdu(WE_sensorInterface_t *sensorInterface, HIDS_state_t bdu);
+	int8_t HIDS_getBduState(WE_sensorInterface_t *sensorInterface, HIDS_state_t *bdu);
 
-	int8_t HIDS_setPowerMode(HIDS_power_mode_t pd);
-	int8_t HIDS_getPowerMode(HIDS_power_mode_t *pd);
-	int8_t HIDS_enOneShot(HIDS_state_t oneShot);
-	int8_t HIDS_getOneShotState(HIDS_state_t *oneShot);
+	int8_t HIDS_setPowerMode(WE_sensorInterface_t *sensorInterface, HIDS_power_mode_t pd);
+	int8_t HIDS_getPowerMode(WE_sensorInterface_t *sensorInterface, HIDS_power_mode_t *pd);
+	int8_t HIDS_enOneShot(WE_sensorInterface_t *sensorInterface, HIDS_state_t oneShot);
+	int8_t HIDS_getOneShotState(WE_sensorInterface_t *sensorInterface, HIDS_state_t *oneShot);
 
-	int8_t HIDS_enHeater(HIDS_state_t heater);
-	int8_t HIDS_getHeaterState(HIDS_state_t *heater);
+	int8_t HIDS_enHeater(WE_sensorInterface_t *sensorInterface, HIDS_state_t heater);
+	int8_t HIDS_getHeaterState(WE_sensorInterface_t *sensorInterface, HIDS_state_t *heater);
 
-	int8_t HIDS_enRebootMemory(HIDS_state_t reboot);
-	int8_t HIDS_getRebootMemoryState(HIDS_state_t *reboot);
+	int8_t HIDS_enRebootMemory(WE_sensorInterface_t *sensorInterface, HIDS_state_t reboot);
+	int8_t HIDS_getRebootMemoryState(WE_sensorInterface_t *sensorInterface, HIDS_state_t *reboot);
 
-	int8_t HIDS_enInt(HIDS_state_t Drdy);
-	int8_t HIDS_getIntState(HIDS_state_t *Drdy);
+	int8_t HIDS_enInt(WE_sensorInterface_t *sensorInterface, HIDS_state_t Drdy);
+	int8_t HIDS_getIntState(WE_sensorInterface_t *sensorInterface, HIDS_state_t *Drdy);
 
-	int8_t HIDS_setIntPinType(HIDS_PP_OD_t PP_OD);
-	int8_t HIDS_getIntPinType(HIDS_PP_OD_t *PP_OD);
+	int8_t HIDS_setIntPinType(WE_sensorInterface_t *sensorInterface, HIDS_PP_OD_t PP_OD);
+	int8_t HIDS_getIntPinType(WE_sensorInterface_t *sensorInterface, HIDS_PP_OD_t *PP_OD);
 
-	int8_t HIDS_setIntLevel(HIDS_active_level_t Drdy_H_L);
-	int8_t HIDS_getIntLevel(HIDS_active_level_t *Drdy_H_L);
+	int8_t HIDS_setIntLevel(WE_sensorInterface_t *sensorInterface, HIDS_active_level_t Drdy_H_L);
+	int8_t HIDS_getIntLevel(WE_sensorInterface_t *sensorInterface, HIDS_active_level_t *Drdy_H_L);
 
 	/*get the temperature and Humidity Output data  */
 
-	uint16_t HIDS_get_H_T_out();
-	uint16_t HIDS_get_T_OUT();
+	uint16_t HIDS_get_H_T_out(WE_sensorInterface_t *sensorInterface);
+	uint16_t HIDS_get_T_OUT(WE_sensorInterface_t *sensorInterface);
 
 	/*get the calibration parameters */
 
-	uint16_t HIDS_get_H0_T0_out();
-	uint16_t HIDS_get_H1_T0_out();
-	uint16_t HIDS_get_H0_rh();
-	uint16_t HIDS_get_H1_rh();
+	uint16_t HIDS_get_H0_T0_out(WE_sensorInterface_t *sensorInterface);
+	uint16_t HIDS_get_H1_T0_out(WE_sensorInterface_t *sensorInterface);
+	uint16_t HIDS_get_H0_rh(WE_sensorInterface_t *sensorInterface);
+	uint16_t HIDS_get_H1_rh(WE_sensorInterface_t *sensorInterface);
 
-	uint16_t HIDS_get_T1_OUT();
-	uint16_t HIDS_get_T0_OUT();
+	uint16_t HIDS_get_T1_OUT(WE_sensorInterface_t *sensorInterface);
+	uint16_t HIDS_get_T0_OUT(WE_sensorInterface_t *sensorInterface);
 	/* Temperature and Humidity data available State */
 
-	int8_t HIDS_getTempStatus(HIDS_state_t *temp_state);
-	int8_t HIDS_getHumStatus(HIDS_state_t *humidity_state);
-	int8_t HIDS_getStatusDrdy(HIDS_state_t *temp_state, HIDS_state_t *humidity_state);
+	int8_t HIDS_getTempStatus(WE_sensorInterface_t *sensorInterface, HIDS_state_t *temp_state);
+	int8_t HIDS_getHumStatus(WE_sensorInterface_t *sensorInterface, HIDS_state_t *humidity_state);
+	int8_t HIDS_getStatusDrdy(WE_sensorInterface_t *sensorInterface, HIDS_state_t *temp_state, HIDS_state_t *humidity_state);
 
-	int8_t HIDS_getRAWValues(int16_t *rawHumidity, int16_t *rawTemp);
-	int8_t HIDS_getHumidity(float *humidity);
-	int8_t HIDS_getTemperature(float *tempDegC);
+	int8_t HIDS_getRAWValues(WE_sensorInterface_t *sensorInterface, int16_t *rawHumidity, int16_t *rawTemp);
+	int8_t HIDS_getHumidity(WE_sensorInterface_t *sensorInterface, float *humidity);
+	int8_t HIDS_getTemperature(WE_sensorInterface_t *sensorInterface, float *tempDegC);
 
 #ifdef __cplusplus
 }
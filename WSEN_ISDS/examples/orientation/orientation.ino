@@ -0,0 +1,113 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+/*
+ * WSEN-ISDS  Orientation
+ * 
+ * Estimates the orientation as a quaternion from the gyroscope at 833 Hz
+ * and the accelerometer at 104 Hz.
+ * 
+ * Both sensors are stored in the FIFO at their own rate. The loop reads
+ * the FIFO in blocks and updates the fixed-point estimator with each block
+ * from the raw values, no float math is used until the quaternion is
+ * printed 10 times per second.
+ * 
+ */
+
+#include <Wire.h>
+#include "WSEN_ISDS.h"
+#include "WSEN_ISDS_Fusion.h"
+
+Sensor_ISDS sensor;
+ISDS_fusion_t fusion;
+
+void setup()
+{
+  delay(5000);
+  Serial.begin(115200);
+
+  // Initialize the I2C interface
+  sensor.init(ISDS_ADDRESS_I2C_1);
+  Wire.setClock(400000);
+
+  if (WE_FAIL == sensor.SW_RESET())
+  {
+    Serial.println("Error: SW_RESET(). Stop!");
+    while(1);
+  }
+
+  // Gyroscope 833 Hz, 2000 dps; accelerometer 104 Hz, 4 g; FIFO at the gyroscope rate
+  ISDS_ratePlan_t plan = {
+    ISDS_accOdr104Hz, ISDS_accFullScaleFourG, ISDS_disable,
+    ISDS_gyroOdr833Hz, ISDS_gyroFullScale2000dps, ISDS_enable,
+    ISDS_fifoOdr833Hz,
+    ISDS_fifoDecimationNoFifo, ISDS_fifoDecimationNoFifo   // computed by set_Rates()
+  };
+  if (WE_FAIL == sensor.set_Rates(&plan))
+  {
+    Serial.println("Error: set_Rates(). Stop!");
+    while(1);
+  }
+
+  if (WE_FAIL == ISDS_initFusion(&fusion, plan.gyroFullScale, plan.accFullScale,
+                                 ISDS_getGyroOutputDataRatePeriodUs(plan.gyroOdr)))
+  {
+    Serial.println("Error: ISDS_initFusion(). Stop!");
+    while(1);
+  }
+
+  if (WE_FAIL == ISDS_setFifoMode(sensor.get_Interface(), ISDS_continuousMode))
+  {
+    Serial.println("Error: ISDS_setFifoMode(). Stop!");
+    while(1);
+  }
+}
+
+void loop()
+{
+  static uint32_t lastPrint = 0;
+  ISDS_fifoFrame_t frames[16];
+  int count;
+
+  count = sensor.read_FIFO_frames(frames, 16);
+  if (WE_FAIL == count)
+  {
+    Serial.println("Error: read_FIFO_frames(). Stop!");
+    while(1);
+  }
+  ISDS_updateFusionFrames(&fusion, frames, count);
+
+  if ((uint32_t)(millis() - lastPrint) >= 100)
+  {
+    lastPrint = millis();
+
+    // Quaternion w, x, y, z, Q30 to float for printing only
+    for (int i = 0; i < 4; i++)
+    {
+      Serial.print((float)fusion.q[i] / ISDS_FUSION_ONE, 4);
+      Serial.print((i < 3) ? " " : "\n");
+    }
+  }
+}
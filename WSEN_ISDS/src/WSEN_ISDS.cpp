@@ -29,11 +29,28 @@
 /**
    @brief  Initialize the I2C Interface
    @param  I2C address
+   @param  Bus instance of the transport, NULL selects the default bus
+   @param  Transport, NULL selects the default transport of the platform
    @retval Error Code
 */
-int Sensor_ISDS::init(int address)
+int Sensor_ISDS::init(int address, void *handle, const WE_transport_t *transport)
 {
-    return I2CInit(address);
+    sensorInterface.handle = handle;
+    sensorInterface.transport = transport;
+    WE_initRegisterCache(&registerCache, ISDS_cachedRegisters, ISDS_CACHED_REGISTERS, 0, cacheValues);
+    sensorInterface.cache = &registerCache;
+    fifoDecoder.length = 0;
+    ISDS_initTimestampClock(&timestampClock, ISDS_timestampResolution6ms4);
+    return I2CInit(&sensorInterface, address);
+}
+
+/**
+   @brief  Get the bus interface of the sensor, e.g. to queue asynchronous requests
+   @retval Pointer to sensor interface
+*/
+WE_sensorInterface_t *Sensor_ISDS::get_Interface()
+{
+    return &sensorInterface;
 }
 
 /**
@@ -45,7 +62,7 @@ int Sensor_ISDS::get_DeviceID()
 {
     uint8_t devID;
 
-    if (WE_SUCCESS == ISDS_getDeviceID(&devID))
+    if (WE_SUCCESS == ISDS_getDeviceID(&sensorInterface, &devID))
     {
         return devID;
     }
@@ -63,7 +80,7 @@ int Sensor_ISDS::select_ODR(int ODR)
     {
         case 0:
         {
-            if (WE_FAIL == ISDS_setFifoOutputDataRate(ISDS_fifoOdrOff))
+            if (WE_FAIL == ISDS_setFifoOutputDataRate(&sensorInterface, ISDS_fifoOdrOff))
 				{
         return WE_FAIL;
     }
@@ -72,7 +89,7 @@ int Sensor_ISDS::select_ODR(int ODR)
 
         case 1:
         {
-            if (WE_FAIL == ISDS_setFifoOutputDataRate(ISDS_fifoOdr12Hz5))
+            if (WE_FAIL == ISDS_setFifoOutputDataRate(&sensorInterface, ISDS_fifoOdr12Hz5))
 				{
         return WE_FAIL;
     }
@@ -81,7 +98,7 @@ int Sensor_ISDS::select_ODR(int ODR)
 
         case 2:
         {
-            if (WE_FAIL == ISDS_setFifoOutputDataRate(ISDS_fifoOdr26Hz))
+            if (WE_FAIL == ISDS_setFifoOutputDataRate(&sensorInterface, ISDS_fifoOdr26Hz))
 				{
         return WE_FAIL;
     }
@@ -90,7 +107,7 @@ int Sensor_ISDS::select_ODR(int ODR)
 
         case 3:
         {
-            if (WE_FAIL == ISDS_setFifoOutputDataRate(ISDS_fifoOdr52Hz))
+            if (WE_FAIL == ISDS_setFifoOutputDataRate(&sensorInterface, ISDS_fifoOdr52Hz))
 				{
         return WE_FAIL;
     }
@@ -99,7 +116,7 @@ int Sensor_ISDS::select_ODR(int ODR)
 
         case 4:
         {
-            if (WE_FAIL == ISDS_setFifoOutputDataRate(ISDS_fifoOdr104Hz))
+            if (WE_FAIL == ISDS_setFifoOutputDataRate(&sensorInterface, ISDS_fifoOdr104Hz))
 				{
         return WE_FAIL;
     }
@@ -108,7 +125,7 @@ int Sensor_ISDS::select_ODR(int ODR)
 
         case 5:
         {
-            if (WE_FAIL == ISDS_setFifoOutputDataRate(ISDS_fifoOdr208Hz))
+            if (WE_FAIL == ISDS_setFifoOutputDataRate(&sensorInterface, ISDS_fifoOdr208Hz))
 				{
         return WE_FAIL;
     }
@@ -117,7 +134,7 @@ int Sensor_ISDS::select_ODR(int ODR)
 
         case 6:
         {
-            if (WE_FAIL == ISDS_setFifoOutputDataRate(ISDS_fifoOdr416Hz))
+            if (WE_FAIL == ISDS_setFifoOutputDataRate(&sensorInterface, ISDS_fifoOdr416Hz))
 				{
         return WE_FAIL;
     }
@@ -126,7 +143,7 @@ int Sensor_ISDS::select_ODR(int ODR)
 
         case 7:
         {
-            if (WE_FAIL == ISDS_setFifoOutputDataRate(ISDS_fifoOdr833Hz))
+            if (WE_FAIL == ISDS_setFifoOutputDataRate(&sensorInterface, ISDS_fifoOdr833Hz))
 				{
         return WE_FAIL;
     }
@@ -135,7 +152,7 @@ int Sensor_ISDS::select_ODR(int ODR)
 
         case 8:
         {
-            if (WE_FAIL == ISDS_setFifoOutputDataRate(ISDS_fifoOdr1k66Hz))
+            if (WE_FAIL == ISDS_setFifoOutputDataRate(&sensorInterface, ISDS_fifoOdr1k66Hz))
 				
 				{
         return WE_FAIL;
@@ -145,7 +162,7 @@ int Sensor_ISDS::select_ODR(int ODR)
 
         case 9:
         {
-            if (WE_FAIL == ISDS_setFifoOutputDataRate(ISDS_fifoOdr3k33Hz))
+            if (WE_FAIL == ISDS_setFifoOutputDataRate(&sensorInterface, ISDS_fifoOdr3k33Hz))
 				{
         return WE_FAIL;
     }
@@ -154,7 +171,7 @@ int Sensor_ISDS::select_ODR(int ODR)
 
         case 10:
         {
-            if (WE_FAIL == ISDS_setFifoOutputDataRate(ISDS_fifoOdr6k66Hz))
+            if (WE_FAIL == ISDS_setFifoOutputDataRate(&sensorInterface, ISDS_fifoOdr6k66Hz))
 				{
         return WE_FAIL;
     }
@@ -174,15 +191,15 @@ int Sensor_ISDS::select_ODR(int ODR)
 */
 int Sensor_ISDS::power_down()
 {
-    if (WE_FAIL == ISDS_enableBlockDataUpdate(ISDS_disable))
+    if (WE_FAIL == ISDS_enableBlockDataUpdate(&sensorInterface, ISDS_disable))
 	{
         return WE_FAIL;
     }
-    if (WE_FAIL == ISDS_setAccOutputDataRate(ISDS_accOdrOff))
+    if (WE_FAIL == ISDS_setAccOutputDataRate(&sensorInterface, ISDS_accOdrOff))
 	{
         return WE_FAIL;
     }
-    if (WE_FAIL == ISDS_setGyroOutputDataRate(ISDS_gyroOdrOff))
+    if (WE_FAIL == ISDS_setGyroOutputDataRate(&sensorInterface, ISDS_gyroOdrOff))
 	{
         return WE_FAIL;
     }
@@ -195,7 +212,7 @@ int Sensor_ISDS::power_down()
 */
 int Sensor_ISDS::SW_RESET()
 {
-    if (WE_FAIL == ISDS_softReset(ISDS_enable))
+    if (WE_FAIL == ISDS_softReset(&sensorInterface, ISDS_enable))
 	{
         return WE_FAIL;
     }
@@ -205,26 +222,44 @@ int Sensor_ISDS::SW_RESET()
 
 /**
    @brief   Set the mode (high performance, normal or low power)
+   @retval  Error Code
 */
 int Sensor_ISDS::set_Mode(int mode)
 {
-    if (WE_FAIL == ISDS_enableBlockDataUpdate(ISDS_enable))
+    WE_beginConfiguration(&sensorInterface);
+
+    if (WE_FAIL == configure_Mode(mode))
+    {
+        WE_abortConfiguration(&sensorInterface);
+        return WE_FAIL;
+    }
+
+    /* CTRL1..CTRL7 are written in one burst */
+    return WE_commitConfiguration(&sensorInterface);
+}
+
+/**
+   @brief   Change the registers for the mode, see set_Mode()
+*/
+int Sensor_ISDS::configure_Mode(int mode)
+{
+    if (WE_FAIL == ISDS_enableBlockDataUpdate(&sensorInterface, ISDS_enable))
 	{
         return WE_FAIL;
     }
-    if (WE_FAIL == ISDS_enableAutoIncrement(ISDS_enable))
+    if (WE_FAIL == ISDS_enableAutoIncrement(&sensorInterface, ISDS_enable))
 	{
         return WE_FAIL;
     }
     
     /* Accelerometer 16g range */
-    if (WE_FAIL == ISDS_setAccFullScale(ISDS_accFullScaleSixteenG))
+    if (WE_FAIL == ISDS_setAccFullScale(&sensorInterface, ISDS_accFullScaleSixteenG))
 	{
         return WE_FAIL;
     }
 
     /* Gyroscope 2000 dps range */
-    if (WE_FAIL == ISDS_setGyroFullScale(ISDS_gyroFullScale2000dps))
+    if (WE_FAIL == ISDS_setGyroFullScale(&sensorInterface, ISDS_gyroFullScale2000dps))
 	{
         return WE_FAIL;
     }
@@ -233,19 +268,19 @@ int Sensor_ISDS::set_Mode(int mode)
     {
         case 2://high performance
         {
-            if (WE_FAIL == ISDS_setAccOutputDataRate(ISDS_accOdr208Hz))
+            if (WE_FAIL == ISDS_setAccOutputDataRate(&sensorInterface, ISDS_accOdr208Hz))
 			{
 				return WE_FAIL;
 			}
-			if (WE_FAIL == ISDS_setGyroOutputDataRate(ISDS_gyroOdr208Hz))
+			if (WE_FAIL == ISDS_setGyroOutputDataRate(&sensorInterface, ISDS_gyroOdr208Hz))
 			{
 				return WE_FAIL;
 			}
-			if (WE_FAIL == ISDS_disableAccHighPerformanceMode(ISDS_disable))
+			if (WE_FAIL == ISDS_disableAccHighPerformanceMode(&sensorInterface, ISDS_disable))
 			{
 				return WE_FAIL;
 			}
-			if (WE_FAIL == ISDS_disableGyroHighPerformanceMode(ISDS_disable))
+			if (WE_FAIL == ISDS_disableGyroHighPerformanceMode(&sensorInterface, ISDS_disable))
 			{
 				return WE_FAIL;
 			}
@@ -254,19 +289,19 @@ int Sensor_ISDS::set_Mode(int mode)
 
         case 1://normal
         {
-            if (WE_FAIL == ISDS_setAccOutputDataRate(ISDS_accOdr208Hz))
+            if (WE_FAIL == ISDS_setAccOutputDataRate(&sensorInterface, ISDS_accOdr208Hz))
 			{
 				return WE_FAIL;
 			}
-			if (WE_FAIL == ISDS_setGyroOutputDataRate(ISDS_gyroOdr208Hz))
+			if (WE_FAIL == ISDS_setGyroOutputDataRate(&sensorInterface, ISDS_gyroOdr208Hz))
 			{
 				return WE_FAIL;
 			}
-			if (WE_FAIL == ISDS_disableAccHighPerformanceMode(ISDS_enable))
+			if (WE_FAIL == ISDS_disableAccHighPerformanceMode(&sensorInterface, ISDS_enable))
 			{
 				return WE_FAIL;
 			}
-			if (WE_FAIL == ISDS_disableGyroHighPerformanceMode(ISDS_enable))
+			if (WE_FAIL == ISDS_disableGyroHighPerformanceMode(&sensorInterface, ISDS_enable))
 			{
 				return WE_FAIL;
 			}
@@ -277,19 +312,19 @@ int Sensor_ISDS::set_Mode(int mode)
         case 0://low power
         default:
         {
-            if (WE_FAIL == ISDS_setAccOutputDataRate(ISDS_accOdr52Hz))
+            if (WE_FAIL == ISDS_setAccOutputDataRate(&sensorInterface, ISDS_accOdr52Hz))
 			{
 				return WE_FAIL;
 			}
-			if (WE_FAIL == ISDS_setGyroOutputDataRate(ISDS_gyroOdr52Hz))
+			if (WE_FAIL == ISDS_setGyroOutputDataRate(&sensorInterface, ISDS_gyroOdr52Hz))
 			{
 				return WE_FAIL;
 			}
-			if (WE_FAIL == ISDS_disableAccHighPerformanceMode(ISDS_enable))
+			if (WE_FAIL == ISDS_disableAccHighPerformanceMode(&sensorInterface, ISDS_enable))
 			{
 				return WE_FAIL;
 			}
-			if (WE_FAIL == ISDS_disableGyroHighPerformanceMode(ISDS_enable))
+			if (WE_FAIL == ISDS_disableGyroHighPerformanceMode(&sensorInterface, ISDS_enable))
 			{
 				return WE_FAIL;
 			}
@@ -300,6 +335,87 @@ int Sensor_ISDS::set_Mode(int mode)
 	return WE_SUCCESS;
 }
 
+/**
+   @brief   Set the accelerometer, gyroscope and FIFO output data rates and the full scales
+            independently. The FIFO decimation of each sensor is computed by ISDS_planRates()
+            so both are stored at their own ODR, and all registers are written in one
+            configuration commit. The FIFO mode is not changed.
+   @param   plan Rates, full scales and power modes, the decimation factors are returned
+   @retval  Error Code, WE_FAIL if the rates are incompatible
+*/
+int Sensor_ISDS::set_Rates(ISDS_ratePlan_t *plan)
+{
+    if (WE_FAIL == ISDS_planRates(plan))
+    {
+        return WE_FAIL;
+    }
+
+    WE_beginConfiguration(&sensorInterface);
+
+    if (WE_FAIL == configure_Rates(plan))
+    {
+        WE_abortConfiguration(&sensorInterface);
+        return WE_FAIL;
+    }
+
+    /* FIFO_CTRL3..5 and CTRL1..7 are written in one burst each */
+    return WE_commitConfiguration(&sensorInterface);
+}
+
+/**
+   @brief   Change the registers for a checked rate plan, see set_Rates()
+*/
+int Sensor_ISDS::configure_Rates(const ISDS_ratePlan_t *plan)
+{
+    if (WE_FAIL == ISDS_enableBlockDataUpdate(&sensorInterface, ISDS_enable))
+    {
+        return WE_FAIL;
+    }
+    if (WE_FAIL == ISDS_enableAutoIncrement(&sensorInterface, ISDS_enable))
+    {
+        return WE_FAIL;
+    }
+
+    if (WE_FAIL == ISDS_setAccFullScale(&sensorInterface, plan->accFullScale))
+    {
+        return WE_FAIL;
+    }
+    if (WE_FAIL == ISDS_setAccOutputDataRate(&sensorInterface, plan->accOdr))
+    {
+        return WE_FAIL;
+    }
+    if (WE_FAIL == ISDS_disableAccHighPerformanceMode(&sensorInterface,
+                                                      (ISDS_enable == plan->accHighPerformance) ? ISDS_disable : ISDS_enable))
+    {
+        return WE_FAIL;
+    }
+
+    if (WE_FAIL == ISDS_setGyroFullScale(&sensorInterface, plan->gyroFullScale))
+    {
+        return WE_FAIL;
+    }
+    if (WE_FAIL == ISDS_setGyroOutputDataRate(&sensorInterface, plan->gyroOdr))
+    {
+        return WE_FAIL;
+    }
+    if (WE_FAIL == ISDS_disableGyroHighPerformanceMode(&sensorInterface,
+                                                       (ISDS_enable == plan->gyroHighPerformance) ? ISDS_disable : ISDS_enable))
+    {
+        return WE_FAIL;
+    }
+
+    if (WE_FAIL == ISDS_setFifoAccDecimation(&sensorInterface, plan->accDecimation))
+    {
+        return WE_FAIL;
+    }
+    if (WE_FAIL == ISDS_setFifoGyroDecimation(&sensorInterface, plan->gyroDecimation))
+    {
+        return WE_FAIL;
+    }
+
+    return ISDS_setFifoOutputDataRate(&sensorInterface, plan->fifoOdr);
+}
+
 /**
    @brief   Check if new acceleration measurement is available 
    @retval  Error Code
@@ -307,7 +423,7 @@ int Sensor_ISDS::set_Mode(int mode)
 int Sensor_ISDS::is_ACC_Ready_To_Read()
 {
     ISDS_state_t drdy;
-    if (WE_FAIL == ISDS_isAccelerationDataReady(&drdy))
+    if (WE_FAIL == ISDS_isAccelerationDataReady(&sensorInterface, &drdy))
     {
         return WE_FAIL;
     }
@@ -324,7 +440,7 @@ int Sensor_ISDS::is_ACC_Ready_To_Read()
 int Sensor_ISDS::is_Gyro_Ready_To_Read()
 {
     ISDS_state_t drdy;
-    if (WE_FAIL == ISDS_isGyroscopeDataReady(&drdy))
+    if (WE_FAIL == ISDS_isGyroscopeDataReady(&sensorInterface, &drdy))
     {
         return WE_FAIL;
     }
@@ -341,7 +457,7 @@ int Sensor_ISDS::is_Gyro_Ready_To_Read()
 int Sensor_ISDS::is_Temp_Ready()
 {
     ISDS_state_t drdy;
-    if (WE_FAIL == ISDS_isTemperatureDataReady(&drdy))
+    if (WE_FAIL == ISDS_isTemperatureDataReady(&sensorInterface, &drdy))
     {
         return WE_FAIL;
     }
@@ -354,7 +470,7 @@ int Sensor_ISDS::is_Temp_Ready()
 int Sensor_ISDS::get_StatusRegister(ISDS_status_t *status)
 {
 
-    if (WE_FAIL == ISDS_getStatusRegister(status))
+    if (WE_FAIL == ISDS_getStatusRegister(&sensorInterface, status))
     {
         return WE_FAIL;
     }
@@ -372,7 +488,7 @@ int Sensor_ISDS::get_StatusRegister(ISDS_status_t *status)
 int Sensor_ISDS::get_acceleration_X(int16_t *acc_x)
 {
     int16_t val;
-    if (WE_FAIL == ISDS_getAccelerationX_int(&val))
+    if (WE_FAIL == ISDS_getAccelerationX_int(&sensorInterface, &val))
     {
         return WE_FAIL;
     }
@@ -388,7 +504,7 @@ int Sensor_ISDS::get_acceleration_X(int16_t *acc_x)
 int Sensor_ISDS::get_acceleration_Y(int16_t *acc_y)
 {
     int16_t val;
-    if (WE_FAIL == ISDS_getAccelerationY_int(&val))
+    if (WE_FAIL == ISDS_getAccelerationY_int(&sensorInterface, &val))
     {
         return WE_FAIL;
     }
@@ -404,7 +520,7 @@ int Sensor_ISDS::get_acceleration_Y(int16_t *acc_y)
 int Sensor_ISDS::get_acceleration_Z(int16_t *acc_z)
 {
     int16_t val;
-    if (WE_FAIL == ISDS_getAccelerationZ_int(&val))
+    if (WE_FAIL == ISDS_getAccelerationZ_int(&sensorInterface, &val))
     {
         return WE_FAIL;
     }
@@ -422,7 +538,7 @@ int Sensor_ISDS::get_acceleration_Z(int16_t *acc_z)
 */
 int Sensor_ISDS::get_accelerations(int16_t* X, int16_t* Y, int16_t* Z)
 {
-    if (WE_FAIL == ISDS_getAccelerations_int(X,Y,Z))
+    if (WE_FAIL == ISDS_getAccelerations_int(&sensorInterface, X,Y,Z))
     {
         return WE_FAIL;
     }
@@ -437,7 +553,7 @@ int Sensor_ISDS::get_angular_rate_X(int32_t *rate_x)
 {
     int32_t val = 0;
     /* Read gyroscope values (alternatively use ISDS_getAngularRates_int() to get values for all three axes in one go) */
-    if (WE_FAIL == ISDS_getAngularRateX_int(&val))
+    if (WE_FAIL == ISDS_getAngularRateX_int(&sensorInterface, &val))
     {
         return WE_FAIL;
     }
@@ -453,7 +569,7 @@ int Sensor_ISDS::get_angular_rate_Y(int32_t *rate_y)
 {
     int32_t val = 0;
     /* Read gyroscope values (alternatively use ISDS_getAngularRates_int() to get values for all three axes in one go) */
-    if (WE_FAIL == ISDS_getAngularRateY_int(&val))
+    if (WE_FAIL == ISDS_getAngularRateY_int(&sensorInterface, &val))
     {
         return WE_FAIL;
     }
@@ -470,7 +586,7 @@ int Sensor_ISDS::get_angular_rate_Z(int32_t *rate_z)
 {
     int32_t val = 0;
     /* Read gyroscope values (alternatively use ISDS_getAngularRates_int() to get values for all three axes in one go) */
-    if (WE_FAIL == ISDS_getAngularRateZ_int(&val))
+    if (WE_FAIL == ISDS_getAngularRateZ_int(&sensorInterface, &val))
     {
         return WE_FAIL;
     }
@@ -489,7 +605,7 @@ int Sensor_ISDS::get_angular_rate_Z(int32_t *rate_z)
 */
 int Sensor_ISDS::get_angular_rates(int32_t* X, int32_t* Y, int32_t* Z)
 {
-    if (ISDS_getAngularRates_int(X,Y,Z) == WE_FAIL)
+    if (ISDS_getAngularRates_int(&sensorInterface, X,Y,Z) == WE_FAIL)
     {
         return WE_FAIL;
     }
@@ -504,7 +620,7 @@ int Sensor_ISDS::get_angular_rates(int32_t* X, int32_t* Y, int32_t* Z)
 int Sensor_ISDS::get_temperature(float *temp)
 {
     int16_t val = 0;
-    if (WE_FAIL == ISDS_getTemperature_int(&val))
+    if (WE_FAIL == ISDS_getTemperature_int(&sensorInterface, &val))
     {
         return WE_FAIL;
     }
@@ -514,3 +630,159 @@ int Sensor_ISDS::get_temperature(float *temp)
 	return WE_SUCCESS;
 }
 
+/**
+   @brief  Read status, temperature, angular rates and accelerations in one transfer,
+           so all values belong to the same sample
+   @param  sample Data-ready flags, temperature in [°C x 100], angular rates in [mdps]
+           and accelerations in [mg]
+   @retval Error Code
+*/
+int Sensor_ISDS::get_Sample(ISDS_sample_t *sample)
+{
+    if (WE_FAIL == ISDS_getSample_int(&sensorInterface, sample))
+    {
+        return WE_FAIL;
+    }
+
+    return WE_SUCCESS;
+}
+
+/**
+   @brief  Read the FIFO and decode it into frames: the fill level and the pattern are read
+           once, the FIFO words in bursts. Each frame holds the data sets (gyroscope,
+           accelerometer, third and fourth) written to the FIFO in one FIFO cycle, according
+           to the decimation of each data set. A frame that is only partly in the FIFO is
+           completed by the next call.
+   @param  Decoded frames
+   @param  Max. number of frames to read
+   @retval Number of frames read, WE_FAIL on error
+*/
+int Sensor_ISDS::read_FIFO_frames(ISDS_fifoFrame_t *frames, int maxFrames)
+{
+    uint8_t data[2 * ISDS_FIFO_WORDS_PER_READ];
+    ISDS_fifoStatus2_t status;
+    uint16_t fillLevel;
+    uint16_t pattern;
+    uint16_t toRead;
+    int count = 0;
+
+    if ((maxFrames < 1) ||
+        (WE_FAIL == ISDS_updateFifoDecoder(&sensorInterface, &fifoDecoder)) ||
+        (WE_FAIL == ISDS_getFifoStatus(&sensorInterface, &status, &fillLevel, &pattern)))
+    {
+        return WE_FAIL;
+    }
+    if ((0 == fifoDecoder.length) || (0 == fillLevel))
+    {
+        return 0;
+    }
+
+    ISDS_syncFifoDecoder(&fifoDecoder, pattern);
+    toRead = ISDS_getFifoFrameWords(&fifoDecoder, (maxFrames < 0xFFFF) ? (uint16_t)maxFrames : 0xFFFF);
+    if (toRead > fillLevel)
+    {
+        toRead = fillLevel;
+    }
+
+    while (toRead > 0)
+    {
+        uint16_t chunk = (toRead > ISDS_FIFO_WORDS_PER_READ) ? ISDS_FIFO_WORDS_PER_READ : toRead;
+        if (WE_FAIL == ReadReg(&sensorInterface, ISDS_FIFO_DATA_OUT_L_REG, chunk * 2, data))
+        {
+            /* position unknown, resynchronized by the next read */
+            fifoDecoder.pattern = 0xFFFF;
+            return WE_FAIL;
+        }
+        for (uint16_t i = 0; i < chunk; i++)
+        {
+            /* FIFO_DATA_OUT_L first; no more than maxFrames end within the words read */
+            uint16_t word = (uint16_t)(data[2 * i] | (data[2 * i + 1] << 8));
+            if (1 == ISDS_decodeFifoWord(&fifoDecoder, word, &frames[count]))
+            {
+                count++;
+            }
+        }
+        toRead -= chunk;
+    }
+
+    return count;
+}
+
+/**
+   @brief  Start the timestamp counter and store it in the FIFO with every FIFO cycle, so
+           read_FIFO_frames() with host times can pair each frame with its sample time.
+           The counter is reset and the mapping to the host clock starts over.
+   @param  resolution 1 LSB = 25 µs or 6.4 ms, the counter wraps after 419 s or 29.8 h
+   @retval Error Code
+*/
+int Sensor_ISDS::start_Timestamps(ISDS_timestampResolution_t resolution)
+{
+    WE_beginConfiguration(&sensorInterface);
+
+    if ((WE_FAIL == ISDS_enableTimestampCount(&sensorInterface, ISDS_enable)) ||
+        (WE_FAIL == ISDS_enableFifoTimestamp(&sensorInterface, ISDS_enable)) ||
+        (WE_FAIL == ISDS_setFifoDataset4Decimation(&sensorInterface, ISDS_fifoDecimationDisabled)) ||
+        (WE_FAIL == ISDS_setTimestampResolution(&sensorInterface, resolution)))
+    {
+        WE_abortConfiguration(&sensorInterface);
+        return WE_FAIL;
+    }
+
+    if ((WE_FAIL == WE_commitConfiguration(&sensorInterface)) ||
+        (WE_FAIL == ISDS_resetTimestampCounter(&sensorInterface)))
+    {
+        return WE_FAIL;
+    }
+
+    ISDS_initTimestampClock(&timestampClock, resolution);
+    return sync_Timestamps();
+}
+
+/**
+   @brief  Read the timestamp counter and update its offset and drift against micros().
+           Called by read_FIFO_frames() with host times, call it in between if the FIFO
+           is read less often than every ISDS_TIMESTAMP_SYNC_WINDOW_US.
+   @retval Error Code
+*/
+int Sensor_ISDS::sync_Timestamps()
+{
+    uint32_t ticks;
+    uint32_t start = micros();
+
+    if (WE_FAIL == ISDS_getTimestamp(&sensorInterface, &ticks))
+    {
+        return WE_FAIL;
+    }
+
+    /* the counter is latched somewhere within the transfer */
+    ISDS_syncTimestampClock(&timestampClock, ticks, start + ((uint32_t)(micros() - start) >> 1));
+    return WE_SUCCESS;
+}
+
+/**
+   @brief  Read the FIFO like read_FIFO_frames() and give each frame its sample time on the
+           micros() clock, taken from the timestamp stored with it (see start_Timestamps()).
+           The time is free of read latency jitter and follows the drift of the sensor clock.
+   @param  Decoded frames
+   @param  Host time of each frame in [µs], 0 for frames without timestamp
+   @param  Max. number of frames to read
+   @retval Number of frames read, WE_FAIL on error
+*/
+int Sensor_ISDS::read_FIFO_frames(ISDS_fifoFrame_t *frames, uint32_t *times, int maxFrames)
+{
+    int count;
+
+    if (WE_FAIL == sync_Timestamps())
+    {
+        return WE_FAIL;
+    }
+
+    count = read_FIFO_frames(frames, maxFrames);
+
+    for (int i = 0; i < count; i++)
+    {
+        times[i] = (ISDS_FIFO_SET_FOURTH == (frames[i].sets & (ISDS_FIFO_SET_FOURTH | ISDS_FIFO_SET_TEMP))) ? ISDS_getHostTime(&timestampClock, frames[i].timestamp) : 0;
+    }
+
+    return count;
+}
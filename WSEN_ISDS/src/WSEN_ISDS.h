@@ -32,7 +32,8 @@ class Sensor_ISDS
 {
 
 public:
-    int init(int address);
+    int init(int address, void *handle = NULL, const WE_transport_t *transport = NULL);
+    WE_sensorInterface_t *get_Interface();
     int get_DeviceID();
 	
     int power_down();
@@ -40,6 +41,7 @@ public:
 	
     int select_ODR(int ODR);
     int set_Mode(int mode);
+    int set_Rates(ISDS_ratePlan_t *plan);
 
     int is_ACC_Ready_To_Read();
     int is_Gyro_Ready_To_Read();
@@ -58,8 +60,23 @@ public:
 	int get_accelerations(int16_t *X, int16_t *Y, int16_t *Z);
     int get_angular_rates(int32_t *X, int32_t *Y, int32_t *Z);
     int get_temperature(float *temp);
+    int get_Sample(ISDS_sample_t *sample);
+
+    int read_FIFO_frames(ISDS_fifoFrame_t *frames, int maxFrames);
+    int read_FIFO_frames(ISDS_fifoFrame_t *frames, uint32_t *times, int maxFrames);
+
+    int start_Timestamps(ISDS_timestampResolution_t resolution = ISDS_timestampResolution25mus);
+    int sync_Timestamps();
 
 private:
+    WE_sensorInterface_t sensorInterface;
+    WE_registerCache_t registerCache;
+    uint8_t cacheValues[ISDS_CACHED_REGISTERS];
+    ISDS_fifoDecoder_t fifoDecoder;
+    ISDS_timestampClock_t timestampClock;
+
+    int configure_Mode(int mode);
+    int configure_Rates(const ISDS_ratePlan_t *plan);
 };
 
 #endif
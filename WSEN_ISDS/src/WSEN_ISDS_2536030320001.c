@@ -32,33 +32,43 @@
 
 #include <stdio.h>
 
-/**
- * @brief Stores the current value of the accelerometer full scale parameter.
- * The value is updated when calling ISDS_setAccFullScale() or
- * ISDS_getAccFullScale().
- *
- */
-static ISDS_accFullScale_t currentAccFullScale = ISDS_accFullScaleTwoG;
 
 /**
- * @brief Stores the current value of the gyroscope full scale parameter.
- * The value is updated when calling ISDS_setGyroFullScale() or
- * ISDS_getGyroFullScale().
- *
- */
-static ISDS_gyroFullScale_t currentGyroFullScale = ISDS_gyroFullScale250dps;
+ * @brief Registers held in the register cache of the sensor interface:
+ * FIFO, interrupt and control registers.
+ */
+const WE_cachedRegister_t ISDS_cachedRegisters[ISDS_CACHED_REGISTERS] = {
+  { ISDS_FIFO_CTRL_1_REG, 0, 0 },
+  { ISDS_FIFO_CTRL_2_REG, 0, 0 },
+  { ISDS_FIFO_CTRL_3_REG, 0, 0 },
+  { ISDS_FIFO_CTRL_4_REG, 0, 0 },
+  { ISDS_FIFO_CTRL_5_REG, 0, 0 },
+  { ISDS_INT0_CTRL_REG, 0, 0 },
+  { ISDS_INT1_CTRL_REG, 0, 0 },
+  { ISDS_CTRL_1_REG, 0, 0 },
+  { ISDS_CTRL_2_REG, 0, 0 },
+  { ISDS_CTRL_3_REG, 0, 0x81 },   /* BOOT, SW_RESET */
+  { ISDS_CTRL_4_REG, 0, 0 },
+  { ISDS_CTRL_5_REG, 0, 0 },
+  { ISDS_CTRL_6_REG, 0, 0 },
+  { ISDS_CTRL_7_REG, 0, 0 },
+  { ISDS_CTRL_8_REG, 0, 0 },
+  { ISDS_CTRL_9_REG, 0, 0 },
+  { ISDS_CTRL_10_REG, 0, 0 }
+};
 
 /**
  * @brief Read the device ID
  *
  * Expected value is ISDS_DEVICE_ID_VALUE.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] deviceID The returned device ID.
  * @retval Error code
  */
-int8_t ISDS_getDeviceID(uint8_t *deviceID)
+int8_t ISDS_getDeviceID(WE_sensorInterface_t *sensorInterface, uint8_t *deviceID)
 {
-  return ReadReg(ISDS_DEVICE_ID_REG, 1, deviceID);
+  return ReadReg(sensorInterface, ISDS_DEVICE_ID_REG, 1, deviceID);
 }
 
 
@@ -67,15 +77,16 @@ int8_t ISDS_getDeviceID(uint8_t *deviceID)
 
 /**
  * @brief Set the FIFO threshold of the sensor
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] threshold FIFO threshold (value between 0 and 127)
  * @retval Error code
  */
-int8_t ISDS_setFifoThreshold(uint16_t threshold)
+int8_t ISDS_setFifoThreshold(WE_sensorInterface_t *sensorInterface, uint16_t threshold)
 {
   ISDS_fifoCtrl1_t fifoCtrl1;
   ISDS_fifoCtrl2_t fifoCtrl2;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2))
   {
     return WE_FAIL;
   }
@@ -83,28 +94,29 @@ int8_t ISDS_setFifoThreshold(uint16_t threshold)
   fifoCtrl1.fifoThresholdLsb = (uint8_t) (threshold & 0xFF);
   fifoCtrl2.fifoThresholdMsb = (uint8_t) ((threshold >> 8) & 0x07);
 
-  if (WE_FAIL == WriteReg(ISDS_FIFO_CTRL_1_REG, 1, (uint8_t *) &fifoCtrl1))
+  if (WE_FAIL == WriteReg(sensorInterface, ISDS_FIFO_CTRL_1_REG, 1, (uint8_t *) &fifoCtrl1))
   {
     return WE_FAIL;
   }
-  return WriteReg(ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2);
+  return WriteReg(sensorInterface, ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2);
 }
 
 /**
  * @brief Read the FIFO threshold of the sensor
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] threshold The returned FIFO threshold
  * @retval Error code
  */
-int8_t ISDS_getFifoThreshold(uint16_t *threshold)
+int8_t ISDS_getFifoThreshold(WE_sensorInterface_t *sensorInterface, uint16_t *threshold)
 {
   ISDS_fifoCtrl1_t fifoCtrl1;
   ISDS_fifoCtrl2_t fifoCtrl2;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_1_REG, 1, (uint8_t *) &fifoCtrl1))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_1_REG, 1, (uint8_t *) &fifoCtrl1))
   {
     return WE_FAIL;
   }
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2))
   {
     return WE_FAIL;
   }
@@ -117,33 +129,35 @@ int8_t ISDS_getFifoThreshold(uint16_t *threshold)
 
 /**
  * @brief Enable storage of temperature data in FIFO.
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] fifoTemp The storage of temperature data in FIFO enable state
  * @retval Error code
  */
-int8_t ISDS_enableFifoTemperature(ISDS_state_t fifoTemp)
+int8_t ISDS_enableFifoTemperature(WE_sensorInterface_t *sensorInterface, ISDS_state_t fifoTemp)
 {
   ISDS_fifoCtrl2_t fifoCtrl2;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2))
   {
     return WE_FAIL;
   }
 
   fifoCtrl2.enFifoTemperature = fifoTemp;
 
-  return WriteReg(ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2);
+  return WriteReg(sensorInterface, ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2);
 }
 
 /**
  * @brief Check if storage of temperature data in FIFO is enabled.
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] fifoTemp The returned storage of temperature data in FIFO enable state
  * @retval Error code
  */
-int8_t ISDS_isFifoTemperatureEnabled(ISDS_state_t *fifoTemp)
+int8_t ISDS_isFifoTemperatureEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *fifoTemp)
 {
   ISDS_fifoCtrl2_t fifoCtrl2;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2))
   {
     return WE_FAIL;
   }
@@ -155,33 +169,35 @@ int8_t ISDS_isFifoTemperatureEnabled(ISDS_state_t *fifoTemp)
 
 /**
  * @brief Enable storage of timestamp data in FIFO.
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] fifoTimestamp The storage of timestamp data in FIFO enable state
  * @retval Error code
  */
-int8_t ISDS_enableFifoTimestamp(ISDS_state_t fifoTimestamp)
+int8_t ISDS_enableFifoTimestamp(WE_sensorInterface_t *sensorInterface, ISDS_state_t fifoTimestamp)
 {
   ISDS_fifoCtrl2_t fifoCtrl2;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2))
   {
     return WE_FAIL;
   }
 
   fifoCtrl2.enFifoTimestamp = fifoTimestamp;
 
-  return WriteReg(ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2);
+  return WriteReg(sensorInterface, ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2);
 }
 
 /**
  * @brief Check if storage of timestamp data in FIFO is enabled.
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] fifoTimestamp The returned storage of timestamp data in FIFO enable state
  * @retval Error code
  */
-int8_t ISDS_isFifoTimestampEnabled(ISDS_state_t *fifoTimestamp)
+int8_t ISDS_isFifoTimestampEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *fifoTimestamp)
 {
   ISDS_fifoCtrl2_t fifoCtrl2;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_2_REG, 1, (uint8_t *) &fifoCtrl2))
   {
     return WE_FAIL;
   }
@@ -196,33 +212,35 @@ int8_t ISDS_isFifoTimestampEnabled(ISDS_state_t *fifoTimestamp)
 
 /**
  * @brief Set decimation of acceleration data in FIFO (second data set in FIFO)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] decimation FIFO acceleration data decimation setting
  * @retval Error code
  */
-int8_t ISDS_setFifoAccDecimation(ISDS_fifoDecimation_t decimation)
+int8_t ISDS_setFifoAccDecimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t decimation)
 {
   ISDS_fifoCtrl3_t fifoCtrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_3_REG, 1, (uint8_t *) &fifoCtrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_3_REG, 1, (uint8_t *) &fifoCtrl3))
   {
     return WE_FAIL;
   }
 
   fifoCtrl3.fifoAccDecimation = (uint8_t) decimation;
 
-  return WriteReg(ISDS_FIFO_CTRL_3_REG, 1, (uint8_t *) &fifoCtrl3);
+  return WriteReg(sensorInterface, ISDS_FIFO_CTRL_3_REG, 1, (uint8_t *) &fifoCtrl3);
 }
 
 /**
  * @brief Read decimation of acceleration data in FIFO (second data set in FIFO) setting
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] decimation The returned FIFO acceleration data decimation setting
  * @retval Error code
  */
-int8_t ISDS_getFifoAccDecimation(ISDS_fifoDecimation_t *decimation)
+int8_t ISDS_getFifoAccDecimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t *decimation)
 {
   ISDS_fifoCtrl3_t fifoCtrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_3_REG, 1, (uint8_t *) &fifoCtrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_3_REG, 1, (uint8_t *) &fifoCtrl3))
   {
     return WE_FAIL;
   }
@@ -234,33 +252,35 @@ int8_t ISDS_getFifoAccDecimation(ISDS_fifoDecimation_t *decimation)
 
 /**
  * @brief Set decimation of gyroscope data in FIFO (first data set in FIFO)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] decimation FIFO gyroscope data decimation setting
  * @retval Error code
  */
-int8_t ISDS_setFifoGyroDecimation(ISDS_fifoDecimation_t decimation)
+int8_t ISDS_setFifoGyroDecimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t decimation)
 {
   ISDS_fifoCtrl3_t fifoCtrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_3_REG, 1, (uint8_t *) &fifoCtrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_3_REG, 1, (uint8_t *) &fifoCtrl3))
   {
     return WE_FAIL;
   }
 
   fifoCtrl3.fifoGyroDecimation = (uint8_t) decimation;
 
-  return WriteReg(ISDS_FIFO_CTRL_3_REG, 1, (uint8_t *) &fifoCtrl3);
+  return WriteReg(sensorInterface, ISDS_FIFO_CTRL_3_REG, 1, (uint8_t *) &fifoCtrl3);
 }
 
 /**
  * @brief Read decimation of gyroscope data in FIFO (first data set in FIFO) setting
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] decimation The returned FIFO gyroscope data decimation setting
  * @retval Error code
  */
-int8_t ISDS_getFifoGyroDecimation(ISDS_fifoDecimation_t *decimation)
+int8_t ISDS_getFifoGyroDecimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t *decimation)
 {
   ISDS_fifoCtrl3_t fifoCtrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_3_REG, 1, (uint8_t *) &fifoCtrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_3_REG, 1, (uint8_t *) &fifoCtrl3))
   {
     return WE_FAIL;
   }
@@ -275,33 +295,35 @@ int8_t ISDS_getFifoGyroDecimation(ISDS_fifoDecimation_t *decimation)
 
 /**
  * @brief Set decimation of third data set in FIFO
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] decimation FIFO third data set decimation setting
  * @retval Error code
  */
-int8_t ISDS_setFifoDataset3Decimation(ISDS_fifoDecimation_t decimation)
+int8_t ISDS_setFifoDataset3Decimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t decimation)
 {
   ISDS_fifoCtrl4_t fifoCtrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
   {
     return WE_FAIL;
   }
 
   fifoCtrl4.fifoThirdDecimation = (uint8_t) decimation;
 
-  return WriteReg(ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4);
+  return WriteReg(sensorInterface, ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4);
 }
 
 /**
  * @brief Read decimation of third data set in FIFO setting
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] decimation The returned FIFO third data set decimation setting
  * @retval Error code
  */
-int8_t ISDS_getFifoDataset3Decimation(ISDS_fifoDecimation_t *decimation)
+int8_t ISDS_getFifoDataset3Decimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t *decimation)
 {
   ISDS_fifoCtrl4_t fifoCtrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
   {
     return WE_FAIL;
   }
@@ -313,33 +335,35 @@ int8_t ISDS_getFifoDataset3Decimation(ISDS_fifoDecimation_t *decimation)
 
 /**
  * @brief Set decimation of fourth data set in FIFO
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] decimation FIFO fourth data set decimation setting
  * @retval Error code
  */
-int8_t ISDS_setFifoDataset4Decimation(ISDS_fifoDecimation_t decimation)
+int8_t ISDS_setFifoDataset4Decimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t decimation)
 {
   ISDS_fifoCtrl4_t fifoCtrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
   {
     return WE_FAIL;
   }
 
   fifoCtrl4.fifoFourthDecimation = (uint8_t) decimation;
 
-  return WriteReg(ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4);
+  return WriteReg(sensorInterface, ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4);
 }
 
 /**
  * @brief Read decimation of fourth data set in FIFO setting
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] decimation The returned FIFO fourth data set decimation setting
  * @retval Error code
  */
-int8_t ISDS_getFifoDataset4Decimation(ISDS_fifoDecimation_t *decimation)
+int8_t ISDS_getFifoDataset4Decimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t *decimation)
 {
   ISDS_fifoCtrl4_t fifoCtrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
   {
     return WE_FAIL;
   }
@@ -351,33 +375,35 @@ int8_t ISDS_getFifoDataset4Decimation(ISDS_fifoDecimation_t *decimation)
 
 /**
  * @brief Enable storage of MSB only (8-bit) in FIFO
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] onlyHighData MSB only enable state
  * @retval Error code
  */
-int8_t ISDS_enableFifoOnlyHighData(ISDS_state_t onlyHighData)
+int8_t ISDS_enableFifoOnlyHighData(WE_sensorInterface_t *sensorInterface, ISDS_state_t onlyHighData)
 {
   ISDS_fifoCtrl4_t fifoCtrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
   {
     return WE_FAIL;
   }
 
   fifoCtrl4.enOnlyHighData = onlyHighData;
 
-  return WriteReg(ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4);
+  return WriteReg(sensorInterface, ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4);
 }
 
 /**
  * @brief Check if storage of MSB only (8-bit) in FIFO is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] onlyHighData The returned MSB only enable state
  * @retval Error code
  */
-int8_t ISDS_isFifoOnlyHighDataEnabled(ISDS_state_t *onlyHighData)
+int8_t ISDS_isFifoOnlyHighDataEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *onlyHighData)
 {
   ISDS_fifoCtrl4_t fifoCtrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
   {
     return WE_FAIL;
   }
@@ -389,33 +415,35 @@ int8_t ISDS_isFifoOnlyHighDataEnabled(ISDS_state_t *onlyHighData)
 
 /**
  * @brief Enable stop when FIFO threshold is reached
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] stopOnThreshold FIFO stop on threshold enable state
  * @retval Error code
  */
-int8_t ISDS_enableFifoStopOnThreshold(ISDS_state_t stopOnThreshold)
+int8_t ISDS_enableFifoStopOnThreshold(WE_sensorInterface_t *sensorInterface, ISDS_state_t stopOnThreshold)
 {
   ISDS_fifoCtrl4_t fifoCtrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
   {
     return WE_FAIL;
   }
 
   fifoCtrl4.enStopOnThreshold = stopOnThreshold;
 
-  return WriteReg(ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4);
+  return WriteReg(sensorInterface, ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4);
 }
 
 /**
  * @brief Check if stop when FIFO threshold is reached is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] stopOnThreshold The returned FIFO stop on threshold enable state
  * @retval Error code
  */
-int8_t ISDS_isFifoStopOnThresholdEnabled(ISDS_state_t *stopOnThreshold)
+int8_t ISDS_isFifoStopOnThresholdEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *stopOnThreshold)
 {
   ISDS_fifoCtrl4_t fifoCtrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_4_REG, 1, (uint8_t *) &fifoCtrl4))
   {
     return WE_FAIL;
   }
@@ -430,33 +458,35 @@ int8_t ISDS_isFifoStopOnThresholdEnabled(ISDS_state_t *stopOnThreshold)
 
 /**
  * @brief Set the FIFO mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] fifoMode FIFO mode
  * @retval Error code
  */
-int8_t ISDS_setFifoMode(ISDS_fifoMode_t fifoMode)
+int8_t ISDS_setFifoMode(WE_sensorInterface_t *sensorInterface, ISDS_fifoMode_t fifoMode)
 {
   ISDS_fifoCtrl5_t fifoCtrl5;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_5_REG, 1, (uint8_t *) &fifoCtrl5))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_5_REG, 1, (uint8_t *) &fifoCtrl5))
   {
     return WE_FAIL;
   }
 
   fifoCtrl5.fifoMode = (uint8_t) fifoMode;
 
-  return WriteReg(ISDS_FIFO_CTRL_5_REG, 1, (uint8_t *) &fifoCtrl5);
+  return WriteReg(sensorInterface, ISDS_FIFO_CTRL_5_REG, 1, (uint8_t *) &fifoCtrl5);
 }
 
 /**
  * @brief Read the FIFO mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] fifoMode The returned FIFO mode
  * @retval Error code
  */
-int8_t ISDS_getFifoMode(ISDS_fifoMode_t *fifoMode)
+int8_t ISDS_getFifoMode(WE_sensorInterface_t *sensorInterface, ISDS_fifoMode_t *fifoMode)
 {
   ISDS_fifoCtrl5_t fifoCtrl5;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_5_REG, 1, (uint8_t *) &fifoCtrl5))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_5_REG, 1, (uint8_t *) &fifoCtrl5))
   {
     return WE_FAIL;
   }
@@ -468,33 +498,35 @@ int8_t ISDS_getFifoMode(ISDS_fifoMode_t *fifoMode)
 
 /**
  * @brief Set the FIFO output data rate
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] fifoOdr FIFO output data rate
  * @retval Error code
  */
-int8_t ISDS_setFifoOutputDataRate(ISDS_fifoOutputDataRate_t fifoOdr)
+int8_t ISDS_setFifoOutputDataRate(WE_sensorInterface_t *sensorInterface, ISDS_fifoOutputDataRate_t fifoOdr)
 {
   ISDS_fifoCtrl5_t fifoCtrl5;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_5_REG, 1, (uint8_t *) &fifoCtrl5))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_5_REG, 1, (uint8_t *) &fifoCtrl5))
   {
     return WE_FAIL;
   }
 
   fifoCtrl5.fifoOdr = (uint8_t) fifoOdr;
 
-  return WriteReg(ISDS_FIFO_CTRL_5_REG, 1, (uint8_t *) &fifoCtrl5);
+  return WriteReg(sensorInterface, ISDS_FIFO_CTRL_5_REG, 1, (uint8_t *) &fifoCtrl5);
 }
 
 /**
  * @brief Read the FIFO output data rate
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] fifoOdr The returned FIFO output data rate
  * @retval Error code
  */
-int8_t ISDS_getFifoOutputDataRate(ISDS_fifoOutputDataRate_t *fifoOdr)
+int8_t ISDS_getFifoOutputDataRate(WE_sensorInterface_t *sensorInterface, ISDS_fifoOutputDataRate_t *fifoOdr)
 {
   ISDS_fifoCtrl5_t fifoCtrl5;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_CTRL_5_REG, 1, (uint8_t *) &fifoCtrl5))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_5_REG, 1, (uint8_t *) &fifoCtrl5))
   {
     return WE_FAIL;
   }
@@ -509,33 +541,35 @@ int8_t ISDS_getFifoOutputDataRate(ISDS_fifoOutputDataRate_t *fifoOdr)
 
 /**
  * @brief Enable pulsed data ready mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] dataReadyPulsed Data ready pulsed mode enable state
  * @retval Error code
  */
-int8_t ISDS_enableDataReadyPulsed(ISDS_state_t dataReadyPulsed)
+int8_t ISDS_enableDataReadyPulsed(WE_sensorInterface_t *sensorInterface, ISDS_state_t dataReadyPulsed)
 {
   ISDS_dataReadyPulseCfg_t dataReadyPulseCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_DRDY_PULSE_CFG_REG, 1, (uint8_t *) &dataReadyPulseCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_DRDY_PULSE_CFG_REG, 1, (uint8_t *) &dataReadyPulseCfg))
   {
     return WE_FAIL;
   }
 
   dataReadyPulseCfg.enDataReadyPulsed = (uint8_t) dataReadyPulsed;
 
-  return WriteReg(ISDS_DRDY_PULSE_CFG_REG, 1, (uint8_t *) &dataReadyPulseCfg);
+  return WriteReg(sensorInterface, ISDS_DRDY_PULSE_CFG_REG, 1, (uint8_t *) &dataReadyPulseCfg);
 }
 
 /**
  * @brief Check if pulsed data ready mode is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] dataReadyPulsed The returned data ready pulsed mode enable state
  * @retval Error code
  */
-int8_t ISDS_isDataReadyPulsedEnabled(ISDS_state_t *dataReadyPulsed)
+int8_t ISDS_isDataReadyPulsedEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *dataReadyPulsed)
 {
   ISDS_dataReadyPulseCfg_t dataReadyPulseCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_DRDY_PULSE_CFG_REG, 1, (uint8_t *) &dataReadyPulseCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_DRDY_PULSE_CFG_REG, 1, (uint8_t *) &dataReadyPulseCfg))
   {
     return WE_FAIL;
   }
@@ -550,33 +584,35 @@ int8_t ISDS_isDataReadyPulsedEnabled(ISDS_state_t *dataReadyPulsed)
 
 /**
  * @brief Enable/disable the acceleration data ready interrupt on INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int0AccDataReady Acceleration data ready interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableAccDataReadyINT0(ISDS_state_t int0AccDataReady)
+int8_t ISDS_enableAccDataReadyINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0AccDataReady)
 {
   ISDS_int0Ctrl_t int0Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
   {
     return WE_FAIL;
   }
 
   int0Ctrl.int0AccDataReady = (uint8_t) int0AccDataReady;
 
-  return WriteReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl);
+  return WriteReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl);
 }
 
 /**
  * @brief Check if the acceleration data ready interrupt on INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int0AccDataReady The returned acceleration data ready interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isAccDataReadyINT0Enabled(ISDS_state_t *int0AccDataReady)
+int8_t ISDS_isAccDataReadyINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0AccDataReady)
 {
   ISDS_int0Ctrl_t int0Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
   {
     return WE_FAIL;
   }
@@ -588,33 +624,35 @@ int8_t ISDS_isAccDataReadyINT0Enabled(ISDS_state_t *int0AccDataReady)
 
 /**
  * @brief Enable/disable the gyroscope data ready interrupt on INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int0GyroDataReady Gyroscope data ready interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableGyroDataReadyINT0(ISDS_state_t int0GyroDataReady)
+int8_t ISDS_enableGyroDataReadyINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0GyroDataReady)
 {
   ISDS_int0Ctrl_t int0Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
   {
     return WE_FAIL;
   }
 
   int0Ctrl.int0GyroDataReady = (uint8_t) int0GyroDataReady;
 
-  return WriteReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl);
+  return WriteReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl);
 }
 
 /**
  * @brief Check if the gyroscope data ready interrupt on INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int0GyroDataReady The returned gyroscope data ready interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isGyroDataReadyINT0Enabled(ISDS_state_t *int0GyroDataReady)
+int8_t ISDS_isGyroDataReadyINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0GyroDataReady)
 {
   ISDS_int0Ctrl_t int0Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
   {
     return WE_FAIL;
   }
@@ -626,33 +664,35 @@ int8_t ISDS_isGyroDataReadyINT0Enabled(ISDS_state_t *int0GyroDataReady)
 
 /**
  * @brief Enable/disable the boot status interrupt on INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int0BootStatus Boot status interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableBootStatusINT0(ISDS_state_t int0BootStatus)
+int8_t ISDS_enableBootStatusINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0BootStatus)
 {
   ISDS_int0Ctrl_t int0Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
   {
     return WE_FAIL;
   }
 
   int0Ctrl.int0Boot = (uint8_t) int0BootStatus;
 
-  return WriteReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl);
+  return WriteReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl);
 }
 
 /**
  * @brief Check if the boot status interrupt on INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int0BootStatus The returned boot status interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isBootStatusINT0Enabled(ISDS_state_t *int0BootStatus)
+int8_t ISDS_isBootStatusINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0BootStatus)
 {
   ISDS_int0Ctrl_t int0Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
   {
     return WE_FAIL;
   }
@@ -664,33 +704,35 @@ int8_t ISDS_isBootStatusINT0Enabled(ISDS_state_t *int0BootStatus)
 
 /**
  * @brief Enable/disable the FIFO threshold reached interrupt on INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int0FifoThreshold FIFO threshold reached interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableFifoThresholdINT0(ISDS_state_t int0FifoThreshold)
+int8_t ISDS_enableFifoThresholdINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0FifoThreshold)
 {
   ISDS_int0Ctrl_t int0Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
   {
     return WE_FAIL;
   }
 
   int0Ctrl.int0FifoThreshold = (uint8_t) int0FifoThreshold;
 
-  return WriteReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl);
+  return WriteReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl);
 }
 
 /**
  * @brief Check if the FIFO threshold reached interrupt on INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int0FifoThreshold The returned FIFO threshold reached interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isFifoThresholdINT0Enabled(ISDS_state_t *int0FifoThreshold)
+int8_t ISDS_isFifoThresholdINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0FifoThreshold)
 {
   ISDS_int0Ctrl_t int0Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
   {
     return WE_FAIL;
   }
@@ -702,33 +744,35 @@ int8_t ISDS_isFifoThresholdINT0Enabled(ISDS_state_t *int0FifoThreshold)
 
 /**
  * @brief Enable/disable the FIFO overrun interrupt on INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int0FifoOverrun FIFO overrun interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableFifoOverrunINT0(ISDS_state_t int0FifoOverrun)
+int8_t ISDS_enableFifoOverrunINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0FifoOverrun)
 {
   ISDS_int0Ctrl_t int0Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
   {
     return WE_FAIL;
   }
 
   int0Ctrl.int0FifoOverrun = (uint8_t) int0FifoOverrun;
 
-  return WriteReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl);
+  return WriteReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl);
 }
 
 /**
  * @brief Check if the FIFO overrun interrupt on INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int0FifoOverrun The returned FIFO overrun interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isFifoOverrunINT0Enabled(ISDS_state_t *int0FifoOverrun)
+int8_t ISDS_isFifoOverrunINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0FifoOverrun)
 {
   ISDS_int0Ctrl_t int0Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
   {
     return WE_FAIL;
   }
@@ -740,33 +784,35 @@ int8_t ISDS_isFifoOverrunINT0Enabled(ISDS_state_t *int0FifoOverrun)
 
 /**
  * @brief Enable/disable the FIFO full interrupt on INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int0FifoFull FIFO full interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableFifoFullINT0(ISDS_state_t int0FifoFull)
+int8_t ISDS_enableFifoFullINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0FifoFull)
 {
   ISDS_int0Ctrl_t int0Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
   {
     return WE_FAIL;
   }
 
   int0Ctrl.int0FifoFull = (uint8_t) int0FifoFull;
 
-  return WriteReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl);
+  return WriteReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl);
 }
 
 /**
  * @brief Check if the FIFO full interrupt on INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int0FifoFull The returned FIFO full interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isFifoFullINT0Enabled(ISDS_state_t *int0FifoFull)
+int8_t ISDS_isFifoFullINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0FifoFull)
 {
   ISDS_int0Ctrl_t int0Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT0_CTRL_REG, 1, (uint8_t *) &int0Ctrl))
   {
     return WE_FAIL;
   }
@@ -781,33 +827,35 @@ int8_t ISDS_isFifoFullINT0Enabled(ISDS_state_t *int0FifoFull)
 
 /**
  * @brief Enable/disable the acceleration data ready interrupt on INT_1
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int1AccDataReady Acceleration data ready interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableAccDataReadyINT1(ISDS_state_t int1AccDataReady)
+int8_t ISDS_enableAccDataReadyINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1AccDataReady)
 {
   ISDS_int1Ctrl_t int1Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
   {
     return WE_FAIL;
   }
 
   int1Ctrl.int1AccDataReady = (uint8_t) int1AccDataReady;
 
-  return WriteReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl);
+  return WriteReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl);
 }
 
 /**
  * @brief Check if the acceleration data ready interrupt on INT_1 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int1AccDataReady The returned acceleration data ready interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isAccDataReadyINT1Enabled(ISDS_state_t *int1AccDataReady)
+int8_t ISDS_isAccDataReadyINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1AccDataReady)
 {
   ISDS_int1Ctrl_t int1Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
   {
     return WE_FAIL;
   }
@@ -819,33 +867,35 @@ int8_t ISDS_isAccDataReadyINT1Enabled(ISDS_state_t *int1AccDataReady)
 
 /**
  * @brief Enable/disable the gyroscope data ready interrupt on INT_1
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int1GyroDataReady Gyroscope data ready interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableGyroDataReadyINT1(ISDS_state_t int1GyroDataReady)
+int8_t ISDS_enableGyroDataReadyINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1GyroDataReady)
 {
   ISDS_int1Ctrl_t int1Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
   {
     return WE_FAIL;
   }
 
   int1Ctrl.int1GyroDataReady = (uint8_t) int1GyroDataReady;
 
-  return WriteReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl);
+  return WriteReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl);
 }
 
 /**
  * @brief Check if the gyroscope data ready interrupt on INT_1 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int1GyroDataReady The returned gyroscope data ready interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isGyroDataReadyINT1Enabled(ISDS_state_t *int1GyroDataReady)
+int8_t ISDS_isGyroDataReadyINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1GyroDataReady)
 {
   ISDS_int1Ctrl_t int1Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
   {
     return WE_FAIL;
   }
@@ -857,33 +907,35 @@ int8_t ISDS_isGyroDataReadyINT1Enabled(ISDS_state_t *int1GyroDataReady)
 
 /**
  * @brief Enable/disable the temperature data ready interrupt on INT_1
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int1TempDataReady Temperature data ready interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableTemperatureDataReadyINT1(ISDS_state_t int1TempDataReady)
+int8_t ISDS_enableTemperatureDataReadyINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1TempDataReady)
 {
   ISDS_int1Ctrl_t int1Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
   {
     return WE_FAIL;
   }
 
   int1Ctrl.int1TempDataReady = (uint8_t) int1TempDataReady;
 
-  return WriteReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl);
+  return WriteReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl);
 }
 
 /**
  * @brief Check if the temperature data ready interrupt on INT_1 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int1TempDataReady The returned temperature data ready interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isTemperatureDataReadyINT1Enabled(ISDS_state_t *int1TempDataReady)
+int8_t ISDS_isTemperatureDataReadyINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1TempDataReady)
 {
   ISDS_int1Ctrl_t int1Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
   {
     return WE_FAIL;
   }
@@ -895,33 +947,35 @@ int8_t ISDS_isTemperatureDataReadyINT1Enabled(ISDS_state_t *int1TempDataReady)
 
 /**
  * @brief Enable/disable the FIFO threshold reached interrupt on INT_1
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int1FifoThreshold FIFO threshold reached interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableFifoThresholdINT1(ISDS_state_t int1FifoThreshold)
+int8_t ISDS_enableFifoThresholdINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1FifoThreshold)
 {
   ISDS_int1Ctrl_t int1Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
   {
     return WE_FAIL;
   }
 
   int1Ctrl.int1FifoThreshold = (uint8_t) int1FifoThreshold;
 
-  return WriteReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl);
+  return WriteReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl);
 }
 
 /**
  * @brief Check if the FIFO threshold reached interrupt on INT_1 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int1FifoThreshold The returned FIFO threshold reached interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isFifoThresholdINT1Enabled(ISDS_state_t *int1FifoThreshold)
+int8_t ISDS_isFifoThresholdINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1FifoThreshold)
 {
   ISDS_int1Ctrl_t int1Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
   {
     return WE_FAIL;
   }
@@ -933,33 +987,35 @@ int8_t ISDS_isFifoThresholdINT1Enabled(ISDS_state_t *int1FifoThreshold)
 
 /**
  * @brief Enable/disable the FIFO overrun interrupt on INT_1
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int1FifoOverrun FIFO overrun interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableFifoOverrunINT1(ISDS_state_t int1FifoOverrun)
+int8_t ISDS_enableFifoOverrunINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1FifoOverrun)
 {
   ISDS_int1Ctrl_t int1Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
   {
     return WE_FAIL;
   }
 
   int1Ctrl.int1FifoOverrun = (uint8_t) int1FifoOverrun;
 
-  return WriteReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl);
+  return WriteReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl);
 }
 
 /**
  * @brief Check if the FIFO overrun interrupt on INT_1 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int1FifoOverrun The returned FIFO overrun interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isFifoOverrunINT1Enabled(ISDS_state_t *int1FifoOverrun)
+int8_t ISDS_isFifoOverrunINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1FifoOverrun)
 {
   ISDS_int1Ctrl_t int1Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
   {
     return WE_FAIL;
   }
@@ -971,33 +1027,35 @@ int8_t ISDS_isFifoOverrunINT1Enabled(ISDS_state_t *int1FifoOverrun)
 
 /**
  * @brief Enable/disable the FIFO full interrupt on INT_1
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int1FifoFull FIFO full interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableFifoFullINT1(ISDS_state_t int1FifoFull)
+int8_t ISDS_enableFifoFullINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1FifoFull)
 {
   ISDS_int1Ctrl_t int1Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
   {
     return WE_FAIL;
   }
 
   int1Ctrl.int1FifoFull = (uint8_t) int1FifoFull;
 
-  return WriteReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl);
+  return WriteReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl);
 }
 
 /**
  * @brief Check if the FIFO full interrupt on INT_1 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int1FifoFull The returned FIFO full interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isFifoFullINT1Enabled(ISDS_state_t *int1FifoFull)
+int8_t ISDS_isFifoFullINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1FifoFull)
 {
   ISDS_int1Ctrl_t int1Ctrl;
 
-  if (WE_FAIL == ReadReg(ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT1_CTRL_REG, 1, (uint8_t *) &int1Ctrl))
   {
     return WE_FAIL;
   }
@@ -1015,33 +1073,35 @@ int8_t ISDS_isFifoFullINT1Enabled(ISDS_state_t *int1FifoFull)
 
 /**
  * @brief Set the accelerometer analog chain bandwidth
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] bandwidth Accelerometer analog chain bandwidth
  * @retval Error code
  */
-int8_t ISDS_setAccAnalogChainBandwidth(ISDS_accAnalogChainBandwidth_t bandwidth)
+int8_t ISDS_setAccAnalogChainBandwidth(WE_sensorInterface_t *sensorInterface, ISDS_accAnalogChainBandwidth_t bandwidth)
 {
   ISDS_ctrl1_t ctrl1;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
   {
     return WE_FAIL;
   }
 
   ctrl1.accAnalogBandwidth = bandwidth;
 
-  return WriteReg(ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1);
+  return WriteReg(sensorInterface, ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1);
 }
 
 /**
  * @brief Read the accelerometer analog chain bandwidth
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] bandwidth The returned accelerometer analog chain bandwidth
  * @retval Error code
  */
-int8_t ISDS_getAccAnalogChainBandwidth(ISDS_accAnalogChainBandwidth_t *bandwidth)
+int8_t ISDS_getAccAnalogChainBandwidth(WE_sensorInterface_t *sensorInterface, ISDS_accAnalogChainBandwidth_t *bandwidth)
 {
   ISDS_ctrl1_t ctrl1;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
   {
     return WE_FAIL;
   }
@@ -1053,33 +1113,35 @@ int8_t ISDS_getAccAnalogChainBandwidth(ISDS_accAnalogChainBandwidth_t *bandwidth
 
 /**
  * @brief Set the accelerometer digital LPF (LPF1) bandwidth
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] bandwidth Accelerometer digital LPF (LPF1) bandwidth
  * @retval Error code
  */
-int8_t ISDS_setAccDigitalLpfBandwidth(ISDS_accDigitalLpfBandwidth_t bandwidth)
+int8_t ISDS_setAccDigitalLpfBandwidth(WE_sensorInterface_t *sensorInterface, ISDS_accDigitalLpfBandwidth_t bandwidth)
 {
   ISDS_ctrl1_t ctrl1;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
   {
     return WE_FAIL;
   }
 
   ctrl1.accDigitalBandwidth = bandwidth;
 
-  return WriteReg(ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1);
+  return WriteReg(sensorInterface, ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1);
 }
 
 /**
  * @brief Read the accelerometer digital LPF (LPF1) bandwidth
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] bandwidth The returned accelerometer digital LPF (LPF1) bandwidth
  * @retval Error code
  */
-int8_t ISDS_getAccDigitalLpfBandwidth(ISDS_accDigitalLpfBandwidth_t *bandwidth)
+int8_t ISDS_getAccDigitalLpfBandwidth(WE_sensorInterface_t *sensorInterface, ISDS_accDigitalLpfBandwidth_t *bandwidth)
 {
   ISDS_ctrl1_t ctrl1;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
   {
     return WE_FAIL;
   }
@@ -1091,82 +1153,75 @@ int8_t ISDS_getAccDigitalLpfBandwidth(ISDS_accDigitalLpfBandwidth_t *bandwidth)
 
 /**
  * @brief Set the accelerometer full scale
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] fullScale Accelerometer full scale
  * @retval Error code
  */
-int8_t ISDS_setAccFullScale(ISDS_accFullScale_t fullScale)
+int8_t ISDS_setAccFullScale(WE_sensorInterface_t *sensorInterface, ISDS_accFullScale_t fullScale)
 {
   ISDS_ctrl1_t ctrl1;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
   {
     return WE_FAIL;
   }
 
   ctrl1.accFullScale = fullScale;
 
-  int8_t errCode = WriteReg(ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1);
-
-  /* Store current full scale value to allow convenient conversion of sensor readings */
-  if (WE_SUCCESS == errCode)
-  {
-    currentAccFullScale = fullScale;
-  }
-
-  return errCode;
+  return WriteReg(sensorInterface, ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1);
 }
 
 /**
  * @brief Read the accelerometer full scale
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] fullScale The returned accelerometer full scale
  * @retval Error code
  */
-int8_t ISDS_getAccFullScale(ISDS_accFullScale_t *fullScale)
+int8_t ISDS_getAccFullScale(WE_sensorInterface_t *sensorInterface, ISDS_accFullScale_t *fullScale)
 {
   ISDS_ctrl1_t ctrl1;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
   {
     return WE_FAIL;
   }
 
   *fullScale = (ISDS_accFullScale_t) ctrl1.accFullScale;
 
-  /* Store current full scale value to allow convenient conversion of sensor readings */
-  currentAccFullScale = *fullScale;
-
   return WE_SUCCESS;
 }
 
 /**
  * @brief Set the accelerometer output data rate
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] odr Output data rate
  * @retval Error code
  */
-int8_t ISDS_setAccOutputDataRate(ISDS_accOutputDataRate_t odr)
+int8_t ISDS_setAccOutputDataRate(WE_sensorInterface_t *sensorInterface, ISDS_accOutputDataRate_t odr)
 {
   ISDS_ctrl1_t ctrl1;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
   {
     return WE_FAIL;
   }
 
   ctrl1.accOutputDataRate = odr;
 
-  return WriteReg(ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1);
+  return WriteReg(sensorInterface, ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1);
 }
 
 /**
  * @brief Read the accelerometer output data rate
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] odr The returned output data rate
  * @retval Error code
  */
-int8_t ISDS_getAccOutputDataRate(ISDS_accOutputDataRate_t *odr)
+int8_t ISDS_getAccOutputDataRate(WE_sensorInterface_t *sensorInterface, ISDS_accOutputDataRate_t *odr)
 {
   ISDS_ctrl1_t ctrl1;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1))
   {
     return WE_FAIL;
   }
@@ -1181,82 +1236,75 @@ int8_t ISDS_getAccOutputDataRate(ISDS_accOutputDataRate_t *odr)
 
 /**
  * @brief Set the gyroscope full scale
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] fullScale gyroscope full scale
  * @retval Error code
  */
-int8_t ISDS_setGyroFullScale(ISDS_gyroFullScale_t fullScale)
+int8_t ISDS_setGyroFullScale(WE_sensorInterface_t *sensorInterface, ISDS_gyroFullScale_t fullScale)
 {
   ISDS_ctrl2_t ctrl2;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_2_REG, 1, (uint8_t *) &ctrl2))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_2_REG, 1, (uint8_t *) &ctrl2))
   {
     return WE_FAIL;
   }
 
   ctrl2.gyroFullScale = fullScale;
 
-  int8_t errCode = WriteReg(ISDS_CTRL_2_REG, 1, (uint8_t *) &ctrl2);
-
-  /* Store current full scale value to allow convenient conversion of sensor readings */
-  if (WE_SUCCESS == errCode)
-  {
-    currentGyroFullScale = fullScale;
-  }
-
-  return errCode;
+  return WriteReg(sensorInterface, ISDS_CTRL_2_REG, 1, (uint8_t *) &ctrl2);
 }
 
 /**
  * @brief Read the gyroscope full scale
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] fullScale The returned gyroscope full scale
  * @retval Error code
  */
-int8_t ISDS_getGyroFullScale(ISDS_gyroFullScale_t *fullScale)
+int8_t ISDS_getGyroFullScale(WE_sensorInterface_t *sensorInterface, ISDS_gyroFullScale_t *fullScale)
 {
   ISDS_ctrl2_t ctrl2;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_2_REG, 1, (uint8_t *) &ctrl2))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_2_REG, 1, (uint8_t *) &ctrl2))
   {
     return WE_FAIL;
   }
 
   *fullScale = (ISDS_gyroFullScale_t) ctrl2.gyroFullScale;
 
-  /* Store current full scale value to allow convenient conversion of sensor readings */
-  currentGyroFullScale = *fullScale;
-
   return WE_SUCCESS;
 }
 
 /**
  * @brief Set the gyroscope output data rate
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] odr Output data rate
  * @retval Error code
  */
-int8_t ISDS_setGyroOutputDataRate(ISDS_gyroOutputDataRate_t odr)
+int8_t ISDS_setGyroOutputDataRate(WE_sensorInterface_t *sensorInterface, ISDS_gyroOutputDataRate_t odr)
 {
   ISDS_ctrl2_t ctrl2;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_2_REG, 1, (uint8_t *) &ctrl2))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_2_REG, 1, (uint8_t *) &ctrl2))
   {
     return WE_FAIL;
   }
 
   ctrl2.gyroOutputDataRate = odr;
 
-  return WriteReg(ISDS_CTRL_2_REG, 1, (uint8_t *) &ctrl2);
+  return WriteReg(sensorInterface, ISDS_CTRL_2_REG, 1, (uint8_t *) &ctrl2);
 }
 
 /**
  * @brief Read the gyroscope output data rate
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] odr The returned output data rate.
  * @retval Error code
  */
-int8_t ISDS_getGyroOutputDataRate(ISDS_gyroOutputDataRate_t *odr)
+int8_t ISDS_getGyroOutputDataRate(WE_sensorInterface_t *sensorInterface, ISDS_gyroOutputDataRate_t *odr)
 {
   ISDS_ctrl2_t ctrl2;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_2_REG, 1, (uint8_t *) &ctrl2))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_2_REG, 1, (uint8_t *) &ctrl2))
   {
     return WE_FAIL;
   }
@@ -1271,33 +1319,35 @@ int8_t ISDS_getGyroOutputDataRate(ISDS_gyroOutputDataRate_t *odr)
 
 /**
  * @brief Set software reset [enabled, disabled]
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] swReset Software reset state
  * @retval Error code
  */
-int8_t ISDS_softReset(ISDS_state_t swReset)
+int8_t ISDS_softReset(WE_sensorInterface_t *sensorInterface, ISDS_state_t swReset)
 {
   ISDS_ctrl3_t ctrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
   {
     return WE_FAIL;
   }
 
   ctrl3.softReset = swReset;
 
-  return WriteReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3);
+  return WriteReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3);
 }
 
 /**
  * @brief Read the software reset state [enabled, disabled]
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] swReset The returned software reset state
  * @retval Error code
  */
-int8_t ISDS_getSoftResetState(ISDS_state_t *swReset)
+int8_t ISDS_getSoftResetState(WE_sensorInterface_t *sensorInterface, ISDS_state_t *swReset)
 {
   ISDS_ctrl3_t ctrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
   {
     return WE_FAIL;
   }
@@ -1309,33 +1359,35 @@ int8_t ISDS_getSoftResetState(ISDS_state_t *swReset)
 
 /**
  * @brief Enable/disable auto increment mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] autoIncr Auto increment mode enable state
  * @retval Error code
  */
-int8_t ISDS_enableAutoIncrement(ISDS_state_t autoIncr)
+int8_t ISDS_enableAutoIncrement(WE_sensorInterface_t *sensorInterface, ISDS_state_t autoIncr)
 {
   ISDS_ctrl3_t ctrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
   {
     return WE_FAIL;
   }
 
   ctrl3.autoAddIncr = autoIncr;
 
-  return WriteReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3);
+  return WriteReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3);
 }
 
 /**
  * @brief Read the auto increment mode state
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] autoIncr The returned auto increment mode enable state
  * @retval Error code
  */
-int8_t ISDS_isAutoIncrementEnabled(ISDS_state_t *autoIncr)
+int8_t ISDS_isAutoIncrementEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *autoIncr)
 {
   ISDS_ctrl3_t ctrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
   {
     return WE_FAIL;
   }
@@ -1347,33 +1399,35 @@ int8_t ISDS_isAutoIncrementEnabled(ISDS_state_t *autoIncr)
 
 /**
  * @brief Set the SPI serial interface mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] spiMode SPI serial interface mode
  * @retval Error code
  */
-int8_t ISDS_setSpiMode(ISDS_spiMode_t spiMode)
+int8_t ISDS_setSpiMode(WE_sensorInterface_t *sensorInterface, ISDS_spiMode_t spiMode)
 {
   ISDS_ctrl3_t ctrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
   {
     return WE_FAIL;
   }
 
   ctrl3.spiMode = spiMode;
 
-  return WriteReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3);
+  return WriteReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3);
 }
 
 /**
  * @brief Read the SPI serial interface mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] spiMode The returned SPI serial interface mode
  * @retval Error code
  */
-int8_t ISDS_getSpiMode(ISDS_spiMode_t *spiMode)
+int8_t ISDS_getSpiMode(WE_sensorInterface_t *sensorInterface, ISDS_spiMode_t *spiMode)
 {
   ISDS_ctrl3_t ctrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
   {
     return WE_FAIL;
   }
@@ -1385,109 +1439,115 @@ int8_t ISDS_getSpiMode(ISDS_spiMode_t *spiMode)
 
 /**
  * @brief Set the interrupt pin type [push-pull/open-drain]
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] pinType Interrupt pin type
  * @retval Error code
  */
-int8_t ISDS_setInterruptPinType(ISDS_interruptPinConfig_t pinType)
+int8_t ISDS_setInterruptPinType(WE_sensorInterface_t *sensorInterface, ISDS_interruptPinConfig_t pinType)
 {
   ISDS_ctrl3_t ctrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
   {
     return WE_FAIL;
   }
 
   ctrl3.intPinConf = pinType;
 
-  return WriteReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3);
+  return WriteReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3);
 }
 
 /**
  * @brief Read the interrupt pin type [push-pull/open-drain]
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] pinType The returned interrupt pin type
  * @retval Error code
  */
-int8_t ISDS_getInterruptPinType(ISDS_interruptPinConfig_t *pinType)
+int8_t ISDS_getInterruptPinType(WE_sensorInterface_t *sensorInterface, ISDS_interruptPinConfig_t *pinType)
 {
   ISDS_ctrl3_t ctrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
   {
     return WE_FAIL;
   }
 
-  *pinType = (ISDS_state_t) ctrl3.intPinConf;
+  *pinType = (ISDS_interruptPinConfig_t) ctrl3.intPinConf;
 
   return WE_SUCCESS;
 }
 
 /**
  * @brief Set the interrupt active level [active high/active low]
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] level Interrupt active level
  * @retval Error code
  */
-int8_t ISDS_setInterruptActiveLevel(ISDS_interruptActiveLevel_t level)
+int8_t ISDS_setInterruptActiveLevel(WE_sensorInterface_t *sensorInterface, ISDS_interruptActiveLevel_t level)
 {
   ISDS_ctrl3_t ctrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
   {
     return WE_FAIL;
   }
 
   ctrl3.intActiveLevel = level;
 
-  return WriteReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3);
+  return WriteReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3);
 }
 
 /**
  * @brief Read the interrupt active level
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] level The returned interrupt active level
  * @retval Error code
  */
-int8_t ISDS_getInterruptActiveLevel(ISDS_interruptActiveLevel_t *level)
+int8_t ISDS_getInterruptActiveLevel(WE_sensorInterface_t *sensorInterface, ISDS_interruptActiveLevel_t *level)
 {
   ISDS_ctrl3_t ctrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
   {
     return WE_FAIL;
   }
 
-  *level = (ISDS_state_t) ctrl3.intActiveLevel;
+  *level = (ISDS_interruptActiveLevel_t) ctrl3.intActiveLevel;
 
   return WE_SUCCESS;
 }
 
 /**
  * @brief Enable/disable block data update mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] bdu Block data update enable state
  * @retval Error code
  */
-int8_t ISDS_enableBlockDataUpdate(ISDS_state_t bdu)
+int8_t ISDS_enableBlockDataUpdate(WE_sensorInterface_t *sensorInterface, ISDS_state_t bdu)
 {
   ISDS_ctrl3_t ctrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
   {
     return WE_FAIL;
   }
 
   ctrl3.blockDataUpdate = bdu;
 
-  return WriteReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3);
+  return WriteReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3);
 }
 
 /**
  * @brief Read the block data update state
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] bdu The returned block data update enable state
  * @retval Error code
  */
-int8_t ISDS_isBlockDataUpdateEnabled(ISDS_state_t *bdu)
+int8_t ISDS_isBlockDataUpdateEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *bdu)
 {
   ISDS_ctrl3_t ctrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
   {
     return WE_FAIL;
   }
@@ -1499,33 +1559,35 @@ int8_t ISDS_isBlockDataUpdateEnabled(ISDS_state_t *bdu)
 
 /**
  * @brief (Re)boot the device [enabled, disabled]
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] reboot Reboot state
  * @retval Error code
  */
-int8_t ISDS_reboot(ISDS_state_t reboot)
+int8_t ISDS_reboot(WE_sensorInterface_t *sensorInterface, ISDS_state_t reboot)
 {
   ISDS_ctrl3_t ctrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
   {
     return WE_FAIL;
   }
 
   ctrl3.boot = reboot;
 
-  return WriteReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3);
+  return WriteReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3);
 }
 
 /**
  * @brief Read the reboot state
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] rebooting The returned reboot state
  * @retval Error code
  */
-int8_t ISDS_isRebooting(ISDS_state_t *rebooting)
+int8_t ISDS_isRebooting(WE_sensorInterface_t *sensorInterface, ISDS_state_t *rebooting)
 {
   ISDS_ctrl3_t ctrl3;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_3_REG, 1, (uint8_t *) &ctrl3))
   {
     return WE_FAIL;
   }
@@ -1540,33 +1602,35 @@ int8_t ISDS_isRebooting(ISDS_state_t *rebooting)
 
 /**
  * @brief Enable gyroscope digital LPF1
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] enable Gyroscope digital LPF1 enable state
  * @retval Error code
  */
-int8_t ISDS_enableGyroDigitalLpf1(ISDS_state_t enable)
+int8_t ISDS_enableGyroDigitalLpf1(WE_sensorInterface_t *sensorInterface, ISDS_state_t enable)
 {
   ISDS_ctrl4_t ctrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
   {
     return WE_FAIL;
   }
 
   ctrl4.enGyroLPF1 = enable;
 
-  return WriteReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4);
+  return WriteReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4);
 }
 
 /**
  * @brief Check if gyroscope digital LPF1 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] enable The returned gyroscope digital LPF1 enable state
  * @retval Error code
  */
-int8_t ISDS_isGyroDigitalLpf1Enabled(ISDS_state_t *enable)
+int8_t ISDS_isGyroDigitalLpf1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *enable)
 {
   ISDS_ctrl4_t ctrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
   {
     return WE_FAIL;
   }
@@ -1578,33 +1642,35 @@ int8_t ISDS_isGyroDigitalLpf1Enabled(ISDS_state_t *enable)
 
 /**
  * @brief Disable the I2C interface
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] i2cDisable I2C interface disable state (0: I2C enabled, 1: I2C disabled)
  * @retval Error code
  */
-int8_t ISDS_disableI2CInterface(ISDS_state_t i2cDisable)
+int8_t ISDS_disableI2CInterface(WE_sensorInterface_t *sensorInterface, ISDS_state_t i2cDisable)
 {
   ISDS_ctrl4_t ctrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
   {
     return WE_FAIL;
   }
 
   ctrl4.i2cDisable = i2cDisable;
 
-  return WriteReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4);
+  return WriteReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4);
 }
 
 /**
  * @brief Read the I2C interface disable state [enabled, disabled]
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] i2cDisabled The returned I2C interface disable state (0: I2C enabled, 1: I2C disabled)
  * @retval Error code
  */
-int8_t ISDS_isI2CInterfaceDisabled(ISDS_state_t *i2cDisabled)
+int8_t ISDS_isI2CInterfaceDisabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *i2cDisabled)
 {
   ISDS_ctrl4_t ctrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
   {
     return WE_FAIL;
   }
@@ -1617,34 +1683,36 @@ int8_t ISDS_isI2CInterfaceDisabled(ISDS_state_t *i2cDisabled)
 /**
  * @brief Enable masking of the accelerometer and gyroscope data-ready signals
  * until the settling of the sensor filters is completed
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] dataReadyMask Masking enable state
  * @retval Error code
  */
-int8_t ISDS_enableDataReadyMask(ISDS_state_t dataReadyMask)
+int8_t ISDS_enableDataReadyMask(WE_sensorInterface_t *sensorInterface, ISDS_state_t dataReadyMask)
 {
   ISDS_ctrl4_t ctrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
   {
     return WE_FAIL;
   }
 
   ctrl4.dataReadyMask = dataReadyMask;
 
-  return WriteReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4);
+  return WriteReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4);
 }
 
 /**
  * @brief Check if masking of the accelerometer and gyroscope data-ready signals
  * until the settling of the sensor filters is completed is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] dataReadyMask The returned masking enable state
  * @retval Error code
  */
-int8_t ISDS_isDataReadyMaskEnabled(ISDS_state_t *dataReadyMask)
+int8_t ISDS_isDataReadyMaskEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *dataReadyMask)
 {
   ISDS_ctrl4_t ctrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
   {
     return WE_FAIL;
   }
@@ -1656,33 +1724,35 @@ int8_t ISDS_isDataReadyMaskEnabled(ISDS_state_t *dataReadyMask)
 
 /**
  * @brief Enable/disable the data enable (DEN) data ready interrupt on INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int0DataReady Data enable data (DEN) ready interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableDataEnableDataReadyINT0(ISDS_state_t int0DataReady)
+int8_t ISDS_enableDataEnableDataReadyINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0DataReady)
 {
   ISDS_ctrl4_t ctrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
   {
     return WE_FAIL;
   }
 
   ctrl4.dataEnableDataReadyOnInt0 = int0DataReady;
 
-  return WriteReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4);
+  return WriteReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4);
 }
 
 /**
  * @brief Check if the data enable (DEN) data ready interrupt on INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int0DataReady The returned data enable (DEN) data ready interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isDataEnableDataReadyINT0Enabled(ISDS_state_t *int0DataReady)
+int8_t ISDS_isDataEnableDataReadyINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0DataReady)
 {
   ISDS_ctrl4_t ctrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
   {
     return WE_FAIL;
   }
@@ -1694,33 +1764,35 @@ int8_t ISDS_isDataEnableDataReadyINT0Enabled(ISDS_state_t *int0DataReady)
 
 /**
  * @brief Enable signal routing from INT_1 to INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int1OnInt0 Signal routing INT_1 to INT_0 state
  * @retval Error code
  */
-int8_t ISDS_setInt1OnInt0(ISDS_state_t int1OnInt0)
+int8_t ISDS_setInt1OnInt0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1OnInt0)
 {
   ISDS_ctrl4_t ctrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
   {
     return WE_FAIL;
   }
 
   ctrl4.int1OnInt0 = int1OnInt0;
 
-  return WriteReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4);
+  return WriteReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4);
 }
 
 /**
  * @brief Check if signal routing from INT_1 to INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int1OnInt0 The returned routing enable state.
  * @retval Error code
  */
-int8_t ISDS_getInt1OnInt0(ISDS_state_t *int1OnInt0)
+int8_t ISDS_getInt1OnInt0(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1OnInt0)
 {
   ISDS_ctrl4_t ctrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
   {
     return WE_FAIL;
   }
@@ -1732,33 +1804,35 @@ int8_t ISDS_getInt1OnInt0(ISDS_state_t *int1OnInt0)
 
 /**
  * @brief Enable gyroscope sleep mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] gyroSleepMode Gyroscope sleep mode enable state
  * @retval Error code
  */
-int8_t ISDS_enableGyroSleepMode(ISDS_state_t gyroSleepMode)
+int8_t ISDS_enableGyroSleepMode(WE_sensorInterface_t *sensorInterface, ISDS_state_t gyroSleepMode)
 {
   ISDS_ctrl4_t ctrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
   {
     return WE_FAIL;
   }
 
   ctrl4.enGyroSleepMode = gyroSleepMode;
 
-  return WriteReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4);
+  return WriteReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4);
 }
 
 /**
  * @brief Check if gyroscope sleep mode is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] gyroSleepMode The returned gyroscope sleep mode enable state
  * @retval Error code
  */
-int8_t ISDS_isGyroSleepModeEnabled(ISDS_state_t *gyroSleepMode)
+int8_t ISDS_isGyroSleepModeEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *gyroSleepMode)
 {
   ISDS_ctrl4_t ctrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
   {
     return WE_FAIL;
   }
@@ -1770,33 +1844,35 @@ int8_t ISDS_isGyroSleepModeEnabled(ISDS_state_t *gyroSleepMode)
 
 /**
  * @brief Enable/disable extension of the data enable (DEN) functionality to accelerometer sensor
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] extendToAcc Extension of data enable (DEN) functionality enable state
  * @retval Error code
  */
-int8_t ISDS_extendDataEnableToAcc(ISDS_state_t extendToAcc)
+int8_t ISDS_extendDataEnableToAcc(WE_sensorInterface_t *sensorInterface, ISDS_state_t extendToAcc)
 {
   ISDS_ctrl4_t ctrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
   {
     return WE_FAIL;
   }
 
   ctrl4.dataEnableExtendToAcc = extendToAcc;
 
-  return WriteReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4);
+  return WriteReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4);
 }
 
 /**
  * @brief Check if extension of the data enable (DEN) functionality to accelerometer sensor is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] extendToAcc The returned extension of data enable (DEN) functionality enable state
  * @retval Error code
  */
-int8_t ISDS_isDataEnableExtendedToAcc(ISDS_state_t *extendToAcc)
+int8_t ISDS_isDataEnableExtendedToAcc(WE_sensorInterface_t *sensorInterface, ISDS_state_t *extendToAcc)
 {
   ISDS_ctrl4_t ctrl4;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_4_REG, 1, (uint8_t *) &ctrl4))
   {
     return WE_FAIL;
   }
@@ -1811,33 +1887,35 @@ int8_t ISDS_isDataEnableExtendedToAcc(ISDS_state_t *extendToAcc)
 
 /**
  * @brief Set the accelerometer self test mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] selfTest Accelerometer self test mode
  * @retval Error code
  */
-int8_t ISDS_setAccSelfTestMode(ISDS_accSelfTestMode_t selfTest)
+int8_t ISDS_setAccSelfTestMode(WE_sensorInterface_t *sensorInterface, ISDS_accSelfTestMode_t selfTest)
 {
   ISDS_ctrl5_t ctrl5;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
   {
     return WE_FAIL;
   }
 
   ctrl5.accSelfTest = selfTest;
 
-  return WriteReg(ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5);
+  return WriteReg(sensorInterface, ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5);
 }
 
 /**
  * @brief Read the accelerometer self test mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] selfTest The returned accelerometer self test mode
  * @retval Error code
  */
-int8_t ISDS_getAccSelfTestMode(ISDS_accSelfTestMode_t *selfTest)
+int8_t ISDS_getAccSelfTestMode(WE_sensorInterface_t *sensorInterface, ISDS_accSelfTestMode_t *selfTest)
 {
   ISDS_ctrl5_t ctrl5;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
   {
     return WE_FAIL;
   }
@@ -1849,33 +1927,35 @@ int8_t ISDS_getAccSelfTestMode(ISDS_accSelfTestMode_t *selfTest)
 
 /**
  * @brief Set the gyroscope self test mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] selfTest Gyroscope self test mode
  * @retval Error code
  */
-int8_t ISDS_setGyroSelfTestMode(ISDS_gyroSelfTestMode_t selfTest)
+int8_t ISDS_setGyroSelfTestMode(WE_sensorInterface_t *sensorInterface, ISDS_gyroSelfTestMode_t selfTest)
 {
   ISDS_ctrl5_t ctrl5;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
   {
     return WE_FAIL;
   }
 
   ctrl5.gyroSelfTest = selfTest;
 
-  return WriteReg(ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5);
+  return WriteReg(sensorInterface, ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5);
 }
 
 /**
  * @brief Read the gyroscope self test mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] selfTest The returned gyroscope self test mode
  * @retval Error code
  */
-int8_t ISDS_getGyroSelfTestMode(ISDS_gyroSelfTestMode_t *selfTest)
+int8_t ISDS_getGyroSelfTestMode(WE_sensorInterface_t *sensorInterface, ISDS_gyroSelfTestMode_t *selfTest)
 {
   ISDS_ctrl5_t ctrl5;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
   {
     return WE_FAIL;
   }
@@ -1887,33 +1967,35 @@ int8_t ISDS_getGyroSelfTestMode(ISDS_gyroSelfTestMode_t *selfTest)
 
 /**
  * @brief Set the data enable (DEN) active level
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] activeHigh Data enable (DEN) active level (0: active low, 1: active high)
  * @retval Error code
  */
-int8_t ISDS_setDataEnableActiveHigh(ISDS_state_t activeHigh)
+int8_t ISDS_setDataEnableActiveHigh(WE_sensorInterface_t *sensorInterface, ISDS_state_t activeHigh)
 {
   ISDS_ctrl5_t ctrl5;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
   {
     return WE_FAIL;
   }
 
   ctrl5.dataEnableActiveLevel = activeHigh;
 
-  return WriteReg(ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5);
+  return WriteReg(sensorInterface, ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5);
 }
 
 /**
  * @brief Get the data enable (DEN) active level
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] activeHigh The returned data enable (DEN) active level (0: active low, 1: active high)
  * @retval Error code
  */
-int8_t ISDS_isDataEnableActiveHigh(ISDS_state_t *activeHigh)
+int8_t ISDS_isDataEnableActiveHigh(WE_sensorInterface_t *sensorInterface, ISDS_state_t *activeHigh)
 {
   ISDS_ctrl5_t ctrl5;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
   {
     return WE_FAIL;
   }
@@ -1925,33 +2007,35 @@ int8_t ISDS_isDataEnableActiveHigh(ISDS_state_t *activeHigh)
 
 /**
  * @brief Set the circular burst-mode (rounding) pattern
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] roundingPattern Rounding pattern
  * @retval Error code
  */
-int8_t ISDS_setRoundingPattern(ISDS_roundingPattern_t roundingPattern)
+int8_t ISDS_setRoundingPattern(WE_sensorInterface_t *sensorInterface, ISDS_roundingPattern_t roundingPattern)
 {
   ISDS_ctrl5_t ctrl5;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
   {
     return WE_FAIL;
   }
 
   ctrl5.rounding = roundingPattern;
 
-  return WriteReg(ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5);
+  return WriteReg(sensorInterface, ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5);
 }
 
 /**
  * @brief Read the circular burst-mode (rounding) pattern
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] roundingPattern The returned rounding pattern
  * @retval Error code
  */
-int8_t ISDS_getRoundingPattern(ISDS_roundingPattern_t *roundingPattern)
+int8_t ISDS_getRoundingPattern(WE_sensorInterface_t *sensorInterface, ISDS_roundingPattern_t *roundingPattern)
 {
   ISDS_ctrl5_t ctrl5;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_5_REG, 1, (uint8_t *) &ctrl5))
   {
     return WE_FAIL;
   }
@@ -1966,33 +2050,35 @@ int8_t ISDS_getRoundingPattern(ISDS_roundingPattern_t *roundingPattern)
 
 /**
  * @brief Set the gyroscope low-pass filter (LPF1) bandwidth
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] bandwidth Low-pass filter bandwidth
  * @retval Error code
  */
-int8_t ISDS_setGyroLowPassFilterBandwidth(ISDS_gyroLPF_t bandwidth)
+int8_t ISDS_setGyroLowPassFilterBandwidth(WE_sensorInterface_t *sensorInterface, ISDS_gyroLPF_t bandwidth)
 {
   ISDS_ctrl6_t ctrl6;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
   {
     return WE_FAIL;
   }
 
   ctrl6.gyroLowPassFilterType = bandwidth;
 
-  return WriteReg(ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6);
+  return WriteReg(sensorInterface, ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6);
 }
 
 /**
  * @brief Read the gyroscope low-pass filter (LPF1) bandwidth
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] bandwidth The returned low-pass filter bandwidth
  * @retval Error code
  */
-int8_t ISDS_getGyroLowPassFilterBandwidth(ISDS_gyroLPF_t *bandwidth)
+int8_t ISDS_getGyroLowPassFilterBandwidth(WE_sensorInterface_t *sensorInterface, ISDS_gyroLPF_t *bandwidth)
 {
   ISDS_ctrl6_t ctrl6;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
   {
     return WE_FAIL;
   }
@@ -2004,33 +2090,35 @@ int8_t ISDS_getGyroLowPassFilterBandwidth(ISDS_gyroLPF_t *bandwidth)
 
 /**
  * @brief Set the weight of the user offset words
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] offsetWeight Offset weight
  * @retval Error code
  */
-int8_t ISDS_setOffsetWeight(ISDS_state_t offsetWeight)
+int8_t ISDS_setOffsetWeight(WE_sensorInterface_t *sensorInterface, ISDS_state_t offsetWeight)
 {
   ISDS_ctrl6_t ctrl6;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
   {
     return WE_FAIL;
   }
 
   ctrl6.userOffsetsWeight = offsetWeight;
 
-  return WriteReg(ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6);
+  return WriteReg(sensorInterface, ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6);
 }
 
 /**
  * @brief Read the weight of the user offset words
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] offsetWeight The returned offset weight
  * @retval Error code
  */
-int8_t ISDS_getOffsetWeight(ISDS_state_t *offsetWeight)
+int8_t ISDS_getOffsetWeight(WE_sensorInterface_t *sensorInterface, ISDS_state_t *offsetWeight)
 {
   ISDS_ctrl6_t ctrl6;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
   {
     return WE_FAIL;
   }
@@ -2042,33 +2130,35 @@ int8_t ISDS_getOffsetWeight(ISDS_state_t *offsetWeight)
 
 /**
  * @brief Disable the accelerometer high performance mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] disable Accelerometer high performance mode disable state
  * @retval Error code
  */
-int8_t ISDS_disableAccHighPerformanceMode(ISDS_state_t disable)
+int8_t ISDS_disableAccHighPerformanceMode(WE_sensorInterface_t *sensorInterface, ISDS_state_t disable)
 {
   ISDS_ctrl6_t ctrl6;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
   {
     return WE_FAIL;
   }
 
   ctrl6.accHighPerformanceModeDisable = disable;
 
-  return WriteReg(ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6);
+  return WriteReg(sensorInterface, ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6);
 }
 
 /**
  * @brief Check if the accelerometer high performance mode is disabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] disable The returned accelerometer high performance mode disable state
  * @retval Error code
  */
-int8_t ISDS_isAccHighPerformanceModeDisabled(ISDS_state_t *disable)
+int8_t ISDS_isAccHighPerformanceModeDisabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *disable)
 {
   ISDS_ctrl6_t ctrl6;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
   {
     return WE_FAIL;
   }
@@ -2080,33 +2170,35 @@ int8_t ISDS_isAccHighPerformanceModeDisabled(ISDS_state_t *disable)
 
 /**
  * @brief Set the data enable (DEN) trigger mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] triggerMode Data enable (DEN) trigger mode
  * @retval Error code
  */
-int8_t ISDS_setDataEnableTriggerMode(ISDS_dataEnableTriggerMode_t triggerMode)
+int8_t ISDS_setDataEnableTriggerMode(WE_sensorInterface_t *sensorInterface, ISDS_dataEnableTriggerMode_t triggerMode)
 {
   ISDS_ctrl6_t ctrl6;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
   {
     return WE_FAIL;
   }
 
   ctrl6.dataEnableTriggerMode = triggerMode;
 
-  return WriteReg(ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6);
+  return WriteReg(sensorInterface, ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6);
 }
 
 /**
  * @brief Read the data enable (DEN) trigger mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] triggerMode The returned data enable (DEN) trigger mode
  * @retval Error code
  */
-int8_t ISDS_getDataEnableTriggerMode(ISDS_dataEnableTriggerMode_t *triggerMode)
+int8_t ISDS_getDataEnableTriggerMode(WE_sensorInterface_t *sensorInterface, ISDS_dataEnableTriggerMode_t *triggerMode)
 {
   ISDS_ctrl6_t ctrl6;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_6_REG, 1, (uint8_t *) &ctrl6))
   {
     return WE_FAIL;
   }
@@ -2121,33 +2213,35 @@ int8_t ISDS_getDataEnableTriggerMode(ISDS_dataEnableTriggerMode_t *triggerMode)
 
 /**
  * @brief Enable/disable the source register rounding function
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] rounding Rounding enable state
  * @retval Error code
  */
-int8_t ISDS_enableRounding(ISDS_state_t rounding)
+int8_t ISDS_enableRounding(WE_sensorInterface_t *sensorInterface, ISDS_state_t rounding)
 {
   ISDS_ctrl7_t ctrl7;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
   {
     return WE_FAIL;
   }
 
   ctrl7.enRounding = rounding;
 
-  return WriteReg(ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7);
+  return WriteReg(sensorInterface, ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7);
 }
 
 /**
  * @brief Check if the source register rounding function is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] rounding The returned rounding enable state
  * @retval Error code
  */
-int8_t ISDS_isRoundingEnabled(ISDS_state_t *rounding)
+int8_t ISDS_isRoundingEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *rounding)
 {
   ISDS_ctrl7_t ctrl7;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
   {
     return WE_FAIL;
   }
@@ -2159,33 +2253,35 @@ int8_t ISDS_isRoundingEnabled(ISDS_state_t *rounding)
 
 /**
  * @brief Set the gyroscope digital high pass filter cutoff
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] cutoff Gyroscope digital high pass filter cutoff
  * @retval Error code
  */
-int8_t ISDS_setGyroDigitalHighPassCutoff(ISDS_gyroDigitalHighPassCutoff_t cutoff)
+int8_t ISDS_setGyroDigitalHighPassCutoff(WE_sensorInterface_t *sensorInterface, ISDS_gyroDigitalHighPassCutoff_t cutoff)
 {
   ISDS_ctrl7_t ctrl7;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
   {
     return WE_FAIL;
   }
 
   ctrl7.gyroDigitalHighPassCutoff = cutoff;
 
-  return WriteReg(ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7);
+  return WriteReg(sensorInterface, ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7);
 }
 
 /**
  * @brief Read the gyroscope digital high pass filter cutoff
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] cutoff The returned gyroscope digital high pass filter cutoff
  * @retval Error code
  */
-int8_t ISDS_getGyroDigitalHighPassCutoff(ISDS_gyroDigitalHighPassCutoff_t *cutoff)
+int8_t ISDS_getGyroDigitalHighPassCutoff(WE_sensorInterface_t *sensorInterface, ISDS_gyroDigitalHighPassCutoff_t *cutoff)
 {
   ISDS_ctrl7_t ctrl7;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
   {
     return WE_FAIL;
   }
@@ -2197,33 +2293,35 @@ int8_t ISDS_getGyroDigitalHighPassCutoff(ISDS_gyroDigitalHighPassCutoff_t *cutof
 
 /**
  * @brief Enable the gyroscope digital high pass filter
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] highPass Gyroscope digital high pass filter enable state
  * @retval Error code
  */
-int8_t ISDS_enableGyroDigitalHighPass(ISDS_state_t highPass)
+int8_t ISDS_enableGyroDigitalHighPass(WE_sensorInterface_t *sensorInterface, ISDS_state_t highPass)
 {
   ISDS_ctrl7_t ctrl7;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
   {
     return WE_FAIL;
   }
 
   ctrl7.gyroDigitalHighPassEnable = highPass;
 
-  return WriteReg(ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7);
+  return WriteReg(sensorInterface, ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7);
 }
 
 /**
  * @brief Check if the gyroscope digital high pass filter is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] highPass The returned gyroscope digital high pass filter enable state
  * @retval Error code
  */
-int8_t ISDS_isGyroDigitalHighPassEnabled(ISDS_state_t *highPass)
+int8_t ISDS_isGyroDigitalHighPassEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *highPass)
 {
   ISDS_ctrl7_t ctrl7;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
   {
     return WE_FAIL;
   }
@@ -2235,33 +2333,35 @@ int8_t ISDS_isGyroDigitalHighPassEnabled(ISDS_state_t *highPass)
 
 /**
  * @brief Disable the gyroscope high performance mode
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] disable Gyroscope high performance mode disable state
  * @retval Error code
  */
-int8_t ISDS_disableGyroHighPerformanceMode(ISDS_state_t disable)
+int8_t ISDS_disableGyroHighPerformanceMode(WE_sensorInterface_t *sensorInterface, ISDS_state_t disable)
 {
   ISDS_ctrl7_t ctrl7;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
   {
     return WE_FAIL;
   }
 
   ctrl7.gyroHighPerformanceModeDisable = disable;
 
-  return WriteReg(ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7);
+  return WriteReg(sensorInterface, ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7);
 }
 
 /**
  * @brief Check if the gyroscope high performance mode is disabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] disable The returned gyroscope high performance mode disable state
  * @retval Error code
  */
-int8_t ISDS_isGyroHighPerformanceModeDisabled(ISDS_state_t *disable)
+int8_t ISDS_isGyroHighPerformanceModeDisabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *disable)
 {
   ISDS_ctrl7_t ctrl7;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_7_REG, 1, (uint8_t *) &ctrl7))
   {
     return WE_FAIL;
   }
@@ -2276,33 +2376,35 @@ int8_t ISDS_isGyroHighPerformanceModeDisabled(ISDS_state_t *disable)
 
 /**
  * @brief Enable/disable the low pass filter for 6D orientation detection
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] lowPass Low pass filter enable state
  * @retval Error code
  */
-int8_t ISDS_enable6dLowPass(ISDS_state_t lowPass)
+int8_t ISDS_enable6dLowPass(WE_sensorInterface_t *sensorInterface, ISDS_state_t lowPass)
 {
   ISDS_ctrl8_t ctrl8;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
   {
     return WE_FAIL;
   }
 
   ctrl8.en6dLowPass = lowPass;
 
-  return WriteReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8);
+  return WriteReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8);
 }
 
 /**
  * @brief Check if the low pass filter for 6D orientation detection is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] lowPass The returned low pass filter enable state
  * @retval Error code
  */
-int8_t ISDS_is6dLowPassEnabled(ISDS_state_t *lowPass)
+int8_t ISDS_is6dLowPassEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *lowPass)
 {
   ISDS_ctrl8_t ctrl8;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
   {
     return WE_FAIL;
   }
@@ -2315,33 +2417,35 @@ int8_t ISDS_is6dLowPassEnabled(ISDS_state_t *lowPass)
 /**
  * @brief Enable/disable the accelerometer high pass / slope filter
  * (i.e. the high-pass path of the composite filter block).
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] filterEnable HP / slope filter enable state (0: select low-pass path; 1: select high-pass path)
  * @retval Error code
  */
-int8_t ISDS_enableAccHighPassSlopeFilter(ISDS_state_t filterEnable)
+int8_t ISDS_enableAccHighPassSlopeFilter(WE_sensorInterface_t *sensorInterface, ISDS_state_t filterEnable)
 {
   ISDS_ctrl8_t ctrl8;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
   {
     return WE_FAIL;
   }
 
   ctrl8.enAccHighPassSlopeFilter = filterEnable;
 
-  return WriteReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8);
+  return WriteReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8);
 }
 
 /**
  * @brief Check if the accelerometer slope filter / high pass filter is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] filterEnable The returned filter enable state
  * @retval Error code
  */
-int8_t ISDS_isAccHighPassSlopeFilterEnabled(ISDS_state_t *filterEnable)
+int8_t ISDS_isAccHighPassSlopeFilterEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *filterEnable)
 {
   ISDS_ctrl8_t ctrl8;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
   {
     return WE_FAIL;
   }
@@ -2353,33 +2457,35 @@ int8_t ISDS_isAccHighPassSlopeFilterEnabled(ISDS_state_t *filterEnable)
 
 /**
  * @brief Set composite filter input
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] inputCompositeFilter Composite filter input
  * @retval Error code
  */
-int8_t ISDS_setInputCompositeFilter(ISDS_inputCompositeFilter_t inputCompositeFilter)
+int8_t ISDS_setInputCompositeFilter(WE_sensorInterface_t *sensorInterface, ISDS_inputCompositeFilter_t inputCompositeFilter)
 {
   ISDS_ctrl8_t ctrl8;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
   {
     return WE_FAIL;
   }
 
   ctrl8.inputComposite = inputCompositeFilter;
 
-  return WriteReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8);
+  return WriteReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8);
 }
 
 /**
  * @brief Read composite filter input
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] inputCompositeFilter The returned composite filter input
  * @retval Error code
  */
-int8_t ISDS_getInputCompositeFilter(ISDS_inputCompositeFilter_t *inputCompositeFilter)
+int8_t ISDS_getInputCompositeFilter(WE_sensorInterface_t *sensorInterface, ISDS_inputCompositeFilter_t *inputCompositeFilter)
 {
   ISDS_ctrl8_t ctrl8;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
   {
     return WE_FAIL;
   }
@@ -2398,33 +2504,35 @@ int8_t ISDS_getInputCompositeFilter(ISDS_inputCompositeFilter_t *inputCompositeF
  *
  * The first accelerometer output sample after enabling reference mode has to be discarded.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] refMode High pass filter reference mode enable state
  * @retval Error code
  */
-int8_t ISDS_enableHighPassFilterRefMode(ISDS_state_t refMode)
+int8_t ISDS_enableHighPassFilterRefMode(WE_sensorInterface_t *sensorInterface, ISDS_state_t refMode)
 {
   ISDS_ctrl8_t ctrl8;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
   {
     return WE_FAIL;
   }
 
   ctrl8.highPassFilterRefMode = refMode;
 
-  return WriteReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8);
+  return WriteReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8);
 }
 
 /**
  * @brief Check if the high pass filter reference mode is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] refMode The returned high pass filter reference mode enable state
  * @retval Error code
  */
-int8_t ISDS_isHighPassFilterRefModeEnabled(ISDS_state_t *refMode)
+int8_t ISDS_isHighPassFilterRefModeEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *refMode)
 {
   ISDS_ctrl8_t ctrl8;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
   {
     return WE_FAIL;
   }
@@ -2436,33 +2544,35 @@ int8_t ISDS_isHighPassFilterRefModeEnabled(ISDS_state_t *refMode)
 
 /**
  * @brief Set accelerometer LPF2 and high pass filter configuration and cutoff setting
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] filterConfig Filter configuration
  * @retval Error code
  */
-int8_t ISDS_setAccFilterConfig(ISDS_accFilterConfig_t filterConfig)
+int8_t ISDS_setAccFilterConfig(WE_sensorInterface_t *sensorInterface, ISDS_accFilterConfig_t filterConfig)
 {
   ISDS_ctrl8_t ctrl8;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
   {
     return WE_FAIL;
   }
 
   ctrl8.accFilterConfig = filterConfig;
 
-  return WriteReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8);
+  return WriteReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8);
 }
 
 /**
  * @brief Read the accelerometer LPF2 and high pass filter configuration and cutoff setting
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] filterConfig The returned filter configuration
  * @retval Error code
  */
-int8_t ISDS_getAccFilterConfig(ISDS_accFilterConfig_t *filterConfig)
+int8_t ISDS_getAccFilterConfig(WE_sensorInterface_t *sensorInterface, ISDS_accFilterConfig_t *filterConfig)
 {
   ISDS_ctrl8_t ctrl8;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
   {
     return WE_FAIL;
   }
@@ -2474,33 +2584,35 @@ int8_t ISDS_getAccFilterConfig(ISDS_accFilterConfig_t *filterConfig)
 
 /**
  * @brief Enable/disable the accelerometer low pass filter (LPF2)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] lowPass Filter enable state
  * @retval Error code
  */
-int8_t ISDS_enableAccLowPass(ISDS_state_t lowPass)
+int8_t ISDS_enableAccLowPass(WE_sensorInterface_t *sensorInterface, ISDS_state_t lowPass)
 {
   ISDS_ctrl8_t ctrl8;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
   {
     return WE_FAIL;
   }
 
   ctrl8.enAccLowPass = lowPass;
 
-  return WriteReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8);
+  return WriteReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8);
 }
 
 /**
  * @brief Check if the accelerometer low pass filter (LPF2) is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] lowPass The returned filter enable state
  * @retval Error code
  */
-int8_t ISDS_isAccLowPassEnabled(ISDS_state_t *lowPass)
+int8_t ISDS_isAccLowPassEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *lowPass)
 {
   ISDS_ctrl8_t ctrl8;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_8_REG, 1, (uint8_t *) &ctrl8))
   {
     return WE_FAIL;
   }
@@ -2515,33 +2627,35 @@ int8_t ISDS_isAccLowPassEnabled(ISDS_state_t *lowPass)
 
 /**
  * @brief Set the data enable (DEN) stamping sensor
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] sensor Data enable (DEN) stamping sensor
  * @retval Error code
  */
-int8_t ISDS_setDataEnableStampingSensor(ISDS_dataEnableStampingSensor_t sensor)
+int8_t ISDS_setDataEnableStampingSensor(WE_sensorInterface_t *sensorInterface, ISDS_dataEnableStampingSensor_t sensor)
 {
   ISDS_ctrl9_t ctrl9;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
   {
     return WE_FAIL;
   }
 
   ctrl9.dataEnableStampingSensor = sensor;
 
-  return WriteReg(ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9);
+  return WriteReg(sensorInterface, ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9);
 }
 
 /**
  * @brief Get the data enable (DEN) stamping sensor
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] sensor The returned data enable (DEN) stamping sensor
  * @retval Error code
  */
-int8_t ISDS_getDataEnableStampingSensor(ISDS_dataEnableStampingSensor_t *sensor)
+int8_t ISDS_getDataEnableStampingSensor(WE_sensorInterface_t *sensorInterface, ISDS_dataEnableStampingSensor_t *sensor)
 {
   ISDS_ctrl9_t ctrl9;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
   {
     return WE_FAIL;
   }
@@ -2553,33 +2667,35 @@ int8_t ISDS_getDataEnableStampingSensor(ISDS_dataEnableStampingSensor_t *sensor)
 
 /**
  * @brief Enable/disable storage of data enable (DEN) value in LSB of Z-axis
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] enable Storage of DEN value in LSB of Z-axis enable state
  * @retval Error code
  */
-int8_t ISDS_storeDataEnableValueInZAxisLSB(ISDS_state_t enable)
+int8_t ISDS_storeDataEnableValueInZAxisLSB(WE_sensorInterface_t *sensorInterface, ISDS_state_t enable)
 {
   ISDS_ctrl9_t ctrl9;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
   {
     return WE_FAIL;
   }
 
   ctrl9.dataEnableValueZ = enable;
 
-  return WriteReg(ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9);
+  return WriteReg(sensorInterface, ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9);
 }
 
 /**
  * @brief Check if storage of data enable (DEN) value in LSB of Z-axis is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] enable The returned storage of DEN value in LSB of Z-axis enable state
  * @retval Error code
  */
-int8_t ISDS_isStoreDataEnableValueInZAxisLSB(ISDS_state_t *enable)
+int8_t ISDS_isStoreDataEnableValueInZAxisLSB(WE_sensorInterface_t *sensorInterface, ISDS_state_t *enable)
 {
   ISDS_ctrl9_t ctrl9;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
   {
     return WE_FAIL;
   }
@@ -2591,33 +2707,35 @@ int8_t ISDS_isStoreDataEnableValueInZAxisLSB(ISDS_state_t *enable)
 
 /**
  * @brief Enable/disable storage of data enable (DEN) value in LSB of Y-axis
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] enable Storage of DEN value in LSB of Y-axis enable state
  * @retval Error code
  */
-int8_t ISDS_storeDataEnableValueInYAxisLSB(ISDS_state_t enable)
+int8_t ISDS_storeDataEnableValueInYAxisLSB(WE_sensorInterface_t *sensorInterface, ISDS_state_t enable)
 {
   ISDS_ctrl9_t ctrl9;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
   {
     return WE_FAIL;
   }
 
   ctrl9.dataEnableValueY = enable;
 
-  return WriteReg(ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9);
+  return WriteReg(sensorInterface, ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9);
 }
 
 /**
  * @brief Check if storage of data enable (DEN) value in LSB of Y-axis is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] enable The returned storage of DEN value in LSB of Y-axis enable state
  * @retval Error code
  */
-int8_t ISDS_isStoreDataEnableValueInYAxisLSB(ISDS_state_t *enable)
+int8_t ISDS_isStoreDataEnableValueInYAxisLSB(WE_sensorInterface_t *sensorInterface, ISDS_state_t *enable)
 {
   ISDS_ctrl9_t ctrl9;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
   {
     return WE_FAIL;
   }
@@ -2629,33 +2747,35 @@ int8_t ISDS_isStoreDataEnableValueInYAxisLSB(ISDS_state_t *enable)
 
 /**
  * @brief Enable/disable storage of data enable (DEN) value in LSB of X-axis
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] enable Storage of DEN value in LSB of X-axis enable state
  * @retval Error code
  */
-int8_t ISDS_storeDataEnableValueInXAxisLSB(ISDS_state_t enable)
+int8_t ISDS_storeDataEnableValueInXAxisLSB(WE_sensorInterface_t *sensorInterface, ISDS_state_t enable)
 {
   ISDS_ctrl9_t ctrl9;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
   {
     return WE_FAIL;
   }
 
   ctrl9.dataEnableValueX = enable;
 
-  return WriteReg(ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9);
+  return WriteReg(sensorInterface, ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9);
 }
 
 /**
  * @brief Check if storage of data enable (DEN) value in LSB of X-axis is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] enable The returned storage of DEN value in LSB of X-axis enable state
  * @retval Error code
  */
-int8_t ISDS_isStoreDataEnableValueInXAxisLSB(ISDS_state_t *enable)
+int8_t ISDS_isStoreDataEnableValueInXAxisLSB(WE_sensorInterface_t *sensorInterface, ISDS_state_t *enable)
 {
   ISDS_ctrl9_t ctrl9;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_9_REG, 1, (uint8_t *) &ctrl9))
   {
     return WE_FAIL;
   }
@@ -2670,33 +2790,35 @@ int8_t ISDS_isStoreDataEnableValueInXAxisLSB(ISDS_state_t *enable)
 
 /**
  * @brief Enable/disable embedded functionalities (tilt)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] embeddedFuncEnable Embedded functionalities enable state
  * @retval Error code
  */
-int8_t ISDS_enableEmbeddedFunctionalities(ISDS_state_t embeddedFuncEnable)
+int8_t ISDS_enableEmbeddedFunctionalities(WE_sensorInterface_t *sensorInterface, ISDS_state_t embeddedFuncEnable)
 {
   ISDS_ctrl10_t ctrl10;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10))
   {
     return WE_FAIL;
   }
 
   ctrl10.enEmbeddedFunc = embeddedFuncEnable;
 
-  return WriteReg(ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10);
+  return WriteReg(sensorInterface, ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10);
 }
 
 /**
  * @brief Check if embedded functionalities (tilt) are enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] embeddedFuncEnable The returned embedded functionalities enable state
  * @retval Error code
  */
-int8_t ISDS_areEmbeddedFunctionalitiesEnabled(ISDS_state_t *embeddedFuncEnable)
+int8_t ISDS_areEmbeddedFunctionalitiesEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *embeddedFuncEnable)
 {
   ISDS_ctrl10_t ctrl10;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10))
   {
     return WE_FAIL;
   }
@@ -2708,33 +2830,35 @@ int8_t ISDS_areEmbeddedFunctionalitiesEnabled(ISDS_state_t *embeddedFuncEnable)
 
 /**
  * @brief Enable/disable tilt calculation
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] tiltCalc Tilt calculation enable state
  * @retval Error code
  */
-int8_t ISDS_enableTiltCalculation(ISDS_state_t tiltCalc)
+int8_t ISDS_enableTiltCalculation(WE_sensorInterface_t *sensorInterface, ISDS_state_t tiltCalc)
 {
   ISDS_ctrl10_t ctrl10;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10))
   {
     return WE_FAIL;
   }
 
   ctrl10.enTiltCalculation = tiltCalc;
 
-  return WriteReg(ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10);
+  return WriteReg(sensorInterface, ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10);
 }
 
 /**
  * @brief Check if tilt calculation is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] tiltCalc The returned tilt calculation enable state
  * @retval Error code
  */
-int8_t ISDS_isTiltCalculationEnabled(ISDS_state_t *tiltCalc)
+int8_t ISDS_isTiltCalculationEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tiltCalc)
 {
   ISDS_ctrl10_t ctrl10;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10))
   {
     return WE_FAIL;
   }
@@ -2746,33 +2870,35 @@ int8_t ISDS_isTiltCalculationEnabled(ISDS_state_t *tiltCalc)
 
 /**
  * @brief Enable/disable timestamp count
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] timestampCount Timestamp count enable state
  * @retval Error code
  */
-int8_t ISDS_enableTimestampCount(ISDS_state_t timestampCount)
+int8_t ISDS_enableTimestampCount(WE_sensorInterface_t *sensorInterface, ISDS_state_t timestampCount)
 {
   ISDS_ctrl10_t ctrl10;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10))
   {
     return WE_FAIL;
   }
 
   ctrl10.enTimestampCount = timestampCount;
 
-  return WriteReg(ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10);
+  return WriteReg(sensorInterface, ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10);
 }
 
 /**
  * @brief Check if timestamp count is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] timestampCount The returned timestamp count enable state
  * @retval Error code
  */
-int8_t ISDS_isTimestampCountEnabled(ISDS_state_t *timestampCount)
+int8_t ISDS_isTimestampCountEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *timestampCount)
 {
   ISDS_ctrl10_t ctrl10;
 
-  if (WE_FAIL == ReadReg(ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_10_REG, 1, (uint8_t *) &ctrl10))
   {
     return WE_FAIL;
   }
@@ -2787,24 +2913,26 @@ int8_t ISDS_isTimestampCountEnabled(ISDS_state_t *timestampCount)
 
 /**
  * @brief Read the overall wake-up event status
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] status The returned wake-up event status
  * @retval Error code
  */
-int8_t ISDS_getWakeUpEventRegister(ISDS_wakeUpEvent_t *status)
+int8_t ISDS_getWakeUpEventRegister(WE_sensorInterface_t *sensorInterface, ISDS_wakeUpEvent_t *status)
 {
-  return ReadReg(ISDS_WAKE_UP_EVENT_REG, 1, (uint8_t *) status);
+  return ReadReg(sensorInterface, ISDS_WAKE_UP_EVENT_REG, 1, (uint8_t *) status);
 }
 
 /**
  * @brief Read the wake-up event detection status on axis X
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] wakeUpX The returned wake-up event detection status on axis X
  * @retval Error code
  */
-int8_t ISDS_isWakeUpXEvent(ISDS_state_t *wakeUpX)
+int8_t ISDS_isWakeUpXEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *wakeUpX)
 {
   ISDS_wakeUpEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -2816,14 +2944,15 @@ int8_t ISDS_isWakeUpXEvent(ISDS_state_t *wakeUpX)
 
 /**
  * @brief Read the wake-up event detection status on axis Y
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] wakeUpY The returned wake-up event detection status on axis Y
  * @retval Error code
  */
-int8_t ISDS_isWakeUpYEvent(ISDS_state_t *wakeUpY)
+int8_t ISDS_isWakeUpYEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *wakeUpY)
 {
   ISDS_wakeUpEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -2835,14 +2964,15 @@ int8_t ISDS_isWakeUpYEvent(ISDS_state_t *wakeUpY)
 
 /**
  * @brief Read the wake-up event detection status on axis Z
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] wakeUpZ The returned wake-up event detection status on axis Z
  * @retval Error code
  */
-int8_t ISDS_isWakeUpZEvent(ISDS_state_t *wakeUpZ)
+int8_t ISDS_isWakeUpZEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *wakeUpZ)
 {
   ISDS_wakeUpEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -2854,14 +2984,15 @@ int8_t ISDS_isWakeUpZEvent(ISDS_state_t *wakeUpZ)
 
 /**
  * @brief Read the wake-up event detection status (wake-up event on any axis)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] wakeUpState The returned wake-up event detection state
  * @retval Error code
  */
-int8_t ISDS_isWakeUpEvent(ISDS_state_t *wakeUpState)
+int8_t ISDS_isWakeUpEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *wakeUpState)
 {
   ISDS_wakeUpEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -2873,14 +3004,15 @@ int8_t ISDS_isWakeUpEvent(ISDS_state_t *wakeUpState)
 
 /**
  * @brief Read the sleep state [not sleeping/sleeping]
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] sleepState The returned sleep state.
  * @retval Error code
  */
-int8_t ISDS_getSleepState(ISDS_state_t *sleepState)
+int8_t ISDS_getSleepState(WE_sensorInterface_t *sensorInterface, ISDS_state_t *sleepState)
 {
   ISDS_wakeUpEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -2892,14 +3024,15 @@ int8_t ISDS_getSleepState(ISDS_state_t *sleepState)
 
 /**
  * @brief Read the free-fall event detection status
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] freeFall The returned free-fall event detection state
  * @retval Error code
  */
-int8_t ISDS_isFreeFallEvent(ISDS_state_t *freeFall)
+int8_t ISDS_isFreeFallEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *freeFall)
 {
   ISDS_wakeUpEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -2914,24 +3047,26 @@ int8_t ISDS_isFreeFallEvent(ISDS_state_t *freeFall)
 
 /**
  * @brief Read the overall tap event status
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] status The returned tap event status
  * @retval Error code
  */
-int8_t ISDS_getTapEventRegister(ISDS_tapEvent_t *status)
+int8_t ISDS_getTapEventRegister(WE_sensorInterface_t *sensorInterface, ISDS_tapEvent_t *status)
 {
-  return ReadReg(ISDS_TAP_EVENT_REG, 1, (uint8_t *) status);
+  return ReadReg(sensorInterface, ISDS_TAP_EVENT_REG, 1, (uint8_t *) status);
 }
 
 /**
  * @brief Read the tap event status (tap event on any axis)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] tapEventState The returned tap event state
  * @retval Error code
  */
-int8_t ISDS_isTapEvent(ISDS_state_t *tapEventState)
+int8_t ISDS_isTapEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tapEventState)
 {
   ISDS_tapEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -2943,14 +3078,15 @@ int8_t ISDS_isTapEvent(ISDS_state_t *tapEventState)
 
 /**
  * @brief Read the tap event status on axis X
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] tapXAxis The returned tap event status on axis X
  * @retval Error code
  */
-int8_t ISDS_isTapEventXAxis(ISDS_state_t *tapXAxis)
+int8_t ISDS_isTapEventXAxis(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tapXAxis)
 {
   ISDS_tapEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -2962,14 +3098,15 @@ int8_t ISDS_isTapEventXAxis(ISDS_state_t *tapXAxis)
 
 /**
  * @brief Read the tap event status on axis Y
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] tapYAxis The returned tap event status on axis Y
  * @retval Error code
  */
-int8_t ISDS_isTapEventYAxis(ISDS_state_t *tapYAxis)
+int8_t ISDS_isTapEventYAxis(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tapYAxis)
 {
   ISDS_tapEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -2981,14 +3118,15 @@ int8_t ISDS_isTapEventYAxis(ISDS_state_t *tapYAxis)
 
 /**
  * @brief Read the tap event status on axis Z
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] tapZAxis The returned tap event status on axis Z
  * @retval Error code
  */
-int8_t ISDS_isTapEventZAxis(ISDS_state_t *tapZAxis)
+int8_t ISDS_isTapEventZAxis(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tapZAxis)
 {
   ISDS_tapEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -3000,14 +3138,15 @@ int8_t ISDS_isTapEventZAxis(ISDS_state_t *tapZAxis)
 
 /**
  * @brief Read the double-tap event status
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] doubleTap The returned double-tap event status
  * @retval Error code
  */
-int8_t ISDS_isDoubleTapEvent(ISDS_state_t *doubleTap)
+int8_t ISDS_isDoubleTapEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *doubleTap)
 {
   ISDS_tapEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -3019,14 +3158,15 @@ int8_t ISDS_isDoubleTapEvent(ISDS_state_t *doubleTap)
 
 /**
  * @brief Read the single-tap event status
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] singleTap The returned single-tap event status
  * @retval Error code
  */
-int8_t ISDS_isSingleTapEvent(ISDS_state_t *singleTap)
+int8_t ISDS_isSingleTapEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *singleTap)
 {
   ISDS_tapEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -3038,14 +3178,15 @@ int8_t ISDS_isSingleTapEvent(ISDS_state_t *singleTap)
 
 /**
  * @brief Read the tap event acceleration sign (direction of tap event)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] tapSign The returned tap event acceleration sign
  * @retval Error code
  */
-int8_t ISDS_getTapSign(ISDS_tapSign_t *tapSign)
+int8_t ISDS_getTapSign(WE_sensorInterface_t *sensorInterface, ISDS_tapSign_t *tapSign)
 {
   ISDS_tapEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -3060,24 +3201,26 @@ int8_t ISDS_getTapSign(ISDS_tapSign_t *tapSign)
 
 /**
  * @brief Read register containing info on 6D orientation change event
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] status The returned 6D event status
  * @retval Error code
  */
-int8_t ISDS_get6dEventRegister(ISDS_6dEvent_t *status)
+int8_t ISDS_get6dEventRegister(WE_sensorInterface_t *sensorInterface, ISDS_6dEvent_t *status)
 {
-  return ReadReg(ISDS_6D_EVENT_REG, 1, (uint8_t *) status);
+  return ReadReg(sensorInterface, ISDS_6D_EVENT_REG, 1, (uint8_t *) status);
 }
 
 /**
  * @brief Check if 6D orientation change event has occurred
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] orientationChanged The returned 6D orientation change event status
  * @retval Error code
  */
-int8_t ISDS_has6dOrientationChanged(ISDS_state_t *orientationChanged)
+int8_t ISDS_has6dOrientationChanged(WE_sensorInterface_t *sensorInterface, ISDS_state_t *orientationChanged)
 {
   ISDS_6dEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -3089,14 +3232,15 @@ int8_t ISDS_has6dOrientationChanged(ISDS_state_t *orientationChanged)
 
 /**
  * @brief Read the XL over threshold state (6D orientation)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] xlOverThreshold The returned XL over threshold state
  * @retval Error code
  */
-int8_t ISDS_isXLOverThreshold(ISDS_state_t *xlOverThreshold)
+int8_t ISDS_isXLOverThreshold(WE_sensorInterface_t *sensorInterface, ISDS_state_t *xlOverThreshold)
 {
   ISDS_6dEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -3108,14 +3252,15 @@ int8_t ISDS_isXLOverThreshold(ISDS_state_t *xlOverThreshold)
 
 /**
  * @brief Read the XH over threshold state (6D orientation)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] xhOverThreshold The returned XH over threshold state
  * @retval Error code
  */
-int8_t ISDS_isXHOverThreshold(ISDS_state_t *xhOverThreshold)
+int8_t ISDS_isXHOverThreshold(WE_sensorInterface_t *sensorInterface, ISDS_state_t *xhOverThreshold)
 {
   ISDS_6dEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -3127,14 +3272,15 @@ int8_t ISDS_isXHOverThreshold(ISDS_state_t *xhOverThreshold)
 
 /**
  * @brief Read the YL over threshold state (6D orientation)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] ylOverThreshold The returned YL over threshold state
  * @retval Error code
  */
-int8_t ISDS_isYLOverThreshold(ISDS_state_t *ylOverThreshold)
+int8_t ISDS_isYLOverThreshold(WE_sensorInterface_t *sensorInterface, ISDS_state_t *ylOverThreshold)
 {
   ISDS_6dEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -3146,14 +3292,15 @@ int8_t ISDS_isYLOverThreshold(ISDS_state_t *ylOverThreshold)
 
 /**
  * @brief Read the YH over threshold state (6D orientation)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] yhOverThreshold The returned YH over threshold state
  * @retval Error code
  */
-int8_t ISDS_isYHOverThreshold(ISDS_state_t *yhOverThreshold)
+int8_t ISDS_isYHOverThreshold(WE_sensorInterface_t *sensorInterface, ISDS_state_t *yhOverThreshold)
 {
   ISDS_6dEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -3165,14 +3312,15 @@ int8_t ISDS_isYHOverThreshold(ISDS_state_t *yhOverThreshold)
 
 /**
  * @brief Read the ZL over threshold state (6D orientation)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] zlOverThreshold The returned ZL over threshold state
  * @retval Error code
  */
-int8_t ISDS_isZLOverThreshold(ISDS_state_t *zlOverThreshold)
+int8_t ISDS_isZLOverThreshold(WE_sensorInterface_t *sensorInterface, ISDS_state_t *zlOverThreshold)
 {
   ISDS_6dEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -3184,14 +3332,15 @@ int8_t ISDS_isZLOverThreshold(ISDS_state_t *zlOverThreshold)
 
 /**
  * @brief Read the ZH over threshold state (6D orientation)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] zhOverThreshold The returned ZH over threshold state
  * @retval Error code
  */
-int8_t ISDS_isZHOverThreshold(ISDS_state_t *zhOverThreshold)
+int8_t ISDS_isZHOverThreshold(WE_sensorInterface_t *sensorInterface, ISDS_state_t *zhOverThreshold)
 {
   ISDS_6dEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -3204,14 +3353,15 @@ int8_t ISDS_isZHOverThreshold(ISDS_state_t *zhOverThreshold)
 /**
  * @brief Read the data enable (DEN) data ready signal.
  * It is set high when data output is related to the data coming from a DEN active condition.
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] dataReady The returned DEN data ready signal state
  * @retval Error code
  */
-int8_t ISDS_isDataEnableDataReady(ISDS_state_t *dataReady)
+int8_t ISDS_isDataEnableDataReady(WE_sensorInterface_t *sensorInterface, ISDS_state_t *dataReady)
 {
   ISDS_6dEvent_t status;
 
-  if (WE_FAIL == ReadReg(ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_6D_EVENT_REG, 1, (uint8_t *) &status))
   {
     return WE_FAIL;
   }
@@ -3226,24 +3376,26 @@ int8_t ISDS_isDataEnableDataReady(ISDS_state_t *dataReady)
 
 /**
  * @brief Get overall sensor status
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] status The returned sensor event data
  * @retval Error code
  */
-int8_t ISDS_getStatusRegister(ISDS_status_t *status)
+int8_t ISDS_getStatusRegister(WE_sensorInterface_t *sensorInterface, ISDS_status_t *status)
 {
-  return ReadReg(ISDS_STATUS_REG, 1, (uint8_t *) status);
+  return ReadReg(sensorInterface, ISDS_STATUS_REG, 1, (uint8_t *) status);
 }
 
 /**
  * @brief Check if new acceleration samples are available
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] dataReady The returned data-ready state
  * @retval Error code
  */
-int8_t ISDS_isAccelerationDataReady(ISDS_state_t *dataReady)
+int8_t ISDS_isAccelerationDataReady(WE_sensorInterface_t *sensorInterface, ISDS_state_t *dataReady)
 {
   ISDS_status_t statusRegister;
 
-  if (WE_FAIL == ReadReg(ISDS_STATUS_REG, 1, (uint8_t *) &statusRegister))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_STATUS_REG, 1, (uint8_t *) &statusRegister))
   {
     return WE_FAIL;
   }
@@ -3255,14 +3407,15 @@ int8_t ISDS_isAccelerationDataReady(ISDS_state_t *dataReady)
 
 /**
  * @brief Check if new gyroscope samples are available
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] dataReady The returned data-ready state
  * @retval Error code
  */
-int8_t ISDS_isGyroscopeDataReady(ISDS_state_t *dataReady)
+int8_t ISDS_isGyroscopeDataReady(WE_sensorInterface_t *sensorInterface, ISDS_state_t *dataReady)
 {
   ISDS_status_t statusRegister;
 
-  if (WE_FAIL == ReadReg(ISDS_STATUS_REG, 1, (uint8_t *) &statusRegister))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_STATUS_REG, 1, (uint8_t *) &statusRegister))
   {
     return WE_FAIL;
   }
@@ -3274,14 +3427,15 @@ int8_t ISDS_isGyroscopeDataReady(ISDS_state_t *dataReady)
 
 /**
  * @brief Check if new temperature samples are available
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] dataReady The returned data-ready state
  * @retval Error code
  */
-int8_t ISDS_isTemperatureDataReady(ISDS_state_t *dataReady)
+int8_t ISDS_isTemperatureDataReady(WE_sensorInterface_t *sensorInterface, ISDS_state_t *dataReady)
 {
   ISDS_status_t statusRegister;
 
-  if (WE_FAIL == ReadReg(ISDS_STATUS_REG, 1, (uint8_t *) &statusRegister))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_STATUS_REG, 1, (uint8_t *) &statusRegister))
   {
     return WE_FAIL;
   }
@@ -3302,15 +3456,16 @@ int8_t ISDS_isTemperatureDataReady(ISDS_state_t *dataReady)
  *
  * This is a convenience function querying all FIFO status registers in one read operation.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] status The returned FIFO status flags register
  * @param[out] fillLevel The returned FIFO fill level (0-2047)
  * @param[out] fifoPattern Word of recursive pattern read at the next read
  * @retval Error code
  */
-int8_t ISDS_getFifoStatus(ISDS_fifoStatus2_t *status, uint16_t *fillLevel, uint16_t *fifoPattern)
+int8_t ISDS_getFifoStatus(WE_sensorInterface_t *sensorInterface, ISDS_fifoStatus2_t *status, uint16_t *fillLevel, uint16_t *fifoPattern)
 {
   uint8_t tmp[4];
-  if (WE_FAIL == ReadReg(ISDS_FIFO_STATUS_1_REG, 4, tmp))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_STATUS_1_REG, 4, tmp))
   {
     return WE_FAIL;
   }
@@ -3333,23 +3488,25 @@ int8_t ISDS_getFifoStatus(ISDS_fifoStatus2_t *status, uint16_t *fillLevel, uint1
 
 /**
  * @brief Get FIFO status flags register
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] status The returned FIFO status flags register
  * @retval Error code
  */
-int8_t ISDS_getFifoStatus2Register(ISDS_fifoStatus2_t *status)
+int8_t ISDS_getFifoStatus2Register(WE_sensorInterface_t *sensorInterface, ISDS_fifoStatus2_t *status)
 {
-  return ReadReg(ISDS_FIFO_STATUS_2_REG, 1, (uint8_t *) status);
+  return ReadReg(sensorInterface, ISDS_FIFO_STATUS_2_REG, 1, (uint8_t *) status);
 }
 
 /**
  * @brief Read the FIFO fill level
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] fillLevel The returned FIFO fill level (0-2047)
  * @retval Error code
  */
-int8_t ISDS_getFifoFillLevel(uint16_t *fillLevel)
+int8_t ISDS_getFifoFillLevel(WE_sensorInterface_t *sensorInterface, uint16_t *fillLevel)
 {
   uint8_t tmp[2];
-  if (WE_FAIL == ReadReg(ISDS_FIFO_STATUS_1_REG, 2, tmp))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_STATUS_1_REG, 2, tmp))
   {
     return WE_FAIL;
   }
@@ -3365,14 +3522,15 @@ int8_t ISDS_getFifoFillLevel(uint16_t *fillLevel)
 
 /**
  * @brief Check if the FIFO is empty
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] empty FIFO empty state
  * @retval Error code
  */
-int8_t ISDS_isFifoEmpty(ISDS_state_t *empty)
+int8_t ISDS_isFifoEmpty(WE_sensorInterface_t *sensorInterface, ISDS_state_t *empty)
 {
   ISDS_fifoStatus2_t fifoStatus2;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_STATUS_2_REG, 1, (uint8_t *) &fifoStatus2))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_STATUS_2_REG, 1, (uint8_t *) &fifoStatus2))
   {
     return WE_FAIL;
   }
@@ -3384,14 +3542,15 @@ int8_t ISDS_isFifoEmpty(ISDS_state_t *empty)
 
 /**
  * @brief Check if the FIFO is full
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] full FIFO full state
  * @retval Error code
  */
-int8_t ISDS_isFifoFull(ISDS_state_t *full)
+int8_t ISDS_isFifoFull(WE_sensorInterface_t *sensorInterface, ISDS_state_t *full)
 {
   ISDS_fifoStatus2_t fifoStatus2;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_STATUS_2_REG, 1, (uint8_t *) &fifoStatus2))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_STATUS_2_REG, 1, (uint8_t *) &fifoStatus2))
   {
     return WE_FAIL;
   }
@@ -3403,14 +3562,15 @@ int8_t ISDS_isFifoFull(ISDS_state_t *full)
 
 /**
  * @brief Check if a FIFO overrun has occurred
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] overrun FIFO overrun state
  * @retval Error code
  */
-int8_t ISDS_getFifoOverrunState(ISDS_state_t *overrun)
+int8_t ISDS_getFifoOverrunState(WE_sensorInterface_t *sensorInterface, ISDS_state_t *overrun)
 {
   ISDS_fifoStatus2_t fifoStatus2;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_STATUS_2_REG, 1, (uint8_t *) &fifoStatus2))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_STATUS_2_REG, 1, (uint8_t *) &fifoStatus2))
   {
     return WE_FAIL;
   }
@@ -3422,14 +3582,15 @@ int8_t ISDS_getFifoOverrunState(ISDS_state_t *overrun)
 
 /**
  * @brief Check if the FIFO fill threshold has been reached
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] threshReached FIFO threshold status bit
  * @retval Error code
  */
-int8_t ISDS_isFifoThresholdReached(ISDS_state_t *threshReached)
+int8_t ISDS_isFifoThresholdReached(WE_sensorInterface_t *sensorInterface, ISDS_state_t *threshReached)
 {
   ISDS_fifoStatus2_t fifoStatus2;
 
-  if (WE_FAIL == ReadReg(ISDS_FIFO_STATUS_2_REG, 1, (uint8_t *) &fifoStatus2))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_STATUS_2_REG, 1, (uint8_t *) &fifoStatus2))
   {
     return WE_FAIL;
   }
@@ -3441,13 +3602,14 @@ int8_t ISDS_isFifoThresholdReached(ISDS_state_t *threshReached)
 
 /**
  * @brief Get the word of recursive pattern read at the next read
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] fifoPattern Word of recursive pattern read at the next read
  * @retval Error code
  */
-int8_t ISDS_getFifoPattern(uint16_t *fifoPattern)
+int8_t ISDS_getFifoPattern(WE_sensorInterface_t *sensorInterface, uint16_t *fifoPattern)
 {
   uint8_t tmp[2];
-  if (WE_FAIL == ReadReg(ISDS_FIFO_STATUS_3_REG, 2, tmp))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_STATUS_3_REG, 2, tmp))
   {
     return WE_FAIL;
   }
@@ -3466,14 +3628,15 @@ int8_t ISDS_getFifoPattern(uint16_t *fifoPattern)
 
 /**
  * @brief Check if a tilt event has occurred
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] tiltEvent Tilt event state
  * @retval Error code
  */
-int8_t ISDS_isTiltEvent(ISDS_state_t *tiltEvent)
+int8_t ISDS_isTiltEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tiltEvent)
 {
   ISDS_funcSrc1_t funcSrc1;
 
-  if (WE_FAIL == ReadReg(ISDS_FUNC_SRC_1_REG, 1, (uint8_t *) &funcSrc1))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FUNC_SRC_1_REG, 1, (uint8_t *) &funcSrc1))
   {
     return WE_FAIL;
   }
@@ -3488,33 +3651,35 @@ int8_t ISDS_isTiltEvent(ISDS_state_t *tiltEvent)
 
 /**
  * @brief Enable/disable latched interrupts
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] lir Latched interrupts state
  * @retval Error code
  */
-int8_t ISDS_enableLatchedInterrupt(ISDS_state_t lir)
+int8_t ISDS_enableLatchedInterrupt(WE_sensorInterface_t *sensorInterface, ISDS_state_t lir)
 {
   ISDS_tapCfg_t tapCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
   {
     return WE_FAIL;
   }
 
   tapCfg.latchedInterrupt = lir;
 
-  return WriteReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg);
+  return WriteReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg);
 }
 
 /**
  * @brief Read the latched interrupts state [enabled, disabled]
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] lir The returned latched interrupts state
  * @retval Error code
  */
-int8_t ISDS_isLatchedInterruptEnabled(ISDS_state_t *lir)
+int8_t ISDS_isLatchedInterruptEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *lir)
 {
   ISDS_tapCfg_t tapCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
   {
     return WE_FAIL;
   }
@@ -3526,33 +3691,35 @@ int8_t ISDS_isLatchedInterruptEnabled(ISDS_state_t *lir)
 
 /**
  * @brief Enable/disable tap recognition in X direction
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] tapX Tap X direction state
  * @retval Error code
  */
-int8_t ISDS_enableTapX(ISDS_state_t tapX)
+int8_t ISDS_enableTapX(WE_sensorInterface_t *sensorInterface, ISDS_state_t tapX)
 {
   ISDS_tapCfg_t tapCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
   {
     return WE_FAIL;
   }
 
   tapCfg.enTapX = tapX;
 
-  return WriteReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg);
+  return WriteReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg);
 }
 
 /**
  * @brief Check if detection of tap events in X direction is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] tapX The returned tap X direction state
  * @retval Error code
  */
-int8_t ISDS_isTapXEnabled(ISDS_state_t *tapX)
+int8_t ISDS_isTapXEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tapX)
 {
   ISDS_tapCfg_t tapCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
   {
     return WE_FAIL;
   }
@@ -3564,33 +3731,35 @@ int8_t ISDS_isTapXEnabled(ISDS_state_t *tapX)
 
 /**
  * @brief Enable/disable tap recognition in Y direction
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] tapY Tap Y direction state
  * @retval Error code
  */
-int8_t ISDS_enableTapY(ISDS_state_t tapY)
+int8_t ISDS_enableTapY(WE_sensorInterface_t *sensorInterface, ISDS_state_t tapY)
 {
   ISDS_tapCfg_t tapCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
   {
     return WE_FAIL;
   }
 
   tapCfg.enTapY = tapY;
 
-  return WriteReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg);
+  return WriteReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg);
 }
 
 /**
  * @brief Check if detection of tap events in Y direction is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] tapY The returned tap Y direction state
  * @retval Error code
  */
-int8_t ISDS_isTapYEnabled(ISDS_state_t *tapY)
+int8_t ISDS_isTapYEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tapY)
 {
   ISDS_tapCfg_t tapCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
   {
     return WE_FAIL;
   }
@@ -3602,33 +3771,35 @@ int8_t ISDS_isTapYEnabled(ISDS_state_t *tapY)
 
 /**
  * @brief Enable/disable tap recognition in Z direction
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] tapZ Tap Z direction state
  * @retval Error code
  */
-int8_t ISDS_enableTapZ(ISDS_state_t tapZ)
+int8_t ISDS_enableTapZ(WE_sensorInterface_t *sensorInterface, ISDS_state_t tapZ)
 {
   ISDS_tapCfg_t tapCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
   {
     return WE_FAIL;
   }
 
   tapCfg.enTapZ = tapZ;
 
-  return WriteReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg);
+  return WriteReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg);
 }
 
 /**
  * @brief Check if detection of tap events in Z direction is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] tapZ The returned tap Z direction state
  * @retval Error code
  */
-int8_t ISDS_isTapZEnabled(ISDS_state_t *tapZ)
+int8_t ISDS_isTapZEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tapZ)
 {
   ISDS_tapCfg_t tapCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
   {
     return WE_FAIL;
   }
@@ -3640,33 +3811,35 @@ int8_t ISDS_isTapZEnabled(ISDS_state_t *tapZ)
 
 /**
  * @brief Set activity filter (HPF or SLOPE filter selection on wake-up and activity/inactivity functions)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] filter Activity filter
  * @retval Error code
  */
-int8_t ISDS_setActivityFilter(ISDS_activityFilter_t filter)
+int8_t ISDS_setActivityFilter(WE_sensorInterface_t *sensorInterface, ISDS_activityFilter_t filter)
 {
   ISDS_tapCfg_t tapCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
   {
     return WE_FAIL;
   }
 
   tapCfg.filterSelection = filter;
 
-  return WriteReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg);
+  return WriteReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg);
 }
 
 /**
  * @brief Read activity filter (HPF or SLOPE filter selection on wake-up and activity/inactivity functions)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] filter The returned activity filter
  * @retval Error code
  */
-int8_t ISDS_getActivityFilter(ISDS_activityFilter_t *filter)
+int8_t ISDS_getActivityFilter(WE_sensorInterface_t *sensorInterface, ISDS_activityFilter_t *filter)
 {
   ISDS_tapCfg_t tapCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
   {
     return WE_FAIL;
   }
@@ -3678,33 +3851,35 @@ int8_t ISDS_getActivityFilter(ISDS_activityFilter_t *filter)
 
 /**
  * @brief Set inactivity function
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] function Inactivity function
  * @retval Error code
  */
-int8_t ISDS_setInactivityFunction(ISDS_inactivityFunction_t function)
+int8_t ISDS_setInactivityFunction(WE_sensorInterface_t *sensorInterface, ISDS_inactivityFunction_t function)
 {
   ISDS_tapCfg_t tapCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
   {
     return WE_FAIL;
   }
 
   tapCfg.enInactivity = function;
 
-  return WriteReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg);
+  return WriteReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg);
 }
 
 /**
  * @brief Read inactivity function
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] function The returned inactivity function
  * @retval Error code
  */
-int8_t ISDS_getInactivityFunction(ISDS_inactivityFunction_t *function)
+int8_t ISDS_getInactivityFunction(WE_sensorInterface_t *sensorInterface, ISDS_inactivityFunction_t *function)
 {
   ISDS_tapCfg_t tapCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
   {
     return WE_FAIL;
   }
@@ -3716,33 +3891,35 @@ int8_t ISDS_getInactivityFunction(ISDS_inactivityFunction_t *function)
 
 /**
  * @brief Enable/disable interrupts
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] interruptsEnable Interrupts enable state
  * @retval Error code
  */
-int8_t ISDS_enableInterrupts(ISDS_state_t interruptsEnable)
+int8_t ISDS_enableInterrupts(WE_sensorInterface_t *sensorInterface, ISDS_state_t interruptsEnable)
 {
   ISDS_tapCfg_t tapCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
   {
     return WE_FAIL;
   }
 
   tapCfg.enInterrupts = interruptsEnable;
 
-  return WriteReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg);
+  return WriteReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg);
 }
 
 /**
  * @brief Check if interrupts are enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] interruptsEnable The returned interrupts enable state.
  * @retval Error code
  */
-int8_t ISDS_areInterruptsEnabled(ISDS_state_t *interruptsEnable)
+int8_t ISDS_areInterruptsEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *interruptsEnable)
 {
   ISDS_tapCfg_t tapCfg;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_CFG_REG, 1, (uint8_t *) &tapCfg))
   {
     return WE_FAIL;
   }
@@ -3757,33 +3934,35 @@ int8_t ISDS_areInterruptsEnabled(ISDS_state_t *interruptsEnable)
 
 /**
  * @brief Set the tap threshold
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] tapThreshold Tap threshold (5 bits)
  * @retval Error code
  */
-int8_t ISDS_setTapThreshold(uint8_t tapThreshold)
+int8_t ISDS_setTapThreshold(WE_sensorInterface_t *sensorInterface, uint8_t tapThreshold)
 {
   ISDS_tapThs6d_t tapThs6d;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d))
   {
     return WE_FAIL;
   }
 
   tapThs6d.tapThreshold = (tapThreshold & 0x1F);
 
-  return WriteReg(ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d);
+  return WriteReg(sensorInterface, ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d);
 }
 
 /**
  * @brief Read the tap threshold
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] tapThreshold The returned tap threshold
  * @retval Error code
  */
-int8_t ISDS_getTapThreshold(uint8_t *tapThreshold)
+int8_t ISDS_getTapThreshold(WE_sensorInterface_t *sensorInterface, uint8_t *tapThreshold)
 {
   ISDS_tapThs6d_t tapThs6d;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d))
   {
     return WE_FAIL;
   }
@@ -3795,33 +3974,35 @@ int8_t ISDS_getTapThreshold(uint8_t *tapThreshold)
 
 /**
  * @brief Set the 6D orientation detection threshold (degrees)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] threshold6D 6D orientation detection threshold
  * @retval Error code
  */
-int8_t ISDS_set6DThreshold(ISDS_sixDThreshold_t threshold6D)
+int8_t ISDS_set6DThreshold(WE_sensorInterface_t *sensorInterface, ISDS_sixDThreshold_t threshold6D)
 {
   ISDS_tapThs6d_t tapThs6d;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d))
   {
     return WE_FAIL;
   }
 
   tapThs6d.sixDThreshold = threshold6D;
 
-  return WriteReg(ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d);
+  return WriteReg(sensorInterface, ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d);
 }
 
 /**
  * @brief Read the 6D orientation detection threshold (degrees)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] threshold6D The returned 6D orientation detection threshold
  * @retval Error code
  */
-int8_t ISDS_get6DThreshold(ISDS_sixDThreshold_t *threshold6D)
+int8_t ISDS_get6DThreshold(WE_sensorInterface_t *sensorInterface, ISDS_sixDThreshold_t *threshold6D)
 {
   ISDS_tapThs6d_t tapThs6d;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d))
   {
     return WE_FAIL;
   }
@@ -3833,33 +4014,35 @@ int8_t ISDS_get6DThreshold(ISDS_sixDThreshold_t *threshold6D)
 
 /**
  * @brief Enable/disable 4D orientation detection
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] detection4D The 4D orientation detection enable state
  * @retval Error code
  */
-int8_t ISDS_enable4DDetection(ISDS_state_t detection4D)
+int8_t ISDS_enable4DDetection(WE_sensorInterface_t *sensorInterface, ISDS_state_t detection4D)
 {
   ISDS_tapThs6d_t tapThs6d;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d))
   {
     return WE_FAIL;
   }
 
   tapThs6d.fourDDetectionEnabled = detection4D;
 
-  return WriteReg(ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d);
+  return WriteReg(sensorInterface, ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d);
 }
 
 /**
  * @brief Check if 4D orientation detection is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] detection4D The returned 4D orientation detection enable state
  * @retval Error code
  */
-int8_t ISDS_is4DDetectionEnabled(ISDS_state_t *detection4D)
+int8_t ISDS_is4DDetectionEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *detection4D)
 {
   ISDS_tapThs6d_t tapThs6d;
 
-  if (WE_FAIL == ReadReg(ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TAP_THS_6D_REG, 1, (uint8_t *) &tapThs6d))
   {
     return WE_FAIL;
   }
@@ -3874,33 +4057,35 @@ int8_t ISDS_is4DDetectionEnabled(ISDS_state_t *detection4D)
 
 /**
  * @brief Set the maximum duration time gap for double-tap recognition (LATENCY)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] latencyTime Latency value (4 bits)
  * @retval Error code
  */
-int8_t ISDS_setTapLatencyTime(uint8_t latencyTime)
+int8_t ISDS_setTapLatencyTime(WE_sensorInterface_t *sensorInterface, uint8_t latencyTime)
 {
   ISDS_intDur2_t intDuration;
 
-  if (WE_FAIL == ReadReg(ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration))
   {
     return WE_FAIL;
   }
 
   intDuration.latency = (latencyTime & 0x0F);
 
-  return WriteReg(ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration);
+  return WriteReg(sensorInterface, ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration);
 }
 
 /**
  * @brief Read the maximum duration time gap for double-tap recognition (LATENCY)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] latencyTime The returned latency time
  * @retval Error code
  */
-int8_t ISDS_getTapLatencyTime(uint8_t *latencyTime)
+int8_t ISDS_getTapLatencyTime(WE_sensorInterface_t *sensorInterface, uint8_t *latencyTime)
 {
   ISDS_intDur2_t intDuration;
 
-  if (WE_FAIL == ReadReg(ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration))
   {
     return WE_FAIL;
   }
@@ -3912,34 +4097,36 @@ int8_t ISDS_getTapLatencyTime(uint8_t *latencyTime)
 
 /**
  * @brief Set the expected quiet time after a tap detection (QUIET)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] quietTime Quiet time value (2 bits)
  * @retval Error code
  */
-int8_t ISDS_setTapQuietTime(uint8_t quietTime)
+int8_t ISDS_setTapQuietTime(WE_sensorInterface_t *sensorInterface, uint8_t quietTime)
 {
   ISDS_intDur2_t intDuration;
 
-  if (WE_FAIL == ReadReg(ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration))
   {
     return WE_FAIL;
   }
 
   intDuration.quiet = (quietTime & 0x03);
 
-  return WriteReg(ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration);
+  return WriteReg(sensorInterface, ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration);
 }
 
 /**
  * @brief Read the expected quiet time after a tap detection (QUIET)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] quietTime The returned quiet time
  * @retval Error code
  */
-int8_t ISDS_getTapQuietTime(uint8_t *quietTime)
+int8_t ISDS_getTapQuietTime(WE_sensorInterface_t *sensorInterface, uint8_t *quietTime)
 {
 
   ISDS_intDur2_t intDuration;
 
-  if (WE_FAIL == ReadReg(ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration))
   {
     return WE_FAIL;
   }
@@ -3951,33 +4138,35 @@ int8_t ISDS_getTapQuietTime(uint8_t *quietTime)
 
 /**
  * @brief Set the maximum duration of over-threshold events (SHOCK)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] shockTime Shock time value (2 bits)
  * @retval Error code
  */
-int8_t ISDS_setTapShockTime(uint8_t shockTime)
+int8_t ISDS_setTapShockTime(WE_sensorInterface_t *sensorInterface, uint8_t shockTime)
 {
   ISDS_intDur2_t intDuration;
 
-  if (WE_FAIL == ReadReg(ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration))
   {
     return WE_FAIL;
   }
 
   intDuration.shock = (shockTime & 0x03);
 
-  return WriteReg(ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration);
+  return WriteReg(sensorInterface, ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration);
 }
 
 /**
  * @brief Read the maximum duration of over-threshold events (SHOCK)
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] shockTime The returned shock time.
  * @retval Error code
  */
-int8_t ISDS_getTapShockTime(uint8_t *shockTime)
+int8_t ISDS_getTapShockTime(WE_sensorInterface_t *sensorInterface, uint8_t *shockTime)
 {
   ISDS_intDur2_t intDuration;
 
-  if (WE_FAIL == ReadReg(ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_INT_DUR2_REG, 1, (uint8_t *) &intDuration))
   {
     return WE_FAIL;
   }
@@ -3992,33 +4181,35 @@ int8_t ISDS_getTapShockTime(uint8_t *shockTime)
 
 /**
  * @brief Set wake-up threshold
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] thresh Wake-up threshold (six bits)
  * @retval Error code
  */
-int8_t ISDS_setWakeUpThreshold(uint8_t thresh)
+int8_t ISDS_setWakeUpThreshold(WE_sensorInterface_t *sensorInterface, uint8_t thresh)
 {
   ISDS_wakeUpThs_t wakeUpThs;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_THS_REG, 1, (uint8_t *) &wakeUpThs))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_THS_REG, 1, (uint8_t *) &wakeUpThs))
   {
     return WE_FAIL;
   }
 
   wakeUpThs.wakeUpThreshold = (thresh & 0x3F);
 
-  return WriteReg(ISDS_WAKE_UP_THS_REG, 1, (uint8_t *) &wakeUpThs);
+  return WriteReg(sensorInterface, ISDS_WAKE_UP_THS_REG, 1, (uint8_t *) &wakeUpThs);
 }
 
 /**
  * @brief Read the wake-up threshold
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] thresh The returned wake-up threshold.
  * @retval Error code
  */
-int8_t ISDS_getWakeUpThreshold(uint8_t *thresh)
+int8_t ISDS_getWakeUpThreshold(WE_sensorInterface_t *sensorInterface, uint8_t *thresh)
 {
   ISDS_wakeUpThs_t wakeUpThs;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_THS_REG, 1, (uint8_t *) &wakeUpThs))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_THS_REG, 1, (uint8_t *) &wakeUpThs))
   {
     return WE_FAIL;
   }
@@ -4030,33 +4221,35 @@ int8_t ISDS_getWakeUpThreshold(uint8_t *thresh)
 
 /**
  * @brief Enable/disable the single and double-tap event OR only single-tap event
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] doubleTapEnable Tap event state [0: only single, 1: single and double-tap]
  * @retval Error code
  */
-int8_t ISDS_enableDoubleTapEvent(ISDS_state_t doubleTapEnable)
+int8_t ISDS_enableDoubleTapEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t doubleTapEnable)
 {
   ISDS_wakeUpThs_t wakeUpThs;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_THS_REG, 1, (uint8_t *) &wakeUpThs))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_THS_REG, 1, (uint8_t *) &wakeUpThs))
   {
     return WE_FAIL;
   }
 
   wakeUpThs.enDoubleTapEvent = doubleTapEnable;
 
-  return WriteReg(ISDS_WAKE_UP_THS_REG, 1, (uint8_t *) &wakeUpThs);
+  return WriteReg(sensorInterface, ISDS_WAKE_UP_THS_REG, 1, (uint8_t *) &wakeUpThs);
 }
 
 /**
  * @brief Check if double-tap events are enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] doubleTap The returned tap event state [0: only single, 1: single and double-tap]
  * @retval Error code
  */
-int8_t ISDS_isDoubleTapEventEnabled(ISDS_state_t *doubleTapEnable)
+int8_t ISDS_isDoubleTapEventEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *doubleTapEnable)
 {
   ISDS_wakeUpThs_t wakeUpThs;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_THS_REG, 1, (uint8_t *) &wakeUpThs))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_THS_REG, 1, (uint8_t *) &wakeUpThs))
   {
     return WE_FAIL;
   }
@@ -4071,33 +4264,35 @@ int8_t ISDS_isDoubleTapEventEnabled(ISDS_state_t *doubleTapEnable)
 
 /**
  * @brief Set the sleep mode duration
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] duration Sleep mode duration (4 bits)
  * @retval Error code
  */
-int8_t ISDS_setSleepDuration(uint8_t duration)
+int8_t ISDS_setSleepDuration(WE_sensorInterface_t *sensorInterface, uint8_t duration)
 {
   ISDS_wakeUpDur_t wakeUpDur;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
   {
     return WE_FAIL;
   }
 
   wakeUpDur.sleepDuration = (duration & 0x0F);
 
-  return WriteReg(ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur);
+  return WriteReg(sensorInterface, ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur);
 }
 
 /**
  * @brief Read the sleep mode duration
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] duration The returned sleep mode duration
  * @retval Error code
  */
-int8_t ISDS_getSleepDuration(uint8_t *duration)
+int8_t ISDS_getSleepDuration(WE_sensorInterface_t *sensorInterface, uint8_t *duration)
 {
   ISDS_wakeUpDur_t wakeUpDur;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
   {
     return WE_FAIL;
   }
@@ -4109,33 +4304,35 @@ int8_t ISDS_getSleepDuration(uint8_t *duration)
 
 /**
  * @brief Set the timestamp register resolution
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] resolution Timestamp register resolution
  * @retval Error code
  */
-int8_t ISDS_setTimestampResolution(ISDS_timestampResolution_t resolution)
+int8_t ISDS_setTimestampResolution(WE_sensorInterface_t *sensorInterface, ISDS_timestampResolution_t resolution)
 {
   ISDS_wakeUpDur_t wakeUpDur;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
   {
     return WE_FAIL;
   }
 
   wakeUpDur.timestampResolution = resolution;
 
-  return WriteReg(ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur);
+  return WriteReg(sensorInterface, ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur);
 }
 
 /**
  * @brief Read the timestamp register resolution
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] resolution The returned timestamp register resolution
  * @retval Error code
  */
-int8_t ISDS_getTimestampResolution(ISDS_timestampResolution_t *resolution)
+int8_t ISDS_getTimestampResolution(WE_sensorInterface_t *sensorInterface, ISDS_timestampResolution_t *resolution)
 {
   ISDS_wakeUpDur_t wakeUpDur;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
   {
     return WE_FAIL;
   }
@@ -4147,33 +4344,35 @@ int8_t ISDS_getTimestampResolution(ISDS_timestampResolution_t *resolution)
 
 /**
  * @brief Set wake-up duration
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] duration Wake-up duration (two bits)
  * @retval Error code
  */
-int8_t ISDS_setWakeUpDuration(uint8_t duration)
+int8_t ISDS_setWakeUpDuration(WE_sensorInterface_t *sensorInterface, uint8_t duration)
 {
   ISDS_wakeUpDur_t wakeUpDur;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
   {
     return WE_FAIL;
   }
 
   wakeUpDur.wakeUpDuration = (duration & 0x03);
 
-  return WriteReg(ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur);
+  return WriteReg(sensorInterface, ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur);
 }
 
 /**
  * @brief Read the wake-up duration
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] duration The returned wake-up duration (two bits)
  * @retval Error code
  */
-int8_t ISDS_getWakeUpDuration(uint8_t *duration)
+int8_t ISDS_getWakeUpDuration(WE_sensorInterface_t *sensorInterface, uint8_t *duration)
 {
   ISDS_wakeUpDur_t wakeUpDur;
 
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
   {
     return WE_FAIL;
   }
@@ -4188,33 +4387,35 @@ int8_t ISDS_getWakeUpDuration(uint8_t *duration)
 
 /**
  * @brief Set free-fall threshold
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] thresh Free-fall threshold value
  * @retval Error code
  */
-int8_t ISDS_setFreeFallThreshold(ISDS_freeFallThreshold_t thresh)
+int8_t ISDS_setFreeFallThreshold(WE_sensorInterface_t *sensorInterface, ISDS_freeFallThreshold_t thresh)
 {
   ISDS_freeFall_t freeFall;
 
-  if (WE_FAIL == ReadReg(ISDS_FREE_FALL_REG, 1, (uint8_t *) &freeFall))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FREE_FALL_REG, 1, (uint8_t *) &freeFall))
   {
     return WE_FAIL;
   }
 
   freeFall.freeFallThreshold = thresh;
 
-  return WriteReg(ISDS_FREE_FALL_REG, 1, (uint8_t *) &freeFall);
+  return WriteReg(sensorInterface, ISDS_FREE_FALL_REG, 1, (uint8_t *) &freeFall);
 }
 
 /**
  * @brief Read the free-fall threshold
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] thresh The returned free-fall threshold value
  * @retval Error code
  */
-int8_t ISDS_getFreeFallThreshold(ISDS_freeFallThreshold_t *thresh)
+int8_t ISDS_getFreeFallThreshold(WE_sensorInterface_t *sensorInterface, ISDS_freeFallThreshold_t *thresh)
 {
   ISDS_freeFall_t freeFall;
 
-  if (WE_FAIL == ReadReg(ISDS_FREE_FALL_REG, 1, (uint8_t *) &freeFall))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FREE_FALL_REG, 1, (uint8_t *) &freeFall))
   {
     return WE_FAIL;
   }
@@ -4226,19 +4427,20 @@ int8_t ISDS_getFreeFallThreshold(ISDS_freeFallThreshold_t *thresh)
 
 /**
  * @brief Set the free-fall duration (both LSB and MSB).
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] duration Free-fall duration (6 bits)
  * @retval Error code
  */
-int8_t ISDS_setFreeFallDuration(uint8_t duration)
+int8_t ISDS_setFreeFallDuration(WE_sensorInterface_t *sensorInterface, uint8_t duration)
 {
   ISDS_freeFall_t freeFall;
   ISDS_wakeUpDur_t wakeUpDur;
 
-  if (WE_FAIL == ReadReg(ISDS_FREE_FALL_REG, 1, (uint8_t *) &freeFall))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FREE_FALL_REG, 1, (uint8_t *) &freeFall))
   {
     return WE_FAIL;
   }
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
   {
     return WE_FAIL;
   }
@@ -4246,28 +4448,29 @@ int8_t ISDS_setFreeFallDuration(uint8_t duration)
   freeFall.freeFallDurationLSB = (uint8_t) (duration & 0x1F);
   wakeUpDur.freeFallDurationMSB = (uint8_t) ((duration >> 5) & 0x01);
 
-  if (WE_FAIL == WriteReg(ISDS_FREE_FALL_REG, 1, (uint8_t *) &freeFall))
+  if (WE_FAIL == WriteReg(sensorInterface, ISDS_FREE_FALL_REG, 1, (uint8_t *) &freeFall))
   {
     return WE_FAIL;
   }
-  return WriteReg(ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur);
+  return WriteReg(sensorInterface, ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur);
 }
 
 /**
  * @brief Read the free-fall duration (both LSB and MSB).
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] duration The returned free-fall duration (6 bits)
  * @retval Error code
  */
-int8_t ISDS_getFreeFallDuration(uint8_t *duration)
+int8_t ISDS_getFreeFallDuration(WE_sensorInterface_t *sensorInterface, uint8_t *duration)
 {
   ISDS_freeFall_t freeFall;
   ISDS_wakeUpDur_t wakeUpDur;
 
-  if (WE_FAIL == ReadReg(ISDS_FREE_FALL_REG, 1, (uint8_t *) &freeFall))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FREE_FALL_REG, 1, (uint8_t *) &freeFall))
   {
     return WE_FAIL;
   }
-  if (WE_FAIL == ReadReg(ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_WAKE_UP_DUR_REG, 1, (uint8_t *) &wakeUpDur))
   {
     return WE_FAIL;
   }
@@ -4283,33 +4486,35 @@ int8_t ISDS_getFreeFallDuration(uint8_t *duration)
 
 /**
  * @brief Enable/disable the timer end counter event interrupt on INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int0Timer Timer end counter event interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableTimerEndCounterINT0(ISDS_state_t int0Timer)
+int8_t ISDS_enableTimerEndCounterINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0Timer)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
 
   mde1Cfg.int0Timer = int0Timer;
 
-  return WriteReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
+  return WriteReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
 }
 
 /**
  * @brief Check if the timer end counter event interrupt on INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int0Timer The returned timer end counter event interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isTimerEndCounterINT0Enabled(ISDS_state_t *int0Timer)
+int8_t ISDS_isTimerEndCounterINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0Timer)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
@@ -4321,33 +4526,35 @@ int8_t ISDS_isTimerEndCounterINT0Enabled(ISDS_state_t *int0Timer)
 
 /**
  * @brief Enable/disable the tilt event interrupt on INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int0Tilt Tilt event interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableTiltINT0(ISDS_state_t int0Tilt)
+int8_t ISDS_enableTiltINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0Tilt)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
 
   mde1Cfg.int0Tilt = int0Tilt;
 
-  return WriteReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
+  return WriteReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
 }
 
 /**
  * @brief Check if the tilt event interrupt on INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int0Tilt The returned tilt event interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isTiltINT0Enabled(ISDS_state_t *int0Tilt)
+int8_t ISDS_isTiltINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0Tilt)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
@@ -4359,33 +4566,35 @@ int8_t ISDS_isTiltINT0Enabled(ISDS_state_t *int0Tilt)
 
 /**
  * @brief Enable/disable the 6D orientation change event interrupt on INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int06d 6D orientation change event interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enable6dINT0(ISDS_state_t int06d)
+int8_t ISDS_enable6dINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int06d)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
 
   mde1Cfg.int06d = int06d;
 
-  return WriteReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
+  return WriteReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
 }
 
 /**
  * @brief Check if the 6D orientation change event interrupt on INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int06d The returned 6D orientation change event interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_is6dINT0Enabled(ISDS_state_t *int06d)
+int8_t ISDS_is6dINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int06d)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
@@ -4397,33 +4606,35 @@ int8_t ISDS_is6dINT0Enabled(ISDS_state_t *int06d)
 
 /**
  * @brief Enable/disable the double-tap interrupt on INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int0DoubleTap The double-tap interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableDoubleTapINT0(ISDS_state_t int0DoubleTap)
+int8_t ISDS_enableDoubleTapINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0DoubleTap)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
 
   mde1Cfg.int0DoubleTap = int0DoubleTap;
 
-  return WriteReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
+  return WriteReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
 }
 
 /**
  * @brief Check if the double-tap interrupt on INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int0DoubleTap The returned double-tap interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isDoubleTapINT0Enabled(ISDS_state_t *int0DoubleTap)
+int8_t ISDS_isDoubleTapINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0DoubleTap)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
@@ -4435,33 +4646,35 @@ int8_t ISDS_isDoubleTapINT0Enabled(ISDS_state_t *int0DoubleTap)
 
 /**
  * @brief Enable/disable the free-fall interrupt on INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int0FreeFall Free-fall interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableFreeFallINT0(ISDS_state_t int0FreeFall)
+int8_t ISDS_enableFreeFallINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0FreeFall)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
 
   mde1Cfg.int0FreeFall = int0FreeFall;
 
-  return WriteReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
+  return WriteReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
 }
 
 /**
  * @brief Check if the free-fall interrupt on INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int0FreeFall The returned free-fall enable state
  * @retval Error code
  */
-int8_t ISDS_isFreeFallINT0Enabled(ISDS_state_t *int0FreeFall)
+int8_t ISDS_isFreeFallINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0FreeFall)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
@@ -4473,33 +4686,35 @@ int8_t ISDS_isFreeFallINT0Enabled(ISDS_state_t *int0FreeFall)
 
 /**
  * @brief Enable/disable the wake-up interrupt on INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int0WakeUp Wake-up interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableWakeUpINT0(ISDS_state_t int0WakeUp)
+int8_t ISDS_enableWakeUpINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0WakeUp)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
 
   mde1Cfg.int0WakeUp = int0WakeUp;
 
-  return WriteReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
+  return WriteReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
 }
 
 /**
  * @brief Check if the wake-up interrupt on INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int0WakeUp The returned wake-up interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isWakeUpINT0Enabled(ISDS_state_t *int0WakeUp)
+int8_t ISDS_isWakeUpINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0WakeUp)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
@@ -4511,33 +4726,35 @@ int8_t ISDS_isWakeUpINT0Enabled(ISDS_state_t *int0WakeUp)
 
 /**
  * @brief Enable/disable the single-tap interrupt on INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int0SingleTap Single-tap interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableSingleTapINT0(ISDS_state_t int0SingleTap)
+int8_t ISDS_enableSingleTapINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0SingleTap)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
 
   mde1Cfg.int0SingleTap = int0SingleTap;
 
-  return WriteReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
+  return WriteReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
 }
 
 /**
  * @brief Check if the single-tap interrupt on INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int0SingleTap The returned single-tap interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isSingleTapINT0Enabled(ISDS_state_t *int0SingleTap)
+int8_t ISDS_isSingleTapINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0SingleTap)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
@@ -4549,33 +4766,35 @@ int8_t ISDS_isSingleTapINT0Enabled(ISDS_state_t *int0SingleTap)
 
 /**
  * @brief Enable/disable the inactivity state interrupt on INT_0
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int0InactivityState Inactivity state interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableInactivityStateINT0(ISDS_state_t int0InactivityState)
+int8_t ISDS_enableInactivityStateINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0InactivityState)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
 
   mde1Cfg.int0InactivityState = int0InactivityState;
 
-  return WriteReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
+  return WriteReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg);
 }
 
 /**
  * @brief Check if the inactivity state interrupt on INT_0 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int0InactivityState The returned inactivity state interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isInactivityStateINT0Enabled(ISDS_state_t *int0InactivityState)
+int8_t ISDS_isInactivityStateINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0InactivityState)
 {
   ISDS_mde1Cfg_t mde1Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD1_CFG_REG, 1, (uint8_t *) &mde1Cfg))
   {
     return WE_FAIL;
   }
@@ -4590,33 +4809,35 @@ int8_t ISDS_isInactivityStateINT0Enabled(ISDS_state_t *int0InactivityState)
 
 /**
  * @brief Enable/disable the tilt event interrupt on INT_1
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int1Tilt Tilt event interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableTiltINT1(ISDS_state_t int1Tilt)
+int8_t ISDS_enableTiltINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1Tilt)
 {
   ISDS_mde2Cfg_t mde2Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
   {
     return WE_FAIL;
   }
 
   mde2Cfg.int1Tilt = int1Tilt;
 
-  return WriteReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg);
+  return WriteReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg);
 }
 
 /**
  * @brief Check if the tilt event interrupt on INT_1 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int1Tilt The returned tilt event interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isTiltINT1Enabled(ISDS_state_t *int1Tilt)
+int8_t ISDS_isTiltINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1Tilt)
 {
   ISDS_mde2Cfg_t mde2Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
   {
     return WE_FAIL;
   }
@@ -4628,33 +4849,35 @@ int8_t ISDS_isTiltINT1Enabled(ISDS_state_t *int1Tilt)
 
 /**
  * @brief Enable/disable the 6D orientation change event interrupt on INT_1
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int16d 6D orientation change event interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enable6dINT1(ISDS_state_t int16d)
+int8_t ISDS_enable6dINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int16d)
 {
   ISDS_mde2Cfg_t mde2Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
   {
     return WE_FAIL;
   }
 
   mde2Cfg.int16d = int16d;
 
-  return WriteReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg);
+  return WriteReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg);
 }
 
 /**
  * @brief Check if the 6D orientation change event interrupt on INT_1 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int16d The returned 6D orientation change event interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_is6dINT1Enabled(ISDS_state_t *int16d)
+int8_t ISDS_is6dINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int16d)
 {
   ISDS_mde2Cfg_t mde2Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
   {
     return WE_FAIL;
   }
@@ -4666,33 +4889,35 @@ int8_t ISDS_is6dINT1Enabled(ISDS_state_t *int16d)
 
 /**
  * @brief Enable/disable the double-tap interrupt on INT_1
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int1DoubleTap The double-tap interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableDoubleTapINT1(ISDS_state_t int1DoubleTap)
+int8_t ISDS_enableDoubleTapINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1DoubleTap)
 {
   ISDS_mde2Cfg_t mde2Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
   {
     return WE_FAIL;
   }
 
   mde2Cfg.int1DoubleTap = int1DoubleTap;
 
-  return WriteReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg);
+  return WriteReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg);
 }
 
 /**
  * @brief Check if the double-tap interrupt on INT_1 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int1DoubleTap The returned double-tap interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isDoubleTapINT1Enabled(ISDS_state_t *int1DoubleTap)
+int8_t ISDS_isDoubleTapINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1DoubleTap)
 {
   ISDS_mde2Cfg_t mde2Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
   {
     return WE_FAIL;
   }
@@ -4704,33 +4929,35 @@ int8_t ISDS_isDoubleTapINT1Enabled(ISDS_state_t *int1DoubleTap)
 
 /**
  * @brief Enable/disable the free-fall interrupt on INT_1
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int1FreeFall Free-fall interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableFreeFallINT1(ISDS_state_t int1FreeFall)
+int8_t ISDS_enableFreeFallINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1FreeFall)
 {
   ISDS_mde2Cfg_t mde2Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
   {
     return WE_FAIL;
   }
 
   mde2Cfg.int1FreeFall = int1FreeFall;
 
-  return WriteReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg);
+  return WriteReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg);
 }
 
 /**
  * @brief Check if the free-fall interrupt on INT_1 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int1FreeFall The returned free-fall enable state
  * @retval Error code
  */
-int8_t ISDS_isFreeFallINT1Enabled(ISDS_state_t *int1FreeFall)
+int8_t ISDS_isFreeFallINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1FreeFall)
 {
   ISDS_mde2Cfg_t mde2Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
   {
     return WE_FAIL;
   }
@@ -4742,33 +4969,35 @@ int8_t ISDS_isFreeFallINT1Enabled(ISDS_state_t *int1FreeFall)
 
 /**
  * @brief Enable/disable the wake-up interrupt on INT_1
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int1WakeUp Wake-up interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableWakeUpINT1(ISDS_state_t int1WakeUp)
+int8_t ISDS_enableWakeUpINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1WakeUp)
 {
   ISDS_mde2Cfg_t mde2Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
   {
     return WE_FAIL;
   }
 
   mde2Cfg.int1WakeUp = int1WakeUp;
 
-  return WriteReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg);
+  return WriteReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg);
 }
 
 /**
  * @brief Check if the wake-up interrupt on INT_1 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int1WakeUp The returned wake-up interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isWakeUpINT1Enabled(ISDS_state_t *int1WakeUp)
+int8_t ISDS_isWakeUpINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1WakeUp)
 {
   ISDS_mde2Cfg_t mde2Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
   {
     return WE_FAIL;
   }
@@ -4780,33 +5009,35 @@ int8_t ISDS_isWakeUpINT1Enabled(ISDS_state_t *int1WakeUp)
 
 /**
  * @brief Enable/disable the single-tap interrupt on INT_1
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int1SingleTap Single-tap interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableSingleTapINT1(ISDS_state_t int1SingleTap)
+int8_t ISDS_enableSingleTapINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1SingleTap)
 {
   ISDS_mde2Cfg_t mde2Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
   {
     return WE_FAIL;
   }
 
   mde2Cfg.int1SingleTap = int1SingleTap;
 
-  return WriteReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg);
+  return WriteReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg);
 }
 
 /**
  * @brief Check if the single-tap interrupt on INT_1 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int1SingleTap The returned single-tap interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isSingleTapINT1Enabled(ISDS_state_t *int1SingleTap)
+int8_t ISDS_isSingleTapINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1SingleTap)
 {
   ISDS_mde2Cfg_t mde2Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
   {
     return WE_FAIL;
   }
@@ -4818,33 +5049,35 @@ int8_t ISDS_isSingleTapINT1Enabled(ISDS_state_t *int1SingleTap)
 
 /**
  * @brief Enable/disable the inactivity state interrupt on INT_1
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] int1InactivityState Inactivity state interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_enableInactivityStateINT1(ISDS_state_t int1InactivityState)
+int8_t ISDS_enableInactivityStateINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1InactivityState)
 {
   ISDS_mde2Cfg_t mde2Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
   {
     return WE_FAIL;
   }
 
   mde2Cfg.int1InactivityState = int1InactivityState;
 
-  return WriteReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg);
+  return WriteReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg);
 }
 
 /**
  * @brief Check if the inactivity state interrupt on INT_1 is enabled
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] int1InactivityState The returned inactivity state interrupt enable state
  * @retval Error code
  */
-int8_t ISDS_isInactivityStateINT1Enabled(ISDS_state_t *int1InactivityState)
+int8_t ISDS_isInactivityStateINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1InactivityState)
 {
   ISDS_mde2Cfg_t mde2Cfg;
 
-  if (WE_FAIL == ReadReg(ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_MD2_CFG_REG, 1, (uint8_t *) &mde2Cfg))
   {
     return WE_FAIL;
   }
@@ -4863,14 +5096,15 @@ int8_t ISDS_isInactivityStateINT1Enabled(ISDS_state_t *int1InactivityState)
  * Note that the integrity of the timestamp cannot be guaranteed (the
  * 8-bit words of the timestamp might be overwritten while reading).
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] timestamp Current timestamp (24 bits)
  * @retval Error code
  */
-int8_t ISDS_getTimestamp(uint32_t *timestamp)
+int8_t ISDS_getTimestamp(WE_sensorInterface_t *sensorInterface, uint32_t *timestamp)
 {
   uint8_t tmp[3] = {0};
 
-  if (WE_FAIL == ReadReg(ISDS_TIMESTAMP0_REG, 3, tmp))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_TIMESTAMP0_REG, 3, tmp))
   {
     return WE_FAIL;
   }
@@ -4884,12 +5118,13 @@ int8_t ISDS_getTimestamp(uint32_t *timestamp)
 
 /**
  * @brief Reset the timestamp counter to zero
+ * @param[in] sensorInterface Pointer to sensor interface
  * @retval Error code
  */
-int8_t ISDS_resetTimestampCounter()
+int8_t ISDS_resetTimestampCounter(WE_sensorInterface_t *sensorInterface)
 {
   uint8_t resetCommand = 0xAA;
-  return WriteReg(ISDS_TIMESTAMP2_REG, 1, &resetCommand);
+  return WriteReg(sensorInterface, ISDS_TIMESTAMP2_REG, 1, &resetCommand);
 }
 
 
@@ -4899,62 +5134,68 @@ int8_t ISDS_resetTimestampCounter()
 
 /**
  * @brief Set the user offset for axis X
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] offsetValueXAxis User offset for axis X
  * @retval Error code
  */
-int8_t ISDS_setOffsetValueX(int8_t offsetValueXAxis)
+int8_t ISDS_setOffsetValueX(WE_sensorInterface_t *sensorInterface, int8_t offsetValueXAxis)
 {
-  return WriteReg(ISDS_X_OFS_USR_REG, 1, (uint8_t *) &offsetValueXAxis);
+  return WriteReg(sensorInterface, ISDS_X_OFS_USR_REG, 1, (uint8_t *) &offsetValueXAxis);
 }
 
 /**
  * @brief Read the user offset for axis X
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] offsetValueXAxis The returned user offset for axis X
  * @retval Error code
  */
-int8_t ISDS_getOffsetValueX(int8_t *offsetValueXAxis)
+int8_t ISDS_getOffsetValueX(WE_sensorInterface_t *sensorInterface, int8_t *offsetValueXAxis)
 {
-  return ReadReg(ISDS_X_OFS_USR_REG, 1, (uint8_t *) offsetValueXAxis);
+  return ReadReg(sensorInterface, ISDS_X_OFS_USR_REG, 1, (uint8_t *) offsetValueXAxis);
 }
 
 /**
  * @brief Set the user offset for axis Y
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] offsetValueYAxis User offset for axis Y
  * @retval Error code
  */
-int8_t ISDS_setOffsetValueY(int8_t offsetValueYAxis)
+int8_t ISDS_setOffsetValueY(WE_sensorInterface_t *sensorInterface, int8_t offsetValueYAxis)
 {
-  return WriteReg(ISDS_Y_OFS_USR_REG, 1, (uint8_t *) &offsetValueYAxis);
+  return WriteReg(sensorInterface, ISDS_Y_OFS_USR_REG, 1, (uint8_t *) &offsetValueYAxis);
 }
 
 /**
  * @brief Read the user offset for axis Y
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] offsetValueYAxis The returned user offset for axis Y
  * @retval Error code
  */
-int8_t ISDS_getOffsetValueY(int8_t *offsetValueYAxis)
+int8_t ISDS_getOffsetValueY(WE_sensorInterface_t *sensorInterface, int8_t *offsetValueYAxis)
 {
-  return ReadReg(ISDS_Y_OFS_USR_REG, 1, (uint8_t *) offsetValueYAxis);
+  return ReadReg(sensorInterface, ISDS_Y_OFS_USR_REG, 1, (uint8_t *) offsetValueYAxis);
 }
 
 /**
  * @brief Set the user offset for axis Z
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] offsetValueZAxis The user offset for axis Z
  * @retval Error code
  */
-int8_t ISDS_setOffsetValueZ(int8_t offsetValueZAxis)
+int8_t ISDS_setOffsetValueZ(WE_sensorInterface_t *sensorInterface, int8_t offsetValueZAxis)
 {
-  return WriteReg(ISDS_Z_OFS_USR_REG, 1, (uint8_t *) &offsetValueZAxis);
+  return WriteReg(sensorInterface, ISDS_Z_OFS_USR_REG, 1, (uint8_t *) &offsetValueZAxis);
 }
 
 /**
  * @brief Read the user offset for axis Z
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] offsetValueZAxis The returned user offset for axis Z
  * @retval Error code
  */
-int8_t ISDS_getOffsetValueZ(int8_t *offsetValueZAxis)
+int8_t ISDS_getOffsetValueZ(WE_sensorInterface_t *sensorInterface, int8_t *offsetValueZAxis)
 {
-  return ReadReg(ISDS_Z_OFS_USR_REG, 1, (uint8_t *) offsetValueZAxis);
+  return ReadReg(sensorInterface, ISDS_Z_OFS_USR_REG, 1, (uint8_t *) offsetValueZAxis);
 }
 
 
@@ -4969,13 +5210,506 @@ int8_t ISDS_getOffsetValueZ(int8_t *offsetValueZAxis)
  * ISDS_getFifoPattern() or ISDS_getFifoStatus()). Before reading FIFO data to
  * determine the type of the next value read.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[in] numSamples The number of values to be read
  * @param[out] fifoData The returned values (must provide pointer to buffer of length numSamples)
  * @retval Error code
  */
-int8_t ISDS_getFifoData(uint16_t numSamples, uint16_t *fifoData)
+int8_t ISDS_getFifoData(WE_sensorInterface_t *sensorInterface, uint16_t numSamples, uint16_t *fifoData)
+{
+  return ReadReg(sensorInterface, ISDS_FIFO_DATA_OUT_L_REG, numSamples * 2, (uint8_t *) fifoData);
+}
+
+
+/* FIFO pattern decoder */
+
+/**
+ * @brief Decimation factors of ISDS_fifoDecimation_t, 0 if the data set is not stored
+ */
+static const uint8_t ISDS_fifoDecimationFactors[8] = { 0, 1, 2, 3, 4, 8, 16, 32 };
+
+/**
+ * @brief Move the decoder to the first word of the next data set stored in the FIFO
+ * @param[in] decoder Pointer to the FIFO pattern decoder
+ * @retval 1 if the next data set belongs to the next FIFO cycle, 0 otherwise
+ */
+static uint8_t ISDS_nextFifoSet(ISDS_fifoDecoder_t *decoder)
+{
+  uint8_t newCycle = 0;
+
+  decoder->word = 0;
+  do
+  {
+    if (++decoder->set > 3)
+    {
+      decoder->set = 0;
+      decoder->cycle = (uint8_t) ((decoder->cycle + 1) % decoder->cycles);
+      newCycle = 1;
+    }
+  } while ((0 == decoder->factors[decoder->set]) ||
+           (0 != (decoder->cycle % decoder->factors[decoder->set])));
+
+  return newCycle;
+}
+
+/**
+ * @brief Set up the FIFO pattern decoder for the current FIFO configuration
+ *
+ * The decimation, timestamp and temperature settings are read from the
+ * register cache. The decoder is reset only if they have changed since the last
+ * call, so this can be called before every FIFO read. Reset the decoder by
+ * setting its length to 0 before the first call.
+ *
+ * @param[in] sensorInterface Pointer to sensor interface
+ * @param[in,out] decoder Pointer to the FIFO pattern decoder
+ * @retval Error code
+ */
+int8_t ISDS_updateFifoDecoder(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecoder_t *decoder)
+{
+  uint8_t config[3];
+  uint8_t lcm = 1;
+
+  /* FIFO_CTRL_2 ... FIFO_CTRL_4 */
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_FIFO_CTRL_2_REG, 3, config))
+  {
+    return WE_FAIL;
+  }
+
+  if ((0 != decoder->length) &&
+      (config[0] == decoder->config[0]) && (config[1] == decoder->config[1]) && (config[2] == decoder->config[2]))
+  {
+    return WE_SUCCESS;
+  }
+
+  decoder->config[0] = config[0];
+  decoder->config[1] = config[1];
+  decoder->config[2] = config[2];
+  decoder->factors[0] = ISDS_fifoDecimationFactors[((ISDS_fifoCtrl3_t *) &config[1])->fifoGyroDecimation];
+  decoder->factors[1] = ISDS_fifoDecimationFactors[((ISDS_fifoCtrl3_t *) &config[1])->fifoAccDecimation];
+  decoder->factors[2] = ISDS_fifoDecimationFactors[((ISDS_fifoCtrl4_t *) &config[2])->fifoThirdDecimation];
+  decoder->factors[3] = ISDS_fifoDecimationFactors[((ISDS_fifoCtrl4_t *) &config[2])->fifoFourthDecimation];
+
+  /* the pattern repeats after the least common multiple of the factors */
+  for (uint8_t set = 0; set < 4; set++)
+  {
+    uint8_t factor = decoder->factors[set];
+    uint8_t a = lcm;
+    uint8_t b = factor;
+    if (0 == factor)
+    {
+      continue;
+    }
+    while (0 != b)
+    {
+      uint8_t r = a % b;
+      a = b;
+      b = r;
+    }
+    lcm = (uint8_t) (lcm / a * factor);
+  }
+  decoder->cycles = lcm;
+  decoder->length = 0;
+  for (uint8_t set = 0; set < 4; set++)
+  {
+    if (0 != decoder->factors[set])
+    {
+      decoder->length += 3 * (lcm / decoder->factors[set]);
+    }
+  }
+
+  /* resynchronized by the next ISDS_syncFifoDecoder() */
+  decoder->pattern = 0xFFFF;
+  return WE_SUCCESS;
+}
+
+/**
+ * @brief Synchronize the FIFO pattern decoder with the pattern index of the next FIFO word
+ *
+ * If the pattern index is not the one expected by the decoder (e.g. first
+ * read, FIFO overrun or reset), the frame being decoded is dropped and
+ * decoding continues with the next complete frame.
+ *
+ * @param[in,out] decoder Pointer to the FIFO pattern decoder
+ * @param[in] fifoPattern Pattern index of the next word, from ISDS_getFifoStatus() or ISDS_getFifoPattern()
+ */
+void ISDS_syncFifoDecoder(ISDS_fifoDecoder_t *decoder, uint16_t fifoPattern)
+{
+  uint16_t index = 0;
+
+  if ((0 == decoder->length) || (fifoPattern == decoder->pattern))
+  {
+    return;
+  }
+
+  /* locate the pattern index, starting at the first data set of cycle 0 */
+  decoder->set = 3;
+  decoder->cycle = (uint8_t) (decoder->cycles - 1);
+  ISDS_nextFifoSet(decoder);
+  fifoPattern %= decoder->length;
+  while (index + 3 <= fifoPattern)
+  {
+    ISDS_nextFifoSet(decoder);
+    index += 3;
+  }
+  decoder->word = (uint8_t) (fifoPattern - index);
+  decoder->pattern = fifoPattern;
+
+  /* the frame is complete only if the first set of the cycle is read from its first word */
+  decoder->frame.sets = 0;
+  decoder->frame.cycle = decoder->cycle;
+  decoder->complete = 0;
+  if (0 == decoder->word)
+  {
+    uint8_t first = 0;
+    while ((0 == decoder->factors[first]) || (0 != (decoder->cycle % decoder->factors[first])))
+    {
+      first++;
+    }
+    decoder->complete = (first == decoder->set) ? 1 : 0;
+  }
+}
+
+/**
+ * @brief Get the number of FIFO words to read for a number of frames
+ * @param[in] decoder Pointer to the FIFO pattern decoder
+ * @param[in] numFrames Number of frames, the frame being decoded counts as the first one
+ * @retval Number of words up to the end of the last frame
+ */
+uint16_t ISDS_getFifoFrameWords(const ISDS_fifoDecoder_t *decoder, uint16_t numFrames)
 {
-  return ReadReg(ISDS_FIFO_DATA_OUT_L_REG, numSamples * 2, (uint8_t *) fifoData);
+  ISDS_fifoDecoder_t position = *decoder;
+  uint16_t words = 0;
+
+  if ((0 == decoder->length) || (0xFFFF == decoder->pattern))
+  {
+    return 0;
+  }
+
+  words = 3 - position.word;
+  while (numFrames > 0)
+  {
+    if (ISDS_nextFifoSet(&position))
+    {
+      numFrames--;
+      if (0 == numFrames)
+      {
+        break;
+      }
+    }
+    words += 3;
+  }
+  return words;
+}
+
+/**
+ * @brief Decode the next word read from the FIFO
+ * @param[in,out] decoder Pointer to the FIFO pattern decoder, synchronized by ISDS_syncFifoDecoder()
+ * @param[in] word Word read from the FIFO
+ * @param[out] frame Decoded frame, written when all data sets of a FIFO cycle have been decoded
+ * @retval 1 if a frame has been written, 0 if not, WE_FAIL if the decoder is not synchronized
+ */
+int8_t ISDS_decodeFifoWord(ISDS_fifoDecoder_t *decoder, uint16_t word, ISDS_fifoFrame_t *frame)
+{
+  ISDS_fifoFrame_t *current = &decoder->frame;
+  uint8_t axis = decoder->word;
+
+  if ((0 == decoder->length) || (0xFFFF == decoder->pattern))
+  {
+    return WE_FAIL;
+  }
+
+  switch (decoder->set)
+  {
+  case 0:
+    current->gyro[axis] = (int16_t) word;
+    break;
+  case 1:
+    current->acc[axis] = (int16_t) word;
+    break;
+  case 2:
+    current->third[axis] = word;
+    break;
+  default:
+    current->fourth[axis] = word;
+    break;
+  }
+
+  decoder->pattern = (uint16_t) ((decoder->pattern + 1) % decoder->length);
+  if (++decoder->word < 3)
+  {
+    return 0;
+  }
+
+  current->sets |= (uint8_t) (1 << decoder->set);
+  if ((3 == decoder->set) && ((ISDS_fifoCtrl2_t *) &decoder->config[0])->enFifoTemperature)
+  {
+    /* OUT_TEMP, two unused words */
+    current->temperature = (int16_t) current->fourth[0];
+    current->sets |= ISDS_FIFO_SET_TEMP;
+  }
+  else if ((3 == decoder->set) && ((ISDS_fifoCtrl2_t *) &decoder->config[0])->enFifoTimestamp)
+  {
+    /* TIMESTAMP[15:8], TIMESTAMP[23:16], unused, TIMESTAMP[7:0], STEP_COUNTER */
+    current->timestamp = ((uint32_t) (current->fourth[0] >> 8) << 16) |
+                         ((uint32_t) (current->fourth[0] & 0xFF) << 8) |
+                         (uint32_t) (current->fourth[1] >> 8);
+    current->steps = current->fourth[2];
+  }
+
+  if (0 == ISDS_nextFifoSet(decoder))
+  {
+    return 0;
+  }
+
+  /* all data sets of the cycle have been read */
+  int8_t result = 0;
+  if (decoder->complete)
+  {
+    *frame = *current;
+    result = 1;
+  }
+  current->sets = 0;
+  current->cycle = decoder->cycle;
+  decoder->complete = 1;
+  return result;
+}
+
+/**
+ * @brief Get the FIFO decimation that stores a sensor's samples at the sensor's output data rate
+ *
+ * The ODR settings 1 ... 10 of the FIFO, the accelerometer and the gyroscope
+ * double from one setting to the next (12.5 Hz ... 6.66 kHz), so the FIFO ODR is
+ * a power of two multiple of the sensor ODR. The accelerometer's 1.6 Hz setting
+ * counts as 12.5 Hz / 8. A sensor running at or above the FIFO ODR is stored
+ * without decimation, i.e. at the FIFO ODR.
+ *
+ * @param[in] fifoOdr FIFO output data rate
+ * @param[in] sensorOdr Accelerometer or gyroscope output data rate (ISDS_accOutputDataRate_t or ISDS_gyroOutputDataRate_t)
+ * @param[out] decimation The returned decimation, ISDS_fifoDecimationNoFifo if the FIFO or the sensor is off
+ * @retval Error code, WE_FAIL if the FIFO ODR is more than 32 times the sensor ODR
+ */
+int8_t ISDS_getFifoDecimation(ISDS_fifoOutputDataRate_t fifoOdr, uint8_t sensorOdr, ISDS_fifoDecimation_t *decimation)
+{
+  int8_t ratio;
+
+  if ((fifoOdr > ISDS_fifoOdr6k66Hz) || (sensorOdr > ISDS_accOdr1Hz6))
+  {
+    return WE_FAIL;
+  }
+
+  if ((ISDS_fifoOdrOff == fifoOdr) || (ISDS_accOdrOff == sensorOdr))
+  {
+    *decimation = ISDS_fifoDecimationNoFifo;
+    return WE_SUCCESS;
+  }
+
+  /* log2(FIFO ODR / sensor ODR) */
+  ratio = (int8_t) fifoOdr - ((ISDS_accOdr1Hz6 == sensorOdr) ? -2 : (int8_t) sensorOdr);
+
+  if (ratio <= 0)
+  {
+    *decimation = ISDS_fifoDecimationDisabled;
+  }
+  else if (1 == ratio)
+  {
+    *decimation = ISDS_fifoDecimationFactor2;
+  }
+  else if (ratio <= 5)
+  {
+    /* Factors 4, 8, 16 and 32 */
+    *decimation = (ISDS_fifoDecimation_t) (ratio + 2);
+  }
+  else
+  {
+    return WE_FAIL;
+  }
+
+  return WE_SUCCESS;
+}
+
+/**
+ * @brief Check a rate plan and compute the FIFO decimation of both sensors
+ *
+ * The accelerometer and gyroscope ODRs, full scales and the FIFO ODR are chosen
+ * independently; each sensor is then stored in the FIFO at its own ODR. The FIFO
+ * ODR must not exceed the ODR of the fastest sensor stored, otherwise FIFO cycles
+ * would be spent without data.
+ *
+ * @param[in,out] plan Rate plan, accDecimation and gyroDecimation are set
+ * @retval Error code, WE_FAIL if a setting is invalid or the rates are incompatible
+ */
+int8_t ISDS_planRates(ISDS_ratePlan_t *plan)
+{
+  if ((plan->accFullScale >= ISDS_accFullScaleInvalid) ||
+      (plan->gyroOdr > ISDS_gyroOdr6k66Hz) ||
+      ((plan->gyroFullScale != ISDS_gyroFullScale125dps) &&
+       (plan->gyroFullScale != ISDS_gyroFullScale250dps) &&
+       (plan->gyroFullScale != ISDS_gyroFullScale500dps) &&
+       (plan->gyroFullScale != ISDS_gyroFullScale1000dps) &&
+       (plan->gyroFullScale != ISDS_gyroFullScale2000dps)))
+  {
+    return WE_FAIL;
+  }
+
+  if ((WE_FAIL == ISDS_getFifoDecimation(plan->fifoOdr, (uint8_t) plan->accOdr, &plan->accDecimation)) ||
+      (WE_FAIL == ISDS_getFifoDecimation(plan->fifoOdr, (uint8_t) plan->gyroOdr, &plan->gyroDecimation)))
+  {
+    return WE_FAIL;
+  }
+
+  if ((ISDS_fifoOdrOff != plan->fifoOdr) &&
+      (ISDS_fifoDecimationDisabled != plan->accDecimation) &&
+      (ISDS_fifoDecimationDisabled != plan->gyroDecimation))
+  {
+    /* Neither sensor is stored at the FIFO ODR */
+    return WE_FAIL;
+  }
+
+  return WE_SUCCESS;
+}
+
+/**
+ * @brief Initialize the mapping of the timestamp counter to the host clock
+ * @param[out] clock Timestamp clock
+ * @param[in] resolution Timestamp resolution set with ISDS_setTimestampResolution()
+ */
+void ISDS_initTimestampClock(ISDS_timestampClock_t *clock, ISDS_timestampResolution_t resolution)
+{
+  clock->tickUs = (ISDS_timestampResolution25mus == resolution) ? 25 : 6400;
+  clock->ticks = 0;
+  clock->sensorUs = 0;
+  clock->residue = 0;
+  clock->driftPpm = 0;
+  clock->offsetUs = 0;
+  clock->windowMinUs = 0;
+  clock->lastWindowMinUs = 0;
+  clock->windowStartUs = 0;
+  clock->state = ISDS_timestampClockNew;
+}
+
+/**
+ * @brief Convert a timestamp counter value to the drift corrected sensor time
+ *
+ * The 24 bit counter is unwrapped against the newest value seen, so values up to
+ * half a counter period (209 s at 25 µs, 14.9 h at 6.4 ms) older or newer than it
+ * are converted correctly, in any order. Newer values become the new reference.
+ *
+ * @param[in,out] clock Timestamp clock
+ * @param[in] ticks Timestamp counter value (e.g. ISDS_getTimestamp() or ISDS_fifoFrame_t.timestamp)
+ * @retval Sensor time in [µs]
+ */
+uint32_t ISDS_getSensorTime(ISDS_timestampClock_t *clock, uint32_t ticks)
+{
+  int32_t delta;
+  int64_t deltaUs;
+  int64_t correction;
+
+  ticks &= 0xFFFFFF;
+
+  if (ISDS_timestampClockNew == clock->state)
+  {
+    clock->ticks = ticks;
+    clock->sensorUs = ticks * clock->tickUs;
+    clock->state = ISDS_timestampClockFree;
+    return clock->sensorUs;
+  }
+
+  /* Signed distance to the reference, across counter wraps */
+  delta = (int32_t) ((ticks - clock->ticks) & 0xFFFFFF);
+  if (0 != (delta & 0x800000))
+  {
+    delta -= 0x1000000;
+  }
+
+  deltaUs = (int64_t) delta * clock->tickUs;
+  correction = deltaUs * clock->driftPpm;
+
+  if (delta <= 0)
+  {
+    return clock->sensorUs + (uint32_t) (deltaUs + correction / 1000000);
+  }
+
+  correction += clock->residue;
+  clock->residue = (int32_t) (correction % 1000000);
+  clock->ticks = ticks;
+  clock->sensorUs += (uint32_t) (deltaUs + correction / 1000000);
+
+  return clock->sensorUs;
+}
+
+/**
+ * @brief Update the offset and the drift of the timestamp clock against the host clock
+ *
+ * Call with a counter value read directly from the timestamp registers and the
+ * host time of the read. The read latency only ever adds to the host minus sensor
+ * time, so its lowest value is taken as the offset, and the trend of the lowest
+ * value per ISDS_TIMESTAMP_SYNC_WINDOW_US as the rate error left after the drift
+ * correction.
+ *
+ * @param[in,out] clock Timestamp clock
+ * @param[in] ticks Timestamp counter value
+ * @param[in] hostUs Host time of the read in [µs], e.g. micros()
+ */
+void ISDS_syncTimestampClock(ISDS_timestampClock_t *clock, uint32_t ticks, uint32_t hostUs)
+{
+  int32_t diff = (int32_t) (hostUs - ISDS_getSensorTime(clock, ticks));
+  uint32_t elapsed;
+
+  if (clock->state < ISDS_timestampClockSynced)
+  {
+    clock->offsetUs = diff;
+    clock->windowMinUs = diff;
+    clock->windowStartUs = hostUs;
+    clock->state = ISDS_timestampClockSynced;
+    return;
+  }
+
+  if (diff < clock->offsetUs)
+  {
+    clock->offsetUs = diff;
+  }
+  if (diff < clock->windowMinUs)
+  {
+    clock->windowMinUs = diff;
+  }
+
+  elapsed = hostUs - clock->windowStartUs;
+  if (elapsed < ISDS_TIMESTAMP_SYNC_WINDOW_US)
+  {
+    return;
+  }
+
+  if (ISDS_timestampClockTracking == clock->state)
+  {
+    int32_t errorPpm = (int32_t) (((int64_t) (clock->windowMinUs - clock->lastWindowMinUs) * 1000000) / (int32_t) elapsed);
+
+    clock->driftPpm += errorPpm / ISDS_TIMESTAMP_DRIFT_GAIN;
+    if (clock->driftPpm > ISDS_TIMESTAMP_MAX_DRIFT_PPM)
+    {
+      clock->driftPpm = ISDS_TIMESTAMP_MAX_DRIFT_PPM;
+    }
+    else if (clock->driftPpm < -ISDS_TIMESTAMP_MAX_DRIFT_PPM)
+    {
+      clock->driftPpm = -ISDS_TIMESTAMP_MAX_DRIFT_PPM;
+    }
+  }
+
+  clock->offsetUs = clock->windowMinUs;
+  clock->lastWindowMinUs = clock->windowMinUs;
+  clock->windowMinUs = diff;
+  clock->windowStartUs = hostUs;
+  clock->state = ISDS_timestampClockTracking;
+}
+
+/**
+ * @brief Convert a timestamp counter value to the host time
+ * @param[in,out] clock Timestamp clock, synchronized with ISDS_syncTimestampClock()
+ * @param[in] ticks Timestamp counter value
+ * @retval Host time in [µs]
+ */
+uint32_t ISDS_getHostTime(ISDS_timestampClock_t *clock, uint32_t ticks)
+{
+  return ISDS_getSensorTime(clock, ticks) + (uint32_t) clock->offsetUs;
 }
 
 
@@ -4983,92 +5717,96 @@ int8_t ISDS_getFifoData(uint16_t numSamples, uint16_t *fifoData)
 /**
  * @brief Reads the X-axis angular rate in [mdps]
  *
- * Note that this functions relies on the current gyroscope full scale value.
- * Make sure that the current gyroscope full scale value is known by calling
- * ISDS_setGyroFullScale() or ISDS_getGyroFullScale() at least once prior to
- * calling this function.
+ * The gyroscope full scale is read from CTRL_2_G, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] xRate X-axis angular rate in [mdps]
  * @retval Error code
  */
-int8_t ISDS_getAngularRateX_float(float *xRate)
+int8_t ISDS_getAngularRateX_float(WE_sensorInterface_t *sensorInterface, float *xRate)
 {
   int16_t rawRate;
-  if (WE_FAIL == ISDS_getRawAngularRateX(&rawRate))
+  ISDS_gyroFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getGyroFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAngularRateX(sensorInterface, &rawRate)))
   {
     return WE_FAIL;
   }
-  *xRate = ISDS_convertAngularRate_float(rawRate, currentGyroFullScale);
+  *xRate = ISDS_convertAngularRate_float(rawRate, fullScale);
   return WE_SUCCESS;
 }
 
 /**
  * @brief Reads the Y-axis angular rate in [mdps]
  *
- * Note that this functions relies on the current gyroscope full scale value.
- * Make sure that the current gyroscope full scale value is known by calling
- * ISDS_setGyroFullScale() or ISDS_getGyroFullScale() at least once prior to
- * calling this function.
+ * The gyroscope full scale is read from CTRL_2_G, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] yRate Y-axis angular rate in [mdps]
  * @retval Error code
  */
-int8_t ISDS_getAngularRateY_float(float *yRate)
+int8_t ISDS_getAngularRateY_float(WE_sensorInterface_t *sensorInterface, float *yRate)
 {
   int16_t rawRate;
-  if (WE_FAIL == ISDS_getRawAngularRateY(&rawRate))
+  ISDS_gyroFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getGyroFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAngularRateY(sensorInterface, &rawRate)))
   {
     return WE_FAIL;
   }
-  *yRate = ISDS_convertAngularRate_float(rawRate, currentGyroFullScale);
+  *yRate = ISDS_convertAngularRate_float(rawRate, fullScale);
   return WE_SUCCESS;
 }
 
 /**
  * @brief Reads the Z-axis angular rate in [mdps]
  *
- * Note that this functions relies on the current gyroscope full scale value.
- * Make sure that the current gyroscope full scale value is known by calling
- * ISDS_setGyroFullScale() or ISDS_getGyroFullScale() at least once prior to
- * calling this function.
+ * The gyroscope full scale is read from CTRL_2_G, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] zRate Z-axis angular rate in [mdps]
  * @retval Error code
  */
-int8_t ISDS_getAngularRateZ_float(float *zRate)
+int8_t ISDS_getAngularRateZ_float(WE_sensorInterface_t *sensorInterface, float *zRate)
 {
   int16_t rawRate;
-  if (WE_FAIL == ISDS_getRawAngularRateZ(&rawRate))
+  ISDS_gyroFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getGyroFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAngularRateZ(sensorInterface, &rawRate)))
   {
     return WE_FAIL;
   }
-  *zRate = ISDS_convertAngularRate_float(rawRate, currentGyroFullScale);
+  *zRate = ISDS_convertAngularRate_float(rawRate, fullScale);
   return WE_SUCCESS;
 }
 
 /**
  * @brief Read the gyroscope sensor output in [mdps] for all three axes
  *
- * Note that this functions relies on the current gyroscope full scale value.
- * Make sure that the current gyroscope full scale value is known by calling
- * ISDS_setGyroFullScale() or ISDS_getGyroFullScale() at least once prior to
- * calling this function.
+ * The gyroscope full scale is read from CTRL_2_G, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] xRate The returned X-axis angular rate in [mdps]
  * @param[out] yRate The returned Y-axis angular rate in [mdps]
  * @param[out] zRate The returned Z-axis angular rate in [mdps]
  * @retval Error code
  */
-int8_t ISDS_getAngularRates_float(float *xRate, float *yRate, float *zRate)
+int8_t ISDS_getAngularRates_float(WE_sensorInterface_t *sensorInterface, float *xRate, float *yRate, float *zRate)
 {
   int16_t xRawRate, yRawRate, zRawRate;
-  if (WE_FAIL == ISDS_getRawAngularRates(&xRawRate, &yRawRate, &zRawRate))
+  ISDS_gyroFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getGyroFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAngularRates(sensorInterface, &xRawRate, &yRawRate, &zRawRate)))
   {
     return WE_FAIL;
   }
-  *xRate = ISDS_convertAngularRate_float(xRawRate, currentGyroFullScale);
-  *yRate = ISDS_convertAngularRate_float(yRawRate, currentGyroFullScale);
-  *zRate = ISDS_convertAngularRate_float(zRawRate, currentGyroFullScale);
+  *xRate = ISDS_convertAngularRate_float(xRawRate, fullScale);
+  *yRate = ISDS_convertAngularRate_float(yRawRate, fullScale);
+  *zRate = ISDS_convertAngularRate_float(zRawRate, fullScale);
   return WE_SUCCESS;
 }
 #endif /* WE_USE_FLOAT */
@@ -5076,105 +5814,110 @@ int8_t ISDS_getAngularRates_float(float *xRate, float *yRate, float *zRate)
 /**
  * @brief Reads the X-axis angular rate in [mdps]
  *
- * Note that this functions relies on the current gyroscope full scale value.
- * Make sure that the current gyroscope full scale value is known by calling
- * ISDS_setGyroFullScale() or ISDS_getGyroFullScale() at least once prior to
- * calling this function.
+ * The gyroscope full scale is read from CTRL_2_G, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] xRate X-axis angular rate in [mdps]
  * @retval Error code
  */
-int8_t ISDS_getAngularRateX_int(int32_t *xRate)
+int8_t ISDS_getAngularRateX_int(WE_sensorInterface_t *sensorInterface, int32_t *xRate)
 {
   int16_t rawRate;
-  if (WE_FAIL == ISDS_getRawAngularRateX(&rawRate))
+  ISDS_gyroFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getGyroFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAngularRateX(sensorInterface, &rawRate)))
   {
     return WE_FAIL;
   }
-  *xRate = ISDS_convertAngularRate_int(rawRate, currentGyroFullScale);
+  *xRate = ISDS_convertAngularRate_int(rawRate, fullScale);
   return WE_SUCCESS;
 }
 
 /**
  * @brief Reads the Y-axis angular rate in [mdps]
  *
- * Note that this functions relies on the current gyroscope full scale value.
- * Make sure that the current gyroscope full scale value is known by calling
- * ISDS_setGyroFullScale() or ISDS_getGyroFullScale() at least once prior to
- * calling this function.
+ * The gyroscope full scale is read from CTRL_2_G, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] yRate Y-axis angular rate in [mdps]
  * @retval Error code
  */
-int8_t ISDS_getAngularRateY_int(int32_t *yRate)
+int8_t ISDS_getAngularRateY_int(WE_sensorInterface_t *sensorInterface, int32_t *yRate)
 {
   int16_t rawRate;
-  if (WE_FAIL == ISDS_getRawAngularRateY(&rawRate))
+  ISDS_gyroFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getGyroFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAngularRateY(sensorInterface, &rawRate)))
   {
     return WE_FAIL;
   }
-  *yRate = ISDS_convertAngularRate_int(rawRate, currentGyroFullScale);
+  *yRate = ISDS_convertAngularRate_int(rawRate, fullScale);
   return WE_SUCCESS;
 }
 
 /**
  * @brief Reads the Z-axis angular rate in [mdps]
  *
- * Note that this functions relies on the current gyroscope full scale value.
- * Make sure that the current gyroscope full scale value is known by calling
- * ISDS_setGyroFullScale() or ISDS_getGyroFullScale() at least once prior to
- * calling this function.
+ * The gyroscope full scale is read from CTRL_2_G, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] zRate Z-axis angular rate in [mdps]
  * @retval Error code
  */
-int8_t ISDS_getAngularRateZ_int(int32_t *zRate)
+int8_t ISDS_getAngularRateZ_int(WE_sensorInterface_t *sensorInterface, int32_t *zRate)
 {
   int16_t rawRate;
-  if (WE_FAIL == ISDS_getRawAngularRateZ(&rawRate))
+  ISDS_gyroFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getGyroFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAngularRateZ(sensorInterface, &rawRate)))
   {
     return WE_FAIL;
   }
-  *zRate = ISDS_convertAngularRate_int(rawRate, currentGyroFullScale);
+  *zRate = ISDS_convertAngularRate_int(rawRate, fullScale);
   return WE_SUCCESS;
 }
 
 /**
  * @brief Read the gyroscope sensor output in [mdps] for all three axes
  *
- * Note that this functions relies on the current gyroscope full scale value.
- * Make sure that the current gyroscope full scale value is known by calling
- * ISDS_setGyroFullScale() or ISDS_getGyroFullScale() at least once prior to
- * calling this function.
+ * The gyroscope full scale is read from CTRL_2_G, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] xRate The returned X-axis angular rate in [mdps]
  * @param[out] yRate The returned Y-axis angular rate in [mdps]
  * @param[out] zRate The returned Z-axis angular rate in [mdps]
  * @retval Error code
  */
-int8_t ISDS_getAngularRates_int(int32_t *xRate, int32_t *yRate, int32_t *zRate)
+int8_t ISDS_getAngularRates_int(WE_sensorInterface_t *sensorInterface, int32_t *xRate, int32_t *yRate, int32_t *zRate)
 {
   int16_t xRawRate, yRawRate, zRawRate;
-  if (WE_FAIL == ISDS_getRawAngularRates(&xRawRate, &yRawRate, &zRawRate))
+  ISDS_gyroFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getGyroFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAngularRates(sensorInterface, &xRawRate, &yRawRate, &zRawRate)))
   {
     return WE_FAIL;
   }
-  *xRate = ISDS_convertAngularRate_int(xRawRate, currentGyroFullScale);
-  *yRate = ISDS_convertAngularRate_int(yRawRate, currentGyroFullScale);
-  *zRate = ISDS_convertAngularRate_int(zRawRate, currentGyroFullScale);
+  *xRate = ISDS_convertAngularRate_int(xRawRate, fullScale);
+  *yRate = ISDS_convertAngularRate_int(yRawRate, fullScale);
+  *zRate = ISDS_convertAngularRate_int(zRawRate, fullScale);
   return WE_SUCCESS;
 }
 
 /**
  * @brief Read the raw X-axis gyroscope sensor output
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] xRawAcc The returned raw X-axis angular rate
  * @retval Error code
  */
-int8_t ISDS_getRawAngularRateX(int16_t *xRawRate)
+int8_t ISDS_getRawAngularRateX(WE_sensorInterface_t *sensorInterface, int16_t *xRawRate)
 {
   uint8_t tmp[2] = {0};
 
-  if (WE_FAIL == ReadReg(ISDS_X_OUT_L_GYRO_REG, 2, tmp))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_X_OUT_L_GYRO_REG, 2, tmp))
   {
     return WE_FAIL;
   }
@@ -5187,14 +5930,15 @@ int8_t ISDS_getRawAngularRateX(int16_t *xRawRate)
 
 /**
  * @brief Read the raw Y-axis gyroscope sensor output
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] yRawRate The returned raw Y-axis angular rate
  * @retval Error code
  */
-int8_t ISDS_getRawAngularRateY(int16_t *yRawRate)
+int8_t ISDS_getRawAngularRateY(WE_sensorInterface_t *sensorInterface, int16_t *yRawRate)
 {
   uint8_t tmp[2] = {0};
 
-  if (WE_FAIL == ReadReg(ISDS_Y_OUT_L_GYRO_REG, 2, tmp))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_Y_OUT_L_GYRO_REG, 2, tmp))
   {
     return WE_FAIL;
   }
@@ -5207,14 +5951,15 @@ int8_t ISDS_getRawAngularRateY(int16_t *yRawRate)
 
 /**
  * @brief Read the raw Z-axis gyroscope sensor output
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] zRawAcc The returned raw Z-axis angular rate
  * @retval Error code
  */
-int8_t ISDS_getRawAngularRateZ(int16_t *zRawRate)
+int8_t ISDS_getRawAngularRateZ(WE_sensorInterface_t *sensorInterface, int16_t *zRawRate)
 {
   uint8_t tmp[2] = {0};
 
-  if (WE_FAIL == ReadReg(ISDS_Z_OUT_L_GYRO_REG, 2, tmp))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_Z_OUT_L_GYRO_REG, 2, tmp))
   {
     return WE_FAIL;
   }
@@ -5227,16 +5972,17 @@ int8_t ISDS_getRawAngularRateZ(int16_t *zRawRate)
 
 /**
  * @brief Read the raw gyroscope sensor output for all three axes
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] xRawRate The returned raw X-axis angular rate
  * @param[out] yRawRate The returned raw Y-axis angular rate
  * @param[out] zRawRate The returned raw Z-axis angular rate
  * @retval Error code
  */
-int8_t ISDS_getRawAngularRates(int16_t *xRawRate, int16_t *yRawRate, int16_t *zRawRate)
+int8_t ISDS_getRawAngularRates(WE_sensorInterface_t *sensorInterface, int16_t *xRawRate, int16_t *yRawRate, int16_t *zRawRate)
 {
   uint8_t tmp[6] = {0};
 
-  if (WE_FAIL == ReadReg(ISDS_X_OUT_L_GYRO_REG, 6, tmp))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_X_OUT_L_GYRO_REG, 6, tmp))
   {
     return WE_FAIL;
   }
@@ -5257,92 +6003,96 @@ int8_t ISDS_getRawAngularRates(int16_t *xRawRate, int16_t *yRawRate, int16_t *zR
 /**
  * @brief Read the X-axis acceleration in [mg]
  *
- * Note that this functions relies on the current accelerometer full scale value.
- * Make sure that the current accelerometer full scale value is known by calling
- * ISDS_setAccFullScale() or ISDS_getAccFullScale() at least once prior to
- * calling this function.
+ * The accelerometer full scale is read from CTRL_1_XL, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] xAcc X-axis acceleration in [mg]
  * @retval Error code
  */
-int8_t ISDS_getAccelerationX_float(float *xAcc)
+int8_t ISDS_getAccelerationX_float(WE_sensorInterface_t *sensorInterface, float *xAcc)
 {
   int16_t rawAcc;
-  if (WE_FAIL == ISDS_getRawAccelerationX(&rawAcc))
+  ISDS_accFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getAccFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAccelerationX(sensorInterface, &rawAcc)))
   {
     return WE_FAIL;
   }
-  *xAcc = ISDS_convertAcceleration_float(rawAcc, currentAccFullScale);
+  *xAcc = ISDS_convertAcceleration_float(rawAcc, fullScale);
   return WE_SUCCESS;
 }
 
 /**
  * @brief Read the Y-axis acceleration in [mg]
  *
- * Note that this functions relies on the current accelerometer full scale value.
- * Make sure that the current accelerometer full scale value is known by calling
- * ISDS_setAccFullScale() or ISDS_getAccFullScale() at least once prior to
- * calling this function.
+ * The accelerometer full scale is read from CTRL_1_XL, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] yAcc Y-axis acceleration in [mg]
  * @retval Error code
  */
-int8_t ISDS_getAccelerationY_float(float *yAcc)
+int8_t ISDS_getAccelerationY_float(WE_sensorInterface_t *sensorInterface, float *yAcc)
 {
   int16_t rawAcc;
-  if (WE_FAIL == ISDS_getRawAccelerationY(&rawAcc))
+  ISDS_accFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getAccFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAccelerationY(sensorInterface, &rawAcc)))
   {
     return WE_FAIL;
   }
-  *yAcc = ISDS_convertAcceleration_float(rawAcc, currentAccFullScale);
+  *yAcc = ISDS_convertAcceleration_float(rawAcc, fullScale);
   return WE_SUCCESS;
 }
 
 /**
  * @brief Read the Z-axis acceleration in [mg]
  *
- * Note that this functions relies on the current accelerometer full scale value.
- * Make sure that the current accelerometer full scale value is known by calling
- * ISDS_setAccFullScale() or ISDS_getAccFullScale() at least once prior to
- * calling this function.
+ * The accelerometer full scale is read from CTRL_1_XL, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] zAcc Z-axis acceleration in [mg]
  * @retval Error code
  */
-int8_t ISDS_getAccelerationZ_float(float *zAcc)
+int8_t ISDS_getAccelerationZ_float(WE_sensorInterface_t *sensorInterface, float *zAcc)
 {
   int16_t rawAcc;
-  if (WE_FAIL == ISDS_getRawAccelerationZ(&rawAcc))
+  ISDS_accFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getAccFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAccelerationZ(sensorInterface, &rawAcc)))
   {
     return WE_FAIL;
   }
-  *zAcc = ISDS_convertAcceleration_float(rawAcc, currentAccFullScale);
+  *zAcc = ISDS_convertAcceleration_float(rawAcc, fullScale);
   return WE_SUCCESS;
 }
 
 /**
  * @brief Read the accelerometer sensor output in [mg] for all three axes
  *
- * Note that this functions relies on the current accelerometer full scale value.
- * Make sure that the current accelerometer full scale value is known by calling
- * ISDS_setAccFullScale() or ISDS_getAccFullScale() at least once prior to
- * calling this function.
+ * The accelerometer full scale is read from CTRL_1_XL, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] xAcc The returned X-axis acceleration in [mg]
  * @param[out] yAcc The returned Y-axis acceleration in [mg]
  * @param[out] zAcc The returned Z-axis acceleration in [mg]
  * @retval Error code
  */
-int8_t ISDS_getAccelerations_float(float *xAcc, float *yAcc, float *zAcc)
+int8_t ISDS_getAccelerations_float(WE_sensorInterface_t *sensorInterface, float *xAcc, float *yAcc, float *zAcc)
 {
   int16_t xRawAcc, yRawAcc, zRawAcc;
-  if (WE_FAIL == ISDS_getRawAccelerations(&xRawAcc, &yRawAcc, &zRawAcc))
+  ISDS_accFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getAccFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAccelerations(sensorInterface, &xRawAcc, &yRawAcc, &zRawAcc)))
   {
     return WE_FAIL;
   }
-  *xAcc = ISDS_convertAcceleration_float(xRawAcc, currentAccFullScale);
-  *yAcc = ISDS_convertAcceleration_float(yRawAcc, currentAccFullScale);
-  *zAcc = ISDS_convertAcceleration_float(zRawAcc, currentAccFullScale);
+  *xAcc = ISDS_convertAcceleration_float(xRawAcc, fullScale);
+  *yAcc = ISDS_convertAcceleration_float(yRawAcc, fullScale);
+  *zAcc = ISDS_convertAcceleration_float(zRawAcc, fullScale);
   return WE_SUCCESS;
 }
 #endif /* WE_USE_FLOAT */
@@ -5350,105 +6100,110 @@ int8_t ISDS_getAccelerations_float(float *xAcc, float *yAcc, float *zAcc)
 /**
  * @brief Read the X-axis acceleration in [mg]
  *
- * Note that this functions relies on the current accelerometer full scale value.
- * Make sure that the current accelerometer full scale value is known by calling
- * ISDS_setAccFullScale() or ISDS_getAccFullScale() at least once prior to
- * calling this function.
+ * The accelerometer full scale is read from CTRL_1_XL, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] xAcc X-axis acceleration in [mg]
  * @retval Error code
  */
-int8_t ISDS_getAccelerationX_int(int16_t *xAcc)
+int8_t ISDS_getAccelerationX_int(WE_sensorInterface_t *sensorInterface, int16_t *xAcc)
 {
   int16_t rawAcc;
-  if (WE_FAIL == ISDS_getRawAccelerationX(&rawAcc))
+  ISDS_accFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getAccFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAccelerationX(sensorInterface, &rawAcc)))
   {
     return WE_FAIL;
   }
-  *xAcc = ISDS_convertAcceleration_int(rawAcc, currentAccFullScale);
+  *xAcc = ISDS_convertAcceleration_int(rawAcc, fullScale);
   return WE_SUCCESS;
 }
 
 /**
  * @brief Read the Y-axis acceleration in [mg]
  *
- * Note that this functions relies on the current accelerometer full scale value.
- * Make sure that the current accelerometer full scale value is known by calling
- * ISDS_setAccFullScale() or ISDS_getAccFullScale() at least once prior to
- * calling this function.
+ * The accelerometer full scale is read from CTRL_1_XL, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] yAcc Y-axis acceleration in [mg]
  * @retval Error code
  */
-int8_t ISDS_getAccelerationY_int(int16_t *yAcc)
+int8_t ISDS_getAccelerationY_int(WE_sensorInterface_t *sensorInterface, int16_t *yAcc)
 {
   int16_t rawAcc;
-  if (WE_FAIL == ISDS_getRawAccelerationY(&rawAcc))
+  ISDS_accFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getAccFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAccelerationY(sensorInterface, &rawAcc)))
   {
     return WE_FAIL;
   }
-  *yAcc = ISDS_convertAcceleration_int(rawAcc, currentAccFullScale);
+  *yAcc = ISDS_convertAcceleration_int(rawAcc, fullScale);
   return WE_SUCCESS;
 }
 
 /**
  * @brief Read the Z-axis acceleration in [mg]
  *
- * Note that this functions relies on the current accelerometer full scale value.
- * Make sure that the current accelerometer full scale value is known by calling
- * ISDS_setAccFullScale() or ISDS_getAccFullScale() at least once prior to
- * calling this function.
+ * The accelerometer full scale is read from CTRL_1_XL, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] zAcc Z-axis acceleration in [mg]
  * @retval Error code
  */
-int8_t ISDS_getAccelerationZ_int(int16_t *zAcc)
+int8_t ISDS_getAccelerationZ_int(WE_sensorInterface_t *sensorInterface, int16_t *zAcc)
 {
   int16_t rawAcc;
-  if (WE_FAIL == ISDS_getRawAccelerationZ(&rawAcc))
+  ISDS_accFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getAccFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAccelerationZ(sensorInterface, &rawAcc)))
   {
     return WE_FAIL;
   }
-  *zAcc = ISDS_convertAcceleration_int(rawAcc, currentAccFullScale);
+  *zAcc = ISDS_convertAcceleration_int(rawAcc, fullScale);
   return WE_SUCCESS;
 }
 
 /**
  * @brief Read the accelerometer sensor output in [mg] for all three axes
  *
- * Note that this functions relies on the current accelerometer full scale value.
- * Make sure that the current accelerometer full scale value is known by calling
- * ISDS_setAccFullScale() or ISDS_getAccFullScale() at least once prior to
- * calling this function.
+ * The accelerometer full scale is read from CTRL_1_XL, a register cache serves it
+ * without a transfer.
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] xAcc The returned X-axis acceleration in [mg]
  * @param[out] yAcc The returned Y-axis acceleration in [mg]
  * @param[out] zAcc The returned Z-axis acceleration in [mg]
  * @retval Error code
  */
-int8_t ISDS_getAccelerations_int(int16_t *xAcc, int16_t *yAcc, int16_t *zAcc)
+int8_t ISDS_getAccelerations_int(WE_sensorInterface_t *sensorInterface, int16_t *xAcc, int16_t *yAcc, int16_t *zAcc)
 {
   int16_t xRawAcc, yRawAcc, zRawAcc;
-  if (WE_FAIL == ISDS_getRawAccelerations(&xRawAcc, &yRawAcc, &zRawAcc))
+  ISDS_accFullScale_t fullScale;
+  if ((WE_FAIL == ISDS_getAccFullScale(sensorInterface, &fullScale)) ||
+      (WE_FAIL == ISDS_getRawAccelerations(sensorInterface, &xRawAcc, &yRawAcc, &zRawAcc)))
   {
     return WE_FAIL;
   }
-  *xAcc = ISDS_convertAcceleration_int(xRawAcc, currentAccFullScale);
-  *yAcc = ISDS_convertAcceleration_int(yRawAcc, currentAccFullScale);
-  *zAcc = ISDS_convertAcceleration_int(zRawAcc, currentAccFullScale);
+  *xAcc = ISDS_convertAcceleration_int(xRawAcc, fullScale);
+  *yAcc = ISDS_convertAcceleration_int(yRawAcc, fullScale);
+  *zAcc = ISDS_convertAcceleration_int(zRawAcc, fullScale);
   return WE_SUCCESS;
 }
 
 /**
  * @brief Read the raw X-axis acceleration sensor output
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] xRawAcc The returned raw X-axis acceleration
  * @retval Error code
  */
-int8_t ISDS_getRawAccelerationX(int16_t *xRawAcc)
+int8_t ISDS_getRawAccelerationX(WE_sensorInterface_t *sensorInterface, int16_t *xRawAcc)
 {
   uint8_t tmp[2] = {0};
 
-  if (WE_FAIL == ReadReg(ISDS_X_OUT_L_ACC_REG, 2, tmp))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_X_OUT_L_ACC_REG, 2, tmp))
   {
     return WE_FAIL;
   }
@@ -5461,14 +6216,15 @@ int8_t ISDS_getRawAccelerationX(int16_t *xRawAcc)
 
 /**
  * @brief Read the raw Y-axis acceleration sensor output
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] yRawAcc The returned raw Y-axis acceleration
  * @retval Error code
  */
-int8_t ISDS_getRawAccelerationY(int16_t *yRawAcc)
+int8_t ISDS_getRawAccelerationY(WE_sensorInterface_t *sensorInterface, int16_t *yRawAcc)
 {
   uint8_t tmp[2] = {0};
 
-  if (WE_FAIL == ReadReg(ISDS_Y_OUT_L_ACC_REG, 2, tmp))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_Y_OUT_L_ACC_REG, 2, tmp))
   {
     return WE_FAIL;
   }
@@ -5481,14 +6237,15 @@ int8_t ISDS_getRawAccelerationY(int16_t *yRawAcc)
 
 /**
  * @brief Read the raw Z-axis acceleration sensor output
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] zRawAcc The returned raw Z-axis acceleration
  * @retval Error code
  */
-int8_t ISDS_getRawAccelerationZ(int16_t *zRawAcc)
+int8_t ISDS_getRawAccelerationZ(WE_sensorInterface_t *sensorInterface, int16_t *zRawAcc)
 {
   uint8_t tmp[2] = {0};
 
-  if (WE_FAIL == ReadReg(ISDS_Z_OUT_L_ACC_REG, 2, tmp))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_Z_OUT_L_ACC_REG, 2, tmp))
   {
     return WE_FAIL;
   }
@@ -5501,16 +6258,17 @@ int8_t ISDS_getRawAccelerationZ(int16_t *zRawAcc)
 
 /**
  * @brief Read the raw accelerometer sensor output for all three axes
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] xRawAcc The returned raw X-axis acceleration
  * @param[out] yRawAcc The returned raw Y-axis acceleration
  * @param[out] zRawAcc The returned raw Z-axis acceleration
  * @retval Error code
  */
-int8_t ISDS_getRawAccelerations(int16_t *xRawAcc, int16_t *yRawAcc, int16_t *zRawAcc)
+int8_t ISDS_getRawAccelerations(WE_sensorInterface_t *sensorInterface, int16_t *xRawAcc, int16_t *yRawAcc, int16_t *zRawAcc)
 {
   uint8_t tmp[6] = {0};
 
-  if (WE_FAIL == ReadReg(ISDS_X_OUT_L_ACC_REG, 6, tmp))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_X_OUT_L_ACC_REG, 6, tmp))
   {
     return WE_FAIL;
   }
@@ -5531,13 +6289,14 @@ int8_t ISDS_getRawAccelerations(int16_t *xRawAcc, int16_t *yRawAcc, int16_t *zRa
 
 /**
  * @brief Read the temperature in [°C]
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] temperature Temperature in [°C]
  * @retval Error code
  */
-int8_t ISDS_getTemperature_float(float *temperature)
+int8_t ISDS_getTemperature_float(WE_sensorInterface_t *sensorInterface, float *temperature)
 {
   int16_t tempRaw;
-  if (WE_FAIL == ISDS_getRawTemperature(&tempRaw))
+  if (WE_FAIL == ISDS_getRawTemperature(sensorInterface, &tempRaw))
   {
     return WE_FAIL;
   }
@@ -5547,13 +6306,14 @@ int8_t ISDS_getTemperature_float(float *temperature)
 #endif /* WE_USE_FLOAT */
 /**
  * @brief Read the temperature in [°C x 100]
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] temperature Temperature in [°C x 100]
  * @retval Error code
  */
-int8_t ISDS_getTemperature_int(int16_t *temperature)
+int8_t ISDS_getTemperature_int(WE_sensorInterface_t *sensorInterface, int16_t *temperature)
 {
   int16_t tempRaw;
-  if (WE_FAIL == ISDS_getRawTemperature(&tempRaw))
+  if (WE_FAIL == ISDS_getRawTemperature(sensorInterface, &tempRaw))
   {
     return WE_FAIL;
   }
@@ -5568,14 +6328,15 @@ int8_t ISDS_getTemperature_int(int16_t *temperature)
  *
  * Can be converted to [°C] using ISDS_convertTemperature_float()
  *
+ * @param[in] sensorInterface Pointer to sensor interface
  * @param[out] temperature Raw temperature value (temperature sensor output)
  * @retval Error code
  */
-int8_t ISDS_getRawTemperature(int16_t *temperature)
+int8_t ISDS_getRawTemperature(WE_sensorInterface_t *sensorInterface, int16_t *temperature)
 {
   uint8_t tmp[2] = {0};
 
-  if (WE_FAIL == ReadReg(ISDS_OUT_TEMP_L_REG, 2, tmp))
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_OUT_TEMP_L_REG, 2, tmp))
   {
     return WE_FAIL;
   }
@@ -5586,6 +6347,80 @@ int8_t ISDS_getRawTemperature(int16_t *temperature)
   return WE_SUCCESS;
 }
 
+/**
+ * @brief Read the status, temperature, angular rate and acceleration outputs in one transfer
+ *
+ * The registers from ISDS_STATUS_REG to the MSB of the Z-axis acceleration are
+ * consecutive (including one reserved byte at 0x1F), so a single burst returns a
+ * coherent sample together with the data-ready flags it was read with.
+ *
+ * @param[in] sensorInterface Pointer to sensor interface
+ * @param[out] sample The returned raw sample
+ * @retval Error code
+ */
+int8_t ISDS_getRawSample(WE_sensorInterface_t *sensorInterface, ISDS_rawSample_t *sample)
+{
+  uint8_t tmp[ISDS_SAMPLE_LENGTH] = {0};
+  uint8_t i;
+
+  if (WE_FAIL == ReadReg(sensorInterface, ISDS_STATUS_REG, ISDS_SAMPLE_LENGTH, tmp))
+  {
+    return WE_FAIL;
+  }
+
+  *(uint8_t *) &sample->status = tmp[0];
+
+  sample->temperature = (int16_t) (tmp[ISDS_OUT_TEMP_L_REG - ISDS_STATUS_REG + 1] << 8);
+  sample->temperature |= (int16_t) tmp[ISDS_OUT_TEMP_L_REG - ISDS_STATUS_REG];
+
+  for (i = 0; i < 3; i++)
+  {
+    uint8_t gyro = ISDS_X_OUT_L_GYRO_REG - ISDS_STATUS_REG + 2 * i;
+    uint8_t acc = ISDS_X_OUT_L_ACC_REG - ISDS_STATUS_REG + 2 * i;
+    sample->gyro[i] = (int16_t) (tmp[gyro + 1] << 8);
+    sample->gyro[i] |= (int16_t) tmp[gyro];
+    sample->acc[i] = (int16_t) (tmp[acc + 1] << 8);
+    sample->acc[i] |= (int16_t) tmp[acc];
+  }
+
+  return WE_SUCCESS;
+}
+
+/**
+ * @brief Read the status, temperature, angular rate and acceleration outputs in one transfer
+ *
+ * The full scales are read from CTRL_1_XL and CTRL_2_G, a register cache serves
+ * them without a transfer.
+ *
+ * @param[in] sensorInterface Pointer to sensor interface
+ * @param[out] sample The returned sample in [mg], [mdps] and [°C x 100]
+ * @retval Error code
+ */
+int8_t ISDS_getSample_int(WE_sensorInterface_t *sensorInterface, ISDS_sample_t *sample)
+{
+  ISDS_rawSample_t raw;
+  ISDS_ctrl1_t ctrl1;
+  ISDS_ctrl2_t ctrl2;
+  uint8_t i;
+
+  if ((WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_1_REG, 1, (uint8_t *) &ctrl1)) ||
+      (WE_FAIL == ReadReg(sensorInterface, ISDS_CTRL_2_REG, 1, (uint8_t *) &ctrl2)) ||
+      (WE_FAIL == ISDS_getRawSample(sensorInterface, &raw)))
+  {
+    return WE_FAIL;
+  }
+
+  sample->status = raw.status;
+  sample->temperature = ISDS_convertTemperature_int(raw.temperature);
+  for (i = 0; i < 3; i++)
+  {
+    sample->gyro[i] = ISDS_convertAngularRate_int(raw.gyro[i], (ISDS_gyroFullScale_t) ctrl2.gyroFullScale);
+    sample->acc[i] = ISDS_convertAcceleration_int(raw.acc[i], (ISDS_accFullScale_t) ctrl1.accFullScale);
+  }
+
+  return WE_SUCCESS;
+}
+
 
 #ifdef WE_USE_FLOAT
 /**
@@ -111,6 +111,21 @@ extern "C"
 #define ISDS_Y_OFS_USR_REG                    0x74      /**< Accelerometer Y-axis user offset correction */
 #define ISDS_Z_OFS_USR_REG                    0x75      /**< Accelerometer Z-axis user offset correction */
 
+#define ISDS_CACHED_REGISTERS                 17        /**< Number of registers in ISDS_cachedRegisters */
+
+#define ISDS_FIFO_WORDS_PER_READ              (WE_MAX_READ_LENGTH / 2)  /**< FIFO words per transfer */
+#define ISDS_SAMPLE_LENGTH                    16        /**< Bytes from ISDS_STATUS_REG to the MSB of ISDS_Z_OUT_L_ACC_REG */
+
+#define ISDS_TIMESTAMP_SYNC_WINDOW_US         2000000   /**< Host time over which the drift of the timestamp clock is measured */
+#define ISDS_TIMESTAMP_DRIFT_GAIN             4         /**< Divider of the rate error applied to the drift estimate per window */
+#define ISDS_TIMESTAMP_MAX_DRIFT_PPM          50000     /**< Limit of the drift estimate in [ppm] */
+
+#define ISDS_FIFO_SET_GYRO                    0x01      /**< First FIFO data set: gyroscope */
+#define ISDS_FIFO_SET_ACC                     0x02      /**< Second FIFO data set: accelerometer */
+#define ISDS_FIFO_SET_THIRD                   0x04      /**< Third FIFO data set */
+#define ISDS_FIFO_SET_FOURTH                  0x08      /**< Fourth FIFO data set: timestamp and step counter, or temperature */
+#define ISDS_FIFO_SET_TEMP                    0x10      /**< Fourth FIFO data set decoded as temperature */
+
 
 /* Register type definitions */
 
@@ -928,377 +943,500 @@ typedef enum
   ISDS_freeFallThreshold500mg = 7
 } ISDS_freeFallThreshold_t;
 
+/**
+ * @brief Data sets written to the FIFO in one FIFO cycle
+ */
+typedef struct
+{
+  uint8_t sets;                 /**< ISDS_FIFO_SET_* flags of the data sets contained */
+  uint8_t cycle;                /**< FIFO cycle within the FIFO pattern, 0 ... (ISDS_fifoDecoder_t.cycles - 1) */
+  int16_t gyro[3];              /**< Raw X, Y and Z-axis angular rate */
+  int16_t acc[3];               /**< Raw X, Y and Z-axis acceleration */
+  uint16_t third[3];            /**< Third data set, raw words */
+  uint16_t fourth[3];           /**< Fourth data set, raw words */
+  uint32_t timestamp;           /**< Timestamp of the fourth data set if the FIFO timestamp is enabled and the temperature is not */
+  uint16_t steps;               /**< Step counter of the fourth data set if the FIFO timestamp is enabled and the temperature is not */
+  int16_t temperature;          /**< Raw temperature of the fourth data set if the FIFO temperature is enabled */
+} ISDS_fifoFrame_t;
+
+/**
+ * @brief State of the FIFO pattern decoder, see ISDS_updateFifoDecoder()
+ */
+typedef struct
+{
+  uint8_t config[3];            /**< FIFO_CTRL_2 ... FIFO_CTRL_4 the decoder is set up for */
+  uint8_t factors[4];           /**< Decimation factor of each data set, 0 if not stored */
+  uint8_t cycles;               /**< FIFO cycles per FIFO pattern */
+  uint16_t length;              /**< Words per FIFO pattern, 0 if no data set is stored */
+  uint16_t pattern;             /**< Pattern index of the next word */
+  uint8_t cycle;                /**< FIFO cycle of the next word */
+  uint8_t set;                  /**< Data set of the next word */
+  uint8_t word;                 /**< Word of the next word within its data set */
+  uint8_t complete;             /**< The frame being decoded has been read from its first word */
+  ISDS_fifoFrame_t frame;       /**< Frame being decoded */
+} ISDS_fifoDecoder_t;
+
+/**
+ * @brief Raw output registers ISDS_STATUS_REG ... OUTZ_H_XL read in one transfer
+ */
+typedef struct
+{
+  ISDS_status_t status;         /**< Data-ready flags at the time of the read */
+  int16_t temperature;          /**< Raw temperature */
+  int16_t gyro[3];              /**< Raw X, Y and Z-axis angular rate */
+  int16_t acc[3];               /**< Raw X, Y and Z-axis acceleration */
+} ISDS_rawSample_t;
+
+/**
+ * @brief Converted 6-DoF sample, see ISDS_getSample_int()
+ */
+typedef struct
+{
+  ISDS_status_t status;         /**< Data-ready flags at the time of the read */
+  int16_t temperature;          /**< Temperature in [°C x 100] */
+  int32_t gyro[3];              /**< X, Y and Z-axis angular rate in [mdps] */
+  int16_t acc[3];               /**< X, Y and Z-axis acceleration in [mg] */
+} ISDS_sample_t;
+
+/**
+ * @brief Output data rates and full scales of both sensors and the FIFO, see ISDS_planRates()
+ */
+typedef struct
+{
+  ISDS_accOutputDataRate_t accOdr;            /**< Accelerometer ODR, ISDS_accOdrOff to power it down */
+  ISDS_accFullScale_t accFullScale;           /**< Accelerometer full scale */
+  ISDS_state_t accHighPerformance;            /**< Accelerometer high performance mode (always on above 208 Hz) */
+  ISDS_gyroOutputDataRate_t gyroOdr;          /**< Gyroscope ODR, ISDS_gyroOdrOff to power it down */
+  ISDS_gyroFullScale_t gyroFullScale;         /**< Gyroscope full scale */
+  ISDS_state_t gyroHighPerformance;           /**< Gyroscope high performance mode (always on above 208 Hz) */
+  ISDS_fifoOutputDataRate_t fifoOdr;          /**< FIFO ODR, ISDS_fifoOdrOff if the FIFO is not used */
+  ISDS_fifoDecimation_t accDecimation;        /**< FIFO decimation of the accelerometer, set by ISDS_planRates() */
+  ISDS_fifoDecimation_t gyroDecimation;       /**< FIFO decimation of the gyroscope, set by ISDS_planRates() */
+} ISDS_ratePlan_t;
+
+typedef enum
+{
+  ISDS_timestampClockNew       = 0,   /**< No timestamp seen yet */
+  ISDS_timestampClockFree      = 1,   /**< Timestamps are unwrapped, not mapped to the host clock yet */
+  ISDS_timestampClockSynced    = 2,   /**< Offset to the host clock known, first drift window running */
+  ISDS_timestampClockTracking  = 3    /**< Offset and drift are tracked */
+} ISDS_timestampClockState_t;
+
+/**
+ * @brief Mapping of the 24 bit timestamp counter to the host clock, see ISDS_syncTimestampClock()
+ *
+ * All times are in [µs] and wrap at 32 bit like the Arduino micros().
+ */
+typedef struct
+{
+  uint32_t tickUs;                    /**< Timestamp resolution in [µs], 25 or 6400 */
+  uint32_t ticks;                     /**< Reference counter value, the newest seen */
+  uint32_t sensorUs;                  /**< Drift corrected sensor time of the reference */
+  int32_t residue;                    /**< Remainder of the drift correction in [µs x 10^-6] */
+  int32_t driftPpm;                   /**< Rate error of the sensor clock against the host clock in [ppm] */
+  int32_t offsetUs;                   /**< Host time minus sensor time without read latency */
+  int32_t windowMinUs;                /**< Lowest host minus sensor time in the current window */
+  int32_t lastWindowMinUs;            /**< Lowest host minus sensor time in the previous window */
+  uint32_t windowStartUs;             /**< Host time the current window started */
+  ISDS_timestampClockState_t state;
+} ISDS_timestampClock_t;
+
+
+  /**
+   * @brief Registers held in the register cache of the sensor interface.
+   */
+  extern const WE_cachedRegister_t ISDS_cachedRegisters[ISDS_CACHED_REGISTERS];
 
   /*         Function definitions         */
 
-  int8_t ISDS_getDeviceID(uint8_t *deviceID);
+  int8_t ISDS_getDeviceID(WE_sensorInterface_t *sensorInterface, uint8_t *deviceID);
 
   /* ISDS_FIFO_CTRL_1_REG */
   /* ISDS_FIFO_CTRL_2_REG */
-  int8_t ISDS_setFifoThreshold(uint16_t threshold);
-  int8_t ISDS_getFifoThreshold(uint16_t *threshold);
-  int8_t ISDS_enableFifoTemperature(ISDS_state_t fifoTemp);
-  int8_t ISDS_isFifoTemperatureEnabled(ISDS_state_t *fifoTemp);
-  int8_t ISDS_enableFifoTimestamp(ISDS_state_t fifoTimestamp);
-  int8_t ISDS_isFifoTimestampEnabled(ISDS_state_t *fifoTimestamp);
+  int8_t ISDS_setFifoThreshold(WE_sensorInterface_t *sensorInterface, uint16_t threshold);
+  int8_t ISDS_getFifoThreshold(WE_sensorInterface_t *sensorInterface, uint16_t *threshold);
+  int8_t ISDS_enableFifoTemperature(WE_sensorInterface_t *sensorInterface, ISDS_state_t fifoTemp);
+  int8_t ISDS_isFifoTemperatureEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *fifoTemp);
+  int8_t ISDS_enableFifoTimestamp(WE_sensorInterface_t *sensorInterface, ISDS_state_t fifoTimestamp);
+  int8_t ISDS_isFifoTimestampEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *fifoTimestamp);
 
   /* ISDS_FIFO_CTRL_3_REG */
-  int8_t ISDS_setFifoAccDecimation(ISDS_fifoDecimation_t decimation);
-  int8_t ISDS_getFifoAccDecimation(ISDS_fifoDecimation_t *decimation);
-  int8_t ISDS_setFifoGyroDecimation(ISDS_fifoDecimation_t decimation);
-  int8_t ISDS_getFifoGyroDecimation(ISDS_fifoDecimation_t *decimation);
+  int8_t ISDS_setFifoAccDecimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t decimation);
+  int8_t ISDS_getFifoAccDecimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t *decimation);
+  int8_t ISDS_setFifoGyroDecimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t decimation);
+  int8_t ISDS_getFifoGyroDecimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t *decimation);
 
   /* ISDS_FIFO_CTRL_4_REG */
-  int8_t ISDS_setFifoDataset3Decimation(ISDS_fifoDecimation_t decimation);
-  int8_t ISDS_getFifoDataset3Decimation(ISDS_fifoDecimation_t *decimation);
-  int8_t ISDS_setFifoDataset4Decimation(ISDS_fifoDecimation_t decimation);
-  int8_t ISDS_getFifoDataset4Decimation(ISDS_fifoDecimation_t *decimation);
-  int8_t ISDS_enableFifoOnlyHighData(ISDS_state_t onlyHighData);
-  int8_t ISDS_isFifoOnlyHighDataEnabled(ISDS_state_t *onlyHighData);
-  int8_t ISDS_enableFifoStopOnThreshold(ISDS_state_t stopOnThreshold);
-  int8_t ISDS_isFifoStopOnThresholdEnabled(ISDS_state_t *stopOnThreshold);
+  int8_t ISDS_setFifoDataset3Decimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t decimation);
+  int8_t ISDS_getFifoDataset3Decimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t *decimation);
+  int8_t ISDS_setFifoDataset4Decimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t decimation);
+  int8_t ISDS_getFifoDataset4Decimation(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecimation_t *decimation);
+  int8_t ISDS_enableFifoOnlyHighData(WE_sensorInterface_t *sensorInterface, ISDS_state_t onlyHighData);
+  int8_t ISDS_isFifoOnlyHighDataEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *onlyHighData);
+  int8_t ISDS_enableFifoStopOnThreshold(WE_sensorInterface_t *sensorInterface, ISDS_state_t stopOnThreshold);
+  int8_t ISDS_isFifoStopOnThresholdEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *stopOnThreshold);
 
   /* ISDS_FIFO_CTRL_5_REG */
-  int8_t ISDS_setFifoMode(ISDS_fifoMode_t fifoMode);
-  int8_t ISDS_getFifoMode(ISDS_fifoMode_t *fifoMode);
-  int8_t ISDS_setFifoOutputDataRate(ISDS_fifoOutputDataRate_t fifoOdr);
-  int8_t ISDS_getFifoOutputDataRate(ISDS_fifoOutputDataRate_t *fifoOdr);
+  int8_t ISDS_setFifoMode(WE_sensorInterface_t *sensorInterface, ISDS_fifoMode_t fifoMode);
+  int8_t ISDS_getFifoMode(WE_sensorInterface_t *sensorInterface, ISDS_fifoMode_t *fifoMode);
+  int8_t ISDS_setFifoOutputDataRate(WE_sensorInterface_t *sensorInterface, ISDS_fifoOutputDataRate_t fifoOdr);
+  int8_t ISDS_getFifoOutputDataRate(WE_sensorInterface_t *sensorInterface, ISDS_fifoOutputDataRate_t *fifoOdr);
 
   /* ISDS_DRDY_PULSE_CFG_REG */
-  int8_t ISDS_enableDataReadyPulsed(ISDS_state_t dataReadyPulsed);
-  int8_t ISDS_isDataReadyPulsedEnabled(ISDS_state_t *dataReadyPulsed);
+  int8_t ISDS_enableDataReadyPulsed(WE_sensorInterface_t *sensorInterface, ISDS_state_t dataReadyPulsed);
+  int8_t ISDS_isDataReadyPulsedEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *dataReadyPulsed);
 
   /* ISDS_INT0_CTRL_REG */
-  int8_t ISDS_enableAccDataReadyINT0(ISDS_state_t int0AccDataReady);
-  int8_t ISDS_isAccDataReadyINT0Enabled(ISDS_state_t *int0AccDataReady);
-  int8_t ISDS_enableGyroDataReadyINT0(ISDS_state_t int0GyroDataReady);
-  int8_t ISDS_isGyroDataReadyINT0Enabled(ISDS_state_t *int0GyroDataReady);
-  int8_t ISDS_enableBootStatusINT0(ISDS_state_t int0BootStatus);
-  int8_t ISDS_isBootStatusINT0Enabled(ISDS_state_t *int0BootStatus);
-  int8_t ISDS_enableFifoThresholdINT0(ISDS_state_t int0FifoThreshold);
-  int8_t ISDS_isFifoThresholdINT0Enabled(ISDS_state_t *int0FifoThreshold);
-  int8_t ISDS_enableFifoOverrunINT0(ISDS_state_t int0FifoOverrun);
-  int8_t ISDS_isFifoOverrunINT0Enabled(ISDS_state_t *int0FifoOverrun);
-  int8_t ISDS_enableFifoFullINT0(ISDS_state_t int0FifoFull);
-  int8_t ISDS_isFifoFullINT0Enabled(ISDS_state_t *int0FifoFull);
+  int8_t ISDS_enableAccDataReadyINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0AccDataReady);
+  int8_t ISDS_isAccDataReadyINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0AccDataReady);
+  int8_t ISDS_enableGyroDataReadyINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0GyroDataReady);
+  int8_t ISDS_isGyroDataReadyINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0GyroDataReady);
+  int8_t ISDS_enableBootStatusINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0BootStatus);
+  int8_t ISDS_isBootStatusINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0BootStatus);
+  int8_t ISDS_enableFifoThresholdINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0FifoThreshold);
+  int8_t ISDS_isFifoThresholdINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0FifoThreshold);
+  int8_t ISDS_enableFifoOverrunINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0FifoOverrun);
+  int8_t ISDS_isFifoOverrunINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0FifoOverrun);
+  int8_t ISDS_enableFifoFullINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0FifoFull);
+  int8_t ISDS_isFifoFullINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0FifoFull);
 
   /* ISDS_INT1_CTRL_REG */
-  int8_t ISDS_enableAccDataReadyINT1(ISDS_state_t int1AccDataReady);
-  int8_t ISDS_isAccDataReadyINT1Enabled(ISDS_state_t *int1AccDataReady);
-  int8_t ISDS_enableGyroDataReadyINT1(ISDS_state_t int1GyroDataReady);
-  int8_t ISDS_isGyroDataReadyINT1Enabled(ISDS_state_t *int1GyroDataReady);
-  int8_t ISDS_enableTemperatureDataReadyINT1(ISDS_state_t int1TempDataReady);
-  int8_t ISDS_isTemperatureDataReadyINT1Enabled(ISDS_state_t *int1TempDataReady);
-  int8_t ISDS_enableFifoThresholdINT1(ISDS_state_t int1FifoThreshold);
-  int8_t ISDS_isFifoThresholdINT1Enabled(ISDS_state_t *int1FifoThreshold);
-  int8_t ISDS_enableFifoOverrunINT1(ISDS_state_t int1FifoOverrun);
-  int8_t ISDS_isFifoOverrunINT1Enabled(ISDS_state_t *int1FifoOverrun);
-  int8_t ISDS_enableFifoFullINT1(ISDS_state_t int1FifoFull);
-  int8_t ISDS_isFifoFullINT1Enabled(ISDS_state_t *int1FifoFull);
+  int8_t ISDS_enableAccDataReadyINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1AccDataReady);
+  int8_t ISDS_isAccDataReadyINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1AccDataReady);
+  int8_t ISDS_enableGyroDataReadyINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1GyroDataReady);
+  int8_t ISDS_isGyroDataReadyINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1GyroDataReady);
+  int8_t ISDS_enableTemperatureDataReadyINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1TempDataReady);
+  int8_t ISDS_isTemperatureDataReadyINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1TempDataReady);
+  int8_t ISDS_enableFifoThresholdINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1FifoThreshold);
+  int8_t ISDS_isFifoThresholdINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1FifoThreshold);
+  int8_t ISDS_enableFifoOverrunINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1FifoOverrun);
+  int8_t ISDS_isFifoOverrunINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1FifoOverrun);
+  int8_t ISDS_enableFifoFullINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1FifoFull);
+  int8_t ISDS_isFifoFullINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1FifoFull);
 
   /* ISDS_DEVICE_ID_REG */
 
   /* ISDS_CTRL_1_REG */
-  int8_t ISDS_setAccAnalogChainBandwidth(ISDS_accAnalogChainBandwidth_t bandwidth);
-  int8_t ISDS_getAccAnalogChainBandwidth(ISDS_accAnalogChainBandwidth_t *bandwidth);
-  int8_t ISDS_setAccDigitalLpfBandwidth(ISDS_accDigitalLpfBandwidth_t bandwidth);
-  int8_t ISDS_getAccDigitalLpfBandwidth(ISDS_accDigitalLpfBandwidth_t *bandwidth);
-  int8_t ISDS_setAccFullScale(ISDS_accFullScale_t fullScale);
-  int8_t ISDS_getAccFullScale(ISDS_accFullScale_t *fullScale);
-  int8_t ISDS_setAccOutputDataRate(ISDS_accOutputDataRate_t odr);
-  int8_t ISDS_getAccOutputDataRate(ISDS_accOutputDataRate_t *odr);
+  int8_t ISDS_setAccAnalogChainBandwidth(WE_sensorInterface_t *sensorInterface, ISDS_accAnalogChainBandwidth_t bandwidth);
+  int8_t ISDS_getAccAnalogChainBandwidth(WE_sensorInterface_t *sensorInterface, ISDS_accAnalogChainBandwidth_t *bandwidth);
+  int8_t ISDS_setAccDigitalLpfBandwidth(WE_sensorInterface_t *sensorInterface, ISDS_accDigitalLpfBandwidth_t bandwidth);
+  int8_t ISDS_getAccDigitalLpfBandwidth(WE_sensorInterface_t *sensorInterface, ISDS_accDigitalLpfBandwidth_t *bandwidth);
+  int8_t ISDS_setAccFullScale(WE_sensorInterface_t *sensorInterface, ISDS_accFullScale_t fullScale);
+  int8_t ISDS_getAccFullScale(WE_sensorInterface_t *sensorInterface, ISDS_accFullScale_t *fullScale);
+  int8_t ISDS_setAccOutputDataRate(WE_sensorInterface_t *sensorInterface, ISDS_accOutputDataRate_t odr);
+  int8_t ISDS_getAccOutputDataRate(WE_sensorInterface_t *sensorInterface, ISDS_accOutputDataRate_t *odr);
 
   /* ISDS_CTRL_2_REG */
-  int8_t ISDS_setGyroFullScale(ISDS_gyroFullScale_t fullScale);
-  int8_t ISDS_getGyroFullScale(ISDS_gyroFullScale_t *fullScale);
-  int8_t ISDS_setGyroOutputDataRate(ISDS_gyroOutputDataRate_t odr);
-  int8_t ISDS_getGyroOutputDataRate(ISDS_gyroOutputDataRate_t *odr);
+  int8_t ISDS_setGyroFullScale(WE_sensorInterface_t *sensorInterface, ISDS_gyroFullScale_t fullScale);
+  int8_t ISDS_getGyroFullScale(WE_sensorInterface_t *sensorInterface, ISDS_gyroFullScale_t *fullScale);
+  int8_t ISDS_setGyroOutputDataRate(WE_sensorInterface_t *sensorInterface, ISDS_gyroOutputDataRate_t odr);
+  int8_t ISDS_getGyroOutputDataRate(WE_sensorInterface_t *sensorInterface, ISDS_gyroOutputDataRate_t *odr);
 
   /* ISDS_CTRL_3_REG */
-  int8_t ISDS_softReset(ISDS_state_t swReset);
-  int8_t ISDS_getSoftResetState(ISDS_state_t *swReset);
-  int8_t ISDS_enableAutoIncrement(ISDS_state_t autoIncr);
-  int8_t ISDS_isAutoIncrementEnabled(ISDS_state_t *autoIncr);
-  int8_t ISDS_setSpiMode(ISDS_spiMode_t spiMode);
-  int8_t ISDS_getSpiMode(ISDS_spiMode_t *spiMode);
-  int8_t ISDS_setInterruptPinType(ISDS_interruptPinConfig_t pinType);
-  int8_t ISDS_getInterruptPinType(ISDS_interruptPinConfig_t *pinType);
-  int8_t ISDS_setInterruptActiveLevel(ISDS_interruptActiveLevel_t level);
-  int8_t ISDS_getInterruptActiveLevel(ISDS_interruptActiveLevel_t *level);
-  int8_t ISDS_enableBlockDataUpdate(ISDS_state_t bdu);
-  int8_t ISDS_isBlockDataUpdateEnabled(ISDS_state_t *bdu);
-  int8_t ISDS_reboot(ISDS_state_t reboot);
-  int8_t ISDS_isRebooting(ISDS_state_t *rebooting);
+  int8_t ISDS_softReset(WE_sensorInterface_t *sensorInterface, ISDS_state_t swReset);
+  int8_t ISDS_getSoftResetState(WE_sensorInterface_t *sensorInterface, ISDS_state_t *swReset);
+  int8_t ISDS_enableAutoIncrement(WE_sensorInterface_t *sensorInterface, ISDS_state_t autoIncr);
+  int8_t ISDS_isAutoIncrementEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *autoIncr);
+  int8_t ISDS_setSpiMode(WE_sensorInterface_t *sensorInterface, ISDS_spiMode_t spiMode);
+  int8_t ISDS_getSpiMode(WE_sensorInterface_t *sensorInterface, ISDS_spiMode_t *spiMode);
+  int8_t ISDS_setInterruptPinType(WE_sensorInterface_t *sensorInterface, ISDS_interruptPinConfig_t pinType);
+  int8_t ISDS_getInterruptPinType(WE_sensorInterface_t *sensorInterface, ISDS_interruptPinConfig_t *pinType);
+  int8_t ISDS_setInterruptActiveLevel(WE_sensorInterface_t *sensorInterface, ISDS_interruptActiveLevel_t level);
+  int8_t ISDS_getInterruptActiveLevel(WE_sensorInterface_t *sensorInterface, ISDS_interruptActiveLevel_t *level);
+  int8_t ISDS_enableBlockDataUpdate(WE_sensorInterface_t *sensorInterface, ISDS_state_t bdu);
+  int8_t ISDS_isBlockDataUpdateEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *bdu);
+  int8_t ISDS_reboot(WE_sensorInterface_t *sensorInterface, ISDS_state_t reboot);
+  int8_t ISDS_isRebooting(WE_sensorInterface_t *sensorInterface, ISDS_state_t *rebooting);
 
   /* ISDS_CTRL_4_REG */
-  int8_t ISDS_enableGyroDigitalLpf1(ISDS_state_t enable);
-  int8_t ISDS_isGyroDigitalLpf1Enabled(ISDS_state_t *enable);
-  int8_t ISDS_disableI2CInterface(ISDS_state_t i2cDisable);
-  int8_t ISDS_isI2CInterfaceDisabled(ISDS_state_t *i2cDisabled);
-  int8_t ISDS_enableDataReadyMask(ISDS_state_t dataReadyMask);
-  int8_t ISDS_isDataReadyMaskEnabled(ISDS_state_t *dataReadyMask);
-  int8_t ISDS_enableDataEnableDataReadyINT0(ISDS_state_t int0DataReady);
-  int8_t ISDS_isDataEnableDataReadyINT0Enabled(ISDS_state_t *int0DataReady);
-  int8_t ISDS_setInt1OnInt0(ISDS_state_t int1OnInt0);
-  int8_t ISDS_getInt1OnInt0(ISDS_state_t *int1OnInt0);
-  int8_t ISDS_enableGyroSleepMode(ISDS_state_t gyroSleepMode);
-  int8_t ISDS_isGyroSleepModeEnabled(ISDS_state_t *gyroSleepMode);
-  int8_t ISDS_extendDataEnableToAcc(ISDS_state_t extendToAcc);
-  int8_t ISDS_isDataEnableExtendedToAcc(ISDS_state_t *extendToAcc);
+  int8_t ISDS_enableGyroDigitalLpf1(WE_sensorInterface_t *sensorInterface, ISDS_state_t enable);
+  int8_t ISDS_isGyroDigitalLpf1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *enable);
+  int8_t ISDS_disableI2CInterface(WE_sensorInterface_t *sensorInterface, ISDS_state_t i2cDisable);
+  int8_t ISDS_isI2CInterfaceDisabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *i2cDisabled);
+  int8_t ISDS_enableDataReadyMask(WE_sensorInterface_t *sensorInterface, ISDS_state_t dataReadyMask);
+  int8_t ISDS_isDataReadyMaskEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *dataReadyMask);
+  int8_t ISDS_enableDataEnableDataReadyINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0DataReady);
+  int8_t ISDS_isDataEnableDataReadyINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0DataReady);
+  int8_t ISDS_setInt1OnInt0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1OnInt0);
+  int8_t ISDS_getInt1OnInt0(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1OnInt0);
+  int8_t ISDS_enableGyroSleepMode(WE_sensorInterface_t *sensorInterface, ISDS_state_t gyroSleepMode);
+  int8_t ISDS_isGyroSleepModeEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *gyroSleepMode);
+  int8_t ISDS_extendDataEnableToAcc(WE_sensorInterface_t *sensorInterface, ISDS_state_t extendToAcc);
+  int8_t ISDS_isDataEnableExtendedToAcc(WE_sensorInterface_t *sensorInterface, ISDS_state_t *extendToAcc);
 
   /* ISDS_CTRL_5_REG */
-  int8_t ISDS_setAccSelfTestMode(ISDS_accSelfTestMode_t selfTest);
-  int8_t ISDS_getAccSelfTestMode(ISDS_accSelfTestMode_t *selfTest);
-  int8_t ISDS_setGyroSelfTestMode(ISDS_gyroSelfTestMode_t selfTest);
-  int8_t ISDS_getGyroSelfTestMode(ISDS_gyroSelfTestMode_t *selfTest);
-  int8_t ISDS_setDataEnableActiveHigh(ISDS_state_t activeHigh);
-  int8_t ISDS_isDataEnableActiveHigh(ISDS_state_t *activeHigh);
-  int8_t ISDS_setRoundingPattern(ISDS_roundingPattern_t roundingPattern);
-  int8_t ISDS_getRoundingPattern(ISDS_roundingPattern_t *roundingPattern);
+  int8_t ISDS_setAccSelfTestMode(WE_sensorInterface_t *sensorInterface, ISDS_accSelfTestMode_t selfTest);
+  int8_t ISDS_getAccSelfTestMode(WE_sensorInterface_t *sensorInterface, ISDS_accSelfTestMode_t *selfTest);
+  int8_t ISDS_setGyroSelfTestMode(WE_sensorInterface_t *sensorInterface, ISDS_gyroSelfTestMode_t selfTest);
+  int8_t ISDS_getGyroSelfTestMode(WE_sensorInterface_t *sensorInterface, ISDS_gyroSelfTestMode_t *selfTest);
+  int8_t ISDS_setDataEnableActiveHigh(WE_sensorInterface_t *sensorInterface, ISDS_state_t activeHigh);
+  int8_t ISDS_isDataEnableActiveHigh(WE_sensorInterface_t *sensorInterface, ISDS_state_t *activeHigh);
+  int8_t ISDS_setRoundingPattern(WE_sensorInterface_t *sensorInterface, ISDS_roundingPattern_t roundingPattern);
+  int8_t ISDS_getRoundingPattern(WE_sensorInterface_t *sensorInterface, ISDS_roundingPattern_t *roundingPattern);
 
   /* ISDS_CTRL_6_REG */
-  int8_t ISDS_setGyroLowPassFilterBandwidth(ISDS_gyroLPF_t bandwidth);
-  int8_t ISDS_getGyroLowPassFilterBandwidth(ISDS_gyroLPF_t *bandwidth);
-  int8_t ISDS_setOffsetWeight(ISDS_state_t offsetWeight);
-  int8_t ISDS_getOffsetWeight(ISDS_state_t *offsetWeight);
-  int8_t ISDS_disableAccHighPerformanceMode(ISDS_state_t disable);
-  int8_t ISDS_isAccHighPerformanceModeDisabled(ISDS_state_t *disable);
-  int8_t ISDS_setDataEnableTriggerMode(ISDS_dataEnableTriggerMode_t triggerMode);
-  int8_t ISDS_getDataEnableTriggerMode(ISDS_dataEnableTriggerMode_t *triggerMode);
+  int8_t ISDS_setGyroLowPassFilterBandwidth(WE_sensorInterface_t *sensorInterface, ISDS_gyroLPF_t bandwidth);
+  int8_t ISDS_getGyroLowPassFilterBandwidth(WE_sensorInterface_t *sensorInterface, ISDS_gyroLPF_t *bandwidth);
+  int8_t ISDS_setOffsetWeight(WE_sensorInterface_t *sensorInterface, ISDS_state_t offsetWeight);
+  int8_t ISDS_getOffsetWeight(WE_sensorInterface_t *sensorInterface, ISDS_state_t *offsetWeight);
+  int8_t ISDS_disableAccHighPerformanceMode(WE_sensorInterface_t *sensorInterface, ISDS_state_t disable);
+  int8_t ISDS_isAccHighPerformanceModeDisabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *disable);
+  int8_t ISDS_setDataEnableTriggerMode(WE_sensorInterface_t *sensorInterface, ISDS_dataEnableTriggerMode_t triggerMode);
+  int8_t ISDS_getDataEnableTriggerMode(WE_sensorInterface_t *sensorInterface, ISDS_dataEnableTriggerMode_t *triggerMode);
 
   /* ISDS_CTRL_7_REG */
-  int8_t ISDS_enableRounding(ISDS_state_t rounding);
-  int8_t ISDS_isRoundingEnabled(ISDS_state_t *rounding);
-  int8_t ISDS_setGyroDigitalHighPassCutoff(ISDS_gyroDigitalHighPassCutoff_t cutoff);
-  int8_t ISDS_getGyroDigitalHighPassCutoff(ISDS_gyroDigitalHighPassCutoff_t *cutoff);
-  int8_t ISDS_enableGyroDigitalHighPass(ISDS_state_t highPass);
-  int8_t ISDS_isGyroDigitalHighPassEnabled(ISDS_state_t *highPass);
-  int8_t ISDS_disableGyroHighPerformanceMode(ISDS_state_t disable);
-  int8_t ISDS_isGyroHighPerformanceModeDisabled(ISDS_state_t *disable);
+  int8_t ISDS_enableRounding(WE_sensorInterface_t *sensorInterface, ISDS_state_t rounding);
+  int8_t ISDS_isRoundingEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *rounding);
+  int8_t ISDS_setGyroDigitalHighPassCutoff(WE_sensorInterface_t *sensorInterface, ISDS_gyroDigitalHighPassCutoff_t cutoff);
+  int8_t ISDS_getGyroDigitalHighPassCutoff(WE_sensorInterface_t *sensorInterface, ISDS_gyroDigitalHighPassCutoff_t *cutoff);
+  int8_t ISDS_enableGyroDigitalHighPass(WE_sensorInterface_t *sensorInterface, ISDS_state_t highPass);
+  int8_t ISDS_isGyroDigitalHighPassEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *highPass);
+  int8_t ISDS_disableGyroHighPerformanceMode(WE_sensorInterface_t *sensorInterface, ISDS_state_t disable);
+  int8_t ISDS_isGyroHighPerformanceModeDisabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *disable);
 
   /* ISDS_CTRL_8_REG */
-  int8_t ISDS_enable6dLowPass(ISDS_state_t lowPass);
-  int8_t ISDS_is6dLowPassEnabled(ISDS_state_t *lowPass);
-  int8_t ISDS_enableAccHighPassSlopeFilter(ISDS_state_t filterEnable);
-  int8_t ISDS_isAccHighPassSlopeFilterEnabled(ISDS_state_t *filterEnable);
-  int8_t ISDS_setInputCompositeFilter(ISDS_inputCompositeFilter_t inputCompositeFilter);
-  int8_t ISDS_getInputCompositeFilter(ISDS_inputCompositeFilter_t *inputCompositeFilter);
-  int8_t ISDS_enableHighPassFilterRefMode(ISDS_state_t refMode);
-  int8_t ISDS_isHighPassFilterRefModeEnabled(ISDS_state_t *refMode);
-  int8_t ISDS_setAccFilterConfig(ISDS_accFilterConfig_t filterConfig);
-  int8_t ISDS_getAccFilterConfig(ISDS_accFilterConfig_t *filterConfig);
-  int8_t ISDS_enableAccLowPass(ISDS_state_t lowPass);
-  int8_t ISDS_isAccLowPassEnabled(ISDS_state_t *lowPass);
+  int8_t ISDS_enable6dLowPass(WE_sensorInterface_t *sensorInterface, ISDS_state_t lowPass);
+  int8_t ISDS_is6dLowPassEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *lowPass);
+  int8_t ISDS_enableAccHighPassSlopeFilter(WE_sensorInterface_t *sensorInterface, ISDS_state_t filterEnable);
+  int8_t ISDS_isAccHighPassSlopeFilterEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *filterEnable);
+  int8_t ISDS_setInputCompositeFilter(WE_sensorInterface_t *sensorInterface, ISDS_inputCompositeFilter_t inputCompositeFilter);
+  int8_t ISDS_getInputCompositeFilter(WE_sensorInterface_t *sensorInterface, ISDS_inputCompositeFilter_t *inputCompositeFilter);
+  int8_t ISDS_enableHighPassFilterRefMode(WE_sensorInterface_t *sensorInterface, ISDS_state_t refMode);
+  int8_t ISDS_isHighPassFilterRefModeEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *refMode);
+  int8_t ISDS_setAccFilterConfig(WE_sensorInterface_t *sensorInterface, ISDS_accFilterConfig_t filterConfig);
+  int8_t ISDS_getAccFilterConfig(WE_sensorInterface_t *sensorInterface, ISDS_accFilterConfig_t *filterConfig);
+  int8_t ISDS_enableAccLowPass(WE_sensorInterface_t *sensorInterface, ISDS_state_t lowPass);
+  int8_t ISDS_isAccLowPassEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *lowPass);
 
   /* ISDS_CTRL_9_REG */
-  int8_t ISDS_setDataEnableStampingSensor(ISDS_dataEnableStampingSensor_t sensor);
-  int8_t ISDS_getDataEnableStampingSensor(ISDS_dataEnableStampingSensor_t *sensor);
-  int8_t ISDS_storeDataEnableValueInZAxisLSB(ISDS_state_t enable);
-  int8_t ISDS_isStoreDataEnableValueInZAxisLSB(ISDS_state_t *enable);
-  int8_t ISDS_storeDataEnableValueInYAxisLSB(ISDS_state_t enable);
-  int8_t ISDS_isStoreDataEnableValueInYAxisLSB(ISDS_state_t *enable);
-  int8_t ISDS_storeDataEnableValueInXAxisLSB(ISDS_state_t enable);
-  int8_t ISDS_isStoreDataEnableValueInXAxisLSB(ISDS_state_t *enable);
+  int8_t ISDS_setDataEnableStampingSensor(WE_sensorInterface_t *sensorInterface, ISDS_dataEnableStampingSensor_t sensor);
+  int8_t ISDS_getDataEnableStampingSensor(WE_sensorInterface_t *sensorInterface, ISDS_dataEnableStampingSensor_t *sensor);
+  int8_t ISDS_storeDataEnableValueInZAxisLSB(WE_sensorInterface_t *sensorInterface, ISDS_state_t enable);
+  int8_t ISDS_isStoreDataEnableValueInZAxisLSB(WE_sensorInterface_t *sensorInterface, ISDS_state_t *enable);
+  int8_t ISDS_storeDataEnableValueInYAxisLSB(WE_sensorInterface_t *sensorInterface, ISDS_state_t enable);
+  int8_t ISDS_isStoreDataEnableValueInYAxisLSB(WE_sensorInterface_t *sensorInterface, ISDS_state_t *enable);
+  int8_t ISDS_storeDataEnableValueInXAxisLSB(WE_sensorInterface_t *sensorInterface, ISDS_state_t enable);
+  int8_t ISDS_isStoreDataEnableValueInXAxisLSB(WE_sensorInterface_t *sensorInterface, ISDS_state_t *enable);
 
   /* ISDS_CTRL_10_REG */
-  int8_t ISDS_enableEmbeddedFunctionalities(ISDS_state_t embeddedFuncEnable);
-  int8_t ISDS_areEmbeddedFunctionalitiesEnabled(ISDS_state_t *embeddedFuncEnable);
-  int8_t ISDS_enableTiltCalculation(ISDS_state_t tiltCalc);
-  int8_t ISDS_isTiltCalculationEnabled(ISDS_state_t *tiltCalc);
-  int8_t ISDS_enableTimestampCount(ISDS_state_t timestampCount);
-  int8_t ISDS_isTimestampCountEnabled(ISDS_state_t *timestampCount);
+  int8_t ISDS_enableEmbeddedFunctionalities(WE_sensorInterface_t *sensorInterface, ISDS_state_t embeddedFuncEnable);
+  int8_t ISDS_areEmbeddedFunctionalitiesEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *embeddedFuncEnable);
+  int8_t ISDS_enableTiltCalculation(WE_sensorInterface_t *sensorInterface, ISDS_state_t tiltCalc);
+  int8_t ISDS_isTiltCalculationEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tiltCalc);
+  int8_t ISDS_enableTimestampCount(WE_sensorInterface_t *sensorInterface, ISDS_state_t timestampCount);
+  int8_t ISDS_isTimestampCountEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *timestampCount);
 
   /* ISDS_WAKE_UP_EVENT_REG */
-  int8_t ISDS_getWakeUpEventRegister(ISDS_wakeUpEvent_t *status);
-  int8_t ISDS_isWakeUpXEvent(ISDS_state_t *wakeUpX);
-  int8_t ISDS_isWakeUpYEvent(ISDS_state_t *wakeUpY);
-  int8_t ISDS_isWakeUpZEvent(ISDS_state_t *wakeUpZ);
-  int8_t ISDS_isWakeUpEvent(ISDS_state_t *wakeUpState);
-  int8_t ISDS_getSleepState(ISDS_state_t *sleepState);
-  int8_t ISDS_isFreeFallEvent(ISDS_state_t *freeFall);
+  int8_t ISDS_getWakeUpEventRegister(WE_sensorInterface_t *sensorInterface, ISDS_wakeUpEvent_t *status);
+  int8_t ISDS_isWakeUpXEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *wakeUpX);
+  int8_t ISDS_isWakeUpYEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *wakeUpY);
+  int8_t ISDS_isWakeUpZEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *wakeUpZ);
+  int8_t ISDS_isWakeUpEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *wakeUpState);
+  int8_t ISDS_getSleepState(WE_sensorInterface_t *sensorInterface, ISDS_state_t *sleepState);
+  int8_t ISDS_isFreeFallEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *freeFall);
 
   /* ISDS_TAP_EVENT_REG */
-  int8_t ISDS_getTapEventRegister(ISDS_tapEvent_t *status);
-  int8_t ISDS_isTapEvent(ISDS_state_t *tapEventState);
-  int8_t ISDS_isTapEventXAxis(ISDS_state_t *tapXAxis);
-  int8_t ISDS_isTapEventYAxis(ISDS_state_t *tapYAxis);
-  int8_t ISDS_isTapEventZAxis(ISDS_state_t *tapZAxis);
-  int8_t ISDS_isDoubleTapEvent(ISDS_state_t *doubleTap);
-  int8_t ISDS_isSingleTapEvent(ISDS_state_t *singleTap);
-  int8_t ISDS_getTapSign(ISDS_tapSign_t *tapSign);
+  int8_t ISDS_getTapEventRegister(WE_sensorInterface_t *sensorInterface, ISDS_tapEvent_t *status);
+  int8_t ISDS_isTapEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tapEventState);
+  int8_t ISDS_isTapEventXAxis(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tapXAxis);
+  int8_t ISDS_isTapEventYAxis(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tapYAxis);
+  int8_t ISDS_isTapEventZAxis(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tapZAxis);
+  int8_t ISDS_isDoubleTapEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *doubleTap);
+  int8_t ISDS_isSingleTapEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *singleTap);
+  int8_t ISDS_getTapSign(WE_sensorInterface_t *sensorInterface, ISDS_tapSign_t *tapSign);
 
   /* ISDS_6D_EVENT_REG */
-  int8_t ISDS_get6dEventRegister(ISDS_6dEvent_t *status);
-  int8_t ISDS_has6dOrientationChanged(ISDS_state_t *orientationChanged);
-  int8_t ISDS_isXLOverThreshold(ISDS_state_t *xlOverThreshold);
-  int8_t ISDS_isXHOverThreshold(ISDS_state_t *xhOverThreshold);
-  int8_t ISDS_isYLOverThreshold(ISDS_state_t *ylOverThreshold);
-  int8_t ISDS_isYHOverThreshold(ISDS_state_t *yhOverThreshold);
-  int8_t ISDS_isZLOverThreshold(ISDS_state_t *zlOverThreshold);
-  int8_t ISDS_isZHOverThreshold(ISDS_state_t *zhOverThreshold);
-  int8_t ISDS_isDataEnableDataReady(ISDS_state_t *dataReady);
+  int8_t ISDS_get6dEventRegister(WE_sensorInterface_t *sensorInterface, ISDS_6dEvent_t *status);
+  int8_t ISDS_has6dOrientationChanged(WE_sensorInterface_t *sensorInterface, ISDS_state_t *orientationChanged);
+  int8_t ISDS_isXLOverThreshold(WE_sensorInterface_t *sensorInterface, ISDS_state_t *xlOverThreshold);
+  int8_t ISDS_isXHOverThreshold(WE_sensorInterface_t *sensorInterface, ISDS_state_t *xhOverThreshold);
+  int8_t ISDS_isYLOverThreshold(WE_sensorInterface_t *sensorInterface, ISDS_state_t *ylOverThreshold);
+  int8_t ISDS_isYHOverThreshold(WE_sensorInterface_t *sensorInterface, ISDS_state_t *yhOverThreshold);
+  int8_t ISDS_isZLOverThreshold(WE_sensorInterface_t *sensorInterface, ISDS_state_t *zlOverThreshold);
+  int8_t ISDS_isZHOverThreshold(WE_sensorInterface_t *sensorInterface, ISDS_state_t *zhOverThreshold);
+  int8_t ISDS_isDataEnableDataReady(WE_sensorInterface_t *sensorInterface, ISDS_state_t *dataReady);
 
   /* ISDS_STATUS_REG */
-  int8_t ISDS_getStatusRegister(ISDS_status_t *status);
-  int8_t ISDS_isAccelerationDataReady(ISDS_state_t *dataReady);
-  int8_t ISDS_isGyroscopeDataReady(ISDS_state_t *dataReady);
-  int8_t ISDS_isTemperatureDataReady(ISDS_state_t *dataReady);
+  int8_t ISDS_getStatusRegister(WE_sensorInterface_t *sensorInterface, ISDS_status_t *status);
+  int8_t ISDS_isAccelerationDataReady(WE_sensorInterface_t *sensorInterface, ISDS_state_t *dataReady);
+  int8_t ISDS_isGyroscopeDataReady(WE_sensorInterface_t *sensorInterface, ISDS_state_t *dataReady);
+  int8_t ISDS_isTemperatureDataReady(WE_sensorInterface_t *sensorInterface, ISDS_state_t *dataReady);
 
   /* ISDS_FIFO_STATUS_#_REG */
-  int8_t ISDS_getFifoStatus(ISDS_fifoStatus2_t *status, uint16_t *fillLevel, uint16_t *fifoPattern);
-  int8_t ISDS_getFifoStatus2Register(ISDS_fifoStatus2_t *status);
-  int8_t ISDS_getFifoFillLevel(uint16_t *fillLevel);
-  int8_t ISDS_isFifoEmpty(ISDS_state_t *empty);
-  int8_t ISDS_isFifoFull(ISDS_state_t *full);
-  int8_t ISDS_getFifoOverrunState(ISDS_state_t *overrun);
-  int8_t ISDS_isFifoThresholdReached(ISDS_state_t *threshReached);
-  int8_t ISDS_getFifoPattern(uint16_t *fifoPattern);
+  int8_t ISDS_getFifoStatus(WE_sensorInterface_t *sensorInterface, ISDS_fifoStatus2_t *status, uint16_t *fillLevel, uint16_t *fifoPattern);
+  int8_t ISDS_getFifoStatus2Register(WE_sensorInterface_t *sensorInterface, ISDS_fifoStatus2_t *status);
+  int8_t ISDS_getFifoFillLevel(WE_sensorInterface_t *sensorInterface, uint16_t *fillLevel);
+  int8_t ISDS_isFifoEmpty(WE_sensorInterface_t *sensorInterface, ISDS_state_t *empty);
+  int8_t ISDS_isFifoFull(WE_sensorInterface_t *sensorInterface, ISDS_state_t *full);
+  int8_t ISDS_getFifoOverrunState(WE_sensorInterface_t *sensorInterface, ISDS_state_t *overrun);
+  int8_t ISDS_isFifoThresholdReached(WE_sensorInterface_t *sensorInterface, ISDS_state_t *threshReached);
+  int8_t ISDS_getFifoPattern(WE_sensorInterface_t *sensorInterface, uint16_t *fifoPattern);
 
   /* ISDS_FUNC_SRC_1_REG */
-  int8_t ISDS_isTiltEvent(ISDS_state_t *tiltEvent);
+  int8_t ISDS_isTiltEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tiltEvent);
 
   /* ISDS_TAP_CFG_REG */
-  int8_t ISDS_enableLatchedInterrupt(ISDS_state_t lir);
-  int8_t ISDS_isLatchedInterruptEnabled(ISDS_state_t *lir);
-  int8_t ISDS_enableTapX(ISDS_state_t tapX);
-  int8_t ISDS_isTapXEnabled(ISDS_state_t *tapX);
-  int8_t ISDS_enableTapY(ISDS_state_t tapY);
-  int8_t ISDS_isTapYEnabled(ISDS_state_t *tapY);
-  int8_t ISDS_enableTapZ(ISDS_state_t tapZ);
-  int8_t ISDS_isTapZEnabled(ISDS_state_t *tapZ);
-  int8_t ISDS_setActivityFilter(ISDS_activityFilter_t filter);
-  int8_t ISDS_getActivityFilter(ISDS_activityFilter_t *filter);
-  int8_t ISDS_setInactivityFunction(ISDS_inactivityFunction_t function);
-  int8_t ISDS_getInactivityFunction(ISDS_inactivityFunction_t *function);
-  int8_t ISDS_enableInterrupts(ISDS_state_t interruptsEnable);
-  int8_t ISDS_areInterruptsEnabled(ISDS_state_t *interruptsEnable);
+  int8_t ISDS_enableLatchedInterrupt(WE_sensorInterface_t *sensorInterface, ISDS_state_t lir);
+  int8_t ISDS_isLatchedInterruptEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *lir);
+  int8_t ISDS_enableTapX(WE_sensorInterface_t *sensorInterface, ISDS_state_t tapX);
+  int8_t ISDS_isTapXEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tapX);
+  int8_t ISDS_enableTapY(WE_sensorInterface_t *sensorInterface, ISDS_state_t tapY);
+  int8_t ISDS_isTapYEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tapY);
+  int8_t ISDS_enableTapZ(WE_sensorInterface_t *sensorInterface, ISDS_state_t tapZ);
+  int8_t ISDS_isTapZEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *tapZ);
+  int8_t ISDS_setActivityFilter(WE_sensorInterface_t *sensorInterface, ISDS_activityFilter_t filter);
+  int8_t ISDS_getActivityFilter(WE_sensorInterface_t *sensorInterface, ISDS_activityFilter_t *filter);
+  int8_t ISDS_setInactivityFunction(WE_sensorInterface_t *sensorInterface, ISDS_inactivityFunction_t function);
+  int8_t ISDS_getInactivityFunction(WE_sensorInterface_t *sensorInterface, ISDS_inactivityFunction_t *function);
+  int8_t ISDS_enableInterrupts(WE_sensorInterface_t *sensorInterface, ISDS_state_t interruptsEnable);
+  int8_t ISDS_areInterruptsEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *interruptsEnable);
 
   /* ISDS_TAP_THS_6D_REG */
-  int8_t ISDS_setTapThreshold(uint8_t tapThreshold);
-  int8_t ISDS_getTapThreshold(uint8_t *tapThreshold);
-  int8_t ISDS_set6DThreshold(ISDS_sixDThreshold_t threshold6D);
-  int8_t ISDS_get6DThreshold(ISDS_sixDThreshold_t *threshold6D);
-  int8_t ISDS_enable4DDetection(ISDS_state_t detection4D);
-  int8_t ISDS_is4DDetectionEnabled(ISDS_state_t *detection4D);
+  int8_t ISDS_setTapThreshold(WE_sensorInterface_t *sensorInterface, uint8_t tapThreshold);
+  int8_t ISDS_getTapThreshold(WE_sensorInterface_t *sensorInterface, uint8_t *tapThreshold);
+  int8_t ISDS_set6DThreshold(WE_sensorInterface_t *sensorInterface, ISDS_sixDThreshold_t threshold6D);
+  int8_t ISDS_get6DThreshold(WE_sensorInterface_t *sensorInterface, ISDS_sixDThreshold_t *threshold6D);
+  int8_t ISDS_enable4DDetection(WE_sensorInterface_t *sensorInterface, ISDS_state_t detection4D);
+  int8_t ISDS_is4DDetectionEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *detection4D);
 
   /* ISDS_INT_DUR2_REG */
-  int8_t ISDS_setTapLatencyTime(uint8_t latencyTime);
-  int8_t ISDS_getTapLatencyTime(uint8_t *latencyTime);
-  int8_t ISDS_setTapQuietTime(uint8_t quietTime);
-  int8_t ISDS_getTapQuietTime(uint8_t *quietTime);
-  int8_t ISDS_setTapShockTime(uint8_t shockTime);
-  int8_t ISDS_getTapShockTime(uint8_t *shockTime);
+  int8_t ISDS_setTapLatencyTime(WE_sensorInterface_t *sensorInterface, uint8_t latencyTime);
+  int8_t ISDS_getTapLatencyTime(WE_sensorInterface_t *sensorInterface, uint8_t *latencyTime);
+  int8_t ISDS_setTapQuietTime(WE_sensorInterface_t *sensorInterface, uint8_t quietTime);
+  int8_t ISDS_getTapQuietTime(WE_sensorInterface_t *sensorInterface, uint8_t *quietTime);
+  int8_t ISDS_setTapShockTime(WE_sensorInterface_t *sensorInterface, uint8_t shockTime);
+  int8_t ISDS_getTapShockTime(WE_sensorInterface_t *sensorInterface, uint8_t *shockTime);
 
   /* ISDS_WAKE_UP_THS_REG */
-  int8_t ISDS_setWakeUpThreshold(uint8_t thresh);
-  int8_t ISDS_getWakeUpThreshold(uint8_t *thresh);
-  int8_t ISDS_enableDoubleTapEvent(ISDS_state_t doubleTapEnable);
-  int8_t ISDS_isDoubleTapEventEnabled(ISDS_state_t *doubleTapEnable);
+  int8_t ISDS_setWakeUpThreshold(WE_sensorInterface_t *sensorInterface, uint8_t thresh);
+  int8_t ISDS_getWakeUpThreshold(WE_sensorInterface_t *sensorInterface, uint8_t *thresh);
+  int8_t ISDS_enableDoubleTapEvent(WE_sensorInterface_t *sensorInterface, ISDS_state_t doubleTapEnable);
+  int8_t ISDS_isDoubleTapEventEnabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *doubleTapEnable);
 
   /* ISDS_WAKE_UP_DUR_REG */
-  int8_t ISDS_setSleepDuration(uint8_t duration);
-  int8_t ISDS_getSleepDuration(uint8_t *duration);
-  int8_t ISDS_setTimestampResolution(ISDS_timestampResolution_t resolution);
-  int8_t ISDS_getTimestampResolution(ISDS_timestampResolution_t *resolution);
-  int8_t ISDS_setWakeUpDuration(uint8_t duration);
-  int8_t ISDS_getWakeUpDuration(uint8_t *duration);
+  int8_t ISDS_setSleepDuration(WE_sensorInterface_t *sensorInterface, uint8_t duration);
+  int8_t ISDS_getSleepDuration(WE_sensorInterface_t *sensorInterface, uint8_t *duration);
+  int8_t ISDS_setTimestampResolution(WE_sensorInterface_t *sensorInterface, ISDS_timestampResolution_t resolution);
+  int8_t ISDS_getTimestampResolution(WE_sensorInterface_t *sensorInterface, ISDS_timestampResolution_t *resolution);
+  int8_t ISDS_setWakeUpDuration(WE_sensorInterface_t *sensorInterface, uint8_t duration);
+  int8_t ISDS_getWakeUpDuration(WE_sensorInterface_t *sensorInterface, uint8_t *duration);
 
   /* ISDS_FREE_FALL_REG */
-  int8_t ISDS_setFreeFallThreshold(ISDS_freeFallThreshold_t thresh);
-  int8_t ISDS_getFreeFallThreshold(ISDS_freeFallThreshold_t *thresh);
-  int8_t ISDS_setFreeFallDuration(uint8_t duration);
-  int8_t ISDS_getFreeFallDuration(uint8_t *duration);
+  int8_t ISDS_setFreeFallThreshold(WE_sensorInterface_t *sensorInterface, ISDS_freeFallThreshold_t thresh);
+  int8_t ISDS_getFreeFallThreshold(WE_sensorInterface_t *sensorInterface, ISDS_freeFallThreshold_t *thresh);
+  int8_t ISDS_setFreeFallDuration(WE_sensorInterface_t *sensorInterface, uint8_t duration);
+  int8_t ISDS_getFreeFallDuration(WE_sensorInterface_t *sensorInterface, uint8_t *duration);
 
   /* ISDS_MD1_CFG_REG */
-  int8_t ISDS_enableTimerEndCounterINT0(ISDS_state_t int0Timer);
-  int8_t ISDS_isTimerEndCounterINT0Enabled(ISDS_state_t *int0Timer);
-  int8_t ISDS_enableTiltINT0(ISDS_state_t int0Tilt);
-  int8_t ISDS_isTiltINT0Enabled(ISDS_state_t *int0Tilt);
-  int8_t ISDS_enable6dINT0(ISDS_state_t int06d);
-  int8_t ISDS_is6dINT0Enabled(ISDS_state_t *int06d);
-  int8_t ISDS_enableDoubleTapINT0(ISDS_state_t int0DoubleTap);
-  int8_t ISDS_isDoubleTapINT0Enabled(ISDS_state_t *int0DoubleTap);
-  int8_t ISDS_enableFreeFallINT0(ISDS_state_t int0FreeFall);
-  int8_t ISDS_isFreeFallINT0Enabled(ISDS_state_t *int0FreeFall);
-  int8_t ISDS_enableWakeUpINT0(ISDS_state_t int0WakeUp);
-  int8_t ISDS_isWakeUpINT0Enabled(ISDS_state_t *int0WakeUp);
-  int8_t ISDS_enableSingleTapINT0(ISDS_state_t int0SingleTap);
-  int8_t ISDS_isSingleTapINT0Enabled(ISDS_state_t *int0SingleTap);
-  int8_t ISDS_enableInactivityStateINT0(ISDS_state_t int0InactivityState);
-  int8_t ISDS_isInactivityStateINT0Enabled(ISDS_state_t *int0InactivityState);
+  int8_t ISDS_enableTimerEndCounterINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0Timer);
+  int8_t ISDS_isTimerEndCounterINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0Timer);
+  int8_t ISDS_enableTiltINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0Tilt);
+  int8_t ISDS_isTiltINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0Tilt);
+  int8_t ISDS_enable6dINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int06d);
+  int8_t ISDS_is6dINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int06d);
+  int8_t ISDS_enableDoubleTapINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0DoubleTap);
+  int8_t ISDS_isDoubleTapINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0DoubleTap);
+  int8_t ISDS_enableFreeFallINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0FreeFall);
+  int8_t ISDS_isFreeFallINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0FreeFall);
+  int8_t ISDS_enableWakeUpINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0WakeUp);
+  int8_t ISDS_isWakeUpINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0WakeUp);
+  int8_t ISDS_enableSingleTapINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0SingleTap);
+  int8_t ISDS_isSingleTapINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0SingleTap);
+  int8_t ISDS_enableInactivityStateINT0(WE_sensorInterface_t *sensorInterface, ISDS_state_t int0InactivityState);
+  int8_t ISDS_isInactivityStateINT0Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int0InactivityState);
 
   /* ISDS_MD2_CFG_REG */
-  int8_t ISDS_enableTiltINT1(ISDS_state_t int1Tilt);
-  int8_t ISDS_isTiltINT1Enabled(ISDS_state_t *int1Tilt);
-  int8_t ISDS_enable6dINT1(ISDS_state_t int16d);
-  int8_t ISDS_is6dINT1Enabled(ISDS_state_t *int16d);
-  int8_t ISDS_enableDoubleTapINT1(ISDS_state_t int1DoubleTap);
-  int8_t ISDS_isDoubleTapINT1Enabled(ISDS_state_t *int1DoubleTap);
-  int8_t ISDS_enableFreeFallINT1(ISDS_state_t int1FreeFall);
-  int8_t ISDS_isFreeFallINT1Enabled(ISDS_state_t *int1FreeFall);
-  int8_t ISDS_enableWakeUpINT1(ISDS_state_t int1WakeUp);
-  int8_t ISDS_isWakeUpINT1Enabled(ISDS_state_t *int1WakeUp);
-  int8_t ISDS_enableSingleTapINT1(ISDS_state_t int1SingleTap);
-  int8_t ISDS_isSingleTapINT1Enabled(ISDS_state_t *int1SingleTap);
-  int8_t ISDS_enableInactivityStateINT1(ISDS_state_t int1InactivityState);
-  int8_t ISDS_isInactivityStateINT1Enabled(ISDS_state_t *int1InactivityState);
+  int8_t ISDS_enableTiltINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1Tilt);
+  int8_t ISDS_isTiltINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1Tilt);
+  int8_t ISDS_enable6dINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int16d);
+  int8_t ISDS_is6dINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int16d);
+  int8_t ISDS_enableDoubleTapINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1DoubleTap);
+  int8_t ISDS_isDoubleTapINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1DoubleTap);
+  int8_t ISDS_enableFreeFallINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1FreeFall);
+  int8_t ISDS_isFreeFallINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1FreeFall);
+  int8_t ISDS_enableWakeUpINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1WakeUp);
+  int8_t ISDS_isWakeUpINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1WakeUp);
+  int8_t ISDS_enableSingleTapINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1SingleTap);
+  int8_t ISDS_isSingleTapINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1SingleTap);
+  int8_t ISDS_enableInactivityStateINT1(WE_sensorInterface_t *sensorInterface, ISDS_state_t int1InactivityState);
+  int8_t ISDS_isInactivityStateINT1Enabled(WE_sensorInterface_t *sensorInterface, ISDS_state_t *int1InactivityState);
 
   /* ISDS_TIMESTAMP#_REG */
-  int8_t ISDS_getTimestamp(uint32_t *timestamp);
-  int8_t ISDS_resetTimestampCounter();
+  int8_t ISDS_getTimestamp(WE_sensorInterface_t *sensorInterface, uint32_t *timestamp);
+  int8_t ISDS_resetTimestampCounter(WE_sensorInterface_t *sensorInterface);
 
   /* ISDS_#_OFS_USR_REG */
-  int8_t ISDS_setOffsetValueX(int8_t offsetValueXAxis);
-  int8_t ISDS_getOffsetValueX(int8_t *offsetValueXAxis);
-  int8_t ISDS_setOffsetValueY(int8_t offsetValueYAxis);
-  int8_t ISDS_getOffsetValueY(int8_t *offsetValueYAxis);
-  int8_t ISDS_setOffsetValueZ(int8_t offsetValueZAxis);
-  int8_t ISDS_getOffsetValueZ(int8_t *offsetValueZAxis);
+  int8_t ISDS_setOffsetValueX(WE_sensorInterface_t *sensorInterface, int8_t offsetValueXAxis);
+  int8_t ISDS_getOffsetValueX(WE_sensorInterface_t *sensorInterface, int8_t *offsetValueXAxis);
+  int8_t ISDS_setOffsetValueY(WE_sensorInterface_t *sensorInterface, int8_t offsetValueYAxis);
+  int8_t ISDS_getOffsetValueY(WE_sensorInterface_t *sensorInterface, int8_t *offsetValueYAxis);
+  int8_t ISDS_setOffsetValueZ(WE_sensorInterface_t *sensorInterface, int8_t offsetValueZAxis);
+  int8_t ISDS_getOffsetValueZ(WE_sensorInterface_t *sensorInterface, int8_t *offsetValueZAxis);
 
   /* ISDS_FIFO_DATA_OUT_L_REG */
   /* ISDS_FIFO_DATA_OUT_H_REG */
-  int8_t ISDS_getFifoData(uint16_t numSamples, uint16_t *fifoData);
+  int8_t ISDS_getFifoData(WE_sensorInterface_t *sensorInterface, uint16_t numSamples, uint16_t *fifoData);
+
+  /* FIFO pattern decoder */
+  int8_t ISDS_updateFifoDecoder(WE_sensorInterface_t *sensorInterface, ISDS_fifoDecoder_t *decoder);
+  void ISDS_syncFifoDecoder(ISDS_fifoDecoder_t *decoder, uint16_t fifoPattern);
+  uint16_t ISDS_getFifoFrameWords(const ISDS_fifoDecoder_t *decoder, uint16_t numFrames);
+  int8_t ISDS_decodeFifoWord(ISDS_fifoDecoder_t *decoder, uint16_t word, ISDS_fifoFrame_t *frame);
+
+  /* Rate planner */
+  int8_t ISDS_getFifoDecimation(ISDS_fifoOutputDataRate_t fifoOdr, uint8_t sensorOdr, ISDS_fifoDecimation_t *decimation);
+  int8_t ISDS_planRates(ISDS_ratePlan_t *plan);
+
+  /* Timestamp clock */
+  void ISDS_initTimestampClock(ISDS_timestampClock_t *clock, ISDS_timestampResolution_t resolution);
+  uint32_t ISDS_getSensorTime(ISDS_timestampClock_t *clock, uint32_t ticks);
+  void ISDS_syncTimestampClock(ISDS_timestampClock_t *clock, uint32_t ticks, uint32_t hostUs);
+  uint32_t ISDS_getHostTime(ISDS_timestampClock_t *clock, uint32_t ticks);
 
   /* Gyroscope output */
 #ifdef WE_USE_FLOAT
-  int8_t ISDS_getAngularRateX_float(float *xRate);
-  int8_t ISDS_getAngularRateY_float(float *yRate);
-  int8_t ISDS_getAngularRateZ_float(float *zRate);
-  int8_t ISDS_getAngularRates_float(float *xRate, float *yRate, float *zRate);
+  int8_t ISDS_getAngularRateX_float(WE_sensorInterface_t *sensorInterface, float *xRate);
+  int8_t ISDS_getAngularRateY_float(WE_sensorInterface_t *sensorInterface, float *yRate);
+  int8_t ISDS_getAngularRateZ_float(WE_sensorInterface_t *sensorInterface, float *zRate);
+  int8_t ISDS_getAngularRates_float(WE_sensorInterface_t *sensorInterface, float *xRate, float *yRate, float *zRate);
 #else
   #warning "WSEN_ISDS sensor driver: Float support is turned off by default. Define WE_USE_FLOAT to enable float support."
 #endif /* WE_USE_FLOAT */
-  int8_t ISDS_getAngularRateX_int(int32_t *xRate);
-  int8_t ISDS_getAngularRateY_int(int32_t *yRate);
-  int8_t ISDS_getAngularRateZ_int(int32_t *zRate);
-  int8_t ISDS_getAngularRates_int(int32_t *xRate, int32_t *yRate, int32_t *zRate);
-  int8_t ISDS_getRawAngularRateX(int16_t *xRawRate);
-  int8_t ISDS_getRawAngularRateY(int16_t *yRawRate);
-  int8_t ISDS_getRawAngularRateZ(int16_t *zRawRate);
-  int8_t ISDS_getRawAngularRates(int16_t *xRawRate, int16_t *yRawRate, int16_t *zRawRate);
+  int8_t ISDS_getAngularRateX_int(WE_sensorInterface_t *sensorInterface, int32_t *xRate);
+  int8_t ISDS_getAngularRateY_int(WE_sensorInterface_t *sensorInterface, int32_t *yRate);
+  int8_t ISDS_getAngularRateZ_int(WE_sensorInterface_t *sensorInterface, int32_t *zRate);
+  int8_t ISDS_getAngularRates_int(WE_sensorInterface_t *sensorInterface, int32_t *xRate, int32_t *yRate, int32_t *zRate);
+  int8_t ISDS_getRawAngularRateX(WE_sensorInterface_t *sensorInterface, int16_t *xRawRate);
+  int8_t ISDS_getRawAngularRateY(WE_sensorInterface_t *sensorInterface, int16_t *yRawRate);
+  int8_t ISDS_getRawAngularRateZ(WE_sensorInterface_t *sensorInterface, int16_t *zRawRate);
+  int8_t ISDS_getRawAngularRates(WE_sensorInterface_t *sensorInterface, int16_t *xRawRate, int16_t *yRawRate, int16_t *zRawRate);
 
   /* Accelerometer output */
 #ifdef WE_USE_FLOAT
-  int8_t ISDS_getAccelerationX_float(float *xAcc);
-  int8_t ISDS_getAccelerationY_float(float *yAcc);
-  int8_t ISDS_getAccelerationZ_float(float *zAcc);
-  int8_t ISDS_getAccelerations_float(float *xAcc, float *yAcc, float *zAcc);
+  int8_t ISDS_getAccelerationX_float(WE_sensorInterface_t *sensorInterface, float *xAcc);
+  int8_t ISDS_getAccelerationY_float(WE_sensorInterface_t *sensorInterface, float *yAcc);
+  int8_t ISDS_getAccelerationZ_float(WE_sensorInterface_t *sensorInterface, float *zAcc);
+  int8_t ISDS_getAccelerations_float(WE_sensorInterface_t *sensorInterface, float *xAcc, float *yAcc, float *zAcc);
 #endif /* WE_USE_FLOAT */
-  int8_t ISDS_getAccelerationX_int(int16_t *xAcc);
-  int8_t ISDS_getAccelerationY_int(int16_t *yAcc);
-  int8_t ISDS_getAccelerationZ_int(int16_t *zAcc);
-  int8_t ISDS_getAccelerations_int(int16_t *xAcc, int16_t *yAcc, int16_t *zAcc);
-  int8_t ISDS_getRawAccelerationX(int16_t *xRawAcc);
-  int8_t ISDS_getRawAccelerationY(int16_t *yRawAcc);
-  int8_t ISDS_getRawAccelerationZ(int16_t *zRawAcc);
-  int8_t ISDS_getRawAccelerations(int16_t *xRawAcc, int16_t *yRawAcc, int16_t *zRawAcc);
+  int8_t ISDS_getAccelerationX_int(WE_sensorInterface_t *sensorInterface, int16_t *xAcc);
+  int8_t ISDS_getAccelerationY_int(WE_sensorInterface_t *sensorInterface, int16_t *yAcc);
+  int8_t ISDS_getAccelerationZ_int(WE_sensorInterface_t *sensorInterface, int16_t *zAcc);
+  int8_t ISDS_getAccelerations_int(WE_sensorInterface_t *sensorInterface, int16_t *xAcc, int16_t *yAcc, int16_t *zAcc);
+  int8_t ISDS_getRawAccelerationX(WE_sensorInterface_t *sensorInterface, int16_t *xRawAcc);
+  int8_t ISDS_getRawAccelerationY(WE_sensorInterface_t *sensorInterface, int16_t *yRawAcc);
+  int8_t ISDS_getRawAccelerationZ(WE_sensorInterface_t *sensorInterface, int16_t *zRawAcc);
+  int8_t ISDS_getRawAccelerations(WE_sensorInterface_t *sensorInterface, int16_t *xRawAcc, int16_t *yRawAcc, int16_t *zRawAcc);
 
   /* Temperature sensor output */
 #ifdef WE_USE_FLOAT
-  int8_t ISDS_getTemperature_float(float *temperature);
+  int8_t ISDS_getTemperature_float(WE_sensorInterface_t *sensorInterface, float *temperature);
 #endif /* WE_USE_FLOAT */
-  int8_t ISDS_getTemperature_int(int16_t *temperature);
-  int8_t ISDS_getRawTemperature(int16_t *temperature);
+  int8_t ISDS_getTemperature_int(WE_sensorInterface_t *sensorInterface, int16_t *temperature);
+  int8_t ISDS_getRawTemperature(WE_sensorInterface_t *sensorInterface, int16_t *temperature);
+
+  /* Status, temperature, angular rate and acceleration in one transfer */
+  int8_t ISDS_getRawSample(WE_sensorInterface_t *sensorInterface, ISDS_rawSample_t *sample);
+  int8_t ISDS_getSample_int(WE_sensorInterface_t *sensorInterface, ISDS_sample_t *sample);
 
 
 #ifdef WE_USE_FLOAT
@@ -0,0 +1,355 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+/**
+ * @file
+ * @brief Fixed-point orientation estimator for the WSEN-ISDS sensor.
+ */
+
+#include "WSEN_ISDS_Fusion.h"
+
+/* Product of two Q30 values */
+#define ISDS_FUSION_MUL(a, b)                 ((int32_t) (((int64_t) (a) * (b)) >> 30))
+
+/**
+ * @brief Sample period in [µs] per ODR setting, ISDS_accOdr1Hz6 exists for the accelerometer only
+ */
+static const uint32_t ISDS_outputDataRatePeriodsUs[12] = { 0, 80000, 38462, 19231, 9615, 4808, 2404, 1200, 600, 300, 150, 625000 };
+
+/**
+ * @brief Initialize the orientation estimator
+ *
+ * The quaternion starts at the identity, the gains at ISDS_FUSION_DEFAULT_KP and
+ * ISDS_FUSION_DEFAULT_KI.
+ *
+ * @param[out] fusion Orientation estimator
+ * @param[in] gyroFullScale Gyroscope full scale of the raw angular rates
+ * @param[in] accFullScale Accelerometer full scale of the raw accelerations
+ * @param[in] periodUs Time between two angular rate samples in [µs] (1 ... 1000000),
+ *            e.g. ISDS_getGyroOutputDataRatePeriodUs()
+ * @retval Error code
+ */
+int8_t ISDS_initFusion(ISDS_fusion_t *fusion, ISDS_gyroFullScale_t gyroFullScale, ISDS_accFullScale_t accFullScale, uint32_t periodUs)
+{
+  uint32_t sensitivity;   /* [µdps/LSB] */
+  uint8_t accRange;       /* log2(full scale / 2g) */
+  uint32_t oneG;          /* [LSB] */
+
+  switch (gyroFullScale)
+  {
+  case ISDS_gyroFullScale125dps:
+    sensitivity = 4375;
+    break;
+  case ISDS_gyroFullScale250dps:
+    sensitivity = 8750;
+    break;
+  case ISDS_gyroFullScale500dps:
+    sensitivity = 17500;
+    break;
+  case ISDS_gyroFullScale1000dps:
+    sensitivity = 35000;
+    break;
+  case ISDS_gyroFullScale2000dps:
+    sensitivity = 70000;
+    break;
+  default:
+    return WE_FAIL;
+  }
+
+  switch (accFullScale)
+  {
+  case ISDS_accFullScaleTwoG:
+    accRange = 0;
+    break;
+  case ISDS_accFullScaleFourG:
+    accRange = 1;
+    break;
+  case ISDS_accFullScaleEightG:
+    accRange = 2;
+    break;
+  case ISDS_accFullScaleSixteenG:
+    accRange = 3;
+    break;
+  default:
+    return WE_FAIL;
+  }
+
+  if ((0 == periodUs) || (periodUs > 1000000))
+  {
+    return WE_FAIL;
+  }
+
+  /* [µdps] * [µs] * pi / 360 * 2^38 / 10^12, the factor is 2.398762e-3 * 2^27 */
+  fusion->gyroScale = (int32_t) (((uint64_t) sensitivity * periodUs * 321955) >> 27);
+  fusion->halfPeriod = (int32_t) (((uint64_t) periodUs << 29) / 1000000);
+
+  /* 1 g is about 2^14 LSB at 2 g full scale (0.061 mg/LSB); corrections only use
+   * accelerations between 0.75 g and 1.25 g, scaled by the nominal 1 g */
+  oneG = (uint32_t) 1 << (14 - accRange);
+  fusion->accShift = (uint8_t) (16 + accRange);
+  fusion->accNormMin = ((oneG * oneG) / 16) * 9;
+  fusion->accNormMax = ((oneG * oneG) / 16) * 25;
+
+  ISDS_resetFusion(fusion);
+  return ISDS_setFusionGains(fusion, ISDS_FUSION_DEFAULT_KP, ISDS_FUSION_DEFAULT_KI);
+}
+
+/**
+ * @brief Set the gains of the orientation estimator
+ *
+ * A higher proportional gain follows the accelerometer faster, at the cost of
+ * more noise and of errors during linear acceleration. A nonzero integral gain
+ * estimates the gyroscope bias (roll and pitch axes).
+ *
+ * @param[in,out] fusion Orientation estimator
+ * @param[in] kp Proportional gain in [1/s] Q16 (ISDS_FUSION_GAIN_ONE = 1.0)
+ * @param[in] ki Integral gain in [1/s²] Q16
+ * @retval Error code
+ */
+int8_t ISDS_setFusionGains(ISDS_fusion_t *fusion, uint32_t kp, uint32_t ki)
+{
+  int64_t kpHalfPeriod = ((int64_t) kp * fusion->halfPeriod) >> 16;
+  int64_t kiPeriod = ((int64_t) ki * fusion->halfPeriod) >> 15;
+
+  if ((kpHalfPeriod > ISDS_FUSION_ONE) || (kiPeriod > ISDS_FUSION_ONE))
+  {
+    return WE_FAIL;
+  }
+
+  fusion->kpHalfPeriod = (int32_t) kpHalfPeriod;
+  fusion->kiPeriod = (int32_t) kiPeriod;
+  return WE_SUCCESS;
+}
+
+/**
+ * @brief Reset the orientation to the identity and clear the gyroscope bias estimate
+ * @param[in,out] fusion Orientation estimator
+ */
+void ISDS_resetFusion(ISDS_fusion_t *fusion)
+{
+  uint8_t i;
+
+  fusion->q[0] = ISDS_FUSION_ONE;
+  for (i = 0; i < 3; i++)
+  {
+    fusion->q[i + 1] = 0;
+    fusion->integral[i] = 0;
+  }
+}
+
+/**
+ * @brief Get the sample period of an accelerometer ODR setting
+ * @param[in] odr Accelerometer output data rate
+ * @retval Sample period in [µs], 0 if off or invalid
+ */
+uint32_t ISDS_getAccOutputDataRatePeriodUs(ISDS_accOutputDataRate_t odr)
+{
+  return ((uint8_t) odr <= ISDS_accOdr1Hz6) ? ISDS_outputDataRatePeriodsUs[odr] : 0;
+}
+
+/**
+ * @brief Get the sample period of a gyroscope ODR setting
+ * @param[in] odr Gyroscope output data rate
+ * @retval Sample period in [µs], 0 if off or invalid
+ */
+uint32_t ISDS_getGyroOutputDataRatePeriodUs(ISDS_gyroOutputDataRate_t odr)
+{
+  return ((uint8_t) odr <= ISDS_gyroOdr6k66Hz) ? ISDS_outputDataRatePeriodsUs[odr] : 0;
+}
+
+/**
+ * @brief Advance the orientation by one angular rate sample, without normalization
+ * @param[in,out] fusion Orientation estimator
+ * @param[in] gyro Raw X, Y and Z-axis angular rate
+ * @param[in] acc Raw X, Y and Z-axis acceleration, NULL if none
+ */
+static void ISDS_stepFusion(ISDS_fusion_t *fusion, const int16_t gyro[3], const int16_t *acc)
+{
+  int32_t *q = fusion->q;
+  int32_t h[3];       /* half rotation angle of this sample [rad] Q30 */
+  int32_t q0, q1, q2, q3;
+  uint8_t i;
+
+  for (i = 0; i < 3; i++)
+  {
+    h[i] = (int32_t) (((int64_t) gyro[i] * fusion->gyroScale) >> 8);
+  }
+
+  if (NULL != acc)
+  {
+    uint32_t norm = 0;
+
+    for (i = 0; i < 3; i++)
+    {
+      norm += (uint32_t) ((int32_t) acc[i] * acc[i]);
+    }
+
+    if ((norm >= fusion->accNormMin) && (norm <= fusion->accNormMax))
+    {
+      int32_t a[3];
+      int32_t v[3];
+      int32_t e[3];
+
+      for (i = 0; i < 3; i++)
+      {
+        a[i] = (int32_t) acc[i] * ((int32_t) 1 << fusion->accShift);
+      }
+
+      /* Direction of gravity in the sensor frame according to the orientation */
+      v[0] = 2 * (ISDS_FUSION_MUL(q[1], q[3]) - ISDS_FUSION_MUL(q[0], q[2]));
+      v[1] = 2 * (ISDS_FUSION_MUL(q[0], q[1]) + ISDS_FUSION_MUL(q[2], q[3]));
+      v[2] = ISDS_FUSION_MUL(q[0], q[0]) - ISDS_FUSION_MUL(q[1], q[1]) - ISDS_FUSION_MUL(q[2], q[2]) + ISDS_FUSION_MUL(q[3], q[3]);
+
+      /* Error between measured and estimated direction */
+      e[0] = ISDS_FUSION_MUL(a[1], v[2]) - ISDS_FUSION_MUL(a[2], v[1]);
+      e[1] = ISDS_FUSION_MUL(a[2], v[0]) - ISDS_FUSION_MUL(a[0], v[2]);
+      e[2] = ISDS_FUSION_MUL(a[0], v[1]) - ISDS_FUSION_MUL(a[1], v[0]);
+
+      for (i = 0; i < 3; i++)
+      {
+        if (0 != fusion->kiPeriod)
+        {
+          fusion->integral[i] += ISDS_FUSION_MUL(fusion->kiPeriod, e[i]);
+        }
+        h[i] += ISDS_FUSION_MUL(fusion->kpHalfPeriod, e[i]);
+      }
+    }
+  }
+
+  if (0 != fusion->kiPeriod)
+  {
+    for (i = 0; i < 3; i++)
+    {
+      h[i] += ISDS_FUSION_MUL(fusion->integral[i], fusion->halfPeriod);
+    }
+  }
+
+  /* q += q * (0, h) */
+  q0 = q[0];
+  q1 = q[1];
+  q2 = q[2];
+  q3 = q[3];
+  q[0] = q0 - ISDS_FUSION_MUL(q1, h[0]) - ISDS_FUSION_MUL(q2, h[1]) - ISDS_FUSION_MUL(q3, h[2]);
+  q[1] = q1 + ISDS_FUSION_MUL(q0, h[0]) + ISDS_FUSION_MUL(q2, h[2]) - ISDS_FUSION_MUL(q3, h[1]);
+  q[2] = q2 + ISDS_FUSION_MUL(q0, h[1]) - ISDS_FUSION_MUL(q1, h[2]) + ISDS_FUSION_MUL(q3, h[0]);
+  q[3] = q3 + ISDS_FUSION_MUL(q0, h[2]) + ISDS_FUSION_MUL(q1, h[1]) - ISDS_FUSION_MUL(q2, h[0]);
+}
+
+/**
+ * @brief Scale the quaternion back to unit length
+ *
+ * One Newton step of 1/sqrt(n) starting at 1, the remaining error is of the
+ * order of the squared deviation and is removed by the next call.
+ *
+ * @param[in,out] fusion Orientation estimator
+ */
+static void ISDS_normalizeFusion(ISDS_fusion_t *fusion)
+{
+  int32_t *q = fusion->q;
+  int32_t norm = 0;
+  int32_t scale;
+  uint8_t i;
+
+  for (i = 0; i < 4; i++)
+  {
+    norm += ISDS_FUSION_MUL(q[i], q[i]);
+  }
+
+  scale = ISDS_FUSION_ONE + ((ISDS_FUSION_ONE - norm) / 2);
+  for (i = 0; i < 4; i++)
+  {
+    q[i] = ISDS_FUSION_MUL(q[i], scale);
+  }
+}
+
+/**
+ * @brief Update the orientation with one sample
+ * @param[in,out] fusion Orientation estimator
+ * @param[in] gyro Raw X, Y and Z-axis angular rate (e.g. ISDS_rawSample_t.gyro)
+ * @param[in] acc Raw X, Y and Z-axis acceleration (e.g. ISDS_rawSample_t.acc), NULL if none
+ */
+void ISDS_updateFusion(ISDS_fusion_t *fusion, const int16_t gyro[3], const int16_t *acc)
+{
+  ISDS_stepFusion(fusion, gyro, acc);
+  ISDS_normalizeFusion(fusion);
+}
+
+/**
+ * @brief Update the orientation with a block of decoded FIFO frames
+ *
+ * Every frame with an angular rate is one step of the sample period given to
+ * ISDS_initFusion(). An acceleration is used with the next angular rate, so a
+ * decimated accelerometer only corrects every n-th step. The quaternion is
+ * normalized once per block.
+ *
+ * @param[in,out] fusion Orientation estimator
+ * @param[in] frames Frames decoded by ISDS_decodeFifoWord() (e.g. Sensor_ISDS::read_FIFO_frames())
+ * @param[in] numFrames Number of frames
+ * @retval Number of angular rate samples processed
+ */
+uint16_t ISDS_updateFusionFrames(ISDS_fusion_t *fusion, const ISDS_fifoFrame_t *frames, uint16_t numFrames)
+{
+  const int16_t *acc = NULL;
+  uint16_t steps = 0;
+  uint16_t i;
+
+  for (i = 0; i < numFrames; i++)
+  {
+    if (0 != (frames[i].sets & ISDS_FIFO_SET_ACC))
+    {
+      acc = frames[i].acc;
+    }
+    if (0 != (frames[i].sets & ISDS_FIFO_SET_GYRO))
+    {
+      ISDS_stepFusion(fusion, frames[i].gyro, acc);
+      acc = NULL;
+      steps++;
+    }
+  }
+
+  if (steps > 0)
+  {
+    ISDS_normalizeFusion(fusion);
+  }
+
+  return steps;
+}
+
+#ifdef WE_USE_FLOAT
+/**
+ * @brief Get the orientation quaternion as float
+ * @param[in] fusion Orientation estimator
+ * @param[out] q Quaternion w, x, y, z
+ */
+void ISDS_getFusionQuaternion_float(const ISDS_fusion_t *fusion, float q[4])
+{
+  uint8_t i;
+
+  for (i = 0; i < 4; i++)
+  {
+    q[i] = (float) fusion->q[i] / (float) ISDS_FUSION_ONE;
+  }
+}
+#endif /* WE_USE_FLOAT */
@@ -0,0 +1,87 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+/**
+ * @file
+ * @brief Header file of the fixed-point orientation estimator for the WSEN-ISDS sensor.
+ *
+ * Mahony filter on raw angular rates and accelerations, e.g. from
+ * ISDS_getRawSample() or decoded FIFO frames. All math is integer, the
+ * quaternion is kept in Q30 (1.0 = 2^30).
+ */
+#ifndef _WSEN_ISDS_FUSION_H
+#define _WSEN_ISDS_FUSION_H
+
+#include <stdint.h>
+#include "WSEN_ISDS_2536030320001.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define ISDS_FUSION_ONE                       ((int32_t) 1 << 30)   /**< 1.0 in Q30 */
+#define ISDS_FUSION_GAIN_ONE                  ((uint32_t) 1 << 16)  /**< Gain of 1.0 in Q16 */
+
+#define ISDS_FUSION_DEFAULT_KP                (ISDS_FUSION_GAIN_ONE / 2)  /**< Proportional gain, 0.5 [1/s] */
+#define ISDS_FUSION_DEFAULT_KI                0                           /**< Integral gain, 0 [1/s²] (no gyroscope bias estimation) */
+
+/**
+ * @brief State of the orientation estimator
+ */
+typedef struct
+{
+  int32_t q[4];                 /**< Orientation quaternion w, x, y, z in Q30, rotates the sensor frame into the earth frame */
+  int32_t integral[3];          /**< Integral feedback (gyroscope bias estimate) in [rad/s] Q30 */
+  int32_t gyroScale;            /**< Half rotation angle per sample and gyroscope LSB in [rad] Q38 */
+  int32_t halfPeriod;           /**< Half the sample period in [s] Q30 */
+  int32_t kpHalfPeriod;         /**< Proportional gain times halfPeriod, Q30 */
+  int32_t kiPeriod;             /**< Integral gain times the sample period, Q30 */
+  uint32_t accNormMin;          /**< Lowest squared norm of an acceleration used for correction in [LSB²] */
+  uint32_t accNormMax;          /**< Highest squared norm of an acceleration used for correction in [LSB²] */
+  uint8_t accShift;             /**< Shift of a raw acceleration to [g] Q30 */
+} ISDS_fusion_t;
+
+
+/*         Functions definition         */
+
+  int8_t ISDS_initFusion(ISDS_fusion_t *fusion, ISDS_gyroFullScale_t gyroFullScale, ISDS_accFullScale_t accFullScale, uint32_t periodUs);
+  int8_t ISDS_setFusionGains(ISDS_fusion_t *fusion, uint32_t kp, uint32_t ki);
+  void ISDS_resetFusion(ISDS_fusion_t *fusion);
+  uint32_t ISDS_getAccOutputDataRatePeriodUs(ISDS_accOutputDataRate_t odr);
+  uint32_t ISDS_getGyroOutputDataRatePeriodUs(ISDS_gyroOutputDataRate_t odr);
+
+  void ISDS_updateFusion(ISDS_fusion_t *fusion, const int16_t gyro[3], const int16_t *acc);
+  uint16_t ISDS_updateFusionFrames(ISDS_fusion_t *fusion, const ISDS_fifoFrame_t *frames, uint16_t numFrames);
+
+#ifdef WE_USE_FLOAT
+  void ISDS_getFusionQuaternion_float(const ISDS_fusion_t *fusion, float q[4]);
+#endif /* WE_USE_FLOAT */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _WSEN_ISDS_FUSION_H */
@@ -0,0 +1,111 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+/*
+ * WSEN-ITDS  FIFO streaming
+ * 
+ * Streams the acceleration at 200 Hz without polling the sensor.
+ * 
+ * The FIFO runs in continuous mode and raises INT_0 whenever it holds
+ * 16 samples. The interrupt handler only notes the time, the FIFO is
+ * drained in the loop, a few samples per I2C transfer, into a ring of
+ * timestamped samples. Between the interrupts the MCU is free to sleep.
+ * 
+ * INT_0 of the sensor is connected to pin 2.
+ * 
+ */
+
+#include "WSEN_ITDS.h"
+
+#define INT0_PIN 2
+
+Sensor_ITDS sensor;
+ITDS_streamSample_t ring[64];
+
+void watermark()
+{
+  sensor.watermark_ISR();
+}
+
+void setup()
+{
+  delay(5000);
+  Serial.begin(115200);
+
+  // Initialize the I2C interface
+  sensor.init(ITDS_ADDRESS_I2C_1);
+
+  //The Output Data Rate mode 6 (200hz)
+  sensor.ODR = 6;
+
+  if (WE_FAIL == sensor.set_High_Performance())
+  {
+    Serial.println("Sensor config failed. high performance. STOP.");
+    while(1);
+  }
+
+  pinMode(INT0_PIN, INPUT);
+  attachInterrupt(digitalPinToInterrupt(INT0_PIN), watermark, RISING);
+
+  // Continuous FIFO mode, interrupt at 16 samples
+  if (WE_FAIL == sensor.start_Streaming(ring, 64, 16))
+  {
+    Serial.println("Sensor config failed. Streaming. STOP.");
+    while(1);
+  }
+}
+
+void loop()
+{
+  ITDS_streamSample_t samples[16];
+  int count;
+
+  if (WE_FAIL == sensor.service_Streaming())
+  {
+    Serial.println("Sensor FIFO read error. STOP.");
+    while(1);
+  }
+
+  while (0 < (count = sensor.read_Stream(samples, 16)))
+  {
+    for (int i = 0; i < count; i++)
+    {
+      Serial.print(samples[i].timestamp);
+      Serial.print(" ");
+      Serial.print(samples[i].raw[0]);
+      Serial.print(" ");
+      Serial.print(samples[i].raw[1]);
+      Serial.print(" ");
+      Serial.println(samples[i].raw[2]);
+    }
+  }
+
+  static uint32_t lost = 0;
+  if (lost != sensor.get_Stream_Lost())
+  {
+    lost = sensor.get_Stream_Lost();
+    Serial.println("Samples lost, the loop is too slow.");
+  }
+}
@@ -0,0 +1,105 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+/*
+ * WSEN-ITDS  two sensors on one bus
+ * 
+ * Reads the acceleration of two WSEN-ITDS sensors sharing the same I2C bus.
+ * 
+ * The SAO pins of the two sensors are connected to different logic
+ * levels. Each sensor object keeps its own address, so no re-addressing
+ * is needed between the accesses.
+ * 
+ */
+
+#include "WSEN_ITDS.h"
+
+Sensor_ITDS sensor_0;
+Sensor_ITDS sensor_1;
+
+void configure(Sensor_ITDS *sensor)
+{
+  //The Output Data Rate mode 6 (200hz)
+  sensor->ODR = 6;
+
+  if (WE_FAIL == sensor->set_High_Performance())
+  {
+    Serial.println("Sensor config failed. high performance. STOP.");
+    while(1);
+  }
+
+  // Set the full scale to 16g
+  if (WE_FAIL == sensor->set_Full_Scale(3))
+  {
+    Serial.println("Sensor config failed. Full scale. STOP.");
+    while(1);
+  }
+}
+
+void print_acceleration(Sensor_ITDS *sensor)
+{
+  float acc_X = 0.0f;
+  float acc_Y = 0.0f;
+  float acc_Z = 0.0f;
+
+  if ((WE_FAIL == sensor->get_acceleration_X(&acc_X)) ||
+      (WE_FAIL == sensor->get_acceleration_Y(&acc_Y)) ||
+      (WE_FAIL == sensor->get_acceleration_Z(&acc_Z)))
+  {
+    Serial.println("Sensor read error. STOP.");
+    while(1);
+  }
+
+  Serial.print(acc_X);
+  Serial.print(" ");
+  Serial.print(acc_Y);
+  Serial.print(" ");
+  Serial.println(acc_Z);
+}
+
+void setup()
+{
+  delay(5000);
+
+  Serial.begin(9600);
+
+  // Initialize both sensors on the same I2C interface
+  sensor_0.init(ITDS_ADDRESS_I2C_0);
+  sensor_1.init(ITDS_ADDRESS_I2C_1);
+
+  configure(&sensor_0);
+  configure(&sensor_1);
+}
+
+void loop()
+{
+  Serial.print("Sensor 0 acceleration [mg]: ");
+  print_acceleration(&sensor_0);
+
+  Serial.print("Sensor 1 acceleration [mg]: ");
+  print_acceleration(&sensor_1);
+
+  delay(1000);
+}
@@ -23,42 +23,53 @@
  ***************************************************************************************************
  **/
 
-#ifndef ARDUINOPLATFORM_H
-#define ARDUINOPLATFORM_H
+/*
+ * WSEN-ITDS  single conversion on demand
+ * 
+ * Takes one acceleration sample every 5 seconds. The sensor stays idle
+ * between the samples: each conversion is triggered over I2C, the sensor
+ * returns to idle on its own once the sample is taken.
+ * 
+ */
 
-#define TIMEOUT_MS (uint16_t)100		/* 100ms */
+#include "WSEN_ITDS.h"
 
-/**         Includes         **/
+Sensor_ITDS sensor;
 
-#include <stdint.h>
-#include <stdlib.h>
-
-#include <Arduino.h>
-#include <stdbool.h>
-
-#define WE_SUCCESS 0
-#define WE_FAIL -1
+void setup()
+{
+  delay(5000);
+  Serial.begin(9600);
 
-//Use SDA1 and SCL1 on Arduino Due
-#if defined(__SAM3X8E__)
-#define Wire Wire1
-#endif
+  // Initialize the I2C interface
+  sensor.init(ITDS_ADDRESS_I2C_1);
 
-/**         Functions definition         **/
+  // Single conversion on demand, triggered over I2C
+  if (WE_FAIL == sensor.set_Single_Conversion(I2C))
+  {
+    Serial.println("Sensor config failed. Single conversion. STOP.");
+    while(1);
+  }
+}
 
-#ifdef __cplusplus
-extern "C"
+void loop()
 {
-#endif
+  float acc_X, acc_Y, acc_Z;
 
-void I2CSetAddress(int address);
-int I2CInit(int address);
-int ReadReg(uint8_t RegAdr, int NumByteToRead, uint8_t *Data);
-int WriteReg(uint8_t RegAdr, int NumByteToWrite, uint8_t *Data);
-int I2C_read(uint8_t *data, int bytesToRead);
+  // Blocks until the sample is taken. Without blocking, call
+  // start_Single_Conversion() and read_Single_Conversion() on data-ready.
+  if (WE_FAIL == sensor.get_Single_Conversion(&acc_X, &acc_Y, &acc_Z))
+  {
+    Serial.println("Sensor read error. STOP.");
+    while(1);
+  }
 
-#ifdef __cplusplus
-}
-#endif
+  Serial.print("Acceleration [mg]: ");
+  Serial.print(acc_X);
+  Serial.print(" ");
+  Serial.print(acc_Y);
+  Serial.print(" ");
+  Serial.println(acc_Z);
 
-#endif /* ARDUINOPLATFORM_H */
+  delay(5000);
+}
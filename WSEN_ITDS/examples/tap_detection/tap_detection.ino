@@ -0,0 +1,93 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+/*
+ * WSEN-ITDS  tap detection
+ * 
+ * Configures tap, double-tap and free-fall detection with one constant
+ * detection profile, checked at compile time and written in a single
+ * transfer. The events are read with one transfer per poll.
+ * 
+ */
+
+#include "WSEN_ITDS.h"
+
+// Tap thresholds of 9/32 FS on all axes, double-tap with a gap of up to
+// 8 * 32/ODR, free-fall below 312 mg for 10/ODR
+constexpr ITDS_detection_Profile_t profile = {
+  { 9, 9, 9, ITDS_enable, ITDS_enable, ITDS_enable, Z_Y_X, 2, 1, 7, ITDS_enable },
+  { 0, 0, ITDS_disable, ITDS_disable, 0 },
+  { ten, 10 },
+  sixtyDeg, ITDS_disable };
+static_assert(ITDS_isValidDetectionProfile(profile), "invalid detection profile");
+
+Sensor_ITDS sensor;
+
+void on_Tap(ITDS_event_Type type, const ITDS_events_t *events, void *context)
+{
+  Serial.print(ITDS_eventDoubleTap == type ? "Double tap" : "Tap");
+  Serial.print(events->tapAxes & ITDS_AXIS_X ? " X" : "");
+  Serial.print(events->tapAxes & ITDS_AXIS_Y ? " Y" : "");
+  Serial.print(events->tapAxes & ITDS_AXIS_Z ? " Z" : "");
+  Serial.println(events->tapNegative ? " negative" : " positive");
+}
+
+void on_Free_Fall(ITDS_event_Type type, const ITDS_events_t *events, void *context)
+{
+  Serial.println("Free fall");
+}
+
+void setup()
+{
+  delay(5000);
+  Serial.begin(9600);
+
+  // Initialize the I2C interface
+  sensor.init(ITDS_ADDRESS_I2C_1);
+
+  // 400 Hz in high performance mode, 2 g full scale
+  sensor.ODR = 7;
+  if ((WE_FAIL == sensor.set_High_Performance()) ||
+      (WE_FAIL == sensor.set_Full_Scale(0)) ||
+      (WE_FAIL == sensor.set_Detection_Profile(&profile)))
+  {
+    Serial.println("Sensor config failed. Tap detection. STOP.");
+    while(1);
+  }
+
+  sensor.set_Event_Handler(ITDS_eventSingleTap, on_Tap);
+  sensor.set_Event_Handler(ITDS_eventDoubleTap, on_Tap);
+  sensor.set_Event_Handler(ITDS_eventFreeFall, on_Free_Fall);
+}
+
+void loop()
+{
+  if (WE_FAIL == sensor.service_Events())
+  {
+    Serial.println("Sensor read error. STOP.");
+    while(1);
+  }
+  delay(10);
+}
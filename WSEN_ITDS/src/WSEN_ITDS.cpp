@@ -26,14 +26,49 @@
 #include "WSEN_ITDS.h"
 #include <stdint.h>
 
+/* States of the pre-/post-trigger capture */
+#define CAPTURE_IDLE        0
+#define CAPTURE_ARMED       1       /* FIFO in continuous-to-FIFO mode, waiting for the trigger */
+#define CAPTURE_POST        2       /* pre-trigger samples taken, FIFO mode collecting the post-trigger samples */
+#define CAPTURE_RESTARTED   3       /* FIFO restarted in continuous mode for the rest of the post-trigger samples */
+
 /**
    @brief  Initialize the I2C Interface
    @param  I2C address
+   @param  Bus instance of the transport, NULL selects the default bus
+   @param  Transport, NULL selects the default transport of the platform
    @retval Error Code
 */
-int Sensor_ITDS::init(int address)
+int Sensor_ITDS::init(int address, void *handle, const WE_transport_t *transport)
+{
+    sensorInterface.handle = handle;
+    sensorInterface.transport = transport;
+    WE_initRegisterCache(&registerCache, ITDS_cachedRegisters, ITDS_CACHED_REGISTERS, 0, cacheValues);
+    sensorInterface.cache = &registerCache;
+    full_scale = twoG;
+    singleTrigger = I2C;
+    adaptivePolicy = NULL;
+    for (int i = 0; i < ITDS_eventTypes; i++)
+    {
+        eventHandlers[i] = NULL;
+    }
+    ITDS_getAccConversion(full_scale, ITDS_milliG, &accConversion[ITDS_milliG]);
+    ITDS_getAccConversion(full_scale, ITDS_microG, &accConversion[ITDS_microG]);
+    stream = NULL;
+    streaming = false;
+    watermarkPending = false;
+    captureState = CAPTURE_IDLE;
+    triggerPending = false;
+    return I2CInit(&sensorInterface, address);
+}
+
+/**
+   @brief  Get the bus interface of the sensor, e.g. to queue asynchronous requests
+   @retval Pointer to sensor interface
+*/
+WE_sensorInterface_t *Sensor_ITDS::get_Interface()
 {
-    return I2CInit(address);
+    return &sensorInterface;
 }
 
 /**
@@ -45,7 +80,7 @@ int Sensor_ITDS::get_DeviceID()
 {
     uint8_t devID;
 
-    if (ITDS_getDeviceID(&devID) == WE_SUCCESS)
+    if (ITDS_getDeviceID(&sensorInterface, &devID) == WE_SUCCESS)
     {
         return devID;
     }
@@ -58,65 +93,75 @@ int Sensor_ITDS::get_DeviceID()
 */
 int Sensor_ITDS::select_ODR()
 {
-    switch (ODR)
+    return select_ODR(ODR);
+}
+
+/**
+   @brief  Set an output data rate other than ODR
+   @param  Output data rate setting, 0 ... 9
+   @retval Error Code
+*/
+int Sensor_ITDS::select_ODR(int odr)
+{
+    switch (odr)
     {
         case 0:
         {
-            ITDS_setOutputDataRate(ITDS_odr0);
+            ITDS_setOutputDataRate(&sensorInterface, ITDS_odr0);
             break;
         }
 
         case 1:
         {
-            ITDS_setOutputDataRate(ITDS_odr1);
+            ITDS_setOutputDataRate(&sensorInterface, ITDS_odr1);
             break;
         }
 
         case 2:
         {
-            ITDS_setOutputDataRate(ITDS_odr2);
+            ITDS_setOutputDataRate(&sensorInterface, ITDS_odr2);
             break;
         }
 
         case 3:
         {
-            ITDS_setOutputDataRate(ITDS_odr3);
+            ITDS_setOutputDataRate(&sensorInterface, ITDS_odr3);
             break;
         }
 
         case 4:
         {
-            ITDS_setOutputDataRate(ITDS_odr4);
+            ITDS_setOutputDataRate(&sensorInterface, ITDS_odr4);
             break;
         }
 
         case 5:
         {
-            ITDS_setOutputDataRate(ITDS_odr5);
+            ITDS_setOutputDataRate(&sensorInterface, ITDS_odr5);
             break;
         }
 
         case 6:
         {
-            ITDS_setOutputDataRate(ITDS_odr6);
+            ITDS_setOutputDataRate(&sensorInterface, ITDS_odr6);
             break;
         }
 
         case 7:
         {
-            ITDS_setOutputDataRate(ITDS_odr7);
+            ITDS_setOutputDataRate(&sensorInterface, ITDS_odr7);
             break;
         }
 
         case 8:
         {
-            ITDS_setOutputDataRate(ITDS_odr8);
+            ITDS_setOutputDataRate(&sensorInterface, ITDS_odr8);
             break;
         }
 
         case 9:
         {
-            ITDS_setOutputDataRate(ITDS_odr9);
+            ITDS_setOutputDataRate(&sensorInterface, ITDS_odr9);
             break;
         }
         default:
@@ -133,11 +178,11 @@ int Sensor_ITDS::select_ODR()
 int Sensor_ITDS::power_down()
 {
     ODR = 0;
-    if (WE_FAIL == ITDS_setBlockDataUpdate(ITDS_enable))
+    if (WE_FAIL == ITDS_setBlockDataUpdate(&sensorInterface, ITDS_enable))
 	{
 		return WE_FAIL;
 	}
-	if (WE_FAIL == ITDS_setAutoIncrement(ITDS_enable))
+	if (WE_FAIL == ITDS_setAutoIncrement(&sensorInterface, ITDS_enable))
 	{
 		return WE_FAIL;
 	}
@@ -154,7 +199,7 @@ int Sensor_ITDS::power_down()
 */
 int Sensor_ITDS::SW_RESET()
 {
-    if (WE_FAIL == ITDS_softReset(ITDS_enable))
+    if (WE_FAIL == ITDS_softReset(&sensorInterface, ITDS_enable))
 	{
 		return WE_FAIL;
 	}
@@ -163,92 +208,258 @@ int Sensor_ITDS::SW_RESET()
 }
 
 /**
-   @brief   Set the high performance mode
+   @brief   Set operating and power mode, the register changes are written in one burst
+   @param   Operating mode
+   @param   Power mode, unused in high performance mode
+   @param   Output data rate setting, 0 ... 9
+   @retval  Error Code
 */
-int Sensor_ITDS::set_High_Performance()
+int Sensor_ITDS::configure_Mode(ITDS_operating_mode operatingMode, ITDS_power_mode powerMode, int odr)
 {
-    if (WE_FAIL == ITDS_setBlockDataUpdate(ITDS_enable))
-	{
-		return WE_FAIL;
-	}
-    if (WE_FAIL == ITDS_setAutoIncrement(ITDS_enable))
+    WE_beginConfiguration(&sensorInterface);
+
+    if ((WE_FAIL == ITDS_setBlockDataUpdate(&sensorInterface, ITDS_enable)) ||
+        (WE_FAIL == ITDS_setAutoIncrement(&sensorInterface, ITDS_enable)) ||
+        (WE_FAIL == select_ODR(odr)) ||
+        (WE_FAIL == ITDS_setOperatingMode(&sensorInterface, operatingMode)) ||
+        ((highPerformance != operatingMode) && (WE_FAIL == ITDS_setpowerMode(&sensorInterface, powerMode))) ||
+        ((singleConvertion == operatingMode) && (WE_FAIL == ITDS_setSingleConvInput(&sensorInterface, singleTrigger))))
 	{
+		WE_abortConfiguration(&sensorInterface);
 		return WE_FAIL;
 	}
-    if (WE_FAIL == select_ODR())
+    mode = powerMode;
+
+	return WE_commitConfiguration(&sensorInterface);
+}
+
+/**
+   @brief   Set the high performance mode
+*/
+int Sensor_ITDS::set_High_Performance()
+{
+    return configure_Mode(highPerformance, ITDS_normalMode, ODR);
+}
+
+/**
+   @brief   Set the low mode 
+*/
+int Sensor_ITDS::set_Low_Mode()
+{
+    return configure_Mode(normalOrLowPower, ITDS_lowPower, ODR);
+}
+
+/**
+   @brief   Set the normal mode 
+*/
+int Sensor_ITDS::set_Normal_Mode()
+{
+    return configure_Mode(normalOrLowPower, ITDS_normalMode, ODR);
+}
+
+/**
+   @brief   Set the single conversion on demand mode: the sensor stays idle until a conversion is
+            triggered, takes one sample at low power and returns to idle. ODR selects the filter
+            bandwidth, 12.5 Hz if ODR is 0; ODR itself is not changed.
+   @param   Trigger of a conversion, I2C (start_Single_Conversion()) or a rising edge on INT_1
+   @retval  Error Code
+*/
+int Sensor_ITDS::set_Single_Conversion(ITDS_singleDataConversion_Input trigger)
+{
+    if ((externalTrigger != trigger) && (I2C != trigger))
 	{
 		return WE_FAIL;
 	}
-    mode = ITDS_normalMode;
+    singleTrigger = trigger;
+
+    return configure_Mode(singleConvertion, ITDS_lowPower, (0 == ODR) ? 2 : ODR);
+}
 
-    if (WE_FAIL == ITDS_setOperatingMode(highPerformance))
+/**
+   @brief   Trigger a single conversion through I2C, returns without waiting for the sample
+   @retval  Error Code
+*/
+int Sensor_ITDS::start_Single_Conversion()
+{
+    if (I2C != singleTrigger)
 	{
 		return WE_FAIL;
 	}
-	
-	return WE_SUCCESS;
+    return ITDS_enSingleDataConv(&sensorInterface, ITDS_enable);
 }
 
 /**
-   @brief   Set the low mode 
+   @brief   Read the sample of a single conversion if it is complete, status and sample in one
+            transfer. Also suitable after the data-ready interrupt (e.g. ITDS_enDataReadyINT0()).
+   @param   X-axis acceleration in mg
+   @param   Y-axis acceleration in mg
+   @param   Z-axis acceleration in mg
+   @param   Raw X, Y and Z output (3 values), NULL if not needed
+   @retval  1 if the sample has been read, 0 if the conversion is not complete, WE_FAIL on error
 */
-int Sensor_ITDS::set_Low_Mode()
+int Sensor_ITDS::read_Single_Conversion(float *acc_x, float *acc_y, float *acc_z, int16_t *raw)
+{
+    return get_accelerations_if_ready(acc_x, acc_y, acc_z, raw);
+}
+
+/**
+   @brief   Blocking convenience for the I2C trigger: start a conversion, wait for it with
+            delay() and read the sample. Blocks for ITDS_SINGLE_CONVERSION_MS and then polls
+            every millisecond for up to TIMEOUT_MS. Without blocking, call start_Single_Conversion()
+            and read_Single_Conversion() after the data-ready interrupt.
+   @param   X-axis acceleration in mg
+   @param   Y-axis acceleration in mg
+   @param   Z-axis acceleration in mg
+   @param   Raw X, Y and Z output (3 values), NULL if not needed
+   @retval  Error Code, WE_FAIL with the external trigger or if no sample arrives within TIMEOUT_MS
+*/
+int Sensor_ITDS::get_Single_Conversion(float *acc_x, float *acc_y, float *acc_z, int16_t *raw)
 {
-    if (WE_FAIL == ITDS_setBlockDataUpdate(ITDS_enable))
+    int waited = 0;
+    int result;
+
+    /* an edge on INT_1 cannot be awaited here */
+    if (WE_FAIL == start_Single_Conversion())
 	{
 		return WE_FAIL;
 	}
-    if (WE_FAIL == ITDS_setAutoIncrement(ITDS_enable))
+
+    delay(ITDS_SINGLE_CONVERSION_MS);
+    while (0 == (result = read_Single_Conversion(acc_x, acc_y, acc_z, raw)))
+    {
+        if (waited >= TIMEOUT_MS)
+        {
+            return WE_FAIL;
+        }
+        delay(1);
+        waited++;
+    }
+
+    return (1 == result) ? WE_SUCCESS : WE_FAIL;
+}
+
+/**
+   @brief   Start the adaptive ODR manager: the inactivity detection of the sensor reports when
+            it is stationary, without changing the ODR itself. The manager then switches to the
+            idle ODR in low power mode, and back to the active ODR in high performance mode on
+            wake-up. The change of the sleep state is routed to INT_1; call service_Adaptive_ODR()
+            after the interrupt, or periodically.
+   @param   Policy, must stay valid until stop_Adaptive_ODR()
+   @retval  Error Code
+*/
+int Sensor_ITDS::start_Adaptive_ODR(const ITDS_adaptive_ODR_t *policy)
+{
+    if ((NULL == policy) || (policy->activeODR < 1) || (policy->activeODR > 9) ||
+        (policy->idleODR < 1) || (policy->idleODR > 9) ||
+        (policy->wakeUpThreshold < 1) || (policy->wakeUpThreshold > 63) ||
+        (policy->wakeUpDuration > 3) || (policy->sleepDuration > 15))
 	{
 		return WE_FAIL;
 	}
-    if (WE_FAIL == select_ODR())
+
+    adaptivePolicy = NULL;
+
+    WE_beginConfiguration(&sensorInterface);
+    if ((WE_FAIL == ITDS_setWakeupThreshold(&sensorInterface, policy->wakeUpThreshold)) ||
+        (WE_FAIL == ITDS_enInactivity(&sensorInterface, ITDS_enable)) ||
+        (WE_FAIL == ITDS_setWakeupDuration(&sensorInterface, policy->wakeUpDuration)) ||
+        (WE_FAIL == ITDS_setSleepDuration(&sensorInterface, policy->sleepDuration)) ||
+        (WE_FAIL == ITDS_enStationnaryDetection(&sensorInterface, ITDS_enable)) ||
+        (WE_FAIL == ITDS_enActivityINT1(&sensorInterface, ITDS_enable)) ||
+        (WE_FAIL == ITDS_enInterrups(&sensorInterface, ITDS_enable)))
 	{
+		WE_abortConfiguration(&sensorInterface);
 		return WE_FAIL;
 	}
-    mode = ITDS_lowPower;
-	
-     if (WE_FAIL == ITDS_setOperatingMode(normalOrLowPower))
+    if (WE_FAIL == WE_commitConfiguration(&sensorInterface))
 	{
 		return WE_FAIL;
 	}
-	if (WE_FAIL == ITDS_setpowerMode(ITDS_lowPower))
+
+    adaptivePolicy = policy;
+
+    return switch_Activity(true);
+}
+
+/**
+   @brief   Stop the adaptive ODR manager, the sensor keeps its current ODR and mode
+   @retval  Error Code
+*/
+int Sensor_ITDS::stop_Adaptive_ODR()
+{
+    adaptivePolicy = NULL;
+
+    WE_beginConfiguration(&sensorInterface);
+    if ((WE_FAIL == ITDS_enInactivity(&sensorInterface, ITDS_disable)) ||
+        (WE_FAIL == ITDS_enStationnaryDetection(&sensorInterface, ITDS_disable)) ||
+        (WE_FAIL == ITDS_enActivityINT1(&sensorInterface, ITDS_disable)))
 	{
+		WE_abortConfiguration(&sensorInterface);
 		return WE_FAIL;
 	}
-	
-	return WE_SUCCESS;
+
+	return WE_commitConfiguration(&sensorInterface);
 }
 
 /**
-   @brief   Set the normal mode 
+   @brief   Switch between the active and the idle configuration, then notify the callback
+   @param   true for the active ODR, false for the idle ODR
+   @retval  Error Code
 */
-int Sensor_ITDS::set_Normal_Mode()
+int Sensor_ITDS::switch_Activity(bool active)
 {
-    if (WE_FAIL == ITDS_setBlockDataUpdate(ITDS_enable))
+    ODR = active ? adaptivePolicy->activeODR : adaptivePolicy->idleODR;
+    if (WE_FAIL == (active ? configure_Mode(highPerformance, ITDS_normalMode, ODR) : configure_Mode(normalOrLowPower, ITDS_lowPower, ODR)))
 	{
 		return WE_FAIL;
 	}
-    if (WE_FAIL == ITDS_setAutoIncrement(ITDS_enable))
+    adaptiveActive = active;
+
+    if (NULL != adaptivePolicy->callback)
+    {
+        adaptivePolicy->callback(active, adaptivePolicy->context);
+    }
+    return WE_SUCCESS;
+}
+
+/**
+   @brief   Follow the sleep state of the sensor: one status read, plus one configuration burst
+            on a change
+   @retval  1 if the ODR has been switched, 0 if not, WE_FAIL on error
+*/
+int Sensor_ITDS::service_Adaptive_ODR()
+{
+    ITDS_state_t sleeping;
+    bool active;
+
+    if (NULL == adaptivePolicy)
 	{
-		return WE_FAIL;
+		return 0;
 	}
-    if (WE_FAIL == select_ODR())
+    if (WE_FAIL == ITDS_getsleepState(&sensorInterface, &sleeping))
 	{
 		return WE_FAIL;
 	}
-    mode = ITDS_normalMode;
-	
-    if (WE_FAIL == ITDS_setOperatingMode(normalOrLowPower))
+    active = (ITDS_enable != sleeping);
+    if (active == adaptiveActive)
 	{
-		return WE_FAIL;
+		return 0;
 	}
-    if (WE_FAIL == ITDS_setpowerMode(ITDS_normalMode))
+
+    if (WE_FAIL == switch_Activity(active))
 	{
 		return WE_FAIL;
 	}
-	
-	return WE_SUCCESS;
+    return 1;
+}
+
+/**
+   @brief   Get the state of the adaptive ODR manager
+   @retval  1 while the active ODR is selected, 0 while idle or stopped
+*/
+int Sensor_ITDS::is_Active()
+{
+    return ((NULL != adaptivePolicy) && adaptiveActive) ? 1 : 0;
 }
 
 /**
@@ -258,7 +469,7 @@ int Sensor_ITDS::set_Normal_Mode()
 int Sensor_ITDS::get_Operating_Mode()
 {
     uint8_t opmode;
-    if (WE_FAIL == ITDS_getOperatingMode(&opmode))
+    if (WE_FAIL == ITDS_getOperatingMode(&sensorInterface, &opmode))
 	{
 		return WE_FAIL;
 	}
@@ -273,19 +484,176 @@ int Sensor_ITDS::get_Operating_Mode()
 int Sensor_ITDS::get_Power_Mode()
 {
     uint8_t powermode;
-    if (WE_FAIL == ITDS_getpowerMode(&powermode))
+    if (WE_FAIL == ITDS_getpowerMode(&sensorInterface, &powermode))
 	{
 		return WE_FAIL;
 	}
     return (int)powermode;
 }
 
+/**
+   @brief   Divide, rounding to the nearest integer
+*/
+static int32_t divide_Rounded(int32_t dividend, int32_t divisor)
+{
+    return (dividend >= 0) ? ((dividend + divisor / 2) / divisor) : ((dividend - divisor / 2) / divisor);
+}
+
+/**
+   @brief   Calibrate the offset with the user offset registers: the sensor must be stationary
+            while a block of samples is collected in the FIFO. The mean deviation from the
+            expected acceleration is written to X_OFS_USR ... Z_OFS_USR, and subtracted by the
+            sensor from the output data (low-pass path only) and from the wake-up function.
+            The FIFO mode is restored afterwards; not possible while streaming or capturing.
+   @param   Calibrated offset e.g. to be persisted and restored with set_Offset(), NULL if not needed
+   @param   Expected X-axis acceleration in mg
+   @param   Expected Y-axis acceleration in mg
+   @param   Expected Z-axis acceleration in mg, 1000 if lying flat face up
+   @param   Number of samples to average, 1 ... ITDS_FIFO_DEPTH
+   @retval  Error Code, WE_FAIL also if the offset is out of range of the offset registers
+*/
+int Sensor_ITDS::calibrate_Offset(ITDS_user_Offset_t *userOffset, int32_t x, int32_t y, int32_t z, int numSamples)
+{
+    const ITDS_user_Offset_t noOffset = { { 0, 0, 0 }, ITDS_disable };
+    const int32_t expected[3] = { x * 1000, y * 1000, z * 1000 };
+    int16_t samples[ITDS_FIFO_SAMPLES_PER_READ][3];
+    int32_t sum[3] = { 0, 0, 0 };
+    int32_t deviation[3];
+    ITDS_user_Offset_t calibrated;
+    ITDS_Fifo_Mode fifoMode;
+    uint8_t fifoFill = 0;
+    uint32_t period;
+    int waited = 0;
+
+    if ((numSamples < 1) || (numSamples > ITDS_FIFO_DEPTH) || streaming || (CAPTURE_IDLE != captureState))
+	{
+		return WE_FAIL;
+	}
+    period = get_Sample_Period();
+    if (0 == period)
+	{
+		return WE_FAIL;
+	}
+
+    /* collect raw samples: no offset applied, FIFO mode stops when full */
+    if ((WE_FAIL == ITDS_setUserOffset(&sensorInterface, &noOffset, ITDS_disable)) ||
+        (WE_FAIL == ITDS_getFifoMode(&sensorInterface, &fifoMode)) ||
+        (WE_FAIL == ITDS_setFifoMode(&sensorInterface, ITDS_bypassMode)) ||
+        (WE_FAIL == ITDS_setFifoMode(&sensorInterface, ITDS_fifoModes)))
+	{
+		return WE_FAIL;
+	}
+
+    delay((uint32_t)numSamples * period / 1000);
+    while (fifoFill < numSamples)
+    {
+        if ((WE_FAIL == ITDS_getFifoFillLevel(&sensorInterface, &fifoFill)) || (waited > TIMEOUT_MS + (int)(period / 1000)))
+        {
+            ITDS_setFifoMode(&sensorInterface, fifoMode);
+            return WE_FAIL;
+        }
+        if (fifoFill < numSamples)
+        {
+            delay(1);
+            waited++;
+        }
+    }
+
+    for (int read = 0; read < numSamples; )
+    {
+        int count = numSamples - read;
+        if (count > ITDS_FIFO_SAMPLES_PER_READ)
+        {
+            count = ITDS_FIFO_SAMPLES_PER_READ;
+        }
+        if (WE_FAIL == ITDS_getRawFifoSamples(&sensorInterface, (uint8_t)count, samples))
+        {
+            ITDS_setFifoMode(&sensorInterface, fifoMode);
+            return WE_FAIL;
+        }
+        for (int i = 0; i < count; i++)
+        {
+            sum[0] += samples[i][0];
+            sum[1] += samples[i][1];
+            sum[2] += samples[i][2];
+        }
+        read += count;
+    }
+
+    if ((WE_FAIL == ITDS_setFifoMode(&sensorInterface, ITDS_bypassMode)) ||
+        (WE_FAIL == ITDS_setFifoMode(&sensorInterface, fifoMode)))
+	{
+		return WE_FAIL;
+	}
+
+    /* mean deviation in µg, the finer weight if it fits all axes */
+    calibrated.weight = ITDS_disable;
+    for (int axis = 0; axis < 3; axis++)
+    {
+        int32_t fine;
+        deviation[axis] = divide_Rounded(sum[axis], numSamples) * accConversion[ITDS_microG].multiplier - expected[axis];
+        fine = divide_Rounded(deviation[axis], ITDS_OFFSET_WEIGHT_LOW_UG);
+        if ((fine < -128) || (fine > 127))
+        {
+            calibrated.weight = ITDS_enable;
+        }
+    }
+    for (int axis = 0; axis < 3; axis++)
+    {
+        int32_t offset = divide_Rounded(deviation[axis], (ITDS_enable == calibrated.weight) ? ITDS_OFFSET_WEIGHT_HIGH_UG : ITDS_OFFSET_WEIGHT_LOW_UG);
+        if ((offset < -128) || (offset > 127))
+        {
+            return WE_FAIL;
+        }
+        calibrated.offset[axis] = (int8_t)offset;
+    }
+
+    if (WE_FAIL == set_Offset(&calibrated))
+	{
+		return WE_FAIL;
+	}
+    if (NULL != userOffset)
+    {
+        *userOffset = calibrated;
+    }
+    return WE_SUCCESS;
+}
+
+/**
+   @brief   Write a user offset, e.g. from calibrate_Offset(), in a single transfer and apply it
+            to the output data and to the wake-up function
+   @param   Offset and its weight
+   @retval  Error Code
+*/
+int Sensor_ITDS::set_Offset(const ITDS_user_Offset_t *userOffset)
+{
+    if (WE_FAIL == ITDS_setUserOffset(&sensorInterface, userOffset, ITDS_enable))
+	{
+		return WE_FAIL;
+	}
+	return WE_SUCCESS;
+}
+
+/**
+   @brief   Read the user offset, e.g. to persist it
+   @param   Offset and its weight
+   @retval  Error Code
+*/
+int Sensor_ITDS::get_Offset(ITDS_user_Offset_t *userOffset)
+{
+    if (WE_FAIL == ITDS_getUserOffset(&sensorInterface, userOffset))
+	{
+		return WE_FAIL;
+	}
+	return WE_SUCCESS;
+}
+
 /**
    @brief   Select the acceleration bandwidth for the filtering path
 */
 int Sensor_ITDS::set_Bandwidth(int value)
 {
-    if (WE_FAIL == ITDS_setFilteringCutoff((ITDS_bandwidth)value))
+    if (WE_FAIL == ITDS_setFilteringCutoff(&sensorInterface, (ITDS_bandwidth)value))
 	{
 		return WE_FAIL;
 	}
@@ -297,11 +665,18 @@ int Sensor_ITDS::set_Bandwidth(int value)
 */
 int Sensor_ITDS::set_Full_Scale(int value)
 {
-    full_scale = (ITDS_full_Scale)value;
-    if (WE_FAIL == ITDS_setFullScale(full_scale))
+    if ((value < twoG) || (value > sixteenG))
+	{
+		return WE_FAIL;
+	}
+    ITDS_full_Scale fullScale = (ITDS_full_Scale)value;
+    if (WE_FAIL == ITDS_setFullScale(&sensorInterface, fullScale))
 	{
 		return WE_FAIL;
 	}
+    full_scale = fullScale;
+    ITDS_getAccConversion(full_scale, ITDS_milliG, &accConversion[ITDS_milliG]);
+    ITDS_getAccConversion(full_scale, ITDS_microG, &accConversion[ITDS_microG]);
 	
 	return WE_SUCCESS;
 }
@@ -311,7 +686,7 @@ int Sensor_ITDS::set_Full_Scale(int value)
 */
 int Sensor_ITDS::set_Low_Pass_Filter()
 {
-    if (WE_FAIL == ITDS_setfilterPath(lowPass))
+    if (WE_FAIL == ITDS_setfilterPath(&sensorInterface, lowPass))
 	{
 		return WE_FAIL;
 	}
@@ -323,7 +698,7 @@ int Sensor_ITDS::set_Low_Pass_Filter()
 */
 int Sensor_ITDS::set_High_Pass_Filter()
 {
-    if (WE_FAIL == ITDS_setfilterPath(highPass))
+    if (WE_FAIL == ITDS_setfilterPath(&sensorInterface, highPass))
 	{
 		return WE_FAIL;
 	}
@@ -338,23 +713,13 @@ int Sensor_ITDS::set_High_Pass_Filter()
 float Sensor_ITDS::get_Sensitivity()
 {
 	/* these factors include already handling of 10 vs. 12 bit resolution and bit shifting */
-    if (full_scale == twoG)
-    {
-		return 0.061f;
-    }
-    else if (full_scale == fourG)
-    {       
-		return 0.122f;
-    }
-    else if (full_scale == eightG)
-    {       
-		return 0.244f;
-    }
-    else if (full_scale == sixteenG)
+    static const float sensitivity[] = { 0.061f, 0.122f, 0.244f, 0.488f };
+
+    if (full_scale > sixteenG)
     {
-		return 0.488f;
+		return 0;
     }
-    return 0;
+    return sensitivity[full_scale];
 }
 
 /**
@@ -364,7 +729,7 @@ float Sensor_ITDS::get_Sensitivity()
 int Sensor_ITDS::is_Ready_To_Read()
 {
     ITDS_state_t drdy;
-    int result = ITDS_getdataReadyState(&drdy);
+    int result = ITDS_getdataReadyState(&sensorInterface, &drdy);
 
     if (result == WE_FAIL)
     {
@@ -383,7 +748,7 @@ int Sensor_ITDS::is_Ready_To_Read()
 int Sensor_ITDS::is_Temp_Ready()
 {
     ITDS_state_t tempDrdy;                    // values in output register available
-    int result = ITDS_getTempDrdy(&tempDrdy); // WE_FAIL or WE_SUCCESS
+    int result = ITDS_getTempDrdy(&sensorInterface, &tempDrdy); // WE_FAIL or WE_SUCCESS
 
     if (result == WE_FAIL)
     {
@@ -402,7 +767,7 @@ int Sensor_ITDS::is_Temp_Ready()
 int Sensor_ITDS::get_acceleration_X(float *acc_x)
 {
     int16_t XRawAcc;
-    if (WE_FAIL == ITDS_getRawAccelerationX(&XRawAcc))
+    if (WE_FAIL == ITDS_getRawAccelerationX(&sensorInterface, &XRawAcc))
 	{
 		return WE_FAIL;
 	}
@@ -419,7 +784,7 @@ int Sensor_ITDS::get_acceleration_X(float *acc_x)
 int Sensor_ITDS::get_acceleration_Y(float *acc_y)
 {
     int16_t YRawAcc;
-    if (WE_FAIL == ITDS_getRawAccelerationY(&YRawAcc))
+    if (WE_FAIL == ITDS_getRawAccelerationY(&sensorInterface, &YRawAcc))
 		{
 		return WE_FAIL;
 	}
@@ -436,7 +801,7 @@ int Sensor_ITDS::get_acceleration_Y(float *acc_y)
 int Sensor_ITDS::get_acceleration_Z(float *acc_z)
 {
     int16_t ZRawAcc;
-    if (WE_FAIL == ITDS_getRawAccelerationZ(&ZRawAcc))
+    if (WE_FAIL == ITDS_getRawAccelerationZ(&sensorInterface, &ZRawAcc))
 		{
 		return WE_FAIL;
 	}
@@ -447,90 +812,224 @@ int Sensor_ITDS::get_acceleration_Z(float *acc_z)
 }
 
 /**
-   @brief  Calculate the temperature; Formulas according Table 26
-   @retval Temperature in °C
+   @brief  Read the acceleration along all axes from one sample, in a single transfer
+   @param  X-axis acceleration in mg
+   @param  Y-axis acceleration in mg
+   @param  Z-axis acceleration in mg
+   @param  Raw X, Y and Z output (3 values), NULL if not needed
+   @retval Error Code
 */
-int Sensor_ITDS::get_temperature(int *temperature)
+int Sensor_ITDS::get_accelerations(float *acc_x, float *acc_y, float *acc_z, int16_t *raw)
 {
-    uint8_t RawTemp8;
-	int Temp;
-	
-    if (WE_FAIL == ITDS_getTemperature8bit(&RawTemp8))
+    int16_t rawAcc[3];
+    if (WE_FAIL == ITDS_getRawAccelerations(&sensorInterface, &rawAcc[0], &rawAcc[1], &rawAcc[2]))
 	{
 		return WE_FAIL;
 	}
 
-    if (RawTemp8 > 0 && RawTemp8 <= 0x36)
-    {
-        Temp = (int)RawTemp8 + 25;
-    }
-    else
+    float sensitivity = get_Sensitivity();
+    *acc_x = rawAcc[0] * sensitivity;
+    *acc_y = rawAcc[1] * sensitivity;
+    *acc_z = rawAcc[2] * sensitivity;
+    if (NULL != raw)
     {
-        Temp = -255 + (int)RawTemp8 + 25;
+        raw[0] = rawAcc[0];
+        raw[1] = rawAcc[1];
+        raw[2] = rawAcc[2];
     }
-
-	*temperature = Temp;
     return WE_SUCCESS;
 }
 
 /**
-   @brief  Calculate the temperature in Fahrenheit
-   @retval Temperature in Fahrenheit
+   @brief  Read the data ready state and the acceleration along all axes in a single transfer
+   @param  X-axis acceleration in mg
+   @param  Y-axis acceleration in mg
+   @param  Z-axis acceleration in mg
+   @param  Raw X, Y and Z output (3 values), NULL if not needed
+   @retval 1 if the acceleration is a new sample, 0 if it has been read before, WE_FAIL on error
 */
-int Sensor_ITDS::get_temp_Fahrenheit(int *temperature)
+int Sensor_ITDS::get_accelerations_if_ready(float *acc_x, float *acc_y, float *acc_z, int16_t *raw)
 {
-    int temp_Celsius;
-	if (WE_FAIL == get_temperature(&temp_Celsius))
+    ITDS_status_t status;
+    int16_t rawAcc[3];
+    if (WE_FAIL == ITDS_getStatusAndRawAccelerations(&sensorInterface, &status, &rawAcc[0], &rawAcc[1], &rawAcc[2]))
 	{
 		return WE_FAIL;
 	}
-	
-    int temp_Fahrenheit = temp_Celsius * 1.8 + 32;	
-	*temperature = temp_Fahrenheit;
-    return WE_SUCCESS;
+
+    float sensitivity = get_Sensitivity();
+    *acc_x = rawAcc[0] * sensitivity;
+    *acc_y = rawAcc[1] * sensitivity;
+    *acc_z = rawAcc[2] * sensitivity;
+    if (NULL != raw)
+    {
+        raw[0] = rawAcc[0];
+        raw[1] = rawAcc[1];
+        raw[2] = rawAcc[2];
+    }
+    return status.dataReady;
 }
 
 /**
-   @brief   Set the FIFO mode
+   @brief  Read the acceleration along all axes from one sample, converted without floating point
+   @param  X-axis acceleration
+   @param  Y-axis acceleration
+   @param  Z-axis acceleration
+   @param  Unit, mg (rounded) or µg (exact)
+   @retval Error Code
 */
-
-int Sensor_ITDS::set_FIFO_mode(int fifoMode)
+int Sensor_ITDS::get_accelerations_int(int32_t *acc_x, int32_t *acc_y, int32_t *acc_z, ITDS_acc_Unit unit)
 {
-    if (WE_FAIL == ITDS_setFifoMode((ITDS_Fifo_Mode)fifoMode))
+    int16_t rawAcc[3];
+    if ((unit > ITDS_microG) ||
+        (WE_FAIL == ITDS_getRawAccelerations(&sensorInterface, &rawAcc[0], &rawAcc[1], &rawAcc[2])))
 	{
 		return WE_FAIL;
 	}
-    if (WE_FAIL == select_ODR())
-	{
-		return WE_FAIL;
-	}
-	return WE_SUCCESS;
+
+    *acc_x = ITDS_convertAcceleration_int(rawAcc[0], &accConversion[unit]);
+    *acc_y = ITDS_convertAcceleration_int(rawAcc[1], &accConversion[unit]);
+    *acc_z = ITDS_convertAcceleration_int(rawAcc[2], &accConversion[unit]);
+    return WE_SUCCESS;
 }
 
 /**
-  @brief  Get the FIFO mode
-  @retval Error code
+   @brief  Convert a block of raw samples (e.g. from read_FIFO_samples()) at the current full scale,
+           without floating point
+   @param  Raw X, Y and Z-axis acceleration of each sample
+   @param  Converted X, Y and Z-axis acceleration of each sample
+   @param  Number of samples
+   @param  Unit, mg (rounded) or µg (exact)
+   @retval Error Code
 */
-int Sensor_ITDS::get_FIFO_mode(int *mode)
+int Sensor_ITDS::convert_samples(const int16_t raw[][3], int32_t acc[][3], int numSamples, ITDS_acc_Unit unit)
 {
-    ITDS_Fifo_Mode fifoMode;
-    if (WE_FAIL == ITDS_getFifoMode(&fifoMode))
+    if ((unit > ITDS_microG) || (numSamples < 0) || (numSamples > 0xFFFF))
 	{
 		return WE_FAIL;
 	}
-	
-	*mode = fifoMode;
+    ITDS_convertAccelerations_int(raw, acc, (uint16_t)numSamples, &accConversion[unit]);
     return WE_SUCCESS;
 }
 
 /**
-  @brief  Get the FIFO fill level
-  @retval Error code
+   @brief  Convert a block of raw samples (e.g. from read_FIFO_samples()) at the current full scale to mg
+   @param  Raw X, Y and Z-axis acceleration of each sample
+   @param  X, Y and Z-axis acceleration of each sample in mg
+   @param  Number of samples
+   @retval Error Code
+*/
+int Sensor_ITDS::convert_samples(const int16_t raw[][3], float acc[][3], int numSamples)
+{
+    if ((numSamples < 0) || (numSamples > 0xFFFF))
+	{
+		return WE_FAIL;
+	}
+    ITDS_convertAccelerations_float(raw, acc, (uint16_t)numSamples, get_Sensitivity());
+    return WE_SUCCESS;
+}
+
+/**
+   @brief  Calculate the temperature; Formulas according Table 26
+   @retval Temperature in °C
+*/
+int Sensor_ITDS::get_temperature(int *temperature)
+{
+    uint8_t RawTemp8;
+	int Temp;
+	
+    if (WE_FAIL == ITDS_getTemperature8bit(&sensorInterface, &RawTemp8))
+	{
+		return WE_FAIL;
+	}
+
+    if (RawTemp8 > 0 && RawTemp8 <= 0x36)
+    {
+        Temp = (int)RawTemp8 + 25;
+    }
+    else
+    {
+        Temp = -255 + (int)RawTemp8 + 25;
+    }
+
+	*temperature = Temp;
+    return WE_SUCCESS;
+}
+
+/**
+   @brief  Calculate the temperature in Fahrenheit
+   @retval Temperature in Fahrenheit
+*/
+int Sensor_ITDS::get_temp_Fahrenheit(int *temperature)
+{
+    int temp_Celsius;
+	if (WE_FAIL == get_temperature(&temp_Celsius))
+	{
+		return WE_FAIL;
+	}
+	
+    int temp_Fahrenheit = temp_Celsius * 1.8 + 32;	
+	*temperature = temp_Fahrenheit;
+    return WE_SUCCESS;
+}
+
+/**
+   @brief  Read the 12 bit temperature output in a single transfer, without floating point
+   @param  Temperature in 0.01 °C
+   @retval Error Code
+*/
+int Sensor_ITDS::get_temperature_centi(int *temperature)
+{
+    int16_t centiDegrees;
+    if (WE_FAIL == ITDS_getTemperature12bit_int(&sensorInterface, &centiDegrees))
+	{
+		return WE_FAIL;
+	}
+    *temperature = centiDegrees;
+    return WE_SUCCESS;
+}
+
+/**
+   @brief   Set the FIFO mode
+*/
+
+int Sensor_ITDS::set_FIFO_mode(int fifoMode)
+{
+    if (WE_FAIL == ITDS_setFifoMode(&sensorInterface, (ITDS_Fifo_Mode)fifoMode))
+	{
+		return WE_FAIL;
+	}
+    if (WE_FAIL == select_ODR())
+	{
+		return WE_FAIL;
+	}
+	return WE_SUCCESS;
+}
+
+/**
+  @brief  Get the FIFO mode
+  @retval Error code
+*/
+int Sensor_ITDS::get_FIFO_mode(int *mode)
+{
+    ITDS_Fifo_Mode fifoMode;
+    if (WE_FAIL == ITDS_getFifoMode(&sensorInterface, &fifoMode))
+	{
+		return WE_FAIL;
+	}
+	
+	*mode = fifoMode;
+    return WE_SUCCESS;
+}
+
+/**
+  @brief  Get the FIFO fill level
+  @retval Error code
 */
 int Sensor_ITDS::get_FIFO_Fill_Level(int *lvl)
 {
     uint8_t fifoFill;
-    if (WE_FAIL == ITDS_getFifoFillLevel(&fifoFill))
+    if (WE_FAIL == ITDS_getFifoFillLevel(&sensorInterface, &fifoFill))
 	{
 		return WE_FAIL;
 	}
@@ -538,3 +1037,653 @@ int Sensor_ITDS::get_FIFO_Fill_Level(int *lvl)
 	*lvl = fifoFill;
     return  WE_SUCCESS;
 }
+
+/**
+  @brief  Drain the FIFO, several samples per transfer
+  @param  Raw X, Y and Z-axis acceleration of each sample, ITDS_FIFO_DEPTH entries empty the FIFO
+  @param  Max. number of samples to read
+  @retval Number of samples read, WE_FAIL on error
+*/
+int Sensor_ITDS::read_FIFO_samples(int16_t samples[][3], int maxSamples)
+{
+    uint8_t fifoFill;
+    if (WE_FAIL == ITDS_getFifoFillLevel(&sensorInterface, &fifoFill))
+	{
+		return WE_FAIL;
+	}
+
+    if (fifoFill > maxSamples)
+    {
+        fifoFill = (maxSamples > 0) ? (uint8_t)maxSamples : 0;
+    }
+    if ((0 != fifoFill) && (WE_FAIL == ITDS_getRawFifoSamples(&sensorInterface, fifoFill, samples)))
+	{
+		return WE_FAIL;
+	}
+
+    return fifoFill;
+}
+
+/**
+  @brief  Start streaming the FIFO: continuous mode, FIFO threshold interrupt on INT0.
+          Attach watermark_ISR() to the INT0 pin (rising edge), call service_Streaming()
+          after the interrupt and take the samples with read_Stream().
+  @param  Caller-owned ring buffer, must stay valid until stop_Streaming()
+  @param  Number of entries of the buffer, power of two up to 128
+  @param  FIFO threshold raising INT0, 1 ... 31 samples
+  @retval Error Code
+*/
+int Sensor_ITDS::start_Streaming(ITDS_streamSample_t *buffer, int length, int watermark)
+{
+    if ((NULL == buffer) || (length < 2) || (length > 128) || (0 != (length & (length - 1))) ||
+        (watermark < 1) || (watermark >= ITDS_FIFO_DEPTH) || (CAPTURE_IDLE != captureState))
+	{
+		return WE_FAIL;
+	}
+
+    streaming = false;
+    stream = buffer;
+    streamMask = (uint8_t)(length - 1);
+    streamWatermark = (uint8_t)watermark;
+    streamHead = 0;
+    streamTail = 0;
+    streamLost = 0;
+    watermarkPending = false;
+
+    /* bypass empties the FIFO, so the first watermark is reached with a fresh set of samples */
+    WE_beginConfiguration(&sensorInterface);
+    if ((WE_FAIL == ITDS_setFifoMode(&sensorInterface, ITDS_bypassMode)) ||
+        (WE_FAIL == WE_commitConfiguration(&sensorInterface)))
+	{
+		return WE_FAIL;
+	}
+    WE_beginConfiguration(&sensorInterface);
+    if ((WE_FAIL == ITDS_enFifoThresholdINT0(&sensorInterface, ITDS_enable)) ||
+        (WE_FAIL == ITDS_setFifoThreshold(&sensorInterface, streamWatermark)) ||
+        (WE_FAIL == ITDS_setFifoMode(&sensorInterface, ITDS_continuousMode)))
+	{
+		WE_abortConfiguration(&sensorInterface);
+		return WE_FAIL;
+	}
+    if (WE_FAIL == WE_commitConfiguration(&sensorInterface))
+	{
+		return WE_FAIL;
+	}
+    streaming = true;
+
+	return WE_SUCCESS;
+}
+
+/**
+  @brief  Stop streaming, the samples left in the ring can still be read
+  @retval Error Code
+*/
+int Sensor_ITDS::stop_Streaming()
+{
+    streaming = false;
+    watermarkPending = false;
+
+    WE_beginConfiguration(&sensorInterface);
+    if ((WE_FAIL == ITDS_enFifoThresholdINT0(&sensorInterface, ITDS_disable)) ||
+        (WE_FAIL == ITDS_setFifoMode(&sensorInterface, ITDS_bypassMode)))
+	{
+		WE_abortConfiguration(&sensorInterface);
+		return WE_FAIL;
+	}
+
+	return WE_commitConfiguration(&sensorInterface);
+}
+
+/**
+  @brief  Interrupt handler of the INT0 watermark. Only takes the time of the watermark
+          sample, the Wire library cannot be used inside an interrupt.
+*/
+void Sensor_ITDS::watermark_ISR()
+{
+    watermarkMicros = micros();
+    watermarkPending = true;
+}
+
+/**
+  @brief  Drain the FIFO into the ring if the watermark has been reached, several samples
+          per transfer. Producer of the ring, call from the loop or from a deferred task.
+  @retval Number of samples drained, WE_FAIL on error
+*/
+int Sensor_ITDS::service_Streaming()
+{
+    ITDS_fifo_samples_t fifoStatus;
+    int16_t chunk[ITDS_FIFO_SAMPLES_PER_READ][3];
+    uint32_t period;
+    uint32_t timestamp;
+    uint8_t done = 0;
+
+    if (!streaming || !watermarkPending)
+	{
+		return 0;
+	}
+    /* INT0 stays high until the FIFO is below the watermark again, no further edge before the drain */
+    timestamp = watermarkMicros;
+    watermarkPending = false;
+
+    if (WE_FAIL == ITDS_getFifoStatus(&sensorInterface, &fifoStatus))
+	{
+		return WE_FAIL;
+	}
+    if (fifoStatus.fifoOverrunState)
+    {
+        /* at least one sample has been overwritten in the FIFO */
+        streamLost++;
+    }
+
+    /* the sample at the watermark has been taken when the interrupt fired */
+    period = get_Sample_Period();
+    timestamp -= (uint32_t)(streamWatermark - 1) * period;
+
+    while (done < fifoStatus.fifoFillLevel)
+    {
+        uint8_t count = fifoStatus.fifoFillLevel - done;
+        if (count > ITDS_FIFO_SAMPLES_PER_READ)
+        {
+            count = ITDS_FIFO_SAMPLES_PER_READ;
+        }
+        if (WE_FAIL == ITDS_getRawFifoSamples(&sensorInterface, count, chunk))
+        {
+            return WE_FAIL;
+        }
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            uint8_t head = streamHead;
+            if ((uint8_t)(head - streamTail) > streamMask)
+            {
+                /* ring full, the sample is dropped */
+                streamLost++;
+            }
+            else
+            {
+                ITDS_streamSample_t *sample = &stream[head & streamMask];
+                sample->timestamp = timestamp;
+                sample->raw[0] = chunk[i][0];
+                sample->raw[1] = chunk[i][1];
+                sample->raw[2] = chunk[i][2];
+                streamHead = (uint8_t)(head + 1);
+            }
+            timestamp += period;
+        }
+        done += count;
+    }
+
+    return done;
+}
+
+/**
+  @brief  Take samples from the ring, consumer of the ring
+  @param  Buffer for the samples
+  @param  Max. number of samples to take
+  @retval Number of samples taken
+*/
+int Sensor_ITDS::read_Stream(ITDS_streamSample_t *samples, int maxSamples)
+{
+    uint8_t tail = streamTail;
+    int count = 0;
+
+    if ((NULL == stream) || (NULL == samples))
+	{
+		return 0;
+	}
+    while ((count < maxSamples) && (tail != streamHead))
+    {
+        samples[count++] = stream[tail & streamMask];
+        tail++;
+    }
+    streamTail = tail;
+
+    return count;
+}
+
+/**
+  @brief  Get the number of samples in the ring
+  @retval Number of samples
+*/
+int Sensor_ITDS::get_Stream_Available()
+{
+    if (NULL == stream)
+	{
+		return 0;
+	}
+    return (uint8_t)(streamHead - streamTail);
+}
+
+/**
+  @brief  Get the number of samples lost since start_Streaming(), because the ring was full
+          or the FIFO has overrun (counted once per drain)
+  @retval Number of samples
+*/
+uint32_t Sensor_ITDS::get_Stream_Lost()
+{
+    return streamLost;
+}
+
+/**
+  @brief  Get the time between two samples at the current output data rate and mode
+  @retval Sample period in microseconds, 0 in power down
+*/
+uint32_t Sensor_ITDS::get_Sample_Period()
+{
+    static const uint32_t period[] = { 0, 80000, 80000, 40000, 20000, 10000, 5000, 2500, 1250, 625 };
+    uint8_t odr, opMode, powerMode;
+
+    if ((WE_FAIL == ITDS_getOutputDataRate(&sensorInterface, &odr)) ||
+        (WE_FAIL == ITDS_getOperatingMode(&sensorInterface, &opMode)) ||
+        (WE_FAIL == ITDS_getpowerMode(&sensorInterface, &powerMode)) ||
+        (odr > ITDS_odr9))
+	{
+		return 0;
+	}
+
+    if ((highPerformance != opMode) && (ITDS_lowPower == powerMode))
+    {
+        /* low power mode: 1.6 Hz ... 200 Hz */
+        if (ITDS_odr1 == odr)
+        {
+            return 625000;
+        }
+        if (odr > ITDS_odr6)
+        {
+            return period[ITDS_odr6];
+        }
+    }
+    return period[odr];
+}
+
+/**
+  @brief  Route the capture trigger to INT0
+  @param  Enable or disable the routing
+  @retval Error Code
+*/
+int Sensor_ITDS::route_Capture_Trigger(ITDS_state_t state)
+{
+    switch (captureTrigger)
+    {
+        case ITDS_captureWakeUp:
+            return ITDS_enWakeupOnINT0(&sensorInterface, state);
+        case ITDS_captureFreeFall:
+            return ITDS_enFreeFallINT0(&sensorInterface, state);
+        case ITDS_captureTap:
+            return ITDS_enSingleTapINT0(&sensorInterface, state);
+        default:
+            return WE_FAIL;
+    }
+}
+
+/**
+  @brief  Arm a capture: the FIFO runs in continuous-to-FIFO mode, the trigger event switches
+          it to FIFO mode, which keeps the samples leading up to it and stops when full.
+          Set up the detection of the event (thresholds, durations, tap axes) before, attach
+          trigger_ISR() to the INT0 pin (rising edge) and call service_Capture() until the
+          record is complete.
+  @param  Event ending the pre-trigger window
+  @param  Caller-owned buffer for preSamples + postSamples samples, must stay valid until
+          the record is complete or the capture is disarmed
+  @param  Number of samples up to the trigger, 0 ... ITDS_FIFO_DEPTH
+  @param  Number of samples after the trigger, 0 ... 255 - preSamples
+  @retval Error Code
+*/
+int Sensor_ITDS::arm_Capture(ITDS_capture_Trigger trigger, int16_t samples[][3], int preSamples, int postSamples)
+{
+    if ((NULL == samples) || (preSamples < 0) || (preSamples > ITDS_FIFO_DEPTH) || (postSamples < 0) ||
+        (preSamples + postSamples < 1) || (preSamples + postSamples > 255) || streaming)
+	{
+		return WE_FAIL;
+	}
+
+    if ((CAPTURE_IDLE != captureState) && (WE_FAIL == disarm_Capture()))
+	{
+		return WE_FAIL;
+	}
+
+    capture = samples;
+    captureTrigger = trigger;
+    capturePre = (uint8_t)preSamples;
+    capturePost = (uint8_t)postSamples;
+    captureCount = 0;
+    triggerPending = false;
+
+    /* bypass empties the FIFO, the pre-trigger window only holds samples taken after arming */
+    WE_beginConfiguration(&sensorInterface);
+    if ((WE_FAIL == ITDS_setFifoMode(&sensorInterface, ITDS_bypassMode)) ||
+        (WE_FAIL == WE_commitConfiguration(&sensorInterface)))
+	{
+		return WE_FAIL;
+	}
+    WE_beginConfiguration(&sensorInterface);
+    if ((WE_FAIL == route_Capture_Trigger(ITDS_enable)) ||
+        (WE_FAIL == ITDS_enInterrups(&sensorInterface, ITDS_enable)) ||
+        (WE_FAIL == ITDS_setFifoMode(&sensorInterface, ITDS_continuousToFifo)))
+	{
+		WE_abortConfiguration(&sensorInterface);
+		return WE_FAIL;
+	}
+    if (WE_FAIL == WE_commitConfiguration(&sensorInterface))
+	{
+		return WE_FAIL;
+	}
+    captureArmMicros = micros();
+    captureState = CAPTURE_ARMED;
+
+	return WE_SUCCESS;
+}
+
+/**
+  @brief  Stop a capture, the FIFO returns to bypass mode
+  @retval Error Code
+*/
+int Sensor_ITDS::disarm_Capture()
+{
+    if (CAPTURE_IDLE == captureState)
+	{
+		return WE_SUCCESS;
+	}
+    captureState = CAPTURE_IDLE;
+    triggerPending = false;
+
+    WE_beginConfiguration(&sensorInterface);
+    if ((WE_FAIL == route_Capture_Trigger(ITDS_disable)) ||
+        (WE_FAIL == ITDS_setFifoMode(&sensorInterface, ITDS_bypassMode)))
+	{
+		WE_abortConfiguration(&sensorInterface);
+		return WE_FAIL;
+	}
+
+	return WE_commitConfiguration(&sensorInterface);
+}
+
+/**
+  @brief  Interrupt handler of the capture trigger on INT0, only takes the time of the event
+*/
+void Sensor_ITDS::trigger_ISR()
+{
+    triggerMicros = micros();
+    triggerPending = true;
+}
+
+/**
+  @brief  Restart the stopped FIFO for the remaining post-trigger samples: a full FIFO in
+          FIFO mode only collects again after a mode change, bypass then continuous mode
+  @retval Error Code
+*/
+int Sensor_ITDS::restart_Capture_FIFO()
+{
+    WE_beginConfiguration(&sensorInterface);
+    if ((WE_FAIL == ITDS_setFifoMode(&sensorInterface, ITDS_bypassMode)) ||
+        (WE_FAIL == WE_commitConfiguration(&sensorInterface)))
+	{
+		return WE_FAIL;
+	}
+    WE_beginConfiguration(&sensorInterface);
+    if ((WE_FAIL == ITDS_setFifoMode(&sensorInterface, ITDS_continuousMode)) ||
+        (WE_FAIL == WE_commitConfiguration(&sensorInterface)))
+	{
+		return WE_FAIL;
+	}
+
+    capturePostMicros = micros();
+    captureDeadline = capturePostMicros + (uint32_t)(capturePre + capturePost - captureCount + 1) * get_Sample_Period() +
+                      TIMEOUT_MS * 1000UL;
+    captureState = CAPTURE_RESTARTED;
+
+    return WE_SUCCESS;
+}
+
+/**
+  @brief  Take the samples the FIFO holds at the trigger: the pre-trigger window is split off
+          at the fill level the FIFO had at the trigger, which follows from the samples taken
+          since arming (+-1 sample), the samples collected after it are post-trigger samples
+  @retval Error Code
+*/
+int Sensor_ITDS::read_Capture_Window()
+{
+    ITDS_fifo_samples_t fifoStatus;
+    uint32_t period;
+    uint32_t taken;
+    uint8_t room = capturePre + capturePost;
+    uint8_t atTrigger;
+    uint8_t count;
+
+    if (WE_FAIL == ITDS_getFifoStatus(&sensorInterface, &fifoStatus))
+	{
+		return WE_FAIL;
+	}
+
+    period = get_Sample_Period();
+    taken = (0 == period) ? ITDS_FIFO_DEPTH : (captureMicros - captureArmMicros + period / 2) / period;
+    atTrigger = fifoStatus.fifoFillLevel;
+    if (taken < atTrigger)
+	{
+		atTrigger = (uint8_t)taken;
+	}
+
+    /* the window is shorter if the FIFO had not filled up before the trigger */
+    if (capturePre > atTrigger)
+	{
+		capturePre = atTrigger;
+	}
+
+    /* discard the samples older than the pre-trigger window, in chunks through the buffer */
+    count = atTrigger - capturePre;
+    while (count > 0)
+    {
+        uint8_t discard = (count > room) ? room : count;
+        if (WE_FAIL == ITDS_getRawFifoSamples(&sensorInterface, discard, capture))
+        {
+            return WE_FAIL;
+        }
+        count -= discard;
+    }
+
+    count = fifoStatus.fifoFillLevel - atTrigger;
+    if (count > capturePost)
+	{
+		count = capturePost;
+	}
+    count += capturePre;
+    if ((0 != count) && (WE_FAIL == ITDS_getRawFifoSamples(&sensorInterface, count, capture)))
+	{
+		return WE_FAIL;
+	}
+    captureCount = count;
+    captureContiguous = count - capturePre;
+    captureDeadline = captureMicros + (uint32_t)(capturePost + 1) * period + TIMEOUT_MS * 1000UL;
+    captureState = CAPTURE_POST;
+
+    if ((captureCount < capturePre + capturePost) && (ITDS_FIFO_DEPTH == fifoStatus.fifoFillLevel))
+	{
+		return restart_Capture_FIFO();
+	}
+
+    return WE_SUCCESS;
+}
+
+/**
+  @brief  Advance an armed capture: after the trigger, take the pre-trigger samples and the
+          post-trigger samples the FIFO collected up to full, then restart the FIFO for the
+          rest. Past the deadline the record is delivered with fewer post-trigger samples.
+  @param  Record filled in once the capture is complete, the capture is disarmed then
+  @retval 1 if the record is complete, 0 if not, WE_FAIL on error
+*/
+int Sensor_ITDS::service_Capture(ITDS_shockRecord_t *record)
+{
+    ITDS_fifo_samples_t fifoStatus;
+    uint8_t count;
+
+    if ((NULL == record) || (CAPTURE_IDLE == captureState))
+	{
+		return 0;
+	}
+
+    if (CAPTURE_ARMED == captureState)
+    {
+        if (!triggerPending)
+        {
+            return 0;
+        }
+        captureMicros = triggerMicros;
+        triggerPending = false;
+
+        if (WE_FAIL == read_Capture_Window())
+        {
+            return WE_FAIL;
+        }
+    }
+
+    if (captureCount < capturePre + capturePost)
+    {
+        if (WE_FAIL == ITDS_getFifoStatus(&sensorInterface, &fifoStatus))
+        {
+            return WE_FAIL;
+        }
+
+        /* an overrun in continuous mode breaks the sequence, the record ends before it */
+        if ((CAPTURE_POST == captureState) || !fifoStatus.fifoOverrunState)
+        {
+            count = capturePre + capturePost - captureCount;
+            if (count > fifoStatus.fifoFillLevel)
+            {
+                count = fifoStatus.fifoFillLevel;
+            }
+            if ((0 != count) && (WE_FAIL == ITDS_getRawFifoSamples(&sensorInterface, count, &capture[captureCount])))
+            {
+                return WE_FAIL;
+            }
+            captureCount += count;
+            if (CAPTURE_POST == captureState)
+            {
+                captureContiguous += count;
+            }
+
+            if (captureCount < capturePre + capturePost)
+            {
+                if ((CAPTURE_POST == captureState) && (ITDS_FIFO_DEPTH == fifoStatus.fifoFillLevel))
+                {
+                    return (WE_FAIL == restart_Capture_FIFO()) ? WE_FAIL : 0;
+                }
+                if ((int32_t)(micros() - captureDeadline) < 0)
+                {
+                    return 0;
+                }
+            }
+        }
+    }
+
+    record->timestamp = captureMicros;
+    record->postTimestamp = (CAPTURE_RESTARTED == captureState) ? capturePostMicros : captureMicros;
+    record->samplePeriod = get_Sample_Period();
+    record->trigger = captureTrigger;
+    record->preSamples = capturePre;
+    record->postSamples = captureCount - capturePre;
+    record->contiguousPost = captureContiguous;
+    record->samples = capture;
+
+    if (WE_FAIL == disarm_Capture())
+	{
+		return WE_FAIL;
+	}
+
+    return 1;
+}
+
+/**
+  @brief  Configure tap, wake-up, free-fall and 6D detection in a single transfer
+  @param  Detection profile, e.g. constexpr and checked with ITDS_isValidDetectionProfile()
+  @retval Error Code
+*/
+int Sensor_ITDS::set_Detection_Profile(const ITDS_detection_Profile_t *profile)
+{
+    if (WE_FAIL == ITDS_setDetectionProfile(&sensorInterface, profile))
+	{
+		return WE_FAIL;
+	}
+    return WE_SUCCESS;
+}
+
+/**
+  @brief  Register the handler of an event type, called by service_Events()
+  @param  Event type
+  @param  Handler, NULL removes the handler
+  @param  Passed to the handler
+  @retval Error Code
+*/
+int Sensor_ITDS::set_Event_Handler(ITDS_event_Type type, ITDS_eventHandler_t handler, void *context)
+{
+    if ((type < ITDS_eventFreeFall) || (type >= ITDS_eventTypes))
+	{
+		return WE_FAIL;
+	}
+    eventHandlers[type] = handler;
+    eventContexts[type] = context;
+    return WE_SUCCESS;
+}
+
+/**
+  @brief  Read all event registers in one transfer, decode them and call the handlers of the
+          events detected. Reading the registers also clears latched interrupts.
+  @param  Decoded events, NULL if not needed
+  @retval Bits (1 << ITDS_event_Type) of the events detected, WE_FAIL on error
+*/
+int Sensor_ITDS::service_Events(ITDS_events_t *events)
+{
+    ITDS_event_block_t block;
+    ITDS_events_t decoded;
+
+    if (WE_FAIL == ITDS_getEventBlock(&sensorInterface, &block))
+	{
+		return WE_FAIL;
+	}
+
+    /* ALL_INT_EVENT holds the event flags, the other registers their details */
+    decoded.fired = 0;
+    if (block.allIntEvent.freeFallState)
+    {
+        decoded.fired |= 1 << ITDS_eventFreeFall;
+    }
+    if (block.allIntEvent.wakeupState)
+    {
+        decoded.fired |= 1 << ITDS_eventWakeUp;
+    }
+    if (block.allIntEvent.singleTapState)
+    {
+        decoded.fired |= 1 << ITDS_eventSingleTap;
+    }
+    if (block.allIntEvent.doubleTapState)
+    {
+        decoded.fired |= 1 << ITDS_eventDoubleTap;
+    }
+    if (block.allIntEvent.sixDState)
+    {
+        decoded.fired |= 1 << ITDS_event6D;
+    }
+    if (block.allIntEvent.sleepState)
+    {
+        decoded.fired |= 1 << ITDS_eventSleepChange;
+    }
+    decoded.sleeping = (0 != block.wakeUpEvent.sleepState);
+    decoded.wakeUpAxes = *(uint8_t *)&block.wakeUpEvent & (ITDS_AXIS_X | ITDS_AXIS_Y | ITDS_AXIS_Z);
+    decoded.tapAxes = *(uint8_t *)&block.tapEvent & (ITDS_AXIS_X | ITDS_AXIS_Y | ITDS_AXIS_Z);
+    decoded.tapNegative = (0 != block.tapEvent.tapSign);
+    decoded.position6D = *(uint8_t *)&block.event6D & 0x3F;
+
+    if (NULL != events)
+    {
+        *events = decoded;
+    }
+
+    for (int type = 0; type < ITDS_eventTypes; type++)
+    {
+        if ((decoded.fired & (1 << type)) && (NULL != eventHandlers[type]))
+        {
+            eventHandlers[type]((ITDS_event_Type)type, &decoded, eventContexts[type]);
+        }
+    }
+
+    return decoded.fired;
+}
@@ -28,11 +28,92 @@
 
 #include "WSEN_ITDS_2533020201601.h"
 
+/* Timestamped sample of the FIFO stream */
+typedef struct
+{
+    uint32_t timestamp;     /* micros() at which the sample was taken */
+    int16_t raw[3];         /* raw X, Y and Z-axis acceleration */
+} ITDS_streamSample_t;
+
+/* Event ending the pre-trigger window of a capture */
+typedef enum
+{
+    ITDS_captureWakeUp,
+    ITDS_captureFreeFall,
+    ITDS_captureTap
+} ITDS_capture_Trigger;
+
+/* Samples around one trigger event */
+typedef struct
+{
+    uint32_t timestamp;         /* micros() at which the trigger interrupt fired, time of the last pre-trigger sample */
+    uint32_t postTimestamp;     /* micros() at which the FIFO was restarted after contiguousPost samples, timestamp if not */
+    uint32_t samplePeriod;      /* time between two samples [us] */
+    ITDS_capture_Trigger trigger;
+    uint8_t preSamples;         /* samples up to the trigger */
+    uint8_t postSamples;        /* samples after the trigger, fewer than requested if the deadline passed */
+    uint8_t contiguousPost;     /* post-trigger samples directly following the pre-trigger samples, the rest follow a gap */
+    int16_t (*samples)[3];      /* raw X, Y and Z-axis acceleration, pre-trigger samples first, oldest first */
+} ITDS_shockRecord_t;
+
+/* Called by service_Adaptive_ODR() after a switch, active is true for the high performance ODR */
+typedef void (*ITDS_activityCallback_t)(bool active, void *context);
+
+/* Policy of the adaptive ODR manager */
+typedef struct
+{
+    uint8_t activeODR;          /* ODR (1 ... 9) in high performance mode while moving */
+    uint8_t idleODR;            /* ODR (1 ... 9) in low power mode while stationary */
+    uint8_t wakeUpThreshold;    /* 1 ... 63, 1 LSB = 1/64 of the full scale */
+    uint8_t wakeUpDuration;     /* 0 ... 3, 1 LSB = 1/ODR */
+    uint8_t sleepDuration;      /* 0 ... 15, 1 LSB = 512/ODR, 0 = 16/ODR */
+    ITDS_activityCallback_t callback;  /* may be NULL */
+    void *context;              /* passed to the callback */
+} ITDS_adaptive_ODR_t;
+
+/* Axis flags of wake-up and tap events, same layout as in the event registers */
+#define ITDS_AXIS_Z     0x01
+#define ITDS_AXIS_Y     0x02
+#define ITDS_AXIS_X     0x04
+
+/* Check a detection profile at compile time: static_assert(ITDS_isValidDetectionProfile(profile), "...") */
+constexpr bool ITDS_isValidDetectionProfile(const ITDS_detection_Profile_t &profile)
+{
+    return ITDS_DETECTION_PROFILE_VALID(profile);
+}
+
+/* Types of detection events */
+typedef enum
+{
+    ITDS_eventFreeFall,
+    ITDS_eventWakeUp,
+    ITDS_eventSingleTap,
+    ITDS_eventDoubleTap,
+    ITDS_event6D,
+    ITDS_eventSleepChange,
+    ITDS_eventTypes             /* number of event types */
+} ITDS_event_Type;
+
+/* Decoded event registers */
+typedef struct
+{
+    uint8_t fired;              /* bit (1 << ITDS_event_Type) per event detected */
+    bool sleeping;              /* sleep state */
+    uint8_t wakeUpAxes;         /* ITDS_AXIS_* of the wake-up event */
+    uint8_t tapAxes;            /* ITDS_AXIS_* of the tap event */
+    bool tapNegative;           /* sign of the acceleration of the tap event */
+    uint8_t position6D;         /* over threshold flags XL, XH, YL, YH, ZL, ZH in bits 0 ... 5 */
+} ITDS_events_t;
+
+/* Called by service_Events() for each event type detected */
+typedef void (*ITDS_eventHandler_t)(ITDS_event_Type type, const ITDS_events_t *events, void *context);
+
 class Sensor_ITDS
 {
 
 public:
-    int init(int address);
+    int init(int address, void *handle = NULL, const WE_transport_t *transport = NULL);
+    WE_sensorInterface_t *get_Interface();
     int get_DeviceID();
     int power_down();
     int SW_RESET();
@@ -43,6 +124,25 @@ public:
     int get_Operating_Mode();
     int get_Power_Mode();
 
+    int set_Single_Conversion(ITDS_singleDataConversion_Input trigger = I2C);
+    int start_Single_Conversion();
+    int read_Single_Conversion(float *acc_x, float *acc_y, float *acc_z, int16_t *raw = NULL);
+    int get_Single_Conversion(float *acc_x, float *acc_y, float *acc_z, int16_t *raw = NULL);
+
+    int start_Adaptive_ODR(const ITDS_adaptive_ODR_t *policy);
+    int stop_Adaptive_ODR();
+    int service_Adaptive_ODR();
+    int is_Active();
+
+    int set_Detection_Profile(const ITDS_detection_Profile_t *profile);
+    int set_Event_Handler(ITDS_event_Type type, ITDS_eventHandler_t handler, void *context = NULL);
+    int service_Events(ITDS_events_t *events = NULL);
+
+    int calibrate_Offset(ITDS_user_Offset_t *userOffset = NULL, int32_t x = 0, int32_t y = 0, int32_t z = 1000,
+                         int numSamples = ITDS_FIFO_DEPTH);
+    int set_Offset(const ITDS_user_Offset_t *userOffset);
+    int get_Offset(ITDS_user_Offset_t *userOffset);
+
     int set_Bandwidth(int value);
     int set_Full_Scale(int value);
     int set_Low_Pass_Filter();
@@ -54,19 +154,88 @@ public:
     int get_acceleration_X(float *acc_x);
     int get_acceleration_Y(float *acc_y);
     int get_acceleration_Z(float *acc_z);
+    int get_accelerations(float *acc_x, float *acc_y, float *acc_z, int16_t *raw = NULL);
+    int get_accelerations_if_ready(float *acc_x, float *acc_y, float *acc_z, int16_t *raw = NULL);
+    int get_accelerations_int(int32_t *acc_x, int32_t *acc_y, int32_t *acc_z, ITDS_acc_Unit unit = ITDS_milliG);
+    int convert_samples(const int16_t raw[][3], int32_t acc[][3], int numSamples, ITDS_acc_Unit unit = ITDS_milliG);
+    int convert_samples(const int16_t raw[][3], float acc[][3], int numSamples);
     int get_temperature(int *temperature);
     int get_temp_Fahrenheit(int *temperature);
+    int get_temperature_centi(int *temperature);
 
     int set_FIFO_mode(int fifoMode);
     int get_FIFO_mode(int *mode);
     int get_FIFO_Fill_Level(int *lvl);
+    int read_FIFO_samples(int16_t samples[][3], int maxSamples);
+
+    int start_Streaming(ITDS_streamSample_t *buffer, int length, int watermark);
+    int stop_Streaming();
+    void watermark_ISR();
+    int service_Streaming();
+    int read_Stream(ITDS_streamSample_t *samples, int maxSamples);
+    int get_Stream_Available();
+    uint32_t get_Stream_Lost();
+
+    int arm_Capture(ITDS_capture_Trigger trigger, int16_t samples[][3], int preSamples, int postSamples);
+    int disarm_Capture();
+    void trigger_ISR();
+    int service_Capture(ITDS_shockRecord_t *record);
 
     int ODR;
     int select_ODR();
 
 private:
+    WE_sensorInterface_t sensorInterface;
+    WE_registerCache_t registerCache;
+    uint8_t cacheValues[ITDS_CACHED_REGISTERS];
     ITDS_power_mode mode;
     ITDS_full_Scale full_scale;
+    ITDS_acc_Conversion_t accConversion[2];    /* per ITDS_acc_Unit, follows full_scale */
+
+    /* FIFO stream, single producer (service_Streaming) and single consumer (read_Stream) */
+    ITDS_streamSample_t *stream;
+    bool streaming;
+    uint8_t streamMask;
+    uint8_t streamWatermark;
+    volatile uint8_t streamHead;
+    volatile uint8_t streamTail;
+    volatile bool watermarkPending;
+    volatile uint32_t watermarkMicros;
+    uint32_t streamLost;
+
+    /* pre-/post-trigger capture */
+    int16_t (*capture)[3];
+    ITDS_capture_Trigger captureTrigger;
+    uint8_t captureState;
+    uint8_t capturePre;
+    uint8_t capturePost;
+    uint8_t captureCount;
+    uint8_t captureContiguous;
+    uint32_t captureArmMicros;
+    uint32_t captureMicros;
+    uint32_t capturePostMicros;
+    uint32_t captureDeadline;
+    volatile bool triggerPending;
+    volatile uint32_t triggerMicros;
+
+    uint32_t get_Sample_Period();
+    int route_Capture_Trigger(ITDS_state_t state);
+    int read_Capture_Window();
+    int restart_Capture_FIFO();
+
+    ITDS_singleDataConversion_Input singleTrigger;
+
+    /* adaptive ODR manager, NULL if stopped */
+    const ITDS_adaptive_ODR_t *adaptivePolicy;
+    bool adaptiveActive;
+
+    int switch_Activity(bool active);
+
+    ITDS_eventHandler_t eventHandlers[ITDS_eventTypes];
+    void *eventContexts[ITDS_eventTypes];
+
+    int select_ODR(int odr);
+    int configure_Mode(ITDS_operating_mode operatingMode, ITDS_power_mode powerMode, int odr);
 };
 
 #endif
@@ -26,15 +26,42 @@
 #include <stdio.h>
 
 
+/**
+* @brief  Registers held in the register cache of the sensor interface:
+*         control, threshold and offset registers
+*/
+const WE_cachedRegister_t ITDS_cachedRegisters[ITDS_CACHED_REGISTERS] = {
+	{ ITDS_CTRL_1_REG, 0, 0 },
+	{ ITDS_CTRL_2_REG, 0, 0xC0 },   /* BOOT, SOFT_RESET */
+	{ ITDS_CTRL_3_REG, 0x01, 0 },   /* SLP_MODE_1 (single conversion) */
+	{ ITDS_CTRL_4_REG, 0, 0 },
+	{ ITDS_CTRL_5_REG, 0, 0 },
+	{ ITDS_CTRL_6_REG, 0, 0 },
+	{ ITDS_FIFO_CTRL_REG, 0, 0 },
+	{ ITDS_TAP_X_TH_REG, 0, 0 },
+	{ ITDS_TAP_Y_TH_REG, 0, 0 },
+	{ ITDS_TAP_Z_TH_REG, 0, 0 },
+	{ ITDS_INT_DUR_REG, 0, 0 },
+	{ ITDS_WAKE_UP_TH_REG, 0, 0 },
+	{ ITDS_WAKE_UP_DUR_REG, 0, 0 },
+	{ ITDS_FREE_FALL_REG, 0, 0 },
+	{ ITDS_X_OFS_USR_REG, 0, 0 },
+	{ ITDS_Y_OFS_USR_REG, 0, 0 },
+	{ ITDS_Z_OFS_USR_REG, 0, 0 },
+	{ ITDS_CTRL_7_REG, 0, 0 }
+};
+
+
 /**
 * @brief  Read the device ID
+* @param  Pointer to sensor interface
 * @param  Pointer to Device Id .
 * @retval Error code
 */
-int8_t ITDS_getDeviceID(uint8_t *device_id)
+int8_t ITDS_getDeviceID(WE_sensorInterface_t *sensorInterface, uint8_t *device_id)
 {
 	uint8_t deviceID = 0;
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_DEVICE_ID_REG, 1, &deviceID))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_DEVICE_ID_REG, 1, &deviceID))
 	return WE_FAIL;
 
 	*device_id=deviceID;
@@ -46,20 +73,21 @@ int8_t ITDS_getDeviceID(uint8_t *device_id)
 
 /**
 * @brief  Set the output data rate
+* @param  Pointer to sensor interface
 * @param  output data rate
 * @retval Error code
 */
-int8_t ITDS_setOutputDataRate(ITDS_output_Data_Rate odr)
+int8_t ITDS_setOutputDataRate(WE_sensorInterface_t *sensorInterface, ITDS_output_Data_Rate odr)
 {
 
 	ITDS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.outputDataRate = odr;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -67,14 +95,15 @@ int8_t ITDS_setOutputDataRate(ITDS_output_Data_Rate odr)
 
 /**
 * @brief  Read the output data rate
+* @param  Pointer to sensor interface
 * @param  Pointer to output data rate .
 * @retval Error code
 */
-int8_t ITDS_getOutputDataRate(uint8_t *odr)
+int8_t ITDS_getOutputDataRate(WE_sensorInterface_t *sensorInterface, uint8_t *odr)
 {
 	ITDS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*odr=ctrl_reg_1.outputDataRate;
@@ -83,20 +112,21 @@ int8_t ITDS_getOutputDataRate(uint8_t *odr)
 
 /**
 * @brief  Set the operating mode
+* @param  Pointer to sensor interface
 * @param  operating mode
 * @retval Error code
 */
-int8_t ITDS_setOperatingMode(ITDS_operating_mode Mode)
+int8_t ITDS_setOperatingMode(WE_sensorInterface_t *sensorInterface, ITDS_operating_mode Mode)
 {
 
 	ITDS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.operatingMode = Mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -104,14 +134,15 @@ int8_t ITDS_setOperatingMode(ITDS_operating_mode Mode)
 
 /**
 * @brief  Read the operating mode
+* @param  Pointer to sensor interface
 * @param  Pointer to the operating mode.
 * @retval Error code
 */
-int8_t ITDS_getOperatingMode(uint8_t *opMode)
+int8_t ITDS_getOperatingMode(WE_sensorInterface_t *sensorInterface, uint8_t *opMode)
 {
 	ITDS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*opMode=ctrl_reg_1.operatingMode;
@@ -120,20 +151,21 @@ int8_t ITDS_getOperatingMode(uint8_t *opMode)
 
 /**
 * @brief  Set the power mode
+* @param  Pointer to sensor interface
 * @param  operating mode
 * @retval Error code
 */
-int8_t ITDS_setpowerMode(ITDS_power_mode lowOrNormalMode)
+int8_t ITDS_setpowerMode(WE_sensorInterface_t *sensorInterface, ITDS_power_mode lowOrNormalMode)
 {
 
 	ITDS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.powerMode = lowOrNormalMode;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -141,14 +173,15 @@ int8_t ITDS_setpowerMode(ITDS_power_mode lowOrNormalMode)
 
 /**
 * @brief  Read the power mode
+* @param  Pointer to sensor interface
 * @param  Pointer to the power mode  .
 * @retval Error code
 */
-int8_t ITDS_getpowerMode(uint8_t *powerMode)
+int8_t ITDS_getpowerMode(WE_sensorInterface_t *sensorInterface, uint8_t *powerMode)
 {
 	ITDS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*powerMode=ctrl_reg_1.powerMode;
@@ -159,19 +192,20 @@ int8_t ITDS_getpowerMode(uint8_t *powerMode)
 
 /**
 * @brief  Set the Boot state [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  boot state
 * @retval Error code
 */
-int8_t ITDS_reboot(ITDS_state_t rebootmode)
+int8_t ITDS_reboot(WE_sensorInterface_t *sensorInterface, ITDS_state_t rebootmode)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.boot = rebootmode;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -179,14 +213,15 @@ int8_t ITDS_reboot(ITDS_state_t rebootmode)
 
 /**
 * @brief  Read the Boot state
+* @param  Pointer to sensor interface
 * @param  Pointer to the Boot state .
 * @retval Error code
 */
-int8_t ITDS_getBootState(ITDS_state_t *boot)
+int8_t ITDS_getBootState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *boot)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*boot=(ITDS_state_t)(ctrl_reg_2.boot);
@@ -195,19 +230,20 @@ int8_t ITDS_getBootState(ITDS_state_t *boot)
 
 /**
 * @brief  Set software reset [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  software reset state
 * @retval Error code
 */
-int8_t ITDS_softReset(ITDS_state_t Swreset_mode)
+int8_t ITDS_softReset(WE_sensorInterface_t *sensorInterface, ITDS_state_t Swreset_mode)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.softReset = Swreset_mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -215,14 +251,15 @@ int8_t ITDS_softReset(ITDS_state_t Swreset_mode)
 
 /**
 * @brief  Read the software reset state [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to the software reset state.
 * @retval Error code
 */
-int8_t ITDS_getsoftResetState(ITDS_state_t *swReset )
+int8_t ITDS_getsoftResetState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *swReset )
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*swReset=(ITDS_state_t)(ctrl_reg_2.softReset);
@@ -231,19 +268,20 @@ int8_t ITDS_getsoftResetState(ITDS_state_t *swReset )
 
 /**
 * @brief  Disconnect CS pull up [pull up connected ,[pull up disconnected]
+* @param  Pointer to sensor interface
 * @param  chip pull up state
 * @retval Error code
 */
-int8_t ITDS_ConfigCSPullup(ITDS_state_t CSPullup)
+int8_t ITDS_ConfigCSPullup(WE_sensorInterface_t *sensorInterface, ITDS_state_t CSPullup)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.disCSPullup = CSPullup;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -251,14 +289,15 @@ int8_t ITDS_ConfigCSPullup(ITDS_state_t CSPullup)
 
 /**
 * @brief  Read the CS pull up [pull up connected ,[pull up disconnected]
+* @param  Pointer to sensor interface
 * @param  Pointer to the CS pull up .
 * @retval Error code
 */
-int8_t ITDS_getCSConfigState(ITDS_state_t *configCS)
+int8_t ITDS_getCSConfigState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *configCS)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*configCS=(ITDS_state_t)(ctrl_reg_2.disCSPullup);
@@ -268,19 +307,20 @@ int8_t ITDS_getCSConfigState(ITDS_state_t *configCS)
 
 /**
 * @brief  Set the block data update state
+* @param  Pointer to sensor interface
 * @param  BDU state
 * @retval Error code
 */
-int8_t ITDS_setBlockDataUpdate(ITDS_state_t bdu)
+int8_t ITDS_setBlockDataUpdate(WE_sensorInterface_t *sensorInterface, ITDS_state_t bdu)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.blockDataUpdate = bdu;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -288,14 +328,15 @@ int8_t ITDS_setBlockDataUpdate(ITDS_state_t bdu)
 
 /**
 * @brief  Read the block data update state
+* @param  Pointer to sensor interface
 * @param  Pointer to the block data update state
 * @retval Error code
 */
-int8_t ITDS_getBlockDataUpdateState(ITDS_state_t *bdu)
+int8_t ITDS_getBlockDataUpdateState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *bdu)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*bdu=(ITDS_state_t)(ctrl_reg_2.blockDataUpdate);
 	return WE_SUCCESS;
@@ -304,19 +345,20 @@ int8_t ITDS_getBlockDataUpdateState(ITDS_state_t *bdu)
 
 /**
 * @brief  Set the Auto increment feature
+* @param  Pointer to sensor interface
 * @param  Auto increment state
 * @retval Error code
 */
-int8_t ITDS_setAutoIncrement(ITDS_state_t autoInc)
+int8_t ITDS_setAutoIncrement(WE_sensorInterface_t *sensorInterface, ITDS_state_t autoInc)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.autoAddIncr = autoInc;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -324,14 +366,15 @@ int8_t ITDS_setAutoIncrement(ITDS_state_t autoInc)
 
 /**
 * @brief  Read the auto increment state
+* @param  Pointer to sensor interface
 * @param  Pointer to the auto increment state
 * @retval Error code
 */
-int8_t ITDS_getAutoIncrementState(ITDS_state_t *autoIncr)
+int8_t ITDS_getAutoIncrementState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *autoIncr)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*autoIncr=(ITDS_state_t)(ctrl_reg_2.autoAddIncr);
@@ -340,19 +383,20 @@ int8_t ITDS_getAutoIncrementState(ITDS_state_t *autoIncr)
 
 /**
 * @brief  Disable the I2C Interface
+* @param  Pointer to sensor interface
 * @param  I2C Interface state
 * @retval Error code
 */
-int8_t ITDS_disableI2CInterface(ITDS_state_t I2CStatus)
+int8_t ITDS_disableI2CInterface(WE_sensorInterface_t *sensorInterface, ITDS_state_t I2CStatus)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.i2cDisable = I2CStatus;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -360,14 +404,15 @@ int8_t ITDS_disableI2CInterface(ITDS_state_t I2CStatus)
 
 /**
 * @brief  Read the I2C interface state [enabled;disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to the I2C interface state.
 * @retval Error code
 */
-int8_t ITDS_getI2CInterfaceState(ITDS_state_t *i2cState)
+int8_t ITDS_getI2CInterfaceState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *i2cState)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*i2cState=(ITDS_state_t)(ctrl_reg_2.i2cDisable);
@@ -379,19 +424,20 @@ int8_t ITDS_getI2CInterfaceState(ITDS_state_t *i2cState)
 
 /**
 * @brief  set the self test mode
+* @param  Pointer to sensor interface
 * @param  self test mode
 * @retval Error code
 */
-int8_t ITDS_setSelfTestMode(ITDS_self_Test_Config selfTest)
+int8_t ITDS_setSelfTestMode(WE_sensorInterface_t *sensorInterface, ITDS_self_Test_Config selfTest)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.selfTestMode = selfTest;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -399,14 +445,15 @@ int8_t ITDS_setSelfTestMode(ITDS_self_Test_Config selfTest)
 
 /**
 * @brief  Read the self test mode
+* @param  Pointer to sensor interface
 * @param  Pointer to the self test mode.
 * @retval Error code
 */
-int8_t ITDS_getSelfTestMode(ITDS_state_t *selfTest)
+int8_t ITDS_getSelfTestMode(WE_sensorInterface_t *sensorInterface, ITDS_state_t *selfTest)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*selfTest=(ITDS_state_t)(ctrl_reg_3.selfTestMode);
@@ -415,19 +462,20 @@ int8_t ITDS_getSelfTestMode(ITDS_state_t *selfTest)
 
 /**
 * @brief  set the Interrupt Type [Push-pull/open-drain]
+* @param  Pointer to sensor interface
 * @param  interrupt Type
 * @retval Error code
 */
-int8_t ITDS_setIntPinType(ITDS_interrupt_Pin_Config interruptType)
+int8_t ITDS_setIntPinType(WE_sensorInterface_t *sensorInterface, ITDS_interrupt_Pin_Config interruptType)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.intPinConf = interruptType;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -435,14 +483,15 @@ int8_t ITDS_setIntPinType(ITDS_interrupt_Pin_Config interruptType)
 
 /**
 * @brief  Read the Interrupt Type [Push-pull/open-drain]
+* @param  Pointer to sensor interface
 * @param  Pointer to the Interrupt Type .
 * @retval Error code
 */
-int8_t ITDS_getIntPinType(ITDS_state_t *intType)
+int8_t ITDS_getIntPinType(WE_sensorInterface_t *sensorInterface, ITDS_state_t *intType)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*intType=(ITDS_state_t)(ctrl_reg_3.intPinConf);
@@ -451,19 +500,20 @@ int8_t ITDS_getIntPinType(ITDS_state_t *intType)
 
 /**
 * @brief  set the latched Interrupt
+* @param  Pointer to sensor interface
 * @param  latch Interrupt state
 * @retval Error code
 */
-int8_t ITDS_enLatchInt(ITDS_state_t lir)
+int8_t ITDS_enLatchInt(WE_sensorInterface_t *sensorInterface, ITDS_state_t lir)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.enLatchedInterrupt = lir;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -471,14 +521,15 @@ int8_t ITDS_enLatchInt(ITDS_state_t lir)
 
 /**
 * @brief  Read the latch Interrupt state [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to the latch Interrupt state .
 * @retval Error code
 */
-int8_t ITDS_getLatchIntState(ITDS_state_t *lir)
+int8_t ITDS_getLatchIntState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *lir)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*lir=(ITDS_state_t)(ctrl_reg_3.enLatchedInterrupt);
@@ -487,19 +538,20 @@ int8_t ITDS_getLatchIntState(ITDS_state_t *lir)
 
 /**
 * @brief  set the Interrupt active level [active high/active low]
+* @param  Pointer to sensor interface
 * @param  interrupt active level
 * @retval Error code
 */
-int8_t ITDS_setIntActiveLevel(ITDS_interrupt_Active_Level lowHighLevel)
+int8_t ITDS_setIntActiveLevel(WE_sensorInterface_t *sensorInterface, ITDS_interrupt_Active_Level lowHighLevel)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.intActiveLevel = lowHighLevel;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -507,14 +559,15 @@ int8_t ITDS_setIntActiveLevel(ITDS_interrupt_Active_Level lowHighLevel)
 
 /**
 * @brief  Read the Interrupt active level
+* @param  Pointer to sensor interface
 * @param  Pointer to the Interrupt active level.
 * @retval Error code
 */
-int8_t ITDS_getIntActiveLevel(ITDS_interrupt_Active_Level *lowHighLevel)
+int8_t ITDS_getIntActiveLevel(WE_sensorInterface_t *sensorInterface, ITDS_interrupt_Active_Level *lowHighLevel)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*lowHighLevel=(ITDS_interrupt_Active_Level)(ctrl_reg_3.intActiveLevel);
@@ -523,19 +576,20 @@ int8_t ITDS_getIntActiveLevel(ITDS_interrupt_Active_Level *lowHighLevel)
 
 /**
 * @brief  select the Single data conversion [0:enabled by external trigger signal on INT_1,1:enabled by I2C writing]
+* @param  Pointer to sensor interface
 * @param  single data conversion Demand mode
 * @retval Error code
 */
-int8_t ITDS_setSingleConvInput(ITDS_singleDataConversion_Input slpModeSel)
+int8_t ITDS_setSingleConvInput(WE_sensorInterface_t *sensorInterface, ITDS_singleDataConversion_Input slpModeSel)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
-	ctrl_reg_3.enSingleDataConv = slpModeSel;
+	ctrl_reg_3.singleConvTrigger = slpModeSel;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -543,35 +597,37 @@ int8_t ITDS_setSingleConvInput(ITDS_singleDataConversion_Input slpModeSel)
 
 /**
 * @brief  Read the single data conversion Demand mode
+* @param  Pointer to sensor interface
 * @param  Pointer to single data conversion Demand mode .
 * @retval Error code
 */
-int8_t ITDS_getSingleConvInput(ITDS_singleDataConversion_Input *slpModeSel)
+int8_t ITDS_getSingleConvInput(WE_sensorInterface_t *sensorInterface, ITDS_singleDataConversion_Input *slpModeSel)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
-	*slpModeSel=(ITDS_singleDataConversion_Input)(ctrl_reg_3.enSingleDataConv);
+	*slpModeSel=(ITDS_singleDataConversion_Input)(ctrl_reg_3.singleConvTrigger);
 	return WE_SUCCESS;
 }
 
 /**
 * @brief  enable the Single Data Conversion Mode
+* @param  Pointer to sensor interface
 * @param  Single Data Conversion Mode
 * @retval Error code
 */
-int8_t ITDS_enSingleDataConv(ITDS_state_t slpMode1)
+int8_t ITDS_enSingleDataConv(WE_sensorInterface_t *sensorInterface, ITDS_state_t slpMode1)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
-	ctrl_reg_3.singleConvTrigger = slpMode1;
+	ctrl_reg_3.enSingleDataConv = slpMode1;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -579,17 +635,18 @@ int8_t ITDS_enSingleDataConv(ITDS_state_t slpMode1)
 
 /**
 * @brief  Read the single data conversion Demand mode
+* @param  Pointer to sensor interface
 * @param  Pointer to the single data conversion Demand mode.
 * @retval Error code
 */
-int8_t ITDS_getSingleDataConvState(ITDS_state_t *slpMode1)
+int8_t ITDS_getSingleDataConvState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *slpMode1)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
-	*slpMode1=(ITDS_state_t)(ctrl_reg_3.singleConvTrigger);
+	*slpMode1=(ITDS_state_t)(ctrl_reg_3.enSingleDataConv);
 	return WE_SUCCESS;
 }
 
@@ -598,19 +655,20 @@ int8_t ITDS_getSingleDataConvState(ITDS_state_t *slpMode1)
 
 /**
 * @brief  enable the 6D interrupt on INT_0
+* @param  Pointer to sensor interface
 * @param  the 6D interrupt state on INT_0
 * @retval Error code
 */
-int8_t ITDS_set6DOnINT0(ITDS_state_t int06D)
+int8_t ITDS_set6DOnINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int06D)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.sixDINT0 = int06D;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -618,14 +676,15 @@ int8_t ITDS_set6DOnINT0(ITDS_state_t int06D)
 
 /**
 * @brief  Read the the 6D interrupt state on INT_0
+* @param  Pointer to sensor interface
 * @param  Pointer to the 6D interrupt state on INT_0.
 * @retval Error code
 */
-int8_t ITDS_get6DOnINT0State(ITDS_state_t *int06D)
+int8_t ITDS_get6DOnINT0State(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int06D)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int06D=(ITDS_state_t)(ctrl_reg_4.sixDINT0);
@@ -634,19 +693,20 @@ int8_t ITDS_get6DOnINT0State(ITDS_state_t *int06D)
 
 /**
 * @brief  enable the Single-tap interrupt on INT_0
+* @param  Pointer to sensor interface
 * @param  Single-tap interrupt state on INT_0
 * @retval Error code
 */
-int8_t ITDS_enSingleTapINT0(ITDS_state_t int0SingleTap)
+int8_t ITDS_enSingleTapINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int0SingleTap)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.singleTapINT0 = int0SingleTap;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -654,14 +714,15 @@ int8_t ITDS_enSingleTapINT0(ITDS_state_t int0SingleTap)
 
 /**
 * @brief  Read the Single-tap interrupt state on INT_0
+* @param  Pointer to sensor interface
 * @param  Pointer to the Single-tap interrupt state on INT_0
 * @retval Error code
 */
-int8_t ITDS_getSingleTapINT0(ITDS_state_t *int0SingleTap)
+int8_t ITDS_getSingleTapINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int0SingleTap)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int0SingleTap=(ITDS_state_t)(ctrl_reg_4.singleTapINT0);
@@ -670,19 +731,20 @@ int8_t ITDS_getSingleTapINT0(ITDS_state_t *int0SingleTap)
 
 /**
 * @brief  enable the Wakeup interrupt  on INT_0
+* @param  Pointer to sensor interface
 * @param   Wakeup interrupt state on INT_0
 * @retval Error code
 */
-int8_t ITDS_enWakeupOnINT0(ITDS_state_t int0Wakeup)
+int8_t ITDS_enWakeupOnINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int0Wakeup)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.wakeupINT0 = int0Wakeup;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -690,14 +752,15 @@ int8_t ITDS_enWakeupOnINT0(ITDS_state_t int0Wakeup)
 
 /**
 * @brief  Read the Wakeup interrupt state  on INT_0
+* @param  Pointer to sensor interface
 * @param  Pointer to the Wakeup interrupt state  on INT_0 .
 * @retval Error code
 */
-int8_t ITDS_getWakeupOnINT0(ITDS_state_t *int0Wakeup)
+int8_t ITDS_getWakeupOnINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int0Wakeup)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int0Wakeup=(ITDS_state_t)(ctrl_reg_4.wakeupINT0);
@@ -706,19 +769,20 @@ int8_t ITDS_getWakeupOnINT0(ITDS_state_t *int0Wakeup)
 
 /**
 * @brief  enable Free-fall interrupt on INT_0
+* @param  Pointer to sensor interface
 * @param  Free-fall interrupt state  on INT_0
 * @retval Error code
 */
-int8_t ITDS_enFreeFallINT0(ITDS_state_t int0FreeFall)
+int8_t ITDS_enFreeFallINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int0FreeFall)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.freeFallINT0 = int0FreeFall;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -726,14 +790,15 @@ int8_t ITDS_enFreeFallINT0(ITDS_state_t int0FreeFall)
 
 /**
 * @brief  Read the Free-fall interrupt State on INT_0
+* @param  Pointer to sensor interface
 * @param  Pointer to the Free-fall State on INT_0.
 * @retval Error code
 */
-int8_t ITDS_getFreeFallINT0(ITDS_state_t *int0FreeFall)
+int8_t ITDS_getFreeFallINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int0FreeFall)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int0FreeFall=(ITDS_state_t)(ctrl_reg_4.freeFallINT0);
@@ -743,19 +808,20 @@ int8_t ITDS_getFreeFallINT0(ITDS_state_t *int0FreeFall)
 
 /**
 * @brief  enable the Double-tap interrupton INT_0
+* @param  Pointer to sensor interface
 * @param  the Double-tap state interrupt on INT_0
 * @retval Error code
 */
-int8_t ITDS_enDoubleTapINT0(ITDS_state_t int0DoubleTap)
+int8_t ITDS_enDoubleTapINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int0DoubleTap)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.doubleTapINT0 = int0DoubleTap;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -763,14 +829,15 @@ int8_t ITDS_enDoubleTapINT0(ITDS_state_t int0DoubleTap)
 
 /**
 * @brief  Read the Double-tap interruptstate  on INT_0
+* @param  Pointer to sensor interface
 * @param  Pointer to the Double-tap interrupt state  on INT_0
 * @retval Error code
 */
-int8_t ITDS_getDoubleTapINT0(ITDS_state_t *int0DoubleTap)
+int8_t ITDS_getDoubleTapINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int0DoubleTap)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int0DoubleTap=(ITDS_state_t)(ctrl_reg_4.doubleTapINT0);
@@ -779,19 +846,20 @@ int8_t ITDS_getDoubleTapINT0(ITDS_state_t *int0DoubleTap)
 
 /**
 * @brief  enable the FIFO full interrupton INT_0
+* @param  Pointer to sensor interface
 * @param  FIFO full interrupt state on INT_0
 * @retval Error code
 */
-int8_t ITDS_enFifoFullINT0(ITDS_state_t int0FifoFull)
+int8_t ITDS_enFifoFullINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int0FifoFull)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.fifoFullINT0 = int0FifoFull;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -799,14 +867,15 @@ int8_t ITDS_enFifoFullINT0(ITDS_state_t int0FifoFull)
 
 /**
 * @brief  Read the FIFO full interrupt State on INT_0
+* @param  Pointer to sensor interface
 * @param  Pointer to the FIFO full interrupt State on INT_0
 * @retval Error code
 */
-int8_t ITDS_getFifoFullINT0(ITDS_state_t *int0FifoFull)
+int8_t ITDS_getFifoFullINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int0FifoFull)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int0FifoFull=(ITDS_state_t)(ctrl_reg_4.fifoFullINT0);
@@ -816,19 +885,20 @@ int8_t ITDS_getFifoFullINT0(ITDS_state_t *int0FifoFull)
 
 /**
 * @brief  enable the FIFO threshold interrupt  on INT_0
+* @param  Pointer to sensor interface
 * @param  FIFO threshold interrupt state on INT_0
 * @retval Error code
 */
-int8_t ITDS_enFifoThresholdINT0(ITDS_state_t int0FifoThresholdInt)
+int8_t ITDS_enFifoThresholdINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int0FifoThresholdInt)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.fifoThresholdINT0 = int0FifoThresholdInt;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -836,14 +906,15 @@ int8_t ITDS_enFifoThresholdINT0(ITDS_state_t int0FifoThresholdInt)
 
 /**
 * @brief  Read the FIFO threshold interrupt State on INT_0
+* @param  Pointer to sensor interface
 * @param  Pointer to the FIFO threshold interrupt State on INT_0
 * @retval Error code
 */
-int8_t ITDS_getFifoThresholdINT0(ITDS_state_t *int0FifoThresholdInt)
+int8_t ITDS_getFifoThresholdINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int0FifoThresholdInt)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int0FifoThresholdInt=(ITDS_state_t)(ctrl_reg_4.fifoThresholdINT0);
@@ -853,19 +924,20 @@ int8_t ITDS_getFifoThresholdINT0(ITDS_state_t *int0FifoThresholdInt)
 
 /**
 * @brief  enable the Data-Ready interrupt on INT_0
+* @param  Pointer to sensor interface
 * @param  Data-Ready interrupt on INT_0 State
 * @retval Error code
 */
-int8_t ITDS_enDataReadyINT0(ITDS_state_t int0DataReadyInt)
+int8_t ITDS_enDataReadyINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int0DataReadyInt)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.dataReadyINT0 = int0DataReadyInt;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -873,14 +945,15 @@ int8_t ITDS_enDataReadyINT0(ITDS_state_t int0DataReadyInt)
 
 /**
 * @brief  Read the Data-Ready interrupt on INT_0 State
+* @param  Pointer to sensor interface
 * @param  Pointer to Data-Ready interrupt on INT_0 State.
 * @retval Error code
 */
-int8_t ITDS_getDataReadyINT0(ITDS_state_t *int0DataReadyInt)
+int8_t ITDS_getDataReadyINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int0DataReadyInt)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int0DataReadyInt=(ITDS_state_t)(ctrl_reg_4.dataReadyINT0);
@@ -893,19 +966,20 @@ int8_t ITDS_getDataReadyINT0(ITDS_state_t *int0DataReadyInt)
 
 /**
 * @brief  enable Sleep state on INT_1
+* @param  Pointer to sensor interface
 * @param  Sleep state on INT_1
 * @retval Error code
 */
-int8_t ITDS_enInactivityINT1(ITDS_state_t intSleepState)
+int8_t ITDS_enInactivityINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t intSleepState)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.inactiveStatusINT1 = intSleepState;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -913,14 +987,15 @@ int8_t ITDS_enInactivityINT1(ITDS_state_t intSleepState)
 
 /**
 * @brief  Read the Sleep  state on INT_1
+* @param  Pointer to sensor interface
 * @param  Pointer to the Sleep  state on INT_1.
 * @retval Error code
 */
-int8_t ITDS_getInactivityINT1(ITDS_state_t *intSleepState)
+int8_t ITDS_getInactivityINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *intSleepState)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*intSleepState=(ITDS_state_t)(ctrl_reg_5.inactiveStatusINT1);
@@ -929,19 +1004,20 @@ int8_t ITDS_getInactivityINT1(ITDS_state_t *intSleepState)
 
 /**
 * @brief  enable Sleep change signal on INT_1
+* @param  Pointer to sensor interface
 * @param  Sleep change state signal on INT_1
 * @retval Error code
 */
-int8_t ITDS_enActivityINT1(ITDS_state_t int1SleepChange)
+int8_t ITDS_enActivityINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1SleepChange)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.activeStatusINT1 = int1SleepChange;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -949,14 +1025,15 @@ int8_t ITDS_enActivityINT1(ITDS_state_t int1SleepChange)
 
 /**
 * @brief  Read the Sleep change state on INT_1
+* @param  Pointer to sensor interface
 * @param  Pointer to the Sleep change state on INT_1.
 * @retval Error code
 */
-int8_t ITDS_getActivityINT1(ITDS_state_t *int1SleepChange)
+int8_t ITDS_getActivityINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1SleepChange)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*int1SleepChange=(ITDS_state_t)(ctrl_reg_5.activeStatusINT1);
@@ -965,19 +1042,20 @@ int8_t ITDS_getActivityINT1(ITDS_state_t *int1SleepChange)
 
 /**
 * @brief  enable the Boot Interrupt on INT_1
+* @param  Pointer to sensor interface
 * @param  Boot Interrupt state on INT_1
 * @retval Error code
 */
-int8_t ITDS_enBootStatusINT1(ITDS_state_t int1Boot)
+int8_t ITDS_enBootStatusINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1Boot)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.bootStatusINT1 = int1Boot;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -985,14 +1063,15 @@ int8_t ITDS_enBootStatusINT1(ITDS_state_t int1Boot)
 
 /**
 * @brief  Read the Boot Interrupt state on INT_1
+* @param  Pointer to sensor interface
 * @param  Pointer to Boot Interrupt state on INT_1
 * @retval Error code
 */
-int8_t ITDS_getBootStatusINT1(ITDS_state_t *int1Boot)
+int8_t ITDS_getBootStatusINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1Boot)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*int1Boot=(ITDS_state_t)(ctrl_reg_5.bootStatusINT1);
@@ -1001,19 +1080,20 @@ int8_t ITDS_getBootStatusINT1(ITDS_state_t *int1Boot)
 
 /**
 * @brief  enable the Temperature Data-Ready interrupt on INT_1
+* @param  Pointer to sensor interface
 * @param  the Temperature Data-Ready interrupt State on INT_1
 * @retval Error code
 */
-int8_t ITDS_enTempDataReadyINT1(ITDS_state_t int1TempDataReady)
+int8_t ITDS_enTempDataReadyINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1TempDataReady)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.tempDataReadyINT1 = int1TempDataReady;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1021,14 +1101,15 @@ int8_t ITDS_enTempDataReadyINT1(ITDS_state_t int1TempDataReady)
 
 /**
 * @brief  Read the Temperature Data-Ready interrupt State on INT_1
+* @param  Pointer to sensor interface
 * @param  Pointer to the Temperature Data-Ready interrupt State on INT_1 .
 * @retval Error code
 */
-int8_t ITDS_getTempDataReadyINT1(ITDS_state_t *int1TempDataReady)
+int8_t ITDS_getTempDataReadyINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1TempDataReady)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*int1TempDataReady=(ITDS_state_t)(ctrl_reg_5.tempDataReadyINT1);
@@ -1037,19 +1118,20 @@ int8_t ITDS_getTempDataReadyINT1(ITDS_state_t *int1TempDataReady)
 
 /**
 * @brief  enable the FIFO Overrun interrupt  on INT_1
+* @param  Pointer to sensor interface
 * @param  FIFO Overrun interrupt state on INT_1
 * @retval Error code
 */
-int8_t ITDS_enFifoOverrunIntINT1(ITDS_state_t int1FifoOverrun)
+int8_t ITDS_enFifoOverrunIntINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1FifoOverrun)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.fifoOverrunINT1 = int1FifoOverrun;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1057,14 +1139,15 @@ int8_t ITDS_enFifoOverrunIntINT1(ITDS_state_t int1FifoOverrun)
 
 /**
 * @brief  Read the FIFO Overrun interrupt state on INT_1
+* @param  Pointer to sensor interface
 * @param  Pointer to the FIFO Overrun interrupt state on INT_1
 * @retval Error code
 */
-int8_t ITDS_getFifoOverrunIntINT1(ITDS_state_t *int1FifoOverrun)
+int8_t ITDS_getFifoOverrunIntINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1FifoOverrun)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*int1FifoOverrun=(ITDS_state_t)(ctrl_reg_5.fifoOverrunINT1);
@@ -1073,19 +1156,20 @@ int8_t ITDS_getFifoOverrunIntINT1(ITDS_state_t *int1FifoOverrun)
 
 /**
 * @brief  enable the FIFO full interrupt on INT_1
+* @param  Pointer to sensor interface
 * @param  FIFO full interrupt state on INT_1
 * @retval Error code
 */
-int8_t ITDS_enFifoFullINT1(ITDS_state_t int1FifoFull)
+int8_t ITDS_enFifoFullINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1FifoFull)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.fifoFullINT1 = int1FifoFull;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1093,14 +1177,15 @@ int8_t ITDS_enFifoFullINT1(ITDS_state_t int1FifoFull)
 
 /**
 * @brief  Read the FIFO full interrupt state on INT_1
+* @param  Pointer to sensor interface
 * @param  Pointer to the FIFO full interrupt state on INT_1
 * @retval Error code
 */
-int8_t ITDS_getFifoFullINT1(ITDS_state_t *int1FifoFull)
+int8_t ITDS_getFifoFullINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1FifoFull)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*int1FifoFull=(ITDS_state_t)(ctrl_reg_5.fifoFullINT1);
@@ -1109,19 +1194,20 @@ int8_t ITDS_getFifoFullINT1(ITDS_state_t *int1FifoFull)
 
 /**
 * @brief  enable the FIFO threshold interrupt on INT_1
+* @param  Pointer to sensor interface
 * @param  FIFO threshold interrupt state  on INT_1
 * @retval Error code
 */
-int8_t ITDS_enFifoThresholdIntINT1(ITDS_state_t int1FifoThresholdInt)
+int8_t ITDS_enFifoThresholdIntINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1FifoThresholdInt)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.fifoThresholdINT1 = int1FifoThresholdInt;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1129,14 +1215,15 @@ int8_t ITDS_enFifoThresholdIntINT1(ITDS_state_t int1FifoThresholdInt)
 
 /**
 * @brief  Read the FIFO threshold interrupt State on INT_1
+* @param  Pointer to sensor interface
 * @param  Pointer to the FIFO threshold interrupt State on INT_1 .
 * @retval Error code
 */
-int8_t ITDS_getFifoThresholdINT1(ITDS_state_t *int1FifoThresholdInt)
+int8_t ITDS_getFifoThresholdINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1FifoThresholdInt)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*int1FifoThresholdInt=(ITDS_state_t)(ctrl_reg_5.fifoThresholdINT1);
@@ -1145,19 +1232,20 @@ int8_t ITDS_getFifoThresholdINT1(ITDS_state_t *int1FifoThresholdInt)
 
 /**
 * @brief  enable the Data-Ready interrupt on INT_1
+* @param  Pointer to sensor interface
 * @param  Data-Ready interrupt State on INT_1
 * @retval Error code
 */
-int8_t ITDS_enDataReadyINT1(ITDS_state_t int1DataReadyInt)
+int8_t ITDS_enDataReadyINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1DataReadyInt)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.dataReadyINT1 = int1DataReadyInt;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1165,14 +1253,15 @@ int8_t ITDS_enDataReadyINT1(ITDS_state_t int1DataReadyInt)
 
 /**
 * @brief  Read the Data-Ready interrupt state on INT_1
+* @param  Pointer to sensor interface
 * @param  Pointer to the Data-Ready interrupt signal on INT_1
 * @retval Error code
 */
-int8_t ITDS_getDataReadyINT1(ITDS_state_t *int1DataReadyInt)
+int8_t ITDS_getDataReadyINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1DataReadyInt)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*int1DataReadyInt=(ITDS_state_t)(ctrl_reg_5.dataReadyINT1);
@@ -1184,19 +1273,20 @@ int8_t ITDS_getDataReadyINT1(ITDS_state_t *int1DataReadyInt)
 
 /**
 * @brief  set  the Filtering Cut-off
+* @param  Pointer to sensor interface
 * @param  Bandwith
 * @retval Error code
 */
-int8_t ITDS_setFilteringCutoff(ITDS_bandwidth filteringCutoff)
+int8_t ITDS_setFilteringCutoff(WE_sensorInterface_t *sensorInterface, ITDS_bandwidth filteringCutoff)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	ctrl_reg_6.filterBandwidth = filteringCutoff;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1204,14 +1294,15 @@ int8_t ITDS_setFilteringCutoff(ITDS_bandwidth filteringCutoff)
 
 /**
 * @brief  Read Filtering Cut-off
+* @param  Pointer to sensor interface
 * @param  Pointer to the Filtering Cut-off .
 * @retval Error code
 */
-int8_t ITDS_getFilteringCutoff(ITDS_bandwidth *filteringCutoff)
+int8_t ITDS_getFilteringCutoff(WE_sensorInterface_t *sensorInterface, ITDS_bandwidth *filteringCutoff)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	*filteringCutoff=(ITDS_bandwidth)(ctrl_reg_6.filterBandwidth);
@@ -1220,19 +1311,20 @@ int8_t ITDS_getFilteringCutoff(ITDS_bandwidth *filteringCutoff)
 
 /**
 * @brief  set the Full scale
+* @param  Pointer to sensor interface
 * @param  Full scale
 * @retval Error code
 */
-int8_t ITDS_setFullScale(ITDS_full_Scale fullScale_t)
+int8_t ITDS_setFullScale(WE_sensorInterface_t *sensorInterface, ITDS_full_Scale fullScale_t)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	ctrl_reg_6.fullScale = fullScale_t;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1240,14 +1332,15 @@ int8_t ITDS_setFullScale(ITDS_full_Scale fullScale_t)
 
 /**
 * @brief  Read the Full scale
+* @param  Pointer to sensor interface
 * @param  Pointer to the Full scale.
 * @retval Error code
 */
-int8_t ITDS_getFullScale(ITDS_full_Scale *fullScale_t)
+int8_t ITDS_getFullScale(WE_sensorInterface_t *sensorInterface, ITDS_full_Scale *fullScale_t)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	*fullScale_t=(ITDS_full_Scale)(ctrl_reg_6.fullScale);
@@ -1256,19 +1349,20 @@ int8_t ITDS_getFullScale(ITDS_full_Scale *fullScale_t)
 
 /**
 * @brief  set the Filtered data type [low-pass filter/High-pass filter]
+* @param  Pointer to sensor interface
 * @param  pass filter Type
 * @retval Error code
 */
-int8_t ITDS_setfilterPath(ITDS_filter_Type filterType)
+int8_t ITDS_setfilterPath(WE_sensorInterface_t *sensorInterface, ITDS_filter_Type filterType)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	ctrl_reg_6.filterPath = filterType;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1276,14 +1370,15 @@ int8_t ITDS_setfilterPath(ITDS_filter_Type filterType)
 
 /**
 * @brief  Read the pass filter Type
+* @param  Pointer to sensor interface
 * @param  Pointer to the pass filter Type  .
 * @retval Error code
 */
-int8_t ITDS_getfilterPath(ITDS_filter_Type *filterType)
+int8_t ITDS_getfilterPath(WE_sensorInterface_t *sensorInterface, ITDS_filter_Type *filterType)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	*filterType=(ITDS_filter_Type)((ctrl_reg_6.filterPath));
@@ -1293,19 +1388,20 @@ int8_t ITDS_getfilterPath(ITDS_filter_Type *filterType)
 
 /**
 * @brief  enable low noise configuration
+* @param  Pointer to sensor interface
 * @param  low noise state
 * @retval Error code
 */
-int8_t ITDS_enLowNoise(ITDS_state_t lowNoise)
+int8_t ITDS_enLowNoise(WE_sensorInterface_t *sensorInterface, ITDS_state_t lowNoise)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	ctrl_reg_6.enLowNoise = lowNoise;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1313,14 +1409,15 @@ int8_t ITDS_enLowNoise(ITDS_state_t lowNoise)
 
 /**
 * @brief  Read the low noise configuration state
+* @param  Pointer to sensor interface
 * @param  Pointer to the low noise configuration state
 * @retval Error code
 */
-int8_t ITDS_getLowNoiseState(ITDS_state_t *lowNoise)
+int8_t ITDS_getLowNoiseState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *lowNoise)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	*lowNoise = (ITDS_state_t)(ctrl_reg_6.enLowNoise);
@@ -1333,14 +1430,15 @@ int8_t ITDS_getLowNoiseState(ITDS_state_t *lowNoise)
 
 /**
 * @brief  Read the Data-ready state
+* @param  Pointer to sensor interface
 * @param  Pointer to the Data-ready state.
 * @retval Error code
 */
-int8_t ITDS_getdataReadyState(ITDS_state_t *drdy)
+int8_t ITDS_getdataReadyState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *drdy)
 {
 	ITDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*drdy = (ITDS_state_t)(status_reg.dataReady);
@@ -1349,13 +1447,14 @@ int8_t ITDS_getdataReadyState(ITDS_state_t *drdy)
 
 /**
 * @brief  Read the Free-fall event state   [not detected/detected]
+* @param  Pointer to sensor interface
 * @param  Pointer to the Free-fall event state.
 * @retval Error code
 */
-int8_t ITDS_getfreeFallState(ITDS_state_t *freeFall)
+int8_t ITDS_getfreeFallState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *freeFall)
 {
 	ITDS_status_t status_reg;
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*freeFall = (ITDS_state_t)(status_reg.freeFall);
@@ -1364,14 +1463,15 @@ int8_t ITDS_getfreeFallState(ITDS_state_t *freeFall)
 
 /**
 * @brief  Read the 6D change in position state   [not detected/detected]
+* @param  Pointer to sensor interface
 * @param  Pointer to the 6D change in position state.
 * @retval Error code
 */
-int8_t ITDS_get6DState(ITDS_state_t *sixD)
+int8_t ITDS_get6DState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *sixD)
 {
 	ITDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*sixD = (ITDS_state_t)(status_reg.sixDDetection );
@@ -1380,14 +1480,15 @@ int8_t ITDS_get6DState(ITDS_state_t *sixD)
 
 /**
 * @brief  Read the Single-tap event state   [not detected/detected]
+* @param  Pointer to sensor interface
 * @param  Pointer to the single-tap event state.
 * @retval Error code
 */
-int8_t ITDS_getsingleTapState(ITDS_state_t *singleTap)
+int8_t ITDS_getsingleTapState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *singleTap)
 {
 	ITDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*singleTap = (ITDS_state_t)(status_reg.singleTap);
@@ -1396,14 +1497,15 @@ int8_t ITDS_getsingleTapState(ITDS_state_t *singleTap)
 
 /**
 * @brief  Read the double-tap event state   [not detected/detected]
+* @param  Pointer to sensor interface
 * @param  Pointer to the double-tap event state
 * @retval Error code
 */
-int8_t ITDS_getdoubleTapState(ITDS_state_t *doubleTap)
+int8_t ITDS_getdoubleTapState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *doubleTap)
 {
 	ITDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*doubleTap = (ITDS_state_t)(status_reg.doubleTap);
@@ -1412,14 +1514,15 @@ int8_t ITDS_getdoubleTapState(ITDS_state_t *doubleTap)
 
 /**
 * @brief  Read the Sleep event state   [not detected/detected]
+* @param  Pointer to sensor interface
 * @param  Pointer to the Sleep event state.
 * @retval Error code
 */
-int8_t ITDS_getsleepState(ITDS_state_t *sleepState )
+int8_t ITDS_getsleepState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *sleepState )
 {
 	ITDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*sleepState = (ITDS_state_t)(status_reg.sleep);
@@ -1428,14 +1531,15 @@ int8_t ITDS_getsleepState(ITDS_state_t *sleepState )
 
 /**
 * @brief  Read the wakeup event state   [not detected/detected]
+* @param  Pointer to sensor interface
 * @param  Pointer to the wakeup event state.
 * @retval Error code
 */
-int8_t ITDS_getwakeupState(ITDS_state_t *wakeupState )
+int8_t ITDS_getwakeupState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *wakeupState )
 {
 	ITDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*wakeupState = (ITDS_state_t)(status_reg.wakeup);
@@ -1444,14 +1548,15 @@ int8_t ITDS_getwakeupState(ITDS_state_t *wakeupState )
 
 /**
 * @brief  Read the fifo Threshold event state   [not detected/detected]
+* @param  Pointer to sensor interface
 * @param  Pointer to the fifo Threshold event state.
 * @retval Error code
 */
-int8_t ITDS_getFifoThresholdStatus(ITDS_state_t *fifoTHR)
+int8_t ITDS_getFifoThresholdStatus(WE_sensorInterface_t *sensorInterface, ITDS_state_t *fifoTHR)
 {
 	ITDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*fifoTHR = (ITDS_state_t)(status_reg.fifoThreshold);
@@ -1462,16 +1567,17 @@ int8_t ITDS_getFifoThresholdStatus(ITDS_state_t *fifoTHR)
 
 /**
 * @brief  Read the Raw X-axis acceleration sensor output
+* @param  Pointer to sensor interface
 * @param  Pointer to the Raw X-axis acceleration
 * @retval Error code
 */
-int8_t ITDS_getRawAccelerationX(int16_t *XRawAcc)
+int8_t ITDS_getRawAccelerationX(WE_sensorInterface_t *sensorInterface, int16_t *XRawAcc)
 {
 
 	int16_t  XAxisAccelerationRaw = 0;
 	uint8_t  tmp[2] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_X_OUT_L_REG, 2, tmp))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_X_OUT_L_REG, 2, tmp))
 	return WE_FAIL;
 
 	XAxisAccelerationRaw = (int16_t)(tmp[1] << 8);
@@ -1485,16 +1591,17 @@ int8_t ITDS_getRawAccelerationX(int16_t *XRawAcc)
 
 /**
 * @brief  Read the Raw Y-axis acceleration sensor output
+* @param  Pointer to sensor interface
 * @param  Pointer to the Raw Y-axis acceleration.
 * @retval Error code
 */
-int8_t ITDS_getRawAccelerationY(int16_t *YRawAcc)
+int8_t ITDS_getRawAccelerationY(WE_sensorInterface_t *sensorInterface, int16_t *YRawAcc)
 {
 
 	int16_t  YAxisAcceleration = 0;
 	uint8_t  tmp[2] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_Y_OUT_L_REG, 2, tmp))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_Y_OUT_L_REG, 2, tmp))
 	return WE_FAIL;
 
 	YAxisAcceleration = (int16_t)(tmp[1] << 8);
@@ -1507,16 +1614,17 @@ int8_t ITDS_getRawAccelerationY(int16_t *YRawAcc)
 
 /**
 * @brief  Read the Raw Z-axis acceleration sensor output
+* @param  Pointer to sensor interface
 * @param  Pointer to the Raw Z-axis acceleration .
 * @retval Error code
 */
-int8_t ITDS_getRawAccelerationZ(int16_t *ZRawAcc)
+int8_t ITDS_getRawAccelerationZ(WE_sensorInterface_t *sensorInterface, int16_t *ZRawAcc)
 {
 
 	int16_t  ZAxisAcceleration = 0;
 	uint8_t  tmp[2] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_Z_OUT_L_REG, 2, tmp))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_Z_OUT_L_REG, 2, tmp))
 	return WE_FAIL;
 
 	ZAxisAcceleration = (int16_t)(tmp[1] << 8);
@@ -1526,18 +1634,68 @@ int8_t ITDS_getRawAccelerationZ(int16_t *ZRawAcc)
 	return WE_SUCCESS;
 }
 
+/**
+* @brief  Read the Raw X, Y and Z-axis acceleration sensor output in one transfer
+* @param  Pointer to sensor interface
+* @param  Pointer to the Raw X-axis acceleration
+* @param  Pointer to the Raw Y-axis acceleration
+* @param  Pointer to the Raw Z-axis acceleration
+* @retval Error code
+*/
+int8_t ITDS_getRawAccelerations(WE_sensorInterface_t *sensorInterface, int16_t *XRawAcc, int16_t *YRawAcc, int16_t *ZRawAcc)
+{
+	uint8_t  tmp[6] = { 0 };
+
+	/* X_OUT_L ... Z_OUT_H, the axes come from the same sample */
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_X_OUT_L_REG, 6, tmp))
+	return WE_FAIL;
+
+	*XRawAcc = (int16_t)((tmp[1] << 8) | tmp[0]);
+	*YRawAcc = (int16_t)((tmp[3] << 8) | tmp[2]);
+	*ZRawAcc = (int16_t)((tmp[5] << 8) | tmp[4]);
+
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Read the status and the Raw X, Y and Z-axis acceleration sensor output in one transfer
+* @param  Pointer to sensor interface
+* @param  Pointer to the status, its data ready bit tells if the acceleration is new
+* @param  Pointer to the Raw X-axis acceleration
+* @param  Pointer to the Raw Y-axis acceleration
+* @param  Pointer to the Raw Z-axis acceleration
+* @retval Error code
+*/
+int8_t ITDS_getStatusAndRawAccelerations(WE_sensorInterface_t *sensorInterface, ITDS_status_t *status,
+		int16_t *XRawAcc, int16_t *YRawAcc, int16_t *ZRawAcc)
+{
+	uint8_t  tmp[7] = { 0 };
+
+	/* STATUS, X_OUT_L ... Z_OUT_H */
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_STATUS_REG, 7, tmp))
+	return WE_FAIL;
+
+	*(uint8_t *)status = tmp[0];
+	*XRawAcc = (int16_t)((tmp[2] << 8) | tmp[1]);
+	*YRawAcc = (int16_t)((tmp[4] << 8) | tmp[3]);
+	*ZRawAcc = (int16_t)((tmp[6] << 8) | tmp[5]);
+
+	return WE_SUCCESS;
+}
+
 /*ITDS_T_OUT_REG*/
 /**
 * @brief  Read the 8 bit Temperature
+* @param  Pointer to sensor interface
 * @param  Pointer to the Temperature
 * @retval Error code
 */
 
-int8_t ITDS_getTemperature8bit(uint8_t *temp8bit)
+int8_t ITDS_getTemperature8bit(WE_sensorInterface_t *sensorInterface, uint8_t *temp8bit)
 {
 
 	uint8_t temperatureValue8bit;
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_T_OUT_REG, 1, &temperatureValue8bit))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_T_OUT_REG, 1, &temperatureValue8bit))
 	return WE_FAIL;
 
 	*temp8bit = temperatureValue8bit;
@@ -1546,21 +1704,20 @@ int8_t ITDS_getTemperature8bit(uint8_t *temp8bit)
 
 /**
 * @brief  Read the 12 bit Temperature
+* @param  Pointer to sensor interface
 * @param  Pointer to the Temperature
 * @retval Error code
 */
-int8_t  ITDS_getRawTemp12bit(int16_t *temp12bit)
+int8_t  ITDS_getRawTemp12bit(WE_sensorInterface_t *sensorInterface, int16_t *temp12bit)
 {
 
 	uint8_t temp[2] = {0};
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_T_OUT_L_REG, 1, temp))
-	return WE_FAIL;
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_T_OUT_H_REG, 1, temp + 1))
+	/* T_OUT_L ... T_OUT_H, both bytes come from the same sample */
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_T_OUT_L_REG, 2, temp))
 	return WE_FAIL;
 
-	*temp12bit = (int16_t) (temp[1] << 8);
-	*temp12bit |= (int16_t) temp[0];
+	*temp12bit = (int16_t)((temp[1] << 8) | temp[0]);
 
 	*temp12bit = (*temp12bit) >> 4;
 
@@ -1569,13 +1726,14 @@ int8_t  ITDS_getRawTemp12bit(int16_t *temp12bit)
 
 /**
 * @brief  Read the 12 bit Temperature in °C
+* @param  Pointer to sensor interface
 * @param  Pointer to the Temperature
 * @retval Error code
 */
-int8_t  ITDS_getTemperature12bit(float *tempdegC)
+int8_t  ITDS_getTemperature12bit(WE_sensorInterface_t *sensorInterface, float *tempdegC)
 {
 	int16_t rawTemp = 0;
-	if(ITDS_getRawTemp12bit(&rawTemp) == WE_SUCCESS)
+	if(ITDS_getRawTemp12bit(sensorInterface, &rawTemp) == WE_SUCCESS)
 	{
 		*tempdegC = (((float) rawTemp)/16.0) + 25.0;
 	}
@@ -1586,22 +1744,50 @@ int8_t  ITDS_getTemperature12bit(float *tempdegC)
 	return WE_SUCCESS;
 }
 
+/**
+* @brief  Read the 12 bit Temperature without floating point
+* @param  Pointer to sensor interface
+* @param  Pointer to the Temperature in 0.01 °C
+* @retval Error code
+*/
+int8_t  ITDS_getTemperature12bit_int(WE_sensorInterface_t *sensorInterface, int16_t *tempCentiDegC)
+{
+	int16_t rawTemp = 0;
+	if (WE_FAIL == ITDS_getRawTemp12bit(sensorInterface, &rawTemp))
+	return WE_FAIL;
+
+	*tempCentiDegC = ITDS_convertTemperature12bit_int(rawTemp);
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Convert the raw 12 bit Temperature to 0.01 °C without floating point
+* @param  Raw 12 bit Temperature (16 LSB/°C, 0 at 25 °C)
+* @retval Temperature in 0.01 °C, rounded
+*/
+int16_t ITDS_convertTemperature12bit_int(int16_t temp12bit)
+{
+	/* 100/16 = 25/4, +2 rounds to nearest */
+	return (int16_t)(2500 + ((((int32_t)temp12bit * 25) + 2) >> 2));
+}
+
 /*FIFO_CTRL (0x2E)*/
 /**
 * @brief  set the Fifo Threshold of the sensor
+* @param  Pointer to sensor interface
 * @param  Fifo Threshold
 * @retval Error code
 */
-int8_t ITDS_setFifoThreshold(uint8_t fifo_Threshold)
+int8_t ITDS_setFifoThreshold(WE_sensorInterface_t *sensorInterface, uint8_t fifo_Threshold)
 {
 	ITDS_fifo_ctrl_t fifo_ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	fifo_ctrl_reg.fifoThresholdLevel = fifo_Threshold;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1609,14 +1795,15 @@ int8_t ITDS_setFifoThreshold(uint8_t fifo_Threshold)
 
 /**
 * @brief  Read the Fifo Threshold
+* @param  Pointer to sensor interface
 * @param  Pointer to the Fifo Threshold
 * @retval Error code
 */
-int8_t ITDS_getFifoThreshold(uint8_t *fifo_Threshold)
+int8_t ITDS_getFifoThreshold(WE_sensorInterface_t *sensorInterface, uint8_t *fifo_Threshold)
 {
 	ITDS_fifo_ctrl_t fifo_ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	*fifo_Threshold = fifo_ctrl_reg.fifoThresholdLevel;
@@ -1625,19 +1812,20 @@ int8_t ITDS_getFifoThreshold(uint8_t *fifo_Threshold)
 
 /**
 * @brief  set the Fifo Mode
+* @param  Pointer to sensor interface
 * @param  Fifo Mode
 * @retval Error code
 */
-int8_t ITDS_setFifoMode(ITDS_Fifo_Mode FMode)
+int8_t ITDS_setFifoMode(WE_sensorInterface_t *sensorInterface, ITDS_Fifo_Mode FMode)
 {
 	ITDS_fifo_ctrl_t fifo_ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	fifo_ctrl_reg.fifoMode = FMode;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1645,14 +1833,15 @@ int8_t ITDS_setFifoMode(ITDS_Fifo_Mode FMode)
 
 /**
 * @brief  Read the Fifo Mode
+* @param  Pointer to sensor interface
 * @param  Pointer to the Fifo Mode
 * @retval Error code
 */
-int8_t ITDS_getFifoMode(ITDS_Fifo_Mode *FMode)
+int8_t ITDS_getFifoMode(WE_sensorInterface_t *sensorInterface, ITDS_Fifo_Mode *FMode)
 {
 	ITDS_fifo_ctrl_t fifo_ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	*FMode = (ITDS_Fifo_Mode)(fifo_ctrl_reg.fifoMode);
@@ -1665,14 +1854,15 @@ int8_t ITDS_getFifoMode(ITDS_Fifo_Mode *FMode)
 
 /**
 * @brief  Read the FIFO threshold state  [FIFO filling is lower than threshold level/FIFO filling is equal to or higher than the threshold level]
+* @param  Pointer to sensor interface
 * @param  Pointer to the FIFO threshold state
 * @retval Error code
 */
-int8_t ITDS_getFifoThresholdState(ITDS_state_t *fifoTHR)
+int8_t ITDS_getFifoThresholdState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *fifoTHR)
 {
 	ITDS_fifo_samples_t fifo_samples_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FIFO_SAMPLES_REG, 1, (uint8_t *)&fifo_samples_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_FIFO_SAMPLES_REG, 1, (uint8_t *)&fifo_samples_reg))
 	return WE_FAIL;
 
 	*fifoTHR = (ITDS_state_t)(fifo_samples_reg.fifoThresholdState);
@@ -1681,14 +1871,15 @@ int8_t ITDS_getFifoThresholdState(ITDS_state_t *fifoTHR)
 
 /**
 * @brief  Read the FIFO overrun state  [FIFO is not completely filled,/FIFO completely filled and at least one sample has been overwritten]
+* @param  Pointer to sensor interface
 * @param  Pointer to the FIFO overrun state .
 * @retval Error code
 */
-int8_t ITDS_getFifoOverrunState(ITDS_state_t *fifoOverrun)
+int8_t ITDS_getFifoOverrunState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *fifoOverrun)
 {
 	ITDS_fifo_samples_t fifo_samples_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FIFO_SAMPLES_REG, 1, (uint8_t *)&fifo_samples_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_FIFO_SAMPLES_REG, 1, (uint8_t *)&fifo_samples_reg))
 	return WE_FAIL;
 
 	*fifoOverrun = (ITDS_state_t)(fifo_samples_reg.fifoOverrunState);
@@ -1697,38 +1888,91 @@ int8_t ITDS_getFifoOverrunState(ITDS_state_t *fifoOverrun)
 
 /**
 * @brief  Read the FIFO Fill Level
+* @param  Pointer to sensor interface
 * @param  pointer to the FIFO Fill Level
 * @retval Error code
 */
-int8_t ITDS_getFifoFillLevel(uint8_t *fifoFill)
+int8_t ITDS_getFifoFillLevel(WE_sensorInterface_t *sensorInterface, uint8_t *fifoFill)
 {
 	ITDS_fifo_samples_t fifo_samples_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FIFO_SAMPLES_REG, 1, (uint8_t *)&fifo_samples_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_FIFO_SAMPLES_REG, 1, (uint8_t *)&fifo_samples_reg))
 	return WE_FAIL;
 
 	*fifoFill = (fifo_samples_reg.fifoFillLevel);
 	return WE_SUCCESS;
 }
 
+/**
+* @brief  Read fill level, overrun and threshold state of the FIFO in one access
+* @param  Pointer to sensor interface
+* @param  pointer to the FIFO status
+* @retval Error code
+*/
+int8_t ITDS_getFifoStatus(WE_sensorInterface_t *sensorInterface, ITDS_fifo_samples_t *fifoStatus)
+{
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_FIFO_SAMPLES_REG, 1, (uint8_t *)fifoStatus))
+	return WE_FAIL;
+
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Read samples from the FIFO, as many per transfer as fit into WE_MAX_READ_LENGTH
+* @param  Pointer to sensor interface
+* @param  Number of samples to read, at most the FIFO fill level
+* @param  Raw X, Y and Z-axis acceleration of each sample
+* @retval Error code
+*/
+int8_t ITDS_getRawFifoSamples(WE_sensorInterface_t *sensorInterface, uint8_t numSamples, int16_t samples[][3])
+{
+	uint8_t  tmp[ITDS_FIFO_SAMPLES_PER_READ * 6];
+	uint8_t  done = 0;
+
+	while (done < numSamples)
+	{
+		uint8_t count = numSamples - done;
+		if (count > ITDS_FIFO_SAMPLES_PER_READ)
+		{
+			count = ITDS_FIFO_SAMPLES_PER_READ;
+		}
+
+		/* the register address rolls over from Z_OUT_H to X_OUT_L while the FIFO is on,
+		   every 6 bytes pop one sample */
+		if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_X_OUT_L_REG, count * 6, tmp))
+		return WE_FAIL;
+
+		for (uint8_t i = 0; i < count; i++)
+		{
+			samples[done + i][0] = (int16_t)((tmp[i * 6 + 1] << 8) | tmp[i * 6]);
+			samples[done + i][1] = (int16_t)((tmp[i * 6 + 3] << 8) | tmp[i * 6 + 2]);
+			samples[done + i][2] = (int16_t)((tmp[i * 6 + 5] << 8) | tmp[i * 6 + 4]);
+		}
+		done += count;
+	}
+
+	return WE_SUCCESS;
+}
+
 
 /*TAP_X_TH (0x30)*/
 
 /**
 * @brief  enable the 4D detection position
+* @param  Pointer to sensor interface
 * @param  the 4D detection position state
 * @retval Error code
 */
-int8_t ITDS_en4DDetection(ITDS_state_t detection4D)
+int8_t ITDS_en4DDetection(WE_sensorInterface_t *sensorInterface, ITDS_state_t detection4D)
 {
 	ITDS_tap_x_th_t tap_x_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	tap_x_th.fourDPositionState = detection4D;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1736,14 +1980,15 @@ int8_t ITDS_en4DDetection(ITDS_state_t detection4D)
 
 /**
 * @brief  Read the 4D detection position state
+* @param  Pointer to sensor interface
 * @param  Pointer to the 4D detection position state.
 * @retval Error code
 */
-int8_t ITDS_get4DDetectionState(ITDS_state_t *detection4D)
+int8_t ITDS_get4DDetectionState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *detection4D)
 {
 	ITDS_tap_x_th_t tap_x_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	*detection4D = (ITDS_state_t)(tap_x_th.fourDPositionState);
@@ -1752,19 +1997,20 @@ int8_t ITDS_get4DDetectionState(ITDS_state_t *detection4D)
 
 /**
 * @brief  set the TAP Threshold on X Axis
+* @param  Pointer to sensor interface
 * @param  Tap Threshold X axis
 * @retval Error code
 */
-int8_t ITDS_setTapThresholdX(uint8_t tapThresholdX)
+int8_t ITDS_setTapThresholdX(WE_sensorInterface_t *sensorInterface, uint8_t tapThresholdX)
 {
 	ITDS_tap_x_th_t tap_x_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	tap_x_th.XAxisTapThreshold = tapThresholdX;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1772,14 +2018,15 @@ int8_t ITDS_setTapThresholdX(uint8_t tapThresholdX)
 
 /**
 * @brief  Read the Tap Threshold X axis
+* @param  Pointer to sensor interface
 * @param  Pointer to the Tap Threshold X axis
 * @retval Error code
 */
-int8_t ITDS_getTapThresholdX(uint8_t *tapThresholdX)
+int8_t ITDS_getTapThresholdX(WE_sensorInterface_t *sensorInterface, uint8_t *tapThresholdX)
 {
 	ITDS_tap_x_th_t tap_x_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	*tapThresholdX = (ITDS_state_t)(tap_x_th.XAxisTapThreshold);
@@ -1788,19 +2035,20 @@ int8_t ITDS_getTapThresholdX(uint8_t *tapThresholdX)
 
 /**
 * @brief  set the 6D Threshold (degrees)
+* @param  Pointer to sensor interface
 * @param  6D Threshold (degrees)
 * @retval Error code
 */
-int8_t ITDS_set6DThreshold(ITDS_threshold_Degree threshold6D)
+int8_t ITDS_set6DThreshold(WE_sensorInterface_t *sensorInterface, ITDS_threshold_Degree threshold6D)
 {
 	ITDS_tap_x_th_t tap_x_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	tap_x_th.sixDThreshold = threshold6D;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1808,14 +2056,15 @@ int8_t ITDS_set6DThreshold(ITDS_threshold_Degree threshold6D)
 
 /**
 * @brief  Read the 6D Threshold   (degrees)
+* @param  Pointer to sensor interface
 * @param  Pointer to the 6D Threshold
 * @retval Error code
 */
-int8_t ITDS_get6DThreshold(ITDS_threshold_Degree *threshold6D)
+int8_t ITDS_get6DThreshold(WE_sensorInterface_t *sensorInterface, ITDS_threshold_Degree *threshold6D)
 {
 	ITDS_tap_x_th_t tap_x_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	*threshold6D = (ITDS_threshold_Degree)(tap_x_th.sixDThreshold);
@@ -1827,19 +2076,20 @@ int8_t ITDS_get6DThreshold(ITDS_threshold_Degree *threshold6D)
 
 /**
 * @brief  set the TAP Threshold on Y Axis
+* @param  Pointer to sensor interface
 * @param  Tap Threshold Y axis
 * @retval Error code
 */
-int8_t ITDS_setTapThresholdY(uint8_t tapThresholdY)
+int8_t ITDS_setTapThresholdY(WE_sensorInterface_t *sensorInterface, uint8_t tapThresholdY)
 {
 	ITDS_tap_y_th_t tap_y_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
 	return WE_FAIL;
 
 	tap_y_th.YAxisTapThreshold = tapThresholdY;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1847,14 +2097,15 @@ int8_t ITDS_setTapThresholdY(uint8_t tapThresholdY)
 
 /**
 * @brief  Read the Tap Threshold Y axis
+* @param  Pointer to sensor interface
 * @param  Pointer to the Tap Threshold Y axis.
 * @retval Error code
 */
-int8_t ITDS_getTapThresholdY(uint8_t *tapThresholdY)
+int8_t ITDS_getTapThresholdY(WE_sensorInterface_t *sensorInterface, uint8_t *tapThresholdY)
 {
 	ITDS_tap_y_th_t tap_y_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
 	return WE_FAIL;
 
 	*tapThresholdY = (tap_y_th.YAxisTapThreshold);
@@ -1863,19 +2114,20 @@ int8_t ITDS_getTapThresholdY(uint8_t *tapThresholdY)
 
 /**
 * @brief  set the Axis Tap detection priority
+* @param  Pointer to sensor interface
 * @param  Axis Tap detection priority
 * @retval Error code
 */
-int8_t ITDS_setTapAxisPriority(ITDS_tap_Axis_Priority tapPriorityAxis)
+int8_t ITDS_setTapAxisPriority(WE_sensorInterface_t *sensorInterface, ITDS_tap_Axis_Priority tapPriorityAxis)
 {
 	ITDS_tap_y_th_t tap_y_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
 	return WE_FAIL;
 
 	tap_y_th.tapAxisPriority = tapPriorityAxis;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1883,14 +2135,15 @@ int8_t ITDS_setTapAxisPriority(ITDS_tap_Axis_Priority tapPriorityAxis)
 
 /**
 * @brief  Read the Axis Tap detection priority
+* @param  Pointer to sensor interface
 * @param  Pointer to the Axis Tap detection priority
 * @retval Error code
 */
-int8_t ITDS_getTapAxisPriority(ITDS_tap_Axis_Priority *tapPriorityAxis)
+int8_t ITDS_getTapAxisPriority(WE_sensorInterface_t *sensorInterface, ITDS_tap_Axis_Priority *tapPriorityAxis)
 {
 	ITDS_tap_y_th_t tap_y_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
 	return WE_FAIL;
 
 	*tapPriorityAxis = (ITDS_tap_Axis_Priority)(tap_y_th.tapAxisPriority);
@@ -1903,19 +2156,20 @@ int8_t ITDS_getTapAxisPriority(ITDS_tap_Axis_Priority *tapPriorityAxis)
 
 /**
 * @brief  set the TAP Threshold on Z Axis
+* @param  Pointer to sensor interface
 * @param  Tap Threshold Z axis
 * @retval Error code
 */
-int8_t ITDS_setTapThresholdZ(uint8_t tapThresholdZ)
+int8_t ITDS_setTapThresholdZ(WE_sensorInterface_t *sensorInterface, uint8_t tapThresholdZ)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	tap_z_th.ZAxisTapThreshold = tapThresholdZ;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1923,14 +2177,15 @@ int8_t ITDS_setTapThresholdZ(uint8_t tapThresholdZ)
 
 /**
 * @brief  Read the Tap Threshold Z axis
+* @param  Pointer to sensor interface
 * @param  Pointer to the Tap Threshold Z axis.
 * @retval Error code
 */
-int8_t ITDS_getTapThresholdZ(uint8_t *tapThresholdZ)
+int8_t ITDS_getTapThresholdZ(WE_sensorInterface_t *sensorInterface, uint8_t *tapThresholdZ)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	*tapThresholdZ = (tap_z_th.ZAxisTapThreshold);
@@ -1939,19 +2194,20 @@ int8_t ITDS_getTapThresholdZ(uint8_t *tapThresholdZ)
 
 /**
 * @brief  Enables X direction in tap recognition
+* @param  Pointer to sensor interface
 * @param  tap X direction  State
 * @retval Error code
 */
-int8_t ITDS_enTapX(ITDS_state_t tapX)
+int8_t ITDS_enTapX(WE_sensorInterface_t *sensorInterface, ITDS_state_t tapX)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	tap_z_th.enTapX = tapX;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1959,14 +2215,15 @@ int8_t ITDS_enTapX(ITDS_state_t tapX)
 
 /**
 * @brief  Read the X direction in tap recognition State
+* @param  Pointer to sensor interface
 * @param  Pointer to tap X direction  State.
 * @retval Error code
 */
-int8_t ITDS_getTapX(ITDS_state_t *tapX)
+int8_t ITDS_getTapX(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tapX)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	*tapX = (ITDS_state_t)(tap_z_th.enTapX);
@@ -1975,19 +2232,20 @@ int8_t ITDS_getTapX(ITDS_state_t *tapX)
 
 /**
 * @brief  Enables Y direction in tap recognition
+* @param  Pointer to sensor interface
 * @param  tap Y direction  State
 * @retval Error code
 */
-int8_t ITDS_enTapY(ITDS_state_t tapY)
+int8_t ITDS_enTapY(WE_sensorInterface_t *sensorInterface, ITDS_state_t tapY)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	tap_z_th.enTapY = tapY;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1995,14 +2253,15 @@ int8_t ITDS_enTapY(ITDS_state_t tapY)
 
 /**
 * @brief  Read the Y direction in tap recognition State
+* @param  Pointer to sensor interface
 * @param  Pointer to tap Y direction  State.
 * @retval Error code
 */
-int8_t ITDS_getTapY(ITDS_state_t *tapY)
+int8_t ITDS_getTapY(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tapY)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	*tapY = (ITDS_state_t)(tap_z_th.enTapY);
@@ -2013,19 +2272,20 @@ int8_t ITDS_getTapY(ITDS_state_t *tapY)
 
 /**
 * @brief  Enables the tap Z direction
+* @param  Pointer to sensor interface
 * @param  tap Z direction  State
 * @retval Error code
 */
-int8_t ITDS_enTapZ(ITDS_state_t tapZ)
+int8_t ITDS_enTapZ(WE_sensorInterface_t *sensorInterface, ITDS_state_t tapZ)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	tap_z_th.enTapZ = tapZ;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2033,14 +2293,15 @@ int8_t ITDS_enTapZ(ITDS_state_t tapZ)
 
 /**
 * @brief  Read the tap Z direction state
+* @param  Pointer to sensor interface
 * @param  Pointer to the tap Z direction state
 * @retval Error code
 */
-int8_t ITDS_getTapZ(ITDS_state_t *tapZ)
+int8_t ITDS_getTapZ(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tapZ)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	*tapZ = (ITDS_state_t)(tap_z_th.enTapZ);
@@ -2051,19 +2312,20 @@ int8_t ITDS_getTapZ(ITDS_state_t *tapZ)
 
 /**
 * @brief  set the maximum duration time gap for double-tap recognition (LATENCY)
+* @param  Pointer to sensor interface
 * @param  Latency value
 * @retval Error code
 */
-int8_t ITDS_setLatency(uint8_t latency_t)
+int8_t ITDS_setLatency(WE_sensorInterface_t *sensorInterface, uint8_t latency_t)
 {
 	ITDS_int_dur_t int_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	int_dur_t.latency = latency_t;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2071,15 +2333,16 @@ int8_t ITDS_setLatency(uint8_t latency_t)
 
 /**
 * @brief  Read the maximum duration time gap for double-tap recognition (LATENCY)
+* @param  Pointer to sensor interface
 * @param  Pointer to LATENCY .
 * @retval Error code
 */
-int8_t ITDS_getLatency(uint8_t *latency_t)
+int8_t ITDS_getLatency(WE_sensorInterface_t *sensorInterface, uint8_t *latency_t)
 {
 
 	ITDS_int_dur_t int_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	*latency_t = (ITDS_state_t)(int_dur_t.latency);
@@ -2088,19 +2351,20 @@ int8_t ITDS_getLatency(uint8_t *latency_t)
 
 /**
 * @brief  set the expected quiet time after a tap detection (QUIET)
+* @param  Pointer to sensor interface
 * @param  quiet time value
 * @retval Error code
 */
-int8_t ITDS_setQuiet(uint8_t quiet_t)
+int8_t ITDS_setQuiet(WE_sensorInterface_t *sensorInterface, uint8_t quiet_t)
 {
 	ITDS_int_dur_t int_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	int_dur_t.quiet = quiet_t;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2108,15 +2372,16 @@ int8_t ITDS_setQuiet(uint8_t quiet_t)
 
 /**
 * @brief  Read the expected quiet time after a tap detection (QUIET)
+* @param  Pointer to sensor interface
 * @param  Pointer to  QUIET
 * @retval Error code
 */
-int8_t ITDS_getQuiet(uint8_t *quiet_t)
+int8_t ITDS_getQuiet(WE_sensorInterface_t *sensorInterface, uint8_t *quiet_t)
 {
 
 	ITDS_int_dur_t int_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	*quiet_t = (ITDS_state_t)(int_dur_t.quiet);
@@ -2125,19 +2390,20 @@ int8_t ITDS_getQuiet(uint8_t *quiet_t)
 
 /**
 * @brief  set the maximum duration of over-threshold event (SHOCK)
+* @param  Pointer to sensor interface
 * @param  SHOCK time value
 * @retval Error code
 */
-int8_t ITDS_setShock(uint8_t shock_t)
+int8_t ITDS_setShock(WE_sensorInterface_t *sensorInterface, uint8_t shock_t)
 {
 	ITDS_int_dur_t int_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	int_dur_t.shock = shock_t;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2145,15 +2411,16 @@ int8_t ITDS_setShock(uint8_t shock_t)
 
 /**
 * @brief  Read the maximum duration of over-threshold event (SHOCK)
+* @param  Pointer to sensor interface
 * @param  Pointer to SHOCK .
 * @retval Error code
 */
-int8_t ITDS_getShock(uint8_t *shock_t)
+int8_t ITDS_getShock(WE_sensorInterface_t *sensorInterface, uint8_t *shock_t)
 {
 
 	ITDS_int_dur_t int_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	*shock_t = (ITDS_state_t)(int_dur_t.shock);
@@ -2165,19 +2432,20 @@ int8_t ITDS_getShock(uint8_t *shock_t)
 
 /**
 * @brief  Enable the single und double-tap event OR only Single-tap event [0:only single, 1:single and double-tap]
+* @param  Pointer to sensor interface
 * @param  tap event State [0:only single, 1: single and double-tap]
 * @retval Error code
 */
-int8_t ITDS_enTapEvent(ITDS_state_t singleDoubleTap)
+int8_t ITDS_enTapEvent(WE_sensorInterface_t *sensorInterface, ITDS_state_t singleDoubleTap)
 {
 	ITDS_wake_up_th_t wake_up_th_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	wake_up_th_t.enTapEvent = singleDoubleTap;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2185,14 +2453,15 @@ int8_t ITDS_enTapEvent(ITDS_state_t singleDoubleTap)
 
 /**
 * @brief  Read the tap event State [0:only single, 1: single and double-tap]
+* @param  Pointer to sensor interface
 * @param  Pointer to the tap event State
 * @retval Error code
 */
-int8_t ITDS_getTapEvent(ITDS_state_t *singleDoubleTap)
+int8_t ITDS_getTapEvent(WE_sensorInterface_t *sensorInterface, ITDS_state_t *singleDoubleTap)
 {
 	ITDS_wake_up_th_t wake_up_th_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	*singleDoubleTap = (ITDS_state_t)(wake_up_th_t.enTapEvent);
@@ -2201,19 +2470,20 @@ int8_t ITDS_getTapEvent(ITDS_state_t *singleDoubleTap)
 
 /**
 * @brief  Enable inactivity(sleep)
+* @param  Pointer to sensor interface
 * @param  sleep state
 * @retval Error code
 */
-int8_t ITDS_enInactivity(ITDS_state_t sleep)
+int8_t ITDS_enInactivity(WE_sensorInterface_t *sensorInterface, ITDS_state_t sleep)
 {
 	ITDS_wake_up_th_t wake_up_th_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	wake_up_th_t.enInactivtyEvent = sleep;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2221,14 +2491,15 @@ int8_t ITDS_enInactivity(ITDS_state_t sleep)
 
 /**
 * @brief  Read the inactivity(sleep) State
+* @param  Pointer to sensor interface
 * @param  Pointer to the inactivity(sleep) State .
 * @retval Error code
 */
-int8_t ITDS_getInactivityState(ITDS_state_t *sleep)
+int8_t ITDS_getInactivityState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *sleep)
 {
 	ITDS_wake_up_th_t wake_up_th_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	*sleep = (ITDS_state_t)(wake_up_th_t.enInactivtyEvent);
@@ -2237,19 +2508,20 @@ int8_t ITDS_getInactivityState(ITDS_state_t *sleep)
 
 /**
 * @brief  set Wakeup threshold
+* @param  Pointer to sensor interface
 * @param  wake up threshold
 * @retval Error code
 */
-int8_t ITDS_setWakeupThreshold(uint8_t WakeupTHR)
+int8_t ITDS_setWakeupThreshold(WE_sensorInterface_t *sensorInterface, uint8_t WakeupTHR)
 {
 	ITDS_wake_up_th_t wake_up_th_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	wake_up_th_t.wakeupThreshold = WakeupTHR;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2257,14 +2529,15 @@ int8_t ITDS_setWakeupThreshold(uint8_t WakeupTHR)
 
 /**
 * @brief  Read the Wakeup threshold
+* @param  Pointer to sensor interface
 * @param  Pointer to the Wakeup threshold.
 * @retval Error code
 */
-int8_t ITDS_getWakeupThreshold(uint8_t *WakeupTHR)
+int8_t ITDS_getWakeupThreshold(WE_sensorInterface_t *sensorInterface, uint8_t *WakeupTHR)
 {
 	ITDS_wake_up_th_t wake_up_th_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	*WakeupTHR = (wake_up_th_t.wakeupThreshold);
@@ -2276,19 +2549,20 @@ int8_t ITDS_getWakeupThreshold(uint8_t *WakeupTHR)
 
 /**
 * @brief  set Free-fall duration MSB
+* @param  Pointer to sensor interface
 * @param  Free-fall duration MSB
 * @retval Error code
 */
-int8_t ITDS_setFreeFallDurationMSB(ITDS_state_t FF_DUR5)
+int8_t ITDS_setFreeFallDurationMSB(WE_sensorInterface_t *sensorInterface, ITDS_state_t FF_DUR5)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	wake_up_dur_t.freeFallDurationMSB = FF_DUR5;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2296,14 +2570,15 @@ int8_t ITDS_setFreeFallDurationMSB(ITDS_state_t FF_DUR5)
 
 /**
 * @brief  Read the Free-fall duration MSB
+* @param  Pointer to sensor interface
 * @param  Pointer to the Free-fall duration MSB .
 * @retval Error code
 */
-int8_t ITDS_getFreeFallDurationMSB(ITDS_state_t *FF_DUR5)
+int8_t ITDS_getFreeFallDurationMSB(WE_sensorInterface_t *sensorInterface, ITDS_state_t *FF_DUR5)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	*FF_DUR5=(ITDS_state_t)(wake_up_dur_t.freeFallDurationMSB);
@@ -2312,19 +2587,20 @@ int8_t ITDS_getFreeFallDurationMSB(ITDS_state_t *FF_DUR5)
 
 /**
 * @brief  Enable stationary detection
+* @param  Pointer to sensor interface
 * @param  State
 * @retval Error code
 */
-int8_t ITDS_enStationnaryDetection(ITDS_state_t stationary)
+int8_t ITDS_enStationnaryDetection(WE_sensorInterface_t *sensorInterface, ITDS_state_t stationary)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	wake_up_dur_t.enStationary = stationary;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2332,14 +2608,15 @@ int8_t ITDS_enStationnaryDetection(ITDS_state_t stationary)
 
 /**
 * @brief  Read the stationary detection state
+* @param  Pointer to sensor interface
 * @param  Pointer to the stationary detection state
 * @retval Error code
 */
-int8_t ITDS_getStationnaryState(ITDS_state_t *stationary)
+int8_t ITDS_getStationnaryState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *stationary)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	*stationary = (ITDS_state_t)(wake_up_dur_t.enStationary);
@@ -2348,19 +2625,20 @@ int8_t ITDS_getStationnaryState(ITDS_state_t *stationary)
 
 /**
 * @brief  set Wakeup duration
+* @param  Pointer to sensor interface
 * @param  Wakeup duration
 * @retval Error code
 */
-int8_t ITDS_setWakeupDuration(uint8_t wakeDUR)
+int8_t ITDS_setWakeupDuration(WE_sensorInterface_t *sensorInterface, uint8_t wakeDUR)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	wake_up_dur_t.wakeupDuration = wakeDUR;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2368,14 +2646,15 @@ int8_t ITDS_setWakeupDuration(uint8_t wakeDUR)
 
 /**
 * @brief  Read the Wakeup duration
+* @param  Pointer to sensor interface
 * @param  Pointer to the Wakeup duration
 * @retval Error code
 */
-int8_t ITDS_getWakeupDuration(uint8_t *wakeDUR)
+int8_t ITDS_getWakeupDuration(WE_sensorInterface_t *sensorInterface, uint8_t *wakeDUR)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	*wakeDUR=(wake_up_dur_t.wakeupDuration);
@@ -2384,19 +2663,20 @@ int8_t ITDS_getWakeupDuration(uint8_t *wakeDUR)
 
 /**
 * @brief  set the Sleep Mode Duration
+* @param  Pointer to sensor interface
 * @param  Sleep Mode Duration
 * @retval Error code
 */
-int8_t ITDS_setSleepDuration(uint8_t sleepDur)
+int8_t ITDS_setSleepDuration(WE_sensorInterface_t *sensorInterface, uint8_t sleepDur)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	wake_up_dur_t.sleepDuration = sleepDur;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2404,14 +2684,15 @@ int8_t ITDS_setSleepDuration(uint8_t sleepDur)
 
 /**
 * @brief  Read the Sleep Mode Duration
+* @param  Pointer to sensor interface
 * @param  Pointer to the Sleep Mode Duration
 * @retval Error code
 */
-int8_t ITDS_getSleepDuration(uint8_t *sleepDur)
+int8_t ITDS_getSleepDuration(WE_sensorInterface_t *sensorInterface, uint8_t *sleepDur)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	*sleepDur = (wake_up_dur_t.sleepDuration);
@@ -2424,19 +2705,20 @@ int8_t ITDS_getSleepDuration(uint8_t *sleepDur)
 
 /**
 * @brief  set Free-fall duration LSB
+* @param  Pointer to sensor interface
 * @param  Free-fall duration LSB
 * @retval Error code
 */
-int8_t ITDS_setFreeFallDurationLSB(uint8_t FF_DURLSB)
+int8_t ITDS_setFreeFallDurationLSB(WE_sensorInterface_t *sensorInterface, uint8_t FF_DURLSB)
 {
 	ITDS_free_fall_t free_fall_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
 	return WE_FAIL;
 
 	free_fall_t.freeFallDurationLSB = FF_DURLSB;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2444,14 +2726,15 @@ int8_t ITDS_setFreeFallDurationLSB(uint8_t FF_DURLSB)
 
 /**
 * @brief  Read the Free-fall duration LSB
+* @param  Pointer to sensor interface
 * @param  Pointer to the Free-fall duration LSB
 * @retval Error code
 */
-int8_t ITDS_getFreeFallDurationLSB(uint8_t *FF_DURLSB)
+int8_t ITDS_getFreeFallDurationLSB(WE_sensorInterface_t *sensorInterface, uint8_t *FF_DURLSB)
 {
 	ITDS_free_fall_t free_fall_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
 	return WE_FAIL;
 
 	*FF_DURLSB = (free_fall_t.freeFallDurationLSB);
@@ -2460,19 +2743,20 @@ int8_t ITDS_getFreeFallDurationLSB(uint8_t *FF_DURLSB)
 
 /**
 * @brief  set Free-fall Threshold
+* @param  Pointer to sensor interface
 * @param  Free-fall Threshold Decoding
 * @retval Error code
 */
-int8_t ITDS_setFreeFallThreshold(ITDS_Free_Fall_Thr FF_TH)
+int8_t ITDS_setFreeFallThreshold(WE_sensorInterface_t *sensorInterface, ITDS_Free_Fall_Thr FF_TH)
 {
 	ITDS_free_fall_t free_fall_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
 	return WE_FAIL;
 
 	free_fall_t.freeFallThreshold = FF_TH;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2480,34 +2764,87 @@ int8_t ITDS_setFreeFallThreshold(ITDS_Free_Fall_Thr FF_TH)
 
 /**
 * @brief  Read the Free-fall Threshold decoding
+* @param  Pointer to sensor interface
 * @param  Pointer to the Free-fall Threshold decoding
 * @retval Error code
 */
-int8_t ITDS_getFreeFallThreshold(ITDS_Free_Fall_Thr *FF_TH)
+int8_t ITDS_getFreeFallThreshold(WE_sensorInterface_t *sensorInterface, ITDS_Free_Fall_Thr *FF_TH)
 {
 	ITDS_free_fall_t free_fall_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
 	return WE_FAIL;
 
 	*FF_TH = (ITDS_Free_Fall_Thr)(free_fall_t.freeFallThreshold);
 	return WE_SUCCESS;
 }
 
+/* TAP_X_TH ... FREE_FALL */
+
+/**
+* @brief  Set tap, wake-up, free-fall and 6D detection in one transfer. The profile defines
+*         all bits of TAP_X_TH ... FREE_FALL, no register is read.
+* @param  Pointer to sensor interface
+* @param  Pointer to the detection profile
+* @retval Error code, WE_FAIL also if a value is out of range
+*/
+int8_t ITDS_setDetectionProfile(WE_sensorInterface_t *sensorInterface, const ITDS_detection_Profile_t *profile)
+{
+	uint8_t data[7] = { 0 };
+	ITDS_tap_x_th_t *tap_x_th = (ITDS_tap_x_th_t *)&data[0];
+	ITDS_tap_y_th_t *tap_y_th = (ITDS_tap_y_th_t *)&data[1];
+	ITDS_tap_z_th_t *tap_z_th = (ITDS_tap_z_th_t *)&data[2];
+	ITDS_int_dur_t *int_dur = (ITDS_int_dur_t *)&data[3];
+	ITDS_wake_up_th_t *wake_up_th = (ITDS_wake_up_th_t *)&data[4];
+	ITDS_wake_up_dur_t *wake_up_dur = (ITDS_wake_up_dur_t *)&data[5];
+	ITDS_free_fall_t *free_fall = (ITDS_free_fall_t *)&data[6];
+
+	if (!ITDS_DETECTION_PROFILE_VALID(*profile))
+	return WE_FAIL;
+
+	tap_x_th->XAxisTapThreshold = profile->tap.thresholdX;
+	tap_x_th->sixDThreshold = profile->sixDThreshold;
+	tap_x_th->fourDPositionState = profile->fourD;
+	tap_y_th->YAxisTapThreshold = profile->tap.thresholdY;
+	tap_y_th->tapAxisPriority = profile->tap.axisPriority;
+	tap_z_th->ZAxisTapThreshold = profile->tap.thresholdZ;
+	tap_z_th->enTapX = profile->tap.enX;
+	tap_z_th->enTapY = profile->tap.enY;
+	tap_z_th->enTapZ = profile->tap.enZ;
+	int_dur->shock = profile->tap.shock;
+	int_dur->quiet = profile->tap.quiet;
+	int_dur->latency = profile->tap.latency;
+	wake_up_th->wakeupThreshold = profile->wakeUp.threshold;
+	wake_up_th->enInactivtyEvent = profile->wakeUp.sleep;
+	wake_up_th->enTapEvent = profile->tap.doubleTap;
+	wake_up_dur->sleepDuration = profile->wakeUp.sleepDuration;
+	wake_up_dur->enStationary = profile->wakeUp.stationary;
+	wake_up_dur->wakeupDuration = profile->wakeUp.duration;
+	wake_up_dur->freeFallDurationMSB = profile->freeFall.duration >> 5;
+	free_fall->freeFallThreshold = profile->freeFall.threshold;
+	free_fall->freeFallDurationLSB = profile->freeFall.duration & 0x1F;
+
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_TAP_X_TH_REG, 7, data))
+	return WE_FAIL;
+
+	return WE_SUCCESS;
+}
+
 
 /* STATUS_DETECT */
 
 
 /**
 * @brief  Read the temperature data state
+* @param  Pointer to sensor interface
 * @param  Pointer to the temperature data state
 * @retval Error code
 */
-int8_t ITDS_getTempDrdy(ITDS_state_t *tempDrdy )
+int8_t ITDS_getTempDrdy(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tempDrdy )
 {
 	ITDS_status_detect_t status_detect_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
 	return WE_FAIL;
 
 	*tempDrdy = (ITDS_state_t)(status_detect_t.tempDrdy);
@@ -2516,14 +2853,15 @@ int8_t ITDS_getTempDrdy(ITDS_state_t *tempDrdy )
 
 /**
 * @brief  Read the Sleep event data state
+* @param  Pointer to sensor interface
 * @param  Pointer to the Sleep event data state
 * @retval Error code
 */
-int8_t ITDS_getSleepState(ITDS_state_t *sleepState)
+int8_t ITDS_getSleepState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *sleepState)
 {
 	ITDS_status_detect_t status_detect_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
 	return WE_FAIL;
 
 	*sleepState = (ITDS_state_t)(status_detect_t.sleepState);
@@ -2532,14 +2870,15 @@ int8_t ITDS_getSleepState(ITDS_state_t *sleepState)
 
 /**
 * @brief  Read the double Tap Event State
+* @param  Pointer to sensor interface
 * @param  Pointer to the double Tap Event State
 * @retval Error code
 */
-int8_t ITDS_getDoubleTapState(ITDS_state_t *doubleTap)
+int8_t ITDS_getDoubleTapState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *doubleTap)
 {
 	ITDS_status_detect_t status_detect_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
 	return WE_FAIL;
 
 	*doubleTap = (ITDS_state_t)(status_detect_t.doubleTapState);
@@ -2548,14 +2887,15 @@ int8_t ITDS_getDoubleTapState(ITDS_state_t *doubleTap)
 
 /**
 * @brief  Read the single Tap Event State
+* @param  Pointer to sensor interface
 * @param  Pointer to the single Tap Event State
 * @retval Error code
 */
-int8_t ITDS_getSingleTapState(ITDS_state_t *singleTap)
+int8_t ITDS_getSingleTapState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *singleTap)
 {
 	ITDS_status_detect_t status_detect_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
 	return WE_FAIL;
 
 	*singleTap=(ITDS_state_t)(status_detect_t.singleTapState);
@@ -2564,14 +2904,15 @@ int8_t ITDS_getSingleTapState(ITDS_state_t *singleTap)
 
 /**
 * @brief  Read the temperature data state
+* @param  Pointer to sensor interface
 * @param  Pointer to the temperature data state
 * @retval Error code
 */
-int8_t ITDS_getDrdy(ITDS_state_t *drdy)
+int8_t ITDS_getDrdy(WE_sensorInterface_t *sensorInterface, ITDS_state_t *drdy)
 {
 	ITDS_status_detect_t status_detect_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
 	return WE_FAIL;
 
 	*drdy = (ITDS_state_t)(status_detect_t.drdy);
@@ -2584,14 +2925,15 @@ int8_t ITDS_getDrdy(ITDS_state_t *drdy)
 
 /**
 * @brief  Read the Wake-up Event detection Status On X Axis
+* @param  Pointer to sensor interface
 * @param  pointer to the Wake-up Event detection Status On X Axis
 * @retval Error code
 */
-int8_t ITDS_getWakeupX(ITDS_state_t *wakeUpX)
+int8_t ITDS_getWakeupX(WE_sensorInterface_t *sensorInterface, ITDS_state_t *wakeUpX)
 {
 	ITDS_wake_up_event_t wake_up_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
 	return WE_FAIL;
 
 	*wakeUpX = (ITDS_state_t)(wake_up_event_t.wakeUpX);
@@ -2600,14 +2942,15 @@ int8_t ITDS_getWakeupX(ITDS_state_t *wakeUpX)
 
 /**
 * @brief  Read the Wake-up Event detection Status On Y Axis
+* @param  Pointer to sensor interface
 * @param  pointer to the Wake-up Event detection Status On Y Axis.
 * @retval Error code
 */
-int8_t ITDS_getWakeupY(ITDS_state_t *wakeUpY)
+int8_t ITDS_getWakeupY(WE_sensorInterface_t *sensorInterface, ITDS_state_t *wakeUpY)
 {
 	ITDS_wake_up_event_t wake_up_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
 	return WE_FAIL;
 
 	*wakeUpY = (ITDS_state_t)(wake_up_event_t.wakeUpY);
@@ -2616,14 +2959,15 @@ int8_t ITDS_getWakeupY(ITDS_state_t *wakeUpY)
 
 /**
 * @brief  Read the Wake-up Event detection Status On Z Axis
+* @param  Pointer to sensor interface
 * @param  pointer to the Wake-up Event detection Status On Z Axis.
 * @retval Error code
 */
-int8_t ITDS_getWakeupZ(ITDS_state_t *wakeUpZ)
+int8_t ITDS_getWakeupZ(WE_sensorInterface_t *sensorInterface, ITDS_state_t *wakeUpZ)
 {
 	ITDS_wake_up_event_t wake_up_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
 	return WE_FAIL;
 
 	*wakeUpZ = (ITDS_state_t)(wake_up_event_t.wakeUpZ);
@@ -2632,14 +2976,15 @@ int8_t ITDS_getWakeupZ(ITDS_state_t *wakeUpZ)
 
 /**
 * @brief  Read the Wake-up Event detection Status
+* @param  Pointer to sensor interface
 * @param  Pointer to the Wake-up Event detection State.
 * @retval Error code
 */
-int8_t ITDS_getWakeupState(ITDS_state_t *wakeUpState )
+int8_t ITDS_getWakeupState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *wakeUpState )
 {
 	ITDS_wake_up_event_t wake_up_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
 	return WE_FAIL;
 
 	*wakeUpState = (ITDS_state_t)(wake_up_event_t.wakeUpState);
@@ -2652,14 +2997,15 @@ int8_t ITDS_getWakeupState(ITDS_state_t *wakeUpState )
 
 /**
 * @brief  Read the Tap Event Status
+* @param  Pointer to sensor interface
 * @param  Pointer to the Tap Event State
 * @retval Error code
 */
-int8_t ITDS_getTapEventState(ITDS_state_t *tapEvent)
+int8_t ITDS_getTapEventState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tapEvent)
 {
 	ITDS_tap_event_t tap_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
 	return WE_FAIL;
 
 	*tapEvent = (ITDS_state_t)(tap_event_t.tapEventState);
@@ -2668,14 +3014,15 @@ int8_t ITDS_getTapEventState(ITDS_state_t *tapEvent)
 
 /**
 * @brief  Read the Accelarion Sign
+* @param  Pointer to sensor interface
 * @param  Pointer to the Accelarion Sign
 * @retval Error code
 */
-int8_t ITDS_getTapSign(ITDS_tapSign_t *tapSign)
+int8_t ITDS_getTapSign(WE_sensorInterface_t *sensorInterface, ITDS_tapSign_t *tapSign)
 {
 	ITDS_tap_event_t tap_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
 	return WE_FAIL;
 
 	*tapSign = (ITDS_tapSign_t)(tap_event_t.tapSign);
@@ -2684,14 +3031,15 @@ int8_t ITDS_getTapSign(ITDS_tapSign_t *tapSign)
 
 /**
 * @brief  Read the Tap Event Status on X Axis
+* @param  Pointer to sensor interface
 * @param  Pointer to the Tap Event Status on X Axis.
 * @retval Error code
 */
-int8_t ITDS_getTapXAxis(ITDS_state_t *tapXAxis)
+int8_t ITDS_getTapXAxis(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tapXAxis)
 {
 	ITDS_tap_event_t tap_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
 	return WE_FAIL;
 
 	*tapXAxis = (ITDS_state_t)(tap_event_t.tapXAxis);
@@ -2700,14 +3048,15 @@ int8_t ITDS_getTapXAxis(ITDS_state_t *tapXAxis)
 
 /**
 * @brief  Read the Tap Event Status on Y Axis
+* @param  Pointer to sensor interface
 * @param  Pointer to the Tap Event Status on Y Axis.
 * @retval Error code
 */
-int8_t ITDS_getTapYAxis(ITDS_state_t *tapYAxis)
+int8_t ITDS_getTapYAxis(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tapYAxis)
 {
 	ITDS_tap_event_t tap_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
 	return WE_FAIL;
 
 	*tapYAxis = (ITDS_state_t)(tap_event_t.tapYAxis);
@@ -2716,14 +3065,15 @@ int8_t ITDS_getTapYAxis(ITDS_state_t *tapYAxis)
 
 /**
 * @brief  Read the Tap Event Status on Z Axis
+* @param  Pointer to sensor interface
 * @param  Pointer to the Tap Event Status on Z Axis.
 * @retval Error code
 */
-int8_t ITDS_getTapZAxis(ITDS_state_t *tapZAxis)
+int8_t ITDS_getTapZAxis(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tapZAxis)
 {
 	ITDS_tap_event_t tap_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
 	return WE_FAIL;
 
 	*tapZAxis = (ITDS_state_t)(tap_event_t.tapZAxis);
@@ -2736,14 +3086,15 @@ int8_t ITDS_getTapZAxis(ITDS_state_t *tapZAxis)
 
 /**
 * @brief  Read the XL Over Threshold State
+* @param  Pointer to sensor interface
 * @param  Pointer to the XL Over Threshold State
 * @retval Error code
 */
-int8_t ITDS_getXLOverThresholdState(ITDS_state_t *XLOverThreshold)
+int8_t ITDS_getXLOverThresholdState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *XLOverThreshold)
 {
 	ITDS_event_6D_t event_6D_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
 	return WE_FAIL;
 
 	*XLOverThreshold=(ITDS_state_t)(event_6D_t.XLOverThreshold);
@@ -2752,14 +3103,15 @@ int8_t ITDS_getXLOverThresholdState(ITDS_state_t *XLOverThreshold)
 
 /**
 * @brief  Read the XH Over Threshold State
+* @param  Pointer to sensor interface
 * @param  Pointer to the XH Over Threshold State
 * @retval Error code
 */
-int8_t ITDS_getXHOverThresholdState(ITDS_state_t *XHOverThreshold)
+int8_t ITDS_getXHOverThresholdState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *XHOverThreshold)
 {
 	ITDS_event_6D_t event_6D_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
 	return WE_FAIL;
 
 	*XHOverThreshold = (ITDS_state_t)(event_6D_t.XHOverThreshold);
@@ -2768,14 +3120,15 @@ int8_t ITDS_getXHOverThresholdState(ITDS_state_t *XHOverThreshold)
 
 /**
 * @brief  Read the YL Over Threshold State
+* @param  Pointer to sensor interface
 * @param  Pointer to the XL Over Threshold State
 * @retval Error code
 */
-int8_t ITDS_getYLOverThresholdState(ITDS_state_t *YLOverThreshold)
+int8_t ITDS_getYLOverThresholdState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *YLOverThreshold)
 {
 	ITDS_event_6D_t event_6D_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
 	return WE_FAIL;
 
 	*YLOverThreshold = (ITDS_state_t)(event_6D_t.YLOverThreshold);
@@ -2784,14 +3137,15 @@ int8_t ITDS_getYLOverThresholdState(ITDS_state_t *YLOverThreshold)
 
 /**
 * @brief  Read the YH Over Threshold State
+* @param  Pointer to sensor interface
 * @param  Pointer to the YL Over Threshold State
 * @retval Error code
 */
-int8_t ITDS_getYHOverThresholdState(ITDS_state_t *YHOverThreshold)
+int8_t ITDS_getYHOverThresholdState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *YHOverThreshold)
 {
 	ITDS_event_6D_t event_6D_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
 	return WE_FAIL;
 
 	*YHOverThreshold = (ITDS_state_t)(event_6D_t.YHOverThreshold);
@@ -2800,14 +3154,15 @@ int8_t ITDS_getYHOverThresholdState(ITDS_state_t *YHOverThreshold)
 
 /**
 * @brief  Read the ZL Over Threshold State
+* @param  Pointer to sensor interface
 * @param  Pointer to the ZL Over Threshold State
 * @retval Error code
 */
-int8_t ITDS_getZLOverThresholdState(ITDS_state_t *ZLOverThreshold)
+int8_t ITDS_getZLOverThresholdState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *ZLOverThreshold)
 {
 	ITDS_event_6D_t event_6D_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
 	return WE_FAIL;
 
 	*ZLOverThreshold = (ITDS_state_t)(event_6D_t.ZLOverThreshold);
@@ -2816,14 +3171,15 @@ int8_t ITDS_getZLOverThresholdState(ITDS_state_t *ZLOverThreshold)
 
 /**
 * @brief  Read the ZH Over Threshold State
+* @param  Pointer to sensor interface
 * @param  Pointer to the ZH Over Threshold State
 * @retval Error code
 */
-int8_t ITDS_getZHOverThresholdState(ITDS_state_t *ZHOverThreshold)
+int8_t ITDS_getZHOverThresholdState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *ZHOverThreshold)
 {
 	ITDS_event_6D_t event_6D_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
 	return WE_FAIL;
 
 	*ZHOverThreshold = (ITDS_state_t)(event_6D_t.ZHOverThreshold);
@@ -2835,32 +3191,48 @@ int8_t ITDS_getZHOverThresholdState(ITDS_state_t *ZHOverThreshold)
 
 /**
 * @brief  Read the Sleep Change State
+* @param  Pointer to sensor interface
 * @param  Pointer to the Sleep Change State
 * @retval Error code
 */
-int8_t ITDS_getSleepChangeState(ITDS_state_t *sleep)
+int8_t ITDS_getSleepChangeState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *sleep)
 {
 	ITDS_all_int_event_t all_int_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_ALL_INT_EVENT_REG, 1, (uint8_t *)&all_int_event_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_ALL_INT_EVENT_REG, 1, (uint8_t *)&all_int_event_t))
 	return WE_FAIL;
 
 	*sleep = (ITDS_state_t)(all_int_event_t.sleepState);
 	return WE_SUCCESS;
 }
 
+/**
+* @brief  Read all event registers (STATUS_DETECT ... ALL_INT_EVENT) in one transfer
+* @param  Pointer to sensor interface
+* @param  Pointer to the event registers
+* @retval Error code
+*/
+int8_t ITDS_getEventBlock(WE_sensorInterface_t *sensorInterface, ITDS_event_block_t *events)
+{
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_STATUS_DETECT_REG, sizeof(ITDS_event_block_t), (uint8_t *)events))
+	return WE_FAIL;
+
+	return WE_SUCCESS;
+}
+
 /* X_Y_Z_OFS_USR */
 
 /**
 * @brief  set the User offset on X axis for wake-up
+* @param  Pointer to sensor interface
 * @param  the User offset on X axis state for wake-up
 * @retval Error code
 */
-int8_t ITDS_setOffsetValueOnXAxis(uint8_t offsetValueXAxis)
+int8_t ITDS_setOffsetValueOnXAxis(WE_sensorInterface_t *sensorInterface, uint8_t offsetValueXAxis)
 {
 	uint8_t offsetValueOnXAxis = offsetValueXAxis;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_X_OFS_USR_REG, 1, &offsetValueOnXAxis))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_X_OFS_USR_REG, 1, &offsetValueOnXAxis))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2868,14 +3240,15 @@ int8_t ITDS_setOffsetValueOnXAxis(uint8_t offsetValueXAxis)
 
 /**
 * @brief  Read the User offset Value on X axis
+* @param  Pointer to sensor interface
 * @param  Pointer to the User offset Value on X axis..
 * @retval Error code
 */
-int8_t ITDS_getOffsetValueOnXAxis(uint8_t *offsetvalueXAxis)
+int8_t ITDS_getOffsetValueOnXAxis(WE_sensorInterface_t *sensorInterface, uint8_t *offsetvalueXAxis)
 {
 	uint8_t offsetValueOnXAxis;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_X_OFS_USR_REG, 1, &offsetValueOnXAxis))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_X_OFS_USR_REG, 1, &offsetValueOnXAxis))
 	return WE_FAIL;
 
 	*offsetvalueXAxis = (offsetValueOnXAxis);
@@ -2884,14 +3257,15 @@ int8_t ITDS_getOffsetValueOnXAxis(uint8_t *offsetvalueXAxis)
 
 /**
 * @brief  set the User offset on Y axis for wake-up
+* @param  Pointer to sensor interface
 * @param  ser offset on Y axis state for wake-up
 * @retval Error code
 */
-int8_t ITDS_setOffsetValueOnYAxis(uint8_t offsetValueYAxis)
+int8_t ITDS_setOffsetValueOnYAxis(WE_sensorInterface_t *sensorInterface, uint8_t offsetValueYAxis)
 {
 	uint8_t offsetValueOnYAxis = offsetValueYAxis;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_Y_OFS_USR_REG, 1, &offsetValueOnYAxis))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_Y_OFS_USR_REG, 1, &offsetValueOnYAxis))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2899,14 +3273,15 @@ int8_t ITDS_setOffsetValueOnYAxis(uint8_t offsetValueYAxis)
 
 /**
 * @brief  Read the User offset Value on Y axis
+* @param  Pointer to sensor interface
 * @param  Pointer to the User offset Value on Y axis..
 * @retval Error code
 */
-int8_t ITDS_getOffsetValueOnYAxis(uint8_t *offsetValueYAxis)
+int8_t ITDS_getOffsetValueOnYAxis(WE_sensorInterface_t *sensorInterface, uint8_t *offsetValueYAxis)
 {
 	uint8_t offsetValueOnYAxis;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_Y_OFS_USR_REG, 1, &offsetValueOnYAxis))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_Y_OFS_USR_REG, 1, &offsetValueOnYAxis))
 	return WE_FAIL;
 
 	*offsetValueYAxis = (offsetValueOnYAxis);
@@ -2915,14 +3290,15 @@ int8_t ITDS_getOffsetValueOnYAxis(uint8_t *offsetValueYAxis)
 
 /**
 * @brief  set the User offset on Z axis for wake-up
+* @param  Pointer to sensor interface
 * @param  the User offset on Z axis state for wake-up
 * @retval Error code
 */
-int8_t ITDS_setOffsetValueOnZAxis(uint8_t offsetvalueZAxis)
+int8_t ITDS_setOffsetValueOnZAxis(WE_sensorInterface_t *sensorInterface, uint8_t offsetvalueZAxis)
 {
 	uint8_t offsetValueOnZAxis = offsetvalueZAxis;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_Z_OFS_USR_REG, 1, &offsetValueOnZAxis))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_Z_OFS_USR_REG, 1, &offsetValueOnZAxis))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2930,39 +3306,90 @@ int8_t ITDS_setOffsetValueOnZAxis(uint8_t offsetvalueZAxis)
 
 /**
 * @brief  Read the User offset Value on Z axis
+* @param  Pointer to sensor interface
 * @param  Pointer to the User offset Value on Z axis.
 * @retval Error code
 */
-int8_t ITDS_getOffsetValueOnZAxis(uint8_t *offsetValueZAxis)
+int8_t ITDS_getOffsetValueOnZAxis(WE_sensorInterface_t *sensorInterface, uint8_t *offsetValueZAxis)
 {
 	uint8_t offsetValueOnZAxis;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_Z_OFS_USR_REG, 1, &offsetValueOnZAxis))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_Z_OFS_USR_REG, 1, &offsetValueOnZAxis))
 	return WE_FAIL;
 
 	*offsetValueZAxis = (offsetValueOnZAxis);
 	return WE_SUCCESS;
 }
 
+/**
+* @brief  Set the User offset Values on all axes and their weight in one transfer
+* @param  Pointer to sensor interface
+* @param  Pointer to the User offset Values and weight
+* @param  Apply the offset to the output data and to the wake-up function (USR_OFF_ON_OUT, USR_OFF_ON_WU)
+* @retval Error code
+*/
+int8_t ITDS_setUserOffset(WE_sensorInterface_t *sensorInterface, const ITDS_user_Offset_t *userOffset, ITDS_state_t apply)
+{
+	uint8_t data[4];
+	ITDS_ctrl_7_t *ctrl_7_t = (ITDS_ctrl_7_t *)&data[3];
+
+	/* X_OFS_USR ... Z_OFS_USR are followed by CTRL_7, which holds the weight */
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, &data[3]))
+	return WE_FAIL;
+
+	data[0] = (uint8_t)userOffset->offset[0];
+	data[1] = (uint8_t)userOffset->offset[1];
+	data[2] = (uint8_t)userOffset->offset[2];
+	ctrl_7_t->userOffset = userOffset->weight;
+	ctrl_7_t->applyOffsetXL = apply;
+	ctrl_7_t->applyWakeUpOffsetXL = apply;
+
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_X_OFS_USR_REG, 4, data))
+	return WE_FAIL;
+
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Read the User offset Values on all axes and their weight in one transfer
+* @param  Pointer to sensor interface
+* @param  Pointer to the User offset Values and weight
+* @retval Error code
+*/
+int8_t ITDS_getUserOffset(WE_sensorInterface_t *sensorInterface, ITDS_user_Offset_t *userOffset)
+{
+	uint8_t data[4];
+
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_X_OFS_USR_REG, 4, data))
+	return WE_FAIL;
+
+	userOffset->offset[0] = (int8_t)data[0];
+	userOffset->offset[1] = (int8_t)data[1];
+	userOffset->offset[2] = (int8_t)data[2];
+	userOffset->weight = (ITDS_state_t)(((ITDS_ctrl_7_t *)&data[3])->userOffset);
+	return WE_SUCCESS;
+}
+
 
 /* CTRL_7 */
 
 
 /**
 * @brief  select the Data Ready Interrupt Mode [latched mode / pulsed mode ]
+* @param  Pointer to sensor interface
 * @param  Data Ready Interrupt Mode
 * @retval Error code
 */
-int8_t ITDS_setDrdyPulse(ITDS_drdy_pulse  drdyPulsed)
+int8_t ITDS_setDrdyPulse(WE_sensorInterface_t *sensorInterface, ITDS_drdy_pulse  drdyPulsed)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.drdyPulse = drdyPulsed;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2970,14 +3397,15 @@ int8_t ITDS_setDrdyPulse(ITDS_drdy_pulse  drdyPulsed)
 
 /**
 * @brief  Read the Data Ready Interrupt Mode [latched mode / pulsed mode ]
+* @param  Pointer to sensor interface
 * @param  Pointer to Data Ready Interrupt Mode
 * @retval Error code
 */
-int8_t ITDS_getDrdyPulseIntMode(ITDS_drdy_pulse  *drdyPulsed)
+int8_t ITDS_getDrdyPulseIntMode(WE_sensorInterface_t *sensorInterface, ITDS_drdy_pulse  *drdyPulsed)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*drdyPulsed = (ITDS_drdy_pulse)(ctrl_7_t.drdyPulse);
@@ -2986,19 +3414,20 @@ int8_t ITDS_getDrdyPulseIntMode(ITDS_drdy_pulse  *drdyPulsed)
 
 /**
 * @brief  enable the signal Routing : all signals available only on Int_1 are routed On Int_0
+* @param  Pointer to sensor interface
 * @param  signal Routing Int1 On Int0 state
 * @retval Error code
 */
-int8_t ITDS_setInt1OnInt0(ITDS_state_t int1Onint0)
+int8_t ITDS_setInt1OnInt0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1Onint0)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.INT1toINT0 = int1Onint0;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -3006,14 +3435,15 @@ int8_t ITDS_setInt1OnInt0(ITDS_state_t int1Onint0)
 
 /**
 * @brief  Read the signal Routing INT_1 On INT_0 State
+* @param  Pointer to sensor interface
 * @param  Pointer to Routing INT_1 On INT_0 State.
 * @retval Error code
 */
-int8_t ITDS_getInt1OnInt0(ITDS_state_t *int1Onint0)
+int8_t ITDS_getInt1OnInt0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1Onint0)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*int1Onint0 = (ITDS_state_t)(ctrl_7_t.INT1toINT0);
@@ -3022,19 +3452,20 @@ int8_t ITDS_getInt1OnInt0(ITDS_state_t *int1Onint0)
 
 /**
 * @brief  enable interrupts
+* @param  Pointer to sensor interface
 * @param  interrupts state
 * @retval Error code
 */
-int8_t ITDS_enInterrups(ITDS_state_t interrupts)
+int8_t ITDS_enInterrups(WE_sensorInterface_t *sensorInterface, ITDS_state_t interrupts)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.enInterrupts = interrupts;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -3042,14 +3473,15 @@ int8_t ITDS_enInterrups(ITDS_state_t interrupts)
 
 /**
 * @brief  Read the interrupts State
+* @param  Pointer to sensor interface
 * @param  Pointer to interrupts State .
 * @retval Error code
 */
-int8_t ITDS_getInterruptsState(ITDS_state_t *interrupts)
+int8_t ITDS_getInterruptsState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *interrupts)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*interrupts = (ITDS_state_t)(ctrl_7_t.enInterrupts);
@@ -3058,19 +3490,20 @@ int8_t ITDS_getInterruptsState(ITDS_state_t *interrupts)
 
 /**
 * @brief  enable the application of User Offset value on XL Output Data
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t ITDS_enApplyOffsetXL(ITDS_state_t offsetXLOutput)
+int8_t ITDS_enApplyOffsetXL(WE_sensorInterface_t *sensorInterface, ITDS_state_t offsetXLOutput)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.applyOffsetXL = offsetXLOutput;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -3078,14 +3511,15 @@ int8_t ITDS_enApplyOffsetXL(ITDS_state_t offsetXLOutput)
 
 /**
 * @brief  Read the Application state of User Offset value on XL Output Data
+* @param  Pointer to sensor interface
 * @param  Pointer to offset XL Output.
 * @retval Error code
 */
-int8_t ITDS_getApplyOffsetXL(ITDS_state_t *offsetXLOutput)
+int8_t ITDS_getApplyOffsetXL(WE_sensorInterface_t *sensorInterface, ITDS_state_t *offsetXLOutput)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*offsetXLOutput = (ITDS_state_t)(ctrl_7_t.applyOffsetXL);
@@ -3094,19 +3528,20 @@ int8_t ITDS_getApplyOffsetXL(ITDS_state_t *offsetXLOutput)
 
 /**
 * @brief  enable the application of User Offset value on XL Data only for wakeup functions
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t ITDS_enApplyWakeUpOffsetXL(ITDS_state_t offsetXLWakeup)
+int8_t ITDS_enApplyWakeUpOffsetXL(WE_sensorInterface_t *sensorInterface, ITDS_state_t offsetXLWakeup)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.applyWakeUpOffsetXL = offsetXLWakeup;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -3114,14 +3549,15 @@ int8_t ITDS_enApplyWakeUpOffsetXL(ITDS_state_t offsetXLWakeup)
 
 /**
 * @brief  Read the Application state of User Offset value on XL Data only for wakeup functions
+* @param  Pointer to sensor interface
 * @param  Pointer to offset XL Wakeup.
 * @retval Error code
 */
-int8_t ITDS_getApplyWakeUpOffsetXL(ITDS_state_t *offsetXLWakeup)
+int8_t ITDS_getApplyWakeUpOffsetXL(WE_sensorInterface_t *sensorInterface, ITDS_state_t *offsetXLWakeup)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*offsetXLWakeup = (ITDS_state_t)(ctrl_7_t.applyWakeUpOffsetXL);
@@ -3130,19 +3566,20 @@ int8_t ITDS_getApplyWakeUpOffsetXL(ITDS_state_t *offsetXLWakeup)
 
 /**
 * @brief  set the Weight of the user offset words
+* @param  Pointer to sensor interface
 * @param  offset Weight
 * @retval Error code
 */
-int8_t ITDS_setOffsetWeight(ITDS_state_t offsetWeight)
+int8_t ITDS_setOffsetWeight(WE_sensorInterface_t *sensorInterface, ITDS_state_t offsetWeight)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.userOffset = offsetWeight;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -3150,14 +3587,15 @@ int8_t ITDS_setOffsetWeight(ITDS_state_t offsetWeight)
 
 /**
 * @brief  Read the Weight of the user offset words
+* @param  Pointer to sensor interface
 * @param  Pointer to offset Weight .
 * @retval Error code
 */
-int8_t ITDS_getOffsetWeight(ITDS_state_t *offsetWeight)
+int8_t ITDS_getOffsetWeight(WE_sensorInterface_t *sensorInterface, ITDS_state_t *offsetWeight)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*offsetWeight = (ITDS_state_t)(ctrl_7_t.userOffset);
@@ -3166,19 +3604,20 @@ int8_t ITDS_getOffsetWeight(ITDS_state_t *offsetWeight)
 
 /**
 * @brief  enable High Pass Filter Reference Mode
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t ITDS_enHighPassRefMode(ITDS_state_t refMode)
+int8_t ITDS_enHighPassRefMode(WE_sensorInterface_t *sensorInterface, ITDS_state_t refMode)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.highPassRefMode = refMode;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -3186,14 +3625,15 @@ int8_t ITDS_enHighPassRefMode(ITDS_state_t refMode)
 
 /**
 * @brief  Read the state of High Pass Filter Reference Mode
+* @param  Pointer to sensor interface
 * @param  Pointer to Reference Mode state
 * @retval Error code
 */
-int8_t ITDS_getHighPassRefMode(ITDS_state_t *refMode)
+int8_t ITDS_getHighPassRefMode(WE_sensorInterface_t *sensorInterface, ITDS_state_t *refMode)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*refMode = (ITDS_state_t)(ctrl_7_t.highPassRefMode);
@@ -3202,19 +3642,20 @@ int8_t ITDS_getHighPassRefMode(ITDS_state_t *refMode)
 
 /**
 * @brief  enable the Low Pass On 6D state
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t ITDS_enLowPassOn6D(ITDS_state_t LPassOn6D)
+int8_t ITDS_enLowPassOn6D(WE_sensorInterface_t *sensorInterface, ITDS_state_t LPassOn6D)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.lowPassOn6D = LPassOn6D;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -3222,16 +3663,100 @@ int8_t ITDS_enLowPassOn6D(ITDS_state_t LPassOn6D)
 
 /**
 * @brief  Read the Low Pass On 6D state
+* @param  Pointer to sensor interface
 * @param  Pointer to Low Pass On 6D state.
 * @retval Error code
 */
-int8_t ITDS_getLowPassOn6DState(ITDS_state_t *LPassOn6D)
+int8_t ITDS_getLowPassOn6DState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *LPassOn6D)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*LPassOn6D = (ITDS_state_t)(ctrl_7_t.lowPassOn6D);
 	return WE_SUCCESS;
 }
+
+/**
+* @brief  Get the fixed-point factor converting raw acceleration at a full scale
+*         (0.061 mg/digit at ±2g, doubling with each full scale step)
+* @param  Full scale
+* @param  Unit of the converted values, µg are exact, mg are rounded to the nearest mg
+* @param  Pointer to the conversion
+* @retval Error code
+*/
+int8_t ITDS_getAccConversion(ITDS_full_Scale fullScale, ITDS_acc_Unit unit, ITDS_acc_Conversion_t *conversion)
+{
+	if ((fullScale > sixteenG) || (unit > ITDS_microG))
+	return WE_FAIL;
+
+	if (ITDS_microG == unit)
+	{
+		conversion->multiplier = (int32_t)61 << fullScale;
+		conversion->shift = 0;
+		conversion->rounding = 0;
+	}
+	else
+	{
+		/* 61 µg / 1000 in Q16 is 3997.7, the error of 3998 stays below 0.01 % */
+		conversion->multiplier = (int32_t)3998 << fullScale;
+		conversion->shift = 16;
+		conversion->rounding = (int32_t)1 << 15;
+	}
+
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Convert a raw acceleration without floating point
+* @param  Raw acceleration
+* @param  Pointer to the conversion from ITDS_getAccConversion()
+* @retval Acceleration in the unit of the conversion
+*/
+int32_t ITDS_convertAcceleration_int(int16_t acc, const ITDS_acc_Conversion_t *conversion)
+{
+	return (((int32_t)acc * conversion->multiplier) + conversion->rounding) >> conversion->shift;
+}
+
+/**
+* @brief  Convert a block of raw samples without floating point, e.g. a FIFO block
+* @param  Raw X, Y and Z-axis acceleration of each sample
+* @param  Converted X, Y and Z-axis acceleration of each sample
+* @param  Number of samples
+* @param  Pointer to the conversion from ITDS_getAccConversion()
+*/
+void ITDS_convertAccelerations_int(const int16_t raw[][3], int32_t acc[][3], uint16_t numSamples, const ITDS_acc_Conversion_t *conversion)
+{
+	/* one flat loop without branches, vectorised by the compiler where the target has SIMD */
+	const int16_t *in = &raw[0][0];
+	int32_t *out = &acc[0][0];
+	const int32_t multiplier = conversion->multiplier;
+	const int32_t rounding = conversion->rounding;
+	const uint8_t shift = conversion->shift;
+	uint32_t count = (uint32_t)numSamples * 3;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		out[i] = (((int32_t)in[i] * multiplier) + rounding) >> shift;
+	}
+}
+
+/**
+* @brief  Convert a block of raw samples to floating point, e.g. a FIFO block
+* @param  Raw X, Y and Z-axis acceleration of each sample
+* @param  Converted X, Y and Z-axis acceleration of each sample
+* @param  Number of samples
+* @param  Sensitivity, value per digit
+*/
+void ITDS_convertAccelerations_float(const int16_t raw[][3], float acc[][3], uint16_t numSamples, float sensitivity)
+{
+	const int16_t *in = &raw[0][0];
+	float *out = &acc[0][0];
+	uint32_t count = (uint32_t)numSamples * 3;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		out[i] = (float)in[i] * sensitivity;
+	}
+}
@@ -79,6 +79,25 @@ extern "C"
 #define ITDS_Z_OFS_USR_REG                0x3E     /* Offset value on Z axis data Register */
 #define ITDS_CTRL_7_REG                   0x3F     /* Control Register 7 */
 
+#define ITDS_CACHED_REGISTERS             18       /* number of registers in ITDS_cachedRegisters */
+
+#define ITDS_FIFO_DEPTH                   32       /* max. number of samples in the FIFO */
+#define ITDS_FIFO_SAMPLES_PER_READ        (WE_MAX_READ_LENGTH / 6)	/* FIFO samples per transfer */
+
+#define ITDS_SINGLE_CONVERSION_MS         2        /* max. time of a single conversion on demand */
+
+#define ITDS_OFFSET_WEIGHT_LOW_UG         977      /* user offset weight with USR_OFF_W = 0 [µg/LSB] */
+#define ITDS_OFFSET_WEIGHT_HIGH_UG        15600    /* user offset weight with USR_OFF_W = 1 [µg/LSB] */
+
+#define ITDS_TAP_THRESHOLD_MAX            31       /* TAP_THS[4:0] */
+#define ITDS_SHOCK_MAX                    3        /* SHOCK[1:0] */
+#define ITDS_QUIET_MAX                    3        /* QUIET[1:0] */
+#define ITDS_LATENCY_MAX                  15       /* LATENCY[3:0] */
+#define ITDS_WAKE_UP_THRESHOLD_MAX        63       /* WK_THS[5:0] */
+#define ITDS_WAKE_UP_DURATION_MAX         3        /* WAKE_DUR[1:0] */
+#define ITDS_SLEEP_DURATION_MAX           15       /* SLEEP_DUR[3:0] */
+#define ITDS_FREE_FALL_DURATION_MAX       63       /* FF_DUR[5:0] */
+
 /** Register type definitions **/
 
 
@@ -492,6 +511,19 @@ typedef struct
 	uint8_t not_used_02 : 1;     /* This bit must be set to 0 for proper operation of the device */
 }ITDS_all_int_event_t;
 
+/**
+* Event registers STATUS_DETECT_REG ... ALL_INT_EVENT_REG
+* Address 0x37 ... 0x3B, read in one access
+*/
+typedef struct
+{
+	ITDS_status_detect_t statusDetect;
+	ITDS_wake_up_event_t wakeUpEvent;
+	ITDS_tap_event_t tapEvent;
+	ITDS_event_6D_t event6D;
+	ITDS_all_int_event_t allIntEvent;
+}ITDS_event_block_t;
+
 /**
 * CTRL_7_REG
 * Address 0x3F
@@ -582,6 +614,25 @@ typedef enum {
 	sixteenG = 3    /* ±16g */
 }ITDS_full_Scale;
 
+typedef enum {
+	ITDS_milliG = 0,	/* mg */
+	ITDS_microG = 1		/* µg */
+}ITDS_acc_Unit;
+
+/* Fixed-point conversion of raw acceleration: value = (raw * multiplier + rounding) >> shift */
+typedef struct
+{
+	int32_t multiplier;
+	int32_t rounding;
+	uint8_t shift;
+}ITDS_acc_Conversion_t;
+
+/* User offset registers X_OFS_USR ... Z_OFS_USR with their weight */
+typedef struct {
+	int8_t offset[3];          /* X, Y and Z-axis offset, subtracted from the output */
+	ITDS_state_t weight;       /* USR_OFF_W (0: ITDS_OFFSET_WEIGHT_LOW_UG, 1: ITDS_OFFSET_WEIGHT_HIGH_UG) */
+}ITDS_user_Offset_t;
+
 typedef enum {
 	lowPass = 0,
 	highPass = 1
@@ -627,242 +678,316 @@ typedef enum {
 	pulsed = 1
 }ITDS_drdy_pulse;
 
+/* Tap detection: TAP_X_TH ... INT_DUR and SINGLE_DOUBLE_TAP */
+typedef struct {
+	uint8_t thresholdX;                  /* 0 ... ITDS_TAP_THRESHOLD_MAX, 1 LSB = FS/32 */
+	uint8_t thresholdY;                  /* 0 ... ITDS_TAP_THRESHOLD_MAX, 1 LSB = FS/32 */
+	uint8_t thresholdZ;                  /* 0 ... ITDS_TAP_THRESHOLD_MAX, 1 LSB = FS/32 */
+	ITDS_state_t enX;
+	ITDS_state_t enY;
+	ITDS_state_t enZ;
+	ITDS_tap_Axis_Priority axisPriority;
+	uint8_t shock;                       /* max. duration of the over-threshold event, 0 ... ITDS_SHOCK_MAX, 1 LSB = 8/ODR (0: 4/ODR) */
+	uint8_t quiet;                       /* quiet time after a tap, 0 ... ITDS_QUIET_MAX, 1 LSB = 4/ODR (0: 2/ODR) */
+	uint8_t latency;                     /* max. gap between the taps of a double-tap, 0 ... ITDS_LATENCY_MAX, 1 LSB = 32/ODR (0: 16/ODR) */
+	ITDS_state_t doubleTap;              /* detect double-taps besides single-taps */
+}ITDS_tap_Profile_t;
+
+/* Wake-up and inactivity detection: WAKE_UP_TH and WAKE_UP_DUR */
+typedef struct {
+	uint8_t threshold;                   /* 0 ... ITDS_WAKE_UP_THRESHOLD_MAX, 1 LSB = FS/64 */
+	uint8_t duration;                    /* 0 ... ITDS_WAKE_UP_DURATION_MAX, 1 LSB = 1/ODR */
+	ITDS_state_t sleep;                  /* inactivity detection (SLEEP_ON) */
+	ITDS_state_t stationary;             /* inactivity detection without ODR change */
+	uint8_t sleepDuration;               /* 0 ... ITDS_SLEEP_DURATION_MAX, 1 LSB = 512/ODR (0: 16/ODR) */
+}ITDS_wakeUp_Profile_t;
+
+/* Free-fall detection: FREE_FALL and FF_DUR5 */
+typedef struct {
+	ITDS_Free_Fall_Thr threshold;
+	uint8_t duration;                    /* 0 ... ITDS_FREE_FALL_DURATION_MAX, 1 LSB = 1/ODR */
+}ITDS_freeFall_Profile_t;
+
+/* Event detection registers TAP_X_TH ... FREE_FALL, see ITDS_setDetectionProfile() */
+typedef struct {
+	ITDS_tap_Profile_t tap;
+	ITDS_wakeUp_Profile_t wakeUp;
+	ITDS_freeFall_Profile_t freeFall;
+	ITDS_threshold_Degree sixDThreshold;
+	ITDS_state_t fourD;                  /* 4D instead of 6D orientation detection */
+}ITDS_detection_Profile_t;
+
+/* Check the ranges of a detection profile, e.g. in a static_assert() on a constexpr profile */
+#define ITDS_DETECTION_PROFILE_VALID(p) \
+	(((p).tap.thresholdX <= ITDS_TAP_THRESHOLD_MAX) && ((p).tap.thresholdY <= ITDS_TAP_THRESHOLD_MAX) && \
+	 ((p).tap.thresholdZ <= ITDS_TAP_THRESHOLD_MAX) && ((p).tap.enX <= ITDS_enable) && \
+	 ((p).tap.enY <= ITDS_enable) && ((p).tap.enZ <= ITDS_enable) && ((p).tap.axisPriority <= Z_X_Y) && \
+	 ((p).tap.shock <= ITDS_SHOCK_MAX) && ((p).tap.quiet <= ITDS_QUIET_MAX) && \
+	 ((p).tap.latency <= ITDS_LATENCY_MAX) && ((p).tap.doubleTap <= ITDS_enable) && \
+	 ((p).wakeUp.threshold <= ITDS_WAKE_UP_THRESHOLD_MAX) && ((p).wakeUp.duration <= ITDS_WAKE_UP_DURATION_MAX) && \
+	 ((p).wakeUp.sleep <= ITDS_enable) && ((p).wakeUp.stationary <= ITDS_enable) && \
+	 ((p).wakeUp.sleepDuration <= ITDS_SLEEP_DURATION_MAX) && ((p).freeFall.threshold <= sixteen) && \
+	 ((p).freeFall.duration <= ITDS_FREE_FALL_DURATION_MAX) && ((p).sixDThreshold <= fiftyDeg) && \
+	 ((p).fourD <= ITDS_enable))
+
+	/* Registers held in the register cache of the sensor interface */
+	extern const WE_cachedRegister_t ITDS_cachedRegisters[ITDS_CACHED_REGISTERS];
+
 	/* **********************/
 	/* Functions definition */
 	/* **********************/
 
 	/* DEVICE_ID */
-	int8_t  ITDS_getDeviceID(uint8_t *device_id) ;
+	int8_t  ITDS_getDeviceID(WE_sensorInterface_t *sensorInterface, uint8_t *device_id) ;
 
 	/* CTRL-REG 1 */
-	int8_t  ITDS_setOutputDataRate(ITDS_output_Data_Rate odr);
-	int8_t  ITDS_getOutputDataRate(uint8_t *odr) ;
-	int8_t  ITDS_setOperatingMode(ITDS_operating_mode operatingMode);
-	int8_t  ITDS_getOperatingMode(uint8_t *opMode);
-	int8_t  ITDS_setpowerMode(ITDS_power_mode lowOrNormalMode);
-	int8_t  ITDS_getpowerMode(uint8_t *powerMode);
+	int8_t  ITDS_setOutputDataRate(WE_sensorInterface_t *sensorInterface, ITDS_output_Data_Rate odr);
+	int8_t  ITDS_getOutputDataRate(WE_sensorInterface_t *sensorInterface, uint8_t *odr) ;
+	int8_t  ITDS_setOperatingMode(WE_sensorInterface_t *sensorInterface, ITDS_operating_mode operatingMode);
+	int8_t  ITDS_getOperatingMode(WE_sensorInterface_t *sensorInterface, uint8_t *opMode);
+	int8_t  ITDS_setpowerMode(WE_sensorInterface_t *sensorInterface, ITDS_power_mode lowOrNormalMode);
+	int8_t  ITDS_getpowerMode(WE_sensorInterface_t *sensorInterface, uint8_t *powerMode);
 
 	/* CTRL-REG 2 */
-	int8_t  ITDS_reboot(ITDS_state_t rebootmode);
-	int8_t  ITDS_getBootState(ITDS_state_t *boot);
-	int8_t  ITDS_softReset(ITDS_state_t Swreset_mode);
-	int8_t  ITDS_getsoftResetState(ITDS_state_t *swReset );
-	int8_t  ITDS_ConfigCSPullup(ITDS_state_t CSPullup);
-	int8_t  ITDS_getCSConfigState(ITDS_state_t *configCS);
-	int8_t  ITDS_setBlockDataUpdate(ITDS_state_t bdu);
-	int8_t  ITDS_getBlockDataUpdateState(ITDS_state_t *bdu);
-	int8_t  ITDS_setAutoIncrement(ITDS_state_t autoInc);
-	int8_t  ITDS_getAutoIncrementState(ITDS_state_t *autoIncr);
-	int8_t  ITDS_disableI2CInterface(ITDS_state_t I2CStatus);
-	int8_t  ITDS_getI2CInterfaceState(ITDS_state_t *i2cState);
+	int8_t  ITDS_reboot(WE_sensorInterface_t *sensorInterface, ITDS_state_t rebootmode);
+	int8_t  ITDS_getBootState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *boot);
+	int8_t  ITDS_softReset(WE_sensorInterface_t *sensorInterface, ITDS_state_t Swreset_mode);
+	int8_t  ITDS_getsoftResetState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *swReset );
+	int8_t  ITDS_ConfigCSPullup(WE_sensorInterface_t *sensorInterface, ITDS_state_t CSPullup);
+	int8_t  ITDS_getCSConfigState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *configCS);
+	int8_t  ITDS_setBlockDataUpdate(WE_sensorInterface_t *sensorInterface, ITDS_state_t bdu);
+	int8_t  ITDS_getBlockDataUpdateState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *bdu);
+	int8_t  ITDS_setAutoIncrement(WE_sensorInterface_t *sensorInterface, ITDS_state_t autoInc);
+	int8_t  ITDS_getAutoIncrementState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *autoIncr);
+	int8_t  ITDS_disableI2CInterface(WE_sensorInterface_t *sensorInterface, ITDS_state_t I2CStatus);
+	int8_t  ITDS_getI2CInterfaceState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *i2cState);
 
 	/* CTRL-REG 3 */
-	int8_t  ITDS_setSelfTestMode(ITDS_self_Test_Config selfTest);
-	int8_t  ITDS_getSelfTestMode(ITDS_state_t *selfTest);
-	int8_t  ITDS_setIntPinType(ITDS_interrupt_Pin_Config interruptType);
-	int8_t  ITDS_getIntPinType(ITDS_state_t *intType);
-	int8_t  ITDS_enLatchInt(ITDS_state_t lir);
-	int8_t  ITDS_getLatchIntState(ITDS_state_t *lir);
-	int8_t  ITDS_setIntActiveLevel(ITDS_interrupt_Active_Level lowHighLevel);
-	int8_t  ITDS_getIntActiveLevel(ITDS_interrupt_Active_Level *lowHighLevel);
-	int8_t  ITDS_setSingleConvInput(ITDS_singleDataConversion_Input slpModeSel);
-	int8_t  ITDS_getSingleConvInput(ITDS_singleDataConversion_Input *slpModeSel);
-	int8_t  ITDS_enSingleDataConv(ITDS_state_t slpMode1);
-	int8_t  ITDS_getSingleDataConvState(ITDS_state_t *slpMode1) ;
+	int8_t  ITDS_setSelfTestMode(WE_sensorInterface_t *sensorInterface, ITDS_self_Test_Config selfTest);
+	int8_t  ITDS_getSelfTestMode(WE_sensorInterface_t *sensorInterface, ITDS_state_t *selfTest);
+	int8_t  ITDS_setIntPinType(WE_sensorInterface_t *sensorInterface, ITDS_interrupt_Pin_Config interruptType);
+	int8_t  ITDS_getIntPinType(WE_sensorInterface_t *sensorInterface, ITDS_state_t *intType);
+	int8_t  ITDS_enLatchInt(WE_sensorInterface_t *sensorInterface, ITDS_state_t lir);
+	int8_t  ITDS_getLatchIntState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *lir);
+	int8_t  ITDS_setIntActiveLevel(WE_sensorInterface_t *sensorInterface, ITDS_interrupt_Active_Level lowHighLevel);
+	int8_t  ITDS_getIntActiveLevel(WE_sensorInterface_t *sensorInterface, ITDS_interrupt_Active_Level *lowHighLevel);
+	int8_t  ITDS_setSingleConvInput(WE_sensorInterface_t *sensorInterface, ITDS_singleDataConversion_Input slpModeSel);
+	int8_t  ITDS_getSingleConvInput(WE_sensorInterface_t *sensorInterface, ITDS_singleDataConversion_Input *slpModeSel);
+	int8_t  ITDS_enSingleDataConv(WE_sensorInterface_t *sensorInterface, ITDS_state_t slpMode1);
+	int8_t  ITDS_getSingleDataConvState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *slpMode1) ;
 
 	/* CTRL-REG 4 */
-	int8_t  ITDS_set6DOnINT0(ITDS_state_t int06D);
-	int8_t  ITDS_get6DOnINT0State(ITDS_state_t *int06D);
-	int8_t  ITDS_enSingleTapINT0(ITDS_state_t int0SingleTap);
-	int8_t  ITDS_getSingleTapINT0(ITDS_state_t *int0SingleTap);
-	int8_t  ITDS_enWakeupOnINT0(ITDS_state_t int0Wakeup);
-	int8_t  ITDS_getWakeupOnINT0(ITDS_state_t *int0Wakeup);
-	int8_t  ITDS_enFreeFallINT0(ITDS_state_t int0FreeFall);
-	int8_t  ITDS_getFreeFallINT0(ITDS_state_t *int0FreeFall);
-	int8_t  ITDS_enDoubleTapINT0(ITDS_state_t int0DoubleTap);
-	int8_t  ITDS_getDoubleTapINT0(ITDS_state_t *int0DoubleTap);
-	int8_t  ITDS_enFifoFullINT0(ITDS_state_t int0FifoFull);
-	int8_t  ITDS_getFifoFullINT0(ITDS_state_t *int0FifoFull);
-	int8_t  ITDS_enFifoThresholdINT0(ITDS_state_t int0FifoThresholdInt);
-	int8_t  ITDS_getFifoThresholdINT0(ITDS_state_t *int0FifoThresholdInt);
-	int8_t  ITDS_enDataReadyINT0(ITDS_state_t int0DataReadyInt);
-	int8_t  ITDS_getDataReadyINT0(ITDS_state_t *int0DataReadyInt);
+	int8_t  ITDS_set6DOnINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int06D);
+	int8_t  ITDS_get6DOnINT0State(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int06D);
+	int8_t  ITDS_enSingleTapINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int0SingleTap);
+	int8_t  ITDS_getSingleTapINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int0SingleTap);
+	int8_t  ITDS_enWakeupOnINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int0Wakeup);
+	int8_t  ITDS_getWakeupOnINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int0Wakeup);
+	int8_t  ITDS_enFreeFallINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int0FreeFall);
+	int8_t  ITDS_getFreeFallINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int0FreeFall);
+	int8_t  ITDS_enDoubleTapINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int0DoubleTap);
+	int8_t  ITDS_getDoubleTapINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int0DoubleTap);
+	int8_t  ITDS_enFifoFullINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int0FifoFull);
+	int8_t  ITDS_getFifoFullINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int0FifoFull);
+	int8_t  ITDS_enFifoThresholdINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int0FifoThresholdInt);
+	int8_t  ITDS_getFifoThresholdINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int0FifoThresholdInt);
+	int8_t  ITDS_enDataReadyINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int0DataReadyInt);
+	int8_t  ITDS_getDataReadyINT0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int0DataReadyInt);
 
 	/* CTRL-REG 5 */
-	int8_t  ITDS_enInactivityINT1(ITDS_state_t intSleepState);
-	int8_t  ITDS_getInactivityINT1(ITDS_state_t *intSleepState);
-	int8_t  ITDS_enActivityINT1(ITDS_state_t int1SleepChange);
-	int8_t  ITDS_getActivityINT1(ITDS_state_t *int1SleepChange);
-	int8_t  ITDS_enBootStatusINT1(ITDS_state_t int1Boot);
-	int8_t  ITDS_getBootStatusINT1(ITDS_state_t *int1Boot);
-	int8_t  ITDS_enTempDataReadyINT1(ITDS_state_t int1TempDataReady);
-	int8_t  ITDS_getTempDataReadyINT1(ITDS_state_t *int1TempDataReady);
-	int8_t  ITDS_enFifoOverrunIntINT1(ITDS_state_t int1FifoOverrun);
-	int8_t  ITDS_getFifoOverrunIntINT1(ITDS_state_t *int1FifoOverrun);
-	int8_t  ITDS_enFifoFullINT1(ITDS_state_t int1FifoFull);
-	int8_t  ITDS_getFifoFullINT1(ITDS_state_t *int1FifoFull);
-	int8_t  ITDS_enFifoThresholdIntINT1(ITDS_state_t int1FifoThresholdInt);
-	int8_t  ITDS_getFifoThresholdINT1(ITDS_state_t *int1FifoThresholdInt);
-	int8_t  ITDS_enDataReadyINT1(ITDS_state_t int1DataReadyInt);
-	int8_t  ITDS_getDataReadyINT1(ITDS_state_t *int1DataReadyInt);
+	int8_t  ITDS_enInactivityINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t intSleepState);
+	int8_t  ITDS_getInactivityINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *intSleepState);
+	int8_t  ITDS_enActivityINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1SleepChange);
+	int8_t  ITDS_getActivityINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1SleepChange);
+	int8_t  ITDS_enBootStatusINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1Boot);
+	int8_t  ITDS_getBootStatusINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1Boot);
+	int8_t  ITDS_enTempDataReadyINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1TempDataReady);
+	int8_t  ITDS_getTempDataReadyINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1TempDataReady);
+	int8_t  ITDS_enFifoOverrunIntINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1FifoOverrun);
+	int8_t  ITDS_getFifoOverrunIntINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1FifoOverrun);
+	int8_t  ITDS_enFifoFullINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1FifoFull);
+	int8_t  ITDS_getFifoFullINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1FifoFull);
+	int8_t  ITDS_enFifoThresholdIntINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1FifoThresholdInt);
+	int8_t  ITDS_getFifoThresholdINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1FifoThresholdInt);
+	int8_t  ITDS_enDataReadyINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1DataReadyInt);
+	int8_t  ITDS_getDataReadyINT1(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1DataReadyInt);
 
 	/* CTRL-REG 6 */
-	int8_t  ITDS_setFilteringCutoff(ITDS_bandwidth filteringCutoff);
-	int8_t  ITDS_getFilteringCutoff(ITDS_bandwidth *filteringCutoff);
-	int8_t  ITDS_setFullScale(ITDS_full_Scale fullScale_t);
-	int8_t  ITDS_getFullScale(ITDS_full_Scale *fullScale_t);
-	int8_t  ITDS_setfilterPath(ITDS_filter_Type filterType);
-	int8_t  ITDS_getfilterPath(ITDS_filter_Type *filterType);
-	int8_t  ITDS_enLowNoise(ITDS_state_t lowNoise);
-	int8_t  ITDS_getLowNoiseState(ITDS_state_t *lowNoise);
+	int8_t  ITDS_setFilteringCutoff(WE_sensorInterface_t *sensorInterface, ITDS_bandwidth filteringCutoff);
+	int8_t  ITDS_getFilteringCutoff(WE_sensorInterface_t *sensorInterface, ITDS_bandwidth *filteringCutoff);
+	int8_t  ITDS_setFullScale(WE_sensorInterface_t *sensorInterface, ITDS_full_Scale fullScale_t);
+	int8_t  ITDS_getFullScale(WE_sensorInterface_t *sensorInterface, ITDS_full_Scale *fullScale_t);
+	int8_t  ITDS_setfilterPath(WE_sensorInterface_t *sensorInterface, ITDS_filter_Type filterType);
+	int8_t  ITDS_getfilterPath(WE_sensorInterface_t *sensorInterface, ITDS_filter_Type *filterType);
+	int8_t  ITDS_enLowNoise(WE_sensorInterface_t *sensorInterface, ITDS_state_t lowNoise);
+	int8_t  ITDS_getLowNoiseState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *lowNoise);
 
 	/* Status */
-	int8_t  ITDS_getdataReadyState(ITDS_state_t *drdy);
-	int8_t  ITDS_getfreeFallState(ITDS_state_t *freeFall);
-	int8_t  ITDS_get6DState(ITDS_state_t *sixD);
-	int8_t  ITDS_getsingleTapState(ITDS_state_t *singleTap);
-	int8_t  ITDS_getdoubleTapState(ITDS_state_t *doubleTap);
-	int8_t  ITDS_getsleepState(ITDS_state_t *sleepState );
-	int8_t  ITDS_getwakeupState(ITDS_state_t *wakeupState );
-	int8_t  ITDS_getFifoThresholdStatus(ITDS_state_t *fifoTHR);
+	int8_t  ITDS_getdataReadyState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *drdy);
+	int8_t  ITDS_getfreeFallState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *freeFall);
+	int8_t  ITDS_get6DState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *sixD);
+	int8_t  ITDS_getsingleTapState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *singleTap);
+	int8_t  ITDS_getdoubleTapState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *doubleTap);
+	int8_t  ITDS_getsleepState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *sleepState );
+	int8_t  ITDS_getwakeupState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *wakeupState );
+	int8_t  ITDS_getFifoThresholdStatus(WE_sensorInterface_t *sensorInterface, ITDS_state_t *fifoTHR);
 
 	/*acceleration Output */
-	int8_t  ITDS_getRawAccelerationX(int16_t *XRawAcc);
-	int8_t  ITDS_getRawAccelerationY(int16_t *YRawAcc) ;
-	int8_t  ITDS_getRawAccelerationZ(int16_t *ZRawAcc);
+	int8_t  ITDS_getRawAccelerationX(WE_sensorInterface_t *sensorInterface, int16_t *XRawAcc);
+	int8_t  ITDS_getRawAccelerationY(WE_sensorInterface_t *sensorInterface, int16_t *YRawAcc) ;
+	int8_t  ITDS_getRawAccelerationZ(WE_sensorInterface_t *sensorInterface, int16_t *ZRawAcc);
+	int8_t  ITDS_getRawAccelerations(WE_sensorInterface_t *sensorInterface, int16_t *XRawAcc, int16_t *YRawAcc, int16_t *ZRawAcc);
+	int8_t  ITDS_getStatusAndRawAccelerations(WE_sensorInterface_t *sensorInterface, ITDS_status_t *status,
+			int16_t *XRawAcc, int16_t *YRawAcc, int16_t *ZRawAcc);
 
 	/* Temperature output */
-	int8_t  ITDS_getTemperature8bit(uint8_t *temp8bit);
-	int8_t  ITDS_getRawTemp12bit(int16_t *temp12bit);
-	int8_t  ITDS_getTemperature12bit(float *tempdegC);
+	int8_t  ITDS_getTemperature8bit(WE_sensorInterface_t *sensorInterface, uint8_t *temp8bit);
+	int8_t  ITDS_getRawTemp12bit(WE_sensorInterface_t *sensorInterface, int16_t *temp12bit);
+	int8_t  ITDS_getTemperature12bit(WE_sensorInterface_t *sensorInterface, float *tempdegC);
+	int8_t  ITDS_getTemperature12bit_int(WE_sensorInterface_t *sensorInterface, int16_t *tempCentiDegC);
+	int16_t ITDS_convertTemperature12bit_int(int16_t temp12bit);
 
 	/* FIFO CTRL */
-	int8_t  ITDS_setFifoMode(ITDS_Fifo_Mode FMode);
-	int8_t  ITDS_getFifoMode(ITDS_Fifo_Mode *FMode);
-	int8_t  ITDS_setFifoThreshold(uint8_t fifo_Threshold);
-	int8_t  ITDS_getFifoThreshold(uint8_t *fifo_Threshold);
+	int8_t  ITDS_setFifoMode(WE_sensorInterface_t *sensorInterface, ITDS_Fifo_Mode FMode);
+	int8_t  ITDS_getFifoMode(WE_sensorInterface_t *sensorInterface, ITDS_Fifo_Mode *FMode);
+	int8_t  ITDS_setFifoThreshold(WE_sensorInterface_t *sensorInterface, uint8_t fifo_Threshold);
+	int8_t  ITDS_getFifoThreshold(WE_sensorInterface_t *sensorInterface, uint8_t *fifo_Threshold);
 
 	/* FIFO_SAMPLES */
-	int8_t  ITDS_getFifoThresholdState(ITDS_state_t *fifoTHR);
-	int8_t  ITDS_getFifoOverrunState(ITDS_state_t *fifoOverrun);
-	int8_t  ITDS_getFifoFillLevel(uint8_t *fifoFill);
+	int8_t  ITDS_getFifoThresholdState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *fifoTHR);
+	int8_t  ITDS_getFifoOverrunState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *fifoOverrun);
+	int8_t  ITDS_getFifoFillLevel(WE_sensorInterface_t *sensorInterface, uint8_t *fifoFill);
+	int8_t  ITDS_getFifoStatus(WE_sensorInterface_t *sensorInterface, ITDS_fifo_samples_t *fifoStatus);
+	int8_t  ITDS_getRawFifoSamples(WE_sensorInterface_t *sensorInterface, uint8_t numSamples, int16_t samples[][3]);
 
 	/* TAP_X_TH */
-	int8_t  ITDS_en4DDetection(ITDS_state_t detection4D);
-	int8_t  ITDS_get4DDetectionState(ITDS_state_t *detection4D);
-	int8_t  ITDS_setTapThresholdX(uint8_t tapThresholdX);
-	int8_t  ITDS_getTapThresholdX(uint8_t *tapThresholdX);
-	int8_t  ITDS_set6DThreshold(ITDS_threshold_Degree threshold6D);
-	int8_t  ITDS_get6DThreshold(ITDS_threshold_Degree *threshold6D);
+	int8_t  ITDS_en4DDetection(WE_sensorInterface_t *sensorInterface, ITDS_state_t detection4D);
+	int8_t  ITDS_get4DDetectionState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *detection4D);
+	int8_t  ITDS_setTapThresholdX(WE_sensorInterface_t *sensorInterface, uint8_t tapThresholdX);
+	int8_t  ITDS_getTapThresholdX(WE_sensorInterface_t *sensorInterface, uint8_t *tapThresholdX);
+	int8_t  ITDS_set6DThreshold(WE_sensorInterface_t *sensorInterface, ITDS_threshold_Degree threshold6D);
+	int8_t  ITDS_get6DThreshold(WE_sensorInterface_t *sensorInterface, ITDS_threshold_Degree *threshold6D);
 
 	/* TAP_Y_TH */
-	int8_t  ITDS_setTapThresholdY(uint8_t tapThresholdY);
-	int8_t  ITDS_getTapThresholdY(uint8_t *tapThresholdY);
-	int8_t  ITDS_setTapAxisPriority(ITDS_tap_Axis_Priority tapPriorityAxis);
-	int8_t  ITDS_getTapAxisPriority(ITDS_tap_Axis_Priority *tapPriorityAxis);
+	int8_t  ITDS_setTapThresholdY(WE_sensorInterface_t *sensorInterface, uint8_t tapThresholdY);
+	int8_t  ITDS_getTapThresholdY(WE_sensorInterface_t *sensorInterface, uint8_t *tapThresholdY);
+	int8_t  ITDS_setTapAxisPriority(WE_sensorInterface_t *sensorInterface, ITDS_tap_Axis_Priority tapPriorityAxis);
+	int8_t  ITDS_getTapAxisPriority(WE_sensorInterface_t *sensorInterface, ITDS_tap_Axis_Priority *tapPriorityAxis);
 
 
 	/* TAP_Z_TH */
-	int8_t  ITDS_setTapThresholdZ(uint8_t tapThresholdZ);
-	int8_t  ITDS_getTapThresholdZ(uint8_t *tapThresholdZ);
-	int8_t  ITDS_enTapX(ITDS_state_t tapX);
-	int8_t  ITDS_getTapX(ITDS_state_t *tapX);
-	int8_t  ITDS_enTapY(ITDS_state_t tapY);
-	int8_t  ITDS_getTapY(ITDS_state_t *tapY);
-	int8_t  ITDS_enTapZ(ITDS_state_t tapZ);
-	int8_t  ITDS_getTapZ(ITDS_state_t *tapZ);
+	int8_t  ITDS_setTapThresholdZ(WE_sensorInterface_t *sensorInterface, uint8_t tapThresholdZ);
+	int8_t  ITDS_getTapThresholdZ(WE_sensorInterface_t *sensorInterface, uint8_t *tapThresholdZ);
+	int8_t  ITDS_enTapX(WE_sensorInterface_t *sensorInterface, ITDS_state_t tapX);
+	int8_t  ITDS_getTapX(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tapX);
+	int8_t  ITDS_enTapY(WE_sensorInterface_t *sensorInterface, ITDS_state_t tapY);
+	int8_t  ITDS_getTapY(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tapY);
+	int8_t  ITDS_enTapZ(WE_sensorInterface_t *sensorInterface, ITDS_state_t tapZ);
+	int8_t  ITDS_getTapZ(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tapZ);
 
 	/* INT_DUR */
-	int8_t  ITDS_setLatency(uint8_t latency_t);
-	int8_t  ITDS_getLatency(uint8_t *latency_t);
-	int8_t  ITDS_setQuiet(uint8_t quiet_t);
-	int8_t  ITDS_getQuiet(uint8_t *quiet_t);
-	int8_t  ITDS_setShock(uint8_t shock_t);
-	int8_t  ITDS_getShock(uint8_t *shock_t);
+	int8_t  ITDS_setLatency(WE_sensorInterface_t *sensorInterface, uint8_t latency_t);
+	int8_t  ITDS_getLatency(WE_sensorInterface_t *sensorInterface, uint8_t *latency_t);
+	int8_t  ITDS_setQuiet(WE_sensorInterface_t *sensorInterface, uint8_t quiet_t);
+	int8_t  ITDS_getQuiet(WE_sensorInterface_t *sensorInterface, uint8_t *quiet_t);
+	int8_t  ITDS_setShock(WE_sensorInterface_t *sensorInterface, uint8_t shock_t);
+	int8_t  ITDS_getShock(WE_sensorInterface_t *sensorInterface, uint8_t *shock_t);
 
 	/* WAKE_UP_TH */
-	int8_t  ITDS_enTapEvent(ITDS_state_t singleDoubleTap);    /*Enable single/double-tap event. Default value: 0 (0: enable only single-tap, 1: enable both single and double-tap) */
-	int8_t  ITDS_getTapEvent(ITDS_state_t *singleDoubleTap);  /* only Single Tap is enabled or Single and double Tap are both enabled */
-	int8_t  ITDS_enInactivity(ITDS_state_t sleep);
-	int8_t  ITDS_getInactivityState(ITDS_state_t *sleep) ;
-	int8_t  ITDS_setWakeupThreshold(uint8_t WakeupTHR);
-	int8_t  ITDS_getWakeupThreshold(uint8_t *WakeupTHR);
+	int8_t  ITDS_enTapEvent(WE_sensorInterface_t *sensorInterface, ITDS_state_t singleDoubleTap);    /*Enable single/double-tap event. Default value: 0 (0: enable only single-tap, 1: enable both single and double-tap) */
+	int8_t  ITDS_getTapEvent(WE_sensorInterface_t *sensorInterface, ITDS_state_t *singleDoubleTap);  /* only Single Tap is enabled or Single and double Tap are both enabled */
+	int8_t  ITDS_enInactivity(WE_sensorInterface_t *sensorInterface, ITDS_state_t sleep);
+	int8_t  ITDS_getInactivityState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *sleep) ;
+	int8_t  ITDS_setWakeupThreshold(WE_sensorInterface_t *sensorInterface, uint8_t WakeupTHR);
+	int8_t  ITDS_getWakeupThreshold(WE_sensorInterface_t *sensorInterface, uint8_t *WakeupTHR);
 
 	/* WAKE_UP_DUR */
-	int8_t  ITDS_setFreeFallDurationMSB(ITDS_state_t FF_DUR5);
-	int8_t  ITDS_getFreeFallDurationMSB(ITDS_state_t *FF_DUR5);
-	int8_t  ITDS_setWakeupDuration(uint8_t wakeupDuration);
-	int8_t  ITDS_getWakeupDuration(uint8_t *wakeupDuration);
-	int8_t  ITDS_enStationnaryDetection(ITDS_state_t stationary);
-	int8_t  ITDS_getStationnaryState(ITDS_state_t *stationary);
-	int8_t  ITDS_setSleepDuration(uint8_t sleepDur);
-	int8_t  ITDS_getSleepDuration(uint8_t *sleepDur);
+	int8_t  ITDS_setFreeFallDurationMSB(WE_sensorInterface_t *sensorInterface, ITDS_state_t FF_DUR5);
+	int8_t  ITDS_getFreeFallDurationMSB(WE_sensorInterface_t *sensorInterface, ITDS_state_t *FF_DUR5);
+	int8_t  ITDS_setWakeupDuration(WE_sensorInterface_t *sensorInterface, uint8_t wakeupDuration);
+	int8_t  ITDS_getWakeupDuration(WE_sensorInterface_t *sensorInterface, uint8_t *wakeupDuration);
+	int8_t  ITDS_enStationnaryDetection(WE_sensorInterface_t *sensorInterface, ITDS_state_t stationary);
+	int8_t  ITDS_getStationnaryState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *stationary);
+	int8_t  ITDS_setSleepDuration(WE_sensorInterface_t *sensorInterface, uint8_t sleepDur);
+	int8_t  ITDS_getSleepDuration(WE_sensorInterface_t *sensorInterface, uint8_t *sleepDur);
 
 	/* FREE_FALL */
-	int8_t ITDS_setFreeFallDurationLSB(uint8_t freeFallDuration);
-	int8_t ITDS_getFreeFallDurationLSB(uint8_t *freeFallDuration);
-	int8_t ITDS_setFreeFallThreshold(ITDS_Free_Fall_Thr FF_TH);
-	int8_t ITDS_getFreeFallThreshold(ITDS_Free_Fall_Thr *FF_TH);
+	int8_t ITDS_setFreeFallDurationLSB(WE_sensorInterface_t *sensorInterface, uint8_t freeFallDuration);
+	int8_t ITDS_getFreeFallDurationLSB(WE_sensorInterface_t *sensorInterface, uint8_t *freeFallDuration);
+	int8_t ITDS_setFreeFallThreshold(WE_sensorInterface_t *sensorInterface, ITDS_Free_Fall_Thr FF_TH);
+	int8_t ITDS_getFreeFallThreshold(WE_sensorInterface_t *sensorInterface, ITDS_Free_Fall_Thr *FF_TH);
+
+	/* TAP_X_TH ... FREE_FALL */
+	int8_t ITDS_setDetectionProfile(WE_sensorInterface_t *sensorInterface, const ITDS_detection_Profile_t *profile);
 
 	/* STATUS_DETECT */
-	int8_t ITDS_getTempDrdy(ITDS_state_t *tempDrdy );
-	int8_t ITDS_getSleepState(ITDS_state_t *sleepState);
-	int8_t ITDS_getDoubleTapState(ITDS_state_t *doubleTap);
-	int8_t ITDS_getSingleTapState(ITDS_state_t *singleTap);
-	int8_t ITDS_getDrdy(ITDS_state_t *drdy);
+	int8_t ITDS_getTempDrdy(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tempDrdy );
+	int8_t ITDS_getSleepState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *sleepState);
+	int8_t ITDS_getDoubleTapState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *doubleTap);
+	int8_t ITDS_getSingleTapState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *singleTap);
+	int8_t ITDS_getDrdy(WE_sensorInterface_t *sensorInterface, ITDS_state_t *drdy);
 
 	/* WAKE_UP_EVENT */
-	int8_t ITDS_getWakeupX(ITDS_state_t *wakeUpX);
-	int8_t ITDS_getWakeupY(ITDS_state_t *wakeUpY);
-	int8_t ITDS_getWakeupZ(ITDS_state_t *wakeUpZ);
-	int8_t ITDS_getWakeupState(ITDS_state_t *wakeUpState );
+	int8_t ITDS_getWakeupX(WE_sensorInterface_t *sensorInterface, ITDS_state_t *wakeUpX);
+	int8_t ITDS_getWakeupY(WE_sensorInterface_t *sensorInterface, ITDS_state_t *wakeUpY);
+	int8_t ITDS_getWakeupZ(WE_sensorInterface_t *sensorInterface, ITDS_state_t *wakeUpZ);
+	int8_t ITDS_getWakeupState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *wakeUpState );
 
 	/* TAP_EVENT */
-	int8_t ITDS_getTapEventState(ITDS_state_t *tapEvent);
-	int8_t ITDS_getTapSign(ITDS_tapSign_t *tapSign);
-	int8_t ITDS_getTapXAxis(ITDS_state_t *tapXAxis);
-	int8_t ITDS_getTapYAxis(ITDS_state_t *tapYAxis);
-	int8_t ITDS_getTapZAxis(ITDS_state_t *tapZAxis);
+	int8_t ITDS_getTapEventState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tapEvent);
+	int8_t ITDS_getTapSign(WE_sensorInterface_t *sensorInterface, ITDS_tapSign_t *tapSign);
+	int8_t ITDS_getTapXAxis(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tapXAxis);
+	int8_t ITDS_getTapYAxis(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tapYAxis);
+	int8_t ITDS_getTapZAxis(WE_sensorInterface_t *sensorInterface, ITDS_state_t *tapZAxis);
 
 	/* 6D_EVENT*/
-	int8_t ITDS_getZHOverThresholdState(ITDS_state_t *ZHOverThreshold);
-	int8_t ITDS_getZLOverThresholdState(ITDS_state_t *ZLOverThreshold);
-	int8_t ITDS_getYHOverThresholdState(ITDS_state_t *YHOverThreshold);
-	int8_t ITDS_getYLOverThresholdState(ITDS_state_t *YLOverThreshold);
-	int8_t ITDS_getXHOverThresholdState(ITDS_state_t *XHOverThreshold);
-	int8_t ITDS_getXLOverThresholdState(ITDS_state_t *XLOverThreshold);
+	int8_t ITDS_getZHOverThresholdState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *ZHOverThreshold);
+	int8_t ITDS_getZLOverThresholdState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *ZLOverThreshold);
+	int8_t ITDS_getYHOverThresholdState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *YHOverThreshold);
+	int8_t ITDS_getYLOverThresholdState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *YLOverThreshold);
+	int8_t ITDS_getXHOverThresholdState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *XHOverThreshold);
+	int8_t ITDS_getXLOverThresholdState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *XLOverThreshold);
 
 	/* ALL_INT_EVENT */
-	int8_t ITDS_getSleepChangeState(ITDS_state_t *sleep);
+	int8_t ITDS_getSleepChangeState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *sleep);
+	int8_t ITDS_getEventBlock(WE_sensorInterface_t *sensorInterface, ITDS_event_block_t *events);
 
 	/* X_Y_Z_OFS_USR */
-	int8_t ITDS_setOffsetValueOnXAxis(uint8_t offsetvalueXAxis);
-	int8_t ITDS_getOffsetValueOnXAxis(uint8_t *offsetvalueXAxis);
-	int8_t ITDS_setOffsetValueOnYAxis(uint8_t offsetvalueYAxis);
-	int8_t ITDS_getOffsetValueOnYAxis(uint8_t *offsetvalueYAxis);
-	int8_t ITDS_setOffsetValueOnZAxis(uint8_t offsetvalueZAxis);
-	int8_t ITDS_getOffsetValueOnZAxis(uint8_t *offsetvalueZAxis);
+	int8_t ITDS_setOffsetValueOnXAxis(WE_sensorInterface_t *sensorInterface, uint8_t offsetvalueXAxis);
+	int8_t ITDS_getOffsetValueOnXAxis(WE_sensorInterface_t *sensorInterface, uint8_t *offsetvalueXAxis);
+	int8_t ITDS_setOffsetValueOnYAxis(WE_sensorInterface_t *sensorInterface, uint8_t offsetvalueYAxis);
+	int8_t ITDS_getOffsetValueOnYAxis(WE_sensorInterface_t *sensorInterface, uint8_t *offsetvalueYAxis);
+	int8_t ITDS_setOffsetValueOnZAxis(WE_sensorInterface_t *sensorInterface, uint8_t offsetvalueZAxis);
+	int8_t ITDS_getOffsetValueOnZAxis(WE_sensorInterface_t *sensorInterface, uint8_t *offsetvalueZAxis);
+	int8_t ITDS_setUserOffset(WE_sensorInterface_t *sensorInterface, const ITDS_user_Offset_t *userOffset, ITDS_state_t apply);
+	int8_t ITDS_getUserOffset(WE_sensorInterface_t *sensorInterface, ITDS_user_Offset_t *userOffset);
 
 	/* CTRL_7 */
-	int8_t ITDS_setDrdyPulse(ITDS_drdy_pulse  drdyPulsed);        	/* latched or pulsed DRDY */
-	int8_t ITDS_getDrdyPulseIntMode(ITDS_drdy_pulse  *drdyPulsed); /* latched or pulsed DRDY */
-	int8_t ITDS_setInt1OnInt0(ITDS_state_t int1Onint0);
-	int8_t ITDS_getInt1OnInt0(ITDS_state_t *int1Onint0) ;
-	int8_t ITDS_enInterrups(ITDS_state_t interrupts);
-	int8_t ITDS_getInterruptsState(ITDS_state_t *interrupts);
-	int8_t ITDS_enApplyOffsetXL(ITDS_state_t offsetXLOutput);
-	int8_t ITDS_getApplyOffsetXL(ITDS_state_t *offsetXLOutput);
-	int8_t ITDS_enApplyWakeUpOffsetXL(ITDS_state_t offsetXLWakeup);
-	int8_t ITDS_getApplyWakeUpOffsetXL(ITDS_state_t *offsetXLWakeup);
-
-	int8_t ITDS_setOffsetWeight(ITDS_state_t offsetWeight);
-	int8_t ITDS_getOffsetWeight(ITDS_state_t *offsetWeight);
-
-	int8_t ITDS_enHighPassRefMode(ITDS_state_t refMode);
-	int8_t ITDS_getHighPassRefMode(ITDS_state_t *refMode);
-
-	int8_t ITDS_enLowPassOn6D(ITDS_state_t LPassOn6D);
-	int8_t ITDS_getLowPassOn6DState(ITDS_state_t *LPassOn6D);
+	int8_t ITDS_setDrdyPulse(WE_sensorInterface_t *sensorInterface, ITDS_drdy_pulse  drdyPulsed);        	/* latched or pulsed DRDY */
+	int8_t ITDS_getDrdyPulseIntMode(WE_sensorInterface_t *sensorInterface, ITDS_drdy_pulse  *drdyPulsed); /* latched or pulsed DRDY */
+	int8_t ITDS_setInt1OnInt0(WE_sensorInterface_t *sensorInterface, ITDS_state_t int1Onint0);
+	int8_t ITDS_getInt1OnInt0(WE_sensorInterface_t *sensorInterface, ITDS_state_t *int1Onint0) ;
+	int8_t ITDS_enInterrups(WE_sensorInterface_t *sensorInterface, ITDS_state_t interrupts);
+	int8_t ITDS_getInterruptsState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *interrupts);
+	int8_t ITDS_enApplyOffsetXL(WE_sensorInterface_t *sensorInterface, ITDS_state_t offsetXLOutput);
+	int8_t ITDS_getApplyOffsetXL(WE_sensorInterface_t *sensorInterface, ITDS_state_t *offsetXLOutput);
+	int8_t ITDS_enApplyWakeUpOffsetXL(WE_sensorInterface_t *sensorInterface, ITDS_state_t offsetXLWakeup);
+	int8_t ITDS_getApplyWakeUpOffsetXL(WE_sensorInterface_t *sensorInterface, ITDS_state_t *offsetXLWakeup);
+
+	int8_t ITDS_setOffsetWeight(WE_sensorInterface_t *sensorInterface, ITDS_state_t offsetWeight);
+	int8_t ITDS_getOffsetWeight(WE_sensorInterface_t *sensorInterface, ITDS_state_t *offsetWeight);
+
+	int8_t ITDS_enHighPassRefMode(WE_sensorInterface_t *sensorInterface, ITDS_state_t refMode);
+	int8_t ITDS_getHighPassRefMode(WE_sensorInterface_t *sensorInterface, ITDS_state_t *refMode);
+
+	int8_t ITDS_enLowPassOn6D(WE_sensorInterface_t *sensorInterface, ITDS_state_t LPassOn6D);
+	int8_t ITDS_getLowPassOn6DState(WE_sensorInterface_t *sensorInterface, ITDS_state_t *LPassOn6D);
+
+	/* Conversion of raw acceleration */
+	int8_t ITDS_getAccConversion(ITDS_full_Scale fullScale, ITDS_acc_Unit unit, ITDS_acc_Conversion_t *conversion);
+	int32_t ITDS_convertAcceleration_int(int16_t acc, const ITDS_acc_Conversion_t *conversion);
+	void ITDS_convertAccelerations_int(const int16_t raw[][3], int32_t acc[][3], uint16_t numSamples, const ITDS_acc_Conversion_t *conversion);
+	void ITDS_convertAccelerations_float(const int16_t raw[][3], float acc[][3], uint16_t numSamples, float sensitivity);
 
 
 #ifdef __cplusplus
@@ -29,11 +29,26 @@
 /**
    @brief  Initialize the I2C Interface
    @param  I2C address
+   @param  Bus instance of the transport, NULL selects the default bus
+   @param  Transport, NULL selects the default transport of the platform
    @retval Error Code
 */
-int Sensor_PADS::init(int address)
+int Sensor_PADS::init(int address, void *handle, const WE_transport_t *transport)
 {
-  return I2CInit(address);
+  sensorInterface.handle = handle;
+  sensorInterface.transport = transport;
+  WE_initRegisterCache(&registerCache, PADS_cachedRegisters, PADS_CACHED_REGISTERS, 0, cacheValues);
+  sensorInterface.cache = &registerCache;
+  return I2CInit(&sensorInterface, address);
+}
+
+/**
+   @brief  Get the bus interface of the sensor, e.g. to queue asynchronous requests
+   @retval Pointer to sensor interface
+*/
+WE_sensorInterface_t *Sensor_PADS::get_Interface()
+{
+  return &sensorInterface;
 }
 
 /**
@@ -44,7 +59,7 @@ int Sensor_PADS::get_DeviceID()
 {
   uint8_t devID;
 
-  if (PADS_getDeviceID(&devID) == WE_SUCCESS)
+  if (PADS_getDeviceID(&sensorInterface, &devID) == WE_SUCCESS)
   {
     return devID;
   }
@@ -63,49 +78,49 @@ int Sensor_PADS::select_ODR()
 
     case 200:
     {
-      PADS_setOutputDataRate(PADS_ODR_200HZ);
+      PADS_setOutputDataRate(&sensorInterface, PADS_ODR_200HZ);
       break;
     }
 
     case 100:
     {
-      PADS_setOutputDataRate(PADS_ODR_100HZ);
+      PADS_setOutputDataRate(&sensorInterface, PADS_ODR_100HZ);
       break;
     }
 
     case 75:
     {
-      PADS_setOutputDataRate(PADS_ODR_75HZ);
+      PADS_setOutputDataRate(&sensorInterface, PADS_ODR_75HZ);
       break;
     }
 
     case 50:
     {
-      PADS_setOutputDataRate(PADS_ODR_50HZ);
+      PADS_setOutputDataRate(&sensorInterface, PADS_ODR_50HZ);
       break;
     }
 
     case 25:
     {
-      PADS_setOutputDataRate(PADS_ODR_25HZ);
+      PADS_setOutputDataRate(&sensorInterface, PADS_ODR_25HZ);
       break;
     }
 
     case 10:
     {
-      PADS_setOutputDataRate(PADS_ODR_10HZ);
+      PADS_setOutputDataRate(&sensorInterface, PADS_ODR_10HZ);
       break;
     }
 
     case 1:
     {
-      PADS_setOutputDataRate(PADS_ODR_1HZ); // Low ODR bit is enabled, ODR 1 Hz
+      PADS_setOutputDataRate(&sensorInterface, PADS_ODR_1HZ); // Low ODR bit is enabled, ODR 1 Hz
       break;
     }
 
     case 0:
     {
-      PADS_setOutputDataRate(PADS_ODR_PowerDown);
+      PADS_setOutputDataRate(&sensorInterface, PADS_ODR_PowerDown);
       break;
     }
 
@@ -124,11 +139,11 @@ int Sensor_PADS::power_down()
 {
   ODR = 0;
   
-  if (WE_FAIL == PADS_setBlockDataUpdate(PADS_enable))
+  if (WE_FAIL == PADS_setBlockDataUpdate(&sensorInterface, PADS_enable))
   {
 	  return WE_FAIL;
   }
-  if (WE_FAIL == PADS_setAutoIncrement(PADS_enable))
+  if (WE_FAIL == PADS_setAutoIncrement(&sensorInterface, PADS_enable))
   {
 	  return WE_FAIL;
   }
@@ -145,7 +160,7 @@ int Sensor_PADS::power_down()
 */
 int Sensor_PADS::SW_RESET()
 {
-   if (WE_FAIL == PADS_setSwreset(PADS_enable))
+   if (WE_FAIL == PADS_setSwreset(&sensorInterface, PADS_enable))
    {
 	  return WE_FAIL;
   }
@@ -157,15 +172,15 @@ int Sensor_PADS::SW_RESET()
 */
 int Sensor_PADS::oneshot()
 {
-  if (WE_FAIL == PADS_setBlockDataUpdate(PADS_enable))
+  if (WE_FAIL == PADS_setBlockDataUpdate(&sensorInterface, PADS_enable))
   {
 	  return WE_FAIL;
   }
-  if (WE_FAIL == PADS_setAutoIncrement(PADS_enable))
+  if (WE_FAIL == PADS_setAutoIncrement(&sensorInterface, PADS_enable))
   {
 	  return WE_FAIL;
   }
-  if (WE_FAIL == PADS_setSingleConvMode(PADS_enable)) // enable one shot bit
+  if (WE_FAIL == PADS_setSingleConvMode(&sensorInterface, PADS_enable)) // enable one shot bit
   {
 	  return WE_FAIL;
   }
@@ -183,7 +198,7 @@ int Sensor_PADS::oneshot()
 
 int Sensor_PADS::ready_to_read(PADS_state_t *stateTemperature, PADS_state_t *statePressure)
 {
-  int result = PADS_getStatusDrdy(stateTemperature, statePressure);
+  int result = PADS_getStatusDrdy(&sensorInterface, stateTemperature, statePressure);
   if(result == WE_FAIL) 
   {
     return WE_FAIL;
@@ -204,7 +219,7 @@ int Sensor_PADS::ready_to_read(PADS_state_t *stateTemperature, PADS_state_t *sta
 int Sensor_PADS::temp_ready_to_read()
 {
   PADS_state_t state;
-  int result = PADS_getTempStatus(&state);
+  int result = PADS_getTempStatus(&sensorInterface, &state);
 
   if(result == WE_FAIL) 
   { 
@@ -226,7 +241,7 @@ int Sensor_PADS::temp_ready_to_read()
 int Sensor_PADS::pressure_ready_to_read()
 {
   PADS_state_t state;
-  int result = PADS_getPresStatus(&state);
+  int result = PADS_getPresStatus(&sensorInterface, &state);
   
   if(result == WE_FAIL) 
   {
@@ -246,7 +261,7 @@ int Sensor_PADS::pressure_ready_to_read()
 int Sensor_PADS::read_temperature(float *temperature)
 {
   float float_temp;
-  if (WE_FAIL == PADS_getRAWTemperature(&rawTemp))
+  if (WE_FAIL == PADS_getRAWTemperature(&sensorInterface, &rawTemp))
   {
 	return WE_FAIL;
   }  
@@ -273,7 +288,7 @@ int Sensor_PADS::read_temperature(float *temperature)
 int Sensor_PADS::read_pressure(float *pressure)
 {
   float float_pressure;
-  if (WE_FAIL == PADS_getPressure(&float_pressure))
+  if (WE_FAIL == PADS_getPressure(&sensorInterface, &float_pressure))
   {
 	  return WE_FAIL;
   }
@@ -288,7 +303,7 @@ int Sensor_PADS::read_pressure(float *pressure)
 */
 int Sensor_PADS::set_low_noise_mode()
 {
-  if (WE_FAIL == PADS_setPowerMode(PADS_lowNoise))
+  if (WE_FAIL == PADS_setPowerMode(&sensorInterface, PADS_lowNoise))
   {
 	  return WE_FAIL;
   }
@@ -303,7 +318,7 @@ int Sensor_PADS::set_low_noise_mode()
 
 int Sensor_PADS::set_low_pass_configuration()
 {
-  if (WE_FAIL == PADS_setLowPassFilterConf(lPfilterBW2))
+  if (WE_FAIL == PADS_setLowPassFilterConf(&sensorInterface, lPfilterBW2))
   {
 	  return WE_FAIL;
   }
@@ -318,7 +333,7 @@ int Sensor_PADS::set_low_pass_configuration()
 
 int Sensor_PADS::set_low_pass_filter()
 {
-  if (WE_FAIL == PADS_setLowPassFilter(PADS_enable))
+  if (WE_FAIL == PADS_setLowPassFilter(&sensorInterface, PADS_enable))
     {
 	  return WE_FAIL;
   }
@@ -372,7 +387,7 @@ int Sensor_PADS::set_continuous_mode(int _ODR)
 */
 int Sensor_PADS::set_FIFO_mode(int fifoMode)
 {
-  if (WE_FAIL == PADS_setFifoMode((PADS_fifo_mode_t)fifoMode))
+  if (WE_FAIL == PADS_setFifoMode(&sensorInterface, (PADS_fifo_mode_t)fifoMode))
   {
 	return WE_FAIL;
   }
@@ -387,7 +402,7 @@ int Sensor_PADS::set_FIFO_mode(int fifoMode)
 int Sensor_PADS::get_FIFO_mode(int *mode)
 {
   PADS_fifo_mode_t fifoMode;
-  if (WE_FAIL == PADS_getFifoMode(&fifoMode))
+  if (WE_FAIL == PADS_getFifoMode(&sensorInterface, &fifoMode))
   {
 	return WE_FAIL;
   }
@@ -406,7 +421,7 @@ int Sensor_PADS::read_FIFO_temperature(float *temperature)
 {
   float float_temp;
 
-  if (WE_FAIL == PADS_getFifoRAWTemperature(&rawTemp))
+  if (WE_FAIL == PADS_getFifoRAWTemperature(&sensorInterface, &rawTemp))
   {
 	return WE_FAIL;
   }
@@ -433,7 +448,7 @@ int Sensor_PADS::read_FIFO_temperature(float *temperature)
 int Sensor_PADS::read_FIFO_pressure(float *pressure)
 {
   float float_pressure;
-  if (WE_FAIL == PADS_getFifoPressure(&float_pressure))
+  if (WE_FAIL == PADS_getFifoPressure(&sensorInterface, &float_pressure))
   {
 	return WE_FAIL;
   }
@@ -448,7 +463,7 @@ int Sensor_PADS::read_FIFO_pressure(float *pressure)
 int Sensor_PADS::get_FIFO_fill_level(int *lvl)
 {
   uint8_t fifoLevel;
-  if (WE_FAIL == PADS_getFifoFillLevel(&fifoLevel))
+  if (WE_FAIL == PADS_getFifoFillLevel(&sensorInterface, &fifoLevel))
   {
 	return WE_FAIL;
   }
@@ -32,7 +32,8 @@ class Sensor_PADS
 {
 
 public:
-    int init(int address);
+    int init(int address, void *handle = NULL, const WE_transport_t *transport = NULL);
+    WE_sensorInterface_t *get_Interface();
     int get_DeviceID();
 
     int power_down();
@@ -40,8 +41,8 @@ public:
     int oneshot();
 	
     int ready_to_read(PADS_state_t *stateTemperature, PADS_state_t *statePressure);
-	int Sensor_PADS::temp_ready_to_read();
-	int Sensor_PADS::pressure_ready_to_read();
+	int temp_ready_to_read();
+	int pressure_ready_to_read();
 
     int read_temperature(float *temperature);
     int read_pressure(float *presure);
@@ -62,6 +63,9 @@ public:
     int ODR;
 
 private:
+    WE_sensorInterface_t sensorInterface;
+    WE_registerCache_t registerCache;
+    uint8_t cacheValues[PADS_CACHED_REGISTERS];
     uint16_t rawTemp;
     uint32_t rawPres;
     float T_neg;
@@ -27,14 +27,34 @@
 #include <stdio.h>
 
 
+/**
+* @brief  Registers held in the register cache of the sensor interface:
+*         configuration registers
+*/
+const WE_cachedRegister_t PADS_cachedRegisters[PADS_CACHED_REGISTERS] = {
+	{ PADS_INT_CFG_REG, 0x50, 0 },     /* RESET_ARP, RESET_AZ */
+	{ PADS_THR_P_L_REG, 0, 0 },
+	{ PADS_THR_P_H_REG, 0, 0 },
+	{ PADS_INTERFACE_CTRL_REG, 0, 0 },
+	{ PADS_CTRL_1_REG, 0, 0 },
+	{ PADS_CTRL_2_REG, 0x01, 0x84 },   /* ONE_SHOT; BOOT, SWRESET */
+	{ PADS_CTRL_3_REG, 0, 0 },
+	{ PADS_FIFO_CTRL_REG, 0, 0 },
+	{ PADS_FIFO_WTM_REG, 0, 0 },
+	{ PADS_OPC_P_L_REG, 0, 0 },
+	{ PADS_OPC_P_H_REG, 0, 0 }
+};
+
+
 /**
 * @brief  Read the device ID
+* @param  Pointer to sensor interface
 * @param  Pointer to device ID.
 * @retval Error code
 */
-int8_t PADS_getDeviceID(uint8_t *devID)
+int8_t PADS_getDeviceID(WE_sensorInterface_t *sensorInterface, uint8_t *devID)
 {
-	if (WE_FAIL == ReadReg((uint8_t)PADS_DEVICE_ID_REG, 1, devID))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_DEVICE_ID_REG, 1, devID))
 	return WE_FAIL;
 
 	return WE_SUCCESS; /* expected value is PADS_DEVICE_ID_VALUE */
@@ -43,20 +63,21 @@ int8_t PADS_getDeviceID(uint8_t *devID)
 
 /**
 * @brief  Set the output data rate of the sensor
+* @param  Pointer to sensor interface
 * @param  output data rate
 * @retval Error code
 */
-int8_t PADS_setOutputDataRate(PADS_output_data_rate_t odr)
+int8_t PADS_setOutputDataRate(WE_sensorInterface_t *sensorInterface, PADS_output_data_rate_t odr)
 {
 
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.outputDataRate = odr;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -64,14 +85,15 @@ int8_t PADS_setOutputDataRate(PADS_output_data_rate_t odr)
 
 /**
 * @brief  Read the output data rate of the sensor
+* @param  Pointer to sensor interface
 * @param  Pointer to Output Data Rate
 * @retval Error code
 */
-int8_t PADS_getOutputDataRate(PADS_output_data_rate_t* odr)
+int8_t PADS_getOutputDataRate(WE_sensorInterface_t *sensorInterface, PADS_output_data_rate_t* odr)
 {
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*odr = (PADS_output_data_rate_t)ctrl_reg_1.outputDataRate;
@@ -80,19 +102,20 @@ int8_t PADS_getOutputDataRate(PADS_output_data_rate_t* odr)
 
 /**
 * @brief  Set the low pass filter state
+* @param  Pointer to sensor interface
 * @param  filter state
 * @retval Error code
 */
-int8_t PADS_setLowPassFilter(PADS_state_t filterStatus)
+int8_t PADS_setLowPassFilter(WE_sensorInterface_t *sensorInterface, PADS_state_t filterStatus)
 {
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.enLowPassFilter = filterStatus;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -100,14 +123,15 @@ int8_t PADS_setLowPassFilter(PADS_state_t filterStatus)
 
 /**
 * @brief  Get the status of the low pass filter
+* @param  Pointer to sensor interface
 * @param  Pointer to Low pass filter state
 * @retval Error code
 */
-int8_t PADS_getLowPassFilterStatus(PADS_state_t *filterStatus)
+int8_t PADS_getLowPassFilterStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *filterStatus)
 {
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 	*filterStatus = (PADS_state_t)ctrl_reg_1.enLowPassFilter;
 
@@ -116,19 +140,20 @@ int8_t PADS_getLowPassFilterStatus(PADS_state_t *filterStatus)
 
 /**
 * @brief  Set the low pass filter configuration
+* @param  Pointer to sensor interface
 * @param  configuration parameter
 * @retval Error code
 */
-int8_t PADS_setLowPassFilterConf(PADS_filter_conf_t conf)
+int8_t PADS_setLowPassFilterConf(WE_sensorInterface_t *sensorInterface, PADS_filter_conf_t conf)
 {
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.lowPassFilterConfig = conf;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -137,14 +162,15 @@ int8_t PADS_setLowPassFilterConf(PADS_filter_conf_t conf)
 
 /**
 * @brief  Read the low pass filter configuration
+* @param  Pointer to sensor interface
 * @param  Pointer to Low pass filter configuration
 * @retval Error code
 */
-int8_t PADS_getLowPassFilterConf(PADS_filter_conf_t *conf )
+int8_t PADS_getLowPassFilterConf(WE_sensorInterface_t *sensorInterface, PADS_filter_conf_t *conf )
 {
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 	*conf = (PADS_filter_conf_t)ctrl_reg_1.lowPassFilterConfig;
 
@@ -153,19 +179,20 @@ int8_t PADS_getLowPassFilterConf(PADS_filter_conf_t *conf )
 
 /**
 * @brief  Set the block data update state
+* @param  Pointer to sensor interface
 * @param  BDU state
 * @retval Error code
 */
-int8_t PADS_setBlockDataUpdate(PADS_state_t bdu)
+int8_t PADS_setBlockDataUpdate(WE_sensorInterface_t *sensorInterface, PADS_state_t bdu)
 {
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.blockDataUpdate = bdu;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -173,14 +200,15 @@ int8_t PADS_setBlockDataUpdate(PADS_state_t bdu)
 
 /**
 * @brief Read the block data update state
+* @param  Pointer to sensor interface
 * @param  Pointer to Block data update state
 * @retval Error code
 */
-int8_t PADS_getBlockDataUpdateState(PADS_state_t *bdu)
+int8_t PADS_getBlockDataUpdateState(WE_sensorInterface_t *sensorInterface, PADS_state_t *bdu)
 {
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*bdu = (PADS_state_t)ctrl_reg_1.blockDataUpdate;
@@ -189,19 +217,20 @@ int8_t PADS_getBlockDataUpdateState(PADS_state_t *bdu)
 
 /**
 * @brief  Set the power mode of the sensor [Low noise , low current]
+* @param  Pointer to sensor interface
 * @param  Power mode
 * @retval Error code
 */
-int8_t PADS_setPowerMode(PADS_pwr_mode_t mode)
+int8_t PADS_setPowerMode(WE_sensorInterface_t *sensorInterface, PADS_pwr_mode_t mode)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.lowNoiseMode = mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -209,14 +238,15 @@ int8_t PADS_setPowerMode(PADS_pwr_mode_t mode)
 
 /**
 * @brief  Read the power mode [Low noise , low current]
+* @param  Pointer to sensor interface
 * @param  pointer to Power mode
 * @retval Error code
 */
-int8_t PADS_getPowerMode(PADS_pwr_mode_t *mode)
+int8_t PADS_getPowerMode(WE_sensorInterface_t *sensorInterface, PADS_pwr_mode_t *mode)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*mode = (PADS_pwr_mode_t)ctrl_reg_2.lowNoiseMode;
 
@@ -225,19 +255,20 @@ int8_t PADS_getPowerMode(PADS_pwr_mode_t *mode)
 
 /**
 * @brief  Set the Auto increment feature
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setAutoIncrement(PADS_state_t autoInc)
+int8_t PADS_setAutoIncrement(WE_sensorInterface_t *sensorInterface, PADS_state_t autoInc)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.autoAddIncr = autoInc;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -245,14 +276,15 @@ int8_t PADS_setAutoIncrement(PADS_state_t autoInc)
 
 /**
 * @brief  Read the auto increment state
+* @param  Pointer to sensor interface
 * @param  pointer to auto Increment state
 * @retval Error code
 */
-int8_t PADS_getAutoIncrementState(PADS_state_t *inc)
+int8_t PADS_getAutoIncrementState(WE_sensorInterface_t *sensorInterface, PADS_state_t *inc)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*inc = (PADS_state_t)ctrl_reg_2.autoAddIncr;
 
@@ -261,19 +293,20 @@ int8_t PADS_getAutoIncrementState(PADS_state_t *inc)
 
 /**
 * @brief  Set memory reboot state
+* @param  Pointer to sensor interface
 * @param  reboot state
 * @retval Error code
 */
-int8_t PADS_rebootMemory(PADS_state_t reboot)
+int8_t PADS_rebootMemory(WE_sensorInterface_t *sensorInterface, PADS_state_t reboot)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.boot = reboot;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -281,14 +314,15 @@ int8_t PADS_rebootMemory(PADS_state_t reboot)
 
 /**
 * @brief  Read the memory reboot state
+* @param  Pointer to sensor interface
 * @param  Pointer to reboot memory state
 * @retval Error code
 */
-int8_t PADS_getRebootMemoryState(PADS_state_t *reboot)
+int8_t PADS_getRebootMemoryState(WE_sensorInterface_t *sensorInterface, PADS_state_t *reboot)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*reboot = (PADS_state_t)ctrl_reg_2.boot;
 
@@ -297,14 +331,15 @@ int8_t PADS_getRebootMemoryState(PADS_state_t *reboot)
 
 /**
 * @brief  Read the boot state
+* @param  Pointer to sensor interface
 * @param  Pointer to Boot state
 * @retval Error code
 */
-int8_t PADS_getBootStatus(PADS_state_t *boot)
+int8_t PADS_getBootStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *boot)
 {
 	PADS_intSource_t int_source_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source_reg))
 	return WE_FAIL;
 	*boot = (PADS_state_t)int_source_reg.bootOn;
 
@@ -313,19 +348,20 @@ int8_t PADS_getBootStatus(PADS_state_t *boot)
 
 /**
 * @brief  Set the interrupt active level
+* @param  Pointer to sensor interface
 * @param  active level
 * @retval Error code
 */
-int8_t PADS_setIntActiveLevel(PADS_interrupt_level_t intLvl)
+int8_t PADS_setIntActiveLevel(WE_sensorInterface_t *sensorInterface, PADS_interrupt_level_t intLvl)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.intActiveLevel = intLvl;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -333,14 +369,15 @@ int8_t PADS_setIntActiveLevel(PADS_interrupt_level_t intLvl)
 
 /**
 * @brief  Read the interrupt active level [High,Low]
+* @param  Pointer to sensor interface
 * @param  Pointer to Interrupt active level
 * @retval Error code
 */
-int8_t PADS_getIntActiveLevel(PADS_interrupt_level_t *intLvl)
+int8_t PADS_getIntActiveLevel(WE_sensorInterface_t *sensorInterface, PADS_interrupt_level_t *intLvl)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*intLvl = (PADS_interrupt_level_t)ctrl_reg_2.intActiveLevel;
 
@@ -349,19 +386,20 @@ int8_t PADS_getIntActiveLevel(PADS_interrupt_level_t *intLvl)
 
 /**
 * @brief  Select the interrupt pin type [Push-pull,open_drain]
+* @param  Pointer to sensor interface
 * @param  pin type
 * @retval Error code
 */
-int8_t PADS_setIntPinType(PADS_interrupt_pin_t intr)
+int8_t PADS_setIntPinType(WE_sensorInterface_t *sensorInterface, PADS_interrupt_pin_t intr)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.openDrainOnINTpin = intr;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -369,14 +407,15 @@ int8_t PADS_setIntPinType(PADS_interrupt_pin_t intr)
 
 /**
 * @brief  Read the interrupt type [Push-pull,open_drain]
+* @param  Pointer to sensor interface
 * @param  pointer to interrupt pin type
 * @retval Error code
 */
-int8_t PADS_getIntPinType(PADS_interrupt_pin_t *intr)
+int8_t PADS_getIntPinType(WE_sensorInterface_t *sensorInterface, PADS_interrupt_pin_t *intr)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*intr = (PADS_interrupt_pin_t)ctrl_reg_2.openDrainOnINTpin;
 
@@ -385,19 +424,20 @@ int8_t PADS_getIntPinType(PADS_interrupt_pin_t *intr)
 
 /**
 * @brief  Set the single conversion mode[enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  mode
 * @retval Error code
 */
-int8_t PADS_setSingleConvMode(PADS_state_t mode)
+int8_t PADS_setSingleConvMode(WE_sensorInterface_t *sensorInterface, PADS_state_t mode)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.oneShotbit = mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -405,14 +445,15 @@ int8_t PADS_setSingleConvMode(PADS_state_t mode)
 
 /**
 * @brief  Read the Single Conversion Mode state [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to Single Conversion Mode state
 * @retval Error code
 */
-int8_t PADS_getSingleConvModeState(PADS_state_t *mode)
+int8_t PADS_getSingleConvModeState(WE_sensorInterface_t *sensorInterface, PADS_state_t *mode)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*mode = (PADS_state_t)ctrl_reg_2.oneShotbit;
 
@@ -421,19 +462,20 @@ int8_t PADS_getSingleConvModeState(PADS_state_t *mode)
 
 /**
 * @brief  Set software reset [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setSwreset(PADS_state_t mode)
+int8_t PADS_setSwreset(WE_sensorInterface_t *sensorInterface, PADS_state_t mode)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.softwareReset = mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -441,14 +483,15 @@ int8_t PADS_setSwreset(PADS_state_t mode)
 
 /**
 * @brief  Read the software reset state [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to software reset state
 * @retval Error code
 */
-int8_t PADS_getSwresetState(PADS_state_t *mode)
+int8_t PADS_getSwresetState(WE_sensorInterface_t *sensorInterface, PADS_state_t *mode)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*mode = (PADS_state_t)ctrl_reg_2.softwareReset;
 
@@ -457,19 +500,20 @@ int8_t PADS_getSwresetState(PADS_state_t *mode)
 
 /**
 * @brief Set the fifo full interrupt  [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setFifoFullInt(PADS_state_t fullState)
+int8_t PADS_setFifoFullInt(WE_sensorInterface_t *sensorInterface, PADS_state_t fullState)
 {
 	PADS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.fifoFullInt = fullState;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -477,20 +521,21 @@ int8_t PADS_setFifoFullInt(PADS_state_t fullState)
 
 /**
 * @brief  Set the fifo threshold level interrupt  [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code [Error,NoError]
 */
-int8_t PADS_setFifoWtmInt(PADS_state_t WtmState)
+int8_t PADS_setFifoWtmInt(WE_sensorInterface_t *sensorInterface, PADS_state_t WtmState)
 {
 	PADS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.fifoThresholdInt = WtmState;
 
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -498,19 +543,20 @@ int8_t PADS_setFifoWtmInt(PADS_state_t WtmState)
 
 /**
 * @brief  Enable the fifo overrun interrupt   [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  a variable , its Type is state
 * @retval Error code [Error,NoError]
 */
-int8_t PADS_setFifoOvrInterrupt(PADS_state_t OvrState)
+int8_t PADS_setFifoOvrInterrupt(WE_sensorInterface_t *sensorInterface, PADS_state_t OvrState)
 {
 	PADS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.fifoOverrunInt = OvrState;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -518,14 +564,15 @@ int8_t PADS_setFifoOvrInterrupt(PADS_state_t OvrState)
 
 /**
 * @brief  Read the fifo full state [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  Point to fifo full state
 * @retval Error code
 */
-int8_t PADS_getFifoFullState(PADS_state_t *fifoFull)
+int8_t PADS_getFifoFullState(WE_sensorInterface_t *sensorInterface, PADS_state_t *fifoFull)
 {
 	PADS_fifo_status2_t fifo_status2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_STATUS2_REG, 1, (uint8_t *)&fifo_status2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_FIFO_STATUS2_REG, 1, (uint8_t *)&fifo_status2))
 	return WE_FAIL;
 	*fifoFull = (PADS_state_t)fifo_status2.fifoFull;
 
@@ -534,14 +581,15 @@ int8_t PADS_getFifoFullState(PADS_state_t *fifoFull)
 
 /**
 * @brief  Read if the fifo level has exceeded the user defined watermark[enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to Fifo threshold level state
 * @retval Error code
 */
-int8_t PADS_getFifoWtmState(PADS_state_t *fifoWtm)
+int8_t PADS_getFifoWtmState(WE_sensorInterface_t *sensorInterface, PADS_state_t *fifoWtm)
 {
 	PADS_fifo_status2_t fifo_status2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_STATUS2_REG, 1, (uint8_t *)&fifo_status2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_FIFO_STATUS2_REG, 1, (uint8_t *)&fifo_status2))
 	return WE_FAIL;
 	*fifoWtm = (PADS_state_t)fifo_status2.fifoWtm;
 
@@ -550,14 +598,15 @@ int8_t PADS_getFifoWtmState(PADS_state_t *fifoWtm)
 
 /**
 * @brief  Read the fifo overrun  state [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to fifo overrun state
 * @retval Error code
 */
-int8_t PADS_getFifoOvrState(PADS_state_t *fifoOvr)
+int8_t PADS_getFifoOvrState(WE_sensorInterface_t *sensorInterface, PADS_state_t *fifoOvr)
 {
 	PADS_fifo_status2_t fifo_status2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_STATUS2_REG, 1, (uint8_t *)&fifo_status2))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_FIFO_STATUS2_REG, 1, (uint8_t *)&fifo_status2))
 	return WE_FAIL;
 
 	*fifoOvr = (PADS_state_t)fifo_status2.fifoOverrun;
@@ -567,21 +616,22 @@ int8_t PADS_getFifoOvrState(PADS_state_t *fifoOvr)
 
 /**
 * @brief  Set the data ready signal interrupt    [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setDrdyInt(PADS_state_t DRDYStatus)
+int8_t PADS_setDrdyInt(WE_sensorInterface_t *sensorInterface, PADS_state_t DRDYStatus)
 {
 
 	PADS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.dataReadyInt = DRDYStatus;
 
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -589,14 +639,15 @@ int8_t PADS_setDrdyInt(PADS_state_t DRDYStatus)
 
 /**
 * @brief  Read the data-ready signal interrupt state [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to Data-ready signal interrupt state
 * @retval Error code
 */
-int8_t PADS_getDrdyIntState(PADS_state_t *drdy)
+int8_t PADS_getDrdyIntState(WE_sensorInterface_t *sensorInterface, PADS_state_t *drdy)
 {
 	PADS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 	*drdy = (PADS_state_t)ctrl_reg_3.dataReadyInt;
 
@@ -605,20 +656,21 @@ int8_t PADS_getDrdyIntState(PADS_state_t *drdy)
 
 /**
 * @brief  Set the interrupt control event
+* @param  Pointer to sensor interface
 * @param  event
 * @retval Error code
 */
-int8_t PADS_setIntEventCtrl(PADS_interrupt_event_t ctr)
+int8_t PADS_setIntEventCtrl(WE_sensorInterface_t *sensorInterface, PADS_interrupt_event_t ctr)
 {
 
 	PADS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.intEventCtrl = ctr;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -626,14 +678,15 @@ int8_t PADS_setIntEventCtrl(PADS_interrupt_event_t ctr)
 
 /**
 * @brief  Read the interrupt control event
+* @param  Pointer to sensor interface
 * @param  Pointer to Interrupt control event
 * @retval Error code
 */
-int8_t PADS_getIntEventCtrlState(PADS_interrupt_event_t *intEvent)
+int8_t PADS_getIntEventCtrlState(WE_sensorInterface_t *sensorInterface, PADS_interrupt_event_t *intEvent)
 {
 	PADS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 	*intEvent = (PADS_interrupt_event_t)ctrl_reg_3.intEventCtrl;
 
@@ -643,14 +696,15 @@ int8_t PADS_getIntEventCtrlState(PADS_interrupt_event_t *intEvent)
 
 /**
 * @brief  Check if the temperature data are available
+* @param  Pointer to sensor interface
 * @param  pointer to temperature data State
 * @retval error code
 */
-int8_t PADS_getTempStatus(PADS_state_t *state)
+int8_t PADS_getTempStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *state)
 {
 	PADS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 	*state = (PADS_state_t)status_reg.tempDataAvailable;
 
@@ -659,14 +713,15 @@ int8_t PADS_getTempStatus(PADS_state_t *state)
 
 /**
 * @brief  Check if the pressure data are available
+* @param  Pointer to sensor interface
 * @param  pointer to pressure data State
 * @retval error code
 */
-int8_t PADS_getPresStatus(PADS_state_t *state)
+int8_t PADS_getPresStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *state)
 {
 	PADS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 	*state = (PADS_state_t)status_reg.presDataAvailable;
 
@@ -674,11 +729,11 @@ int8_t PADS_getPresStatus(PADS_state_t *state)
 }
 
 
-int8_t PADS_getStatusDrdy(PADS_state_t *stateDrdyTemperature, PADS_state_t *stateDrdyPressure)
+int8_t PADS_getStatusDrdy(WE_sensorInterface_t *sensorInterface, PADS_state_t *stateDrdyTemperature, PADS_state_t *stateDrdyPressure)
 {
 	uint8_t status_reg;		
 	
-	if (ReadReg((uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (ReadReg(sensorInterface, (uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	{		
 		return WE_FAIL;
 	}
@@ -706,14 +761,15 @@ int8_t PADS_getStatusDrdy(PADS_state_t *stateDrdyTemperature, PADS_state_t *stat
 
 /**
 * @brief  Check if the temperature data register has been overwritten
+* @param  Pointer to sensor interface
 * @param  Pointer to temperature overwritten State
 * @retval Error code
 */
-int8_t PADS_getTemperOverrunStatus(PADS_state_t *state)
+int8_t PADS_getTemperOverrunStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *state)
 {
 	PADS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 	*state = (PADS_state_t)status_reg.tempDataOverrun;
 
@@ -722,14 +778,15 @@ int8_t PADS_getTemperOverrunStatus(PADS_state_t *state)
 
 /**
 * @brief  Check if the pressure data register has been overwritten
+* @param  Pointer to sensor interface
 * @param  Pointer to pressure overwritten State
 * @retval Error code
 */
-int8_t PADS_getPressureOverrunStatus(PADS_state_t *state)
+int8_t PADS_getPressureOverrunStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *state)
 {
 	PADS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 	*state = (PADS_state_t)status_reg.presDataOverrun;
 
@@ -738,20 +795,21 @@ int8_t PADS_getPressureOverrunStatus(PADS_state_t *state)
 
 /**
 * @brief Set autorefp function   [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setAutoRefp(PADS_state_t autorep)
+int8_t PADS_setAutoRefp(WE_sensorInterface_t *sensorInterface, PADS_state_t autorep)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.autoRefp = autorep;
 
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -759,14 +817,15 @@ int8_t PADS_setAutoRefp(PADS_state_t autorep)
 
 /**
 * @brief  Read the autorefp function state [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  pointer to autorefp function state
 * @retval Error code
 */
-int8_t PADS_getAutoRefpState(PADS_state_t *autoRefp)
+int8_t PADS_getAutoRefpState(WE_sensorInterface_t *sensorInterface, PADS_state_t *autoRefp)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 	*autoRefp = (PADS_state_t)interrupt_Configuration_reg.autoRefp;
 	return WE_SUCCESS;
@@ -775,19 +834,20 @@ int8_t PADS_getAutoRefpState(PADS_state_t *autoRefp)
 
 /**
 * @brief  Reset the autorefp function
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_resetAutoRefp(PADS_state_t autorep)
+int8_t PADS_resetAutoRefp(WE_sensorInterface_t *sensorInterface, PADS_state_t autorep)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.resetAutoRefp = autorep;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -796,19 +856,20 @@ int8_t PADS_resetAutoRefp(PADS_state_t autorep)
 
 /**
 * @brief Set the autozero function [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setAutoZeroFunction(PADS_state_t autozero)
+int8_t PADS_setAutoZeroFunction(WE_sensorInterface_t *sensorInterface, PADS_state_t autozero)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.autoZeroFunc = autozero;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -816,14 +877,15 @@ int8_t PADS_setAutoZeroFunction(PADS_state_t autozero)
 
 /**
 * @brief  Read the autozero function state [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  pointer to autozero function state
 * @retval Error code
 */
-int8_t PADS_getAutoZeroState(PADS_state_t *autoZero)
+int8_t PADS_getAutoZeroState(WE_sensorInterface_t *sensorInterface, PADS_state_t *autoZero)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 	*autoZero = (PADS_state_t)interrupt_Configuration_reg.autoZeroFunc;
 	return WE_SUCCESS;
@@ -831,19 +893,20 @@ int8_t PADS_getAutoZeroState(PADS_state_t *autoZero)
 
 /**
 * @brief  Reset autozero function
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_resetAutoZeroFunction(PADS_state_t autozeroRst)
+int8_t PADS_resetAutoZeroFunction(WE_sensorInterface_t *sensorInterface, PADS_state_t autozeroRst)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.resetAutoZeroFunc = autozeroRst;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -851,19 +914,20 @@ int8_t PADS_resetAutoZeroFunction(PADS_state_t autozeroRst)
 
 /**
 * @brief  Set the differential pressure interrupt [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setDiffPresInt(PADS_state_t diffEn)
+int8_t PADS_setDiffPresInt(WE_sensorInterface_t *sensorInterface, PADS_state_t diffEn)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.diffInt = diffEn;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -872,14 +936,15 @@ int8_t PADS_setDiffPresInt(PADS_state_t diffEn)
 
 /**
 * @brief  Read the differential interrupt state [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  pointer to differential interrupt state
 * @retval Error code
 */
-int8_t PADS_getDiffPresIntState(PADS_state_t *diffIntState)
+int8_t PADS_getDiffPresIntState(WE_sensorInterface_t *sensorInterface, PADS_state_t *diffIntState)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 	*diffIntState = (PADS_state_t)interrupt_Configuration_reg.diffInt;
 	return WE_SUCCESS;
@@ -887,19 +952,20 @@ int8_t PADS_getDiffPresIntState(PADS_state_t *diffIntState)
 
 /**
 * @brief  Set latched Interrupt  [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setLatchInt(PADS_state_t state)
+int8_t PADS_setLatchInt(WE_sensorInterface_t *sensorInterface, PADS_state_t state)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.latchedInt = state;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -907,14 +973,15 @@ int8_t PADS_setLatchInt(PADS_state_t state)
 
 /**
 * @brief  Read the state of the latch Interrupt [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to latch Interrupt state
 * @retval Error code
 */
-int8_t PADS_getLatchIntState(PADS_state_t *latchInt)
+int8_t PADS_getLatchIntState(WE_sensorInterface_t *sensorInterface, PADS_state_t *latchInt)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 	*latchInt = (PADS_state_t)interrupt_Configuration_reg.latchedInt;
 	return WE_SUCCESS;
@@ -922,19 +989,20 @@ int8_t PADS_getLatchIntState(PADS_state_t *latchInt)
 
 /**
 * @brief  Set the interrupt on pressure low event [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setLowPresInt(PADS_state_t state)
+int8_t PADS_setLowPresInt(WE_sensorInterface_t *sensorInterface, PADS_state_t state)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.lowPresInt = state;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -942,14 +1010,15 @@ int8_t PADS_setLowPresInt(PADS_state_t state)
 
 /**
 * @brief  Read the state of the interrupt on pressure low event [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to state of the interrupt on pressure low event
 * @retval Error code
 */
-int8_t PADS_getLowPresIntState(PADS_state_t *lpint)
+int8_t PADS_getLowPresIntState(WE_sensorInterface_t *sensorInterface, PADS_state_t *lpint)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 	*lpint = (PADS_state_t)interrupt_Configuration_reg.lowPresInt;
 	return WE_SUCCESS;
@@ -957,19 +1026,20 @@ int8_t PADS_getLowPresIntState(PADS_state_t *lpint)
 
 /**
 * @brief  Set the interrupt on pressure High event [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setHighPresInt(PADS_state_t state)
+int8_t PADS_setHighPresInt(WE_sensorInterface_t *sensorInterface, PADS_state_t state)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.highPresInt = state;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -977,14 +1047,15 @@ int8_t PADS_setHighPresInt(PADS_state_t state)
 
 /**
 * @brief  Read the state of the interrupt on pressure High event [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to state of the interrupt on pressure High event
 * @retval Error code
 */
-int8_t PADS_getHighPresIntState(PADS_state_t *hpint)
+int8_t PADS_getHighPresIntState(WE_sensorInterface_t *sensorInterface, PADS_state_t *hpint)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 	*hpint = (PADS_state_t)interrupt_Configuration_reg.highPresInt;
 	return WE_SUCCESS;
@@ -993,15 +1064,16 @@ int8_t PADS_getHighPresIntState(PADS_state_t *hpint)
 
 /**
 * @brief  Set the LSB pressure threshold value
+* @param  Pointer to sensor interface
 * @param  value
 * @retval Error code
 */
 
-int8_t PADS_setPresThrLSB(uint8_t thr)
+int8_t PADS_setPresThrLSB(WE_sensorInterface_t *sensorInterface, uint8_t thr)
 {
 	uint8_t thresholdLSB = thr;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_THR_P_L_REG, 1, &thresholdLSB))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_THR_P_L_REG, 1, &thresholdLSB))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1009,14 +1081,15 @@ int8_t PADS_setPresThrLSB(uint8_t thr)
 
 /**
 * @brief  Set the MSB pressure threshold value
+* @param  Pointer to sensor interface
 * @param  value
 * @retval Error code
 */
-int8_t PADS_setPresThrMSB(uint8_t thr)
+int8_t PADS_setPresThrMSB(WE_sensorInterface_t *sensorInterface, uint8_t thr)
 {
 	uint8_t thresholdMSB = thr;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_THR_P_H_REG, 1, &thresholdMSB))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_THR_P_H_REG, 1, &thresholdMSB))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1024,12 +1097,13 @@ int8_t PADS_setPresThrMSB(uint8_t thr)
 
 /**
 * @brief  Read LSB threshold pressure value
+* @param  Pointer to sensor interface
 * @param  Pointer to store threshold pressure LSB value
 * @retval Error code
 */
-int8_t PADS_getPresThrLSB(uint8_t *thrLSB)
+int8_t PADS_getPresThrLSB(WE_sensorInterface_t *sensorInterface, uint8_t *thrLSB)
 {
-	if (WE_FAIL == ReadReg((uint8_t)PADS_THR_P_L_REG, 1, thrLSB))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_THR_P_L_REG, 1, thrLSB))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1037,12 +1111,13 @@ int8_t PADS_getPresThrLSB(uint8_t *thrLSB)
 
 /**
 * @brief  Read MSB threshold pressure value
+* @param  Pointer to sensor interface
 * @param  Pointer to threshold pressure MSB value
 * @retval Error code
 */
-int8_t PADS_getPresThrMSB(uint8_t *thrMSB)
+int8_t PADS_getPresThrMSB(WE_sensorInterface_t *sensorInterface, uint8_t *thrMSB)
 {
-	if (WE_FAIL == ReadReg((uint8_t)PADS_THR_P_H_REG, 1, thrMSB))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_THR_P_H_REG, 1, thrMSB))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1050,19 +1125,20 @@ int8_t PADS_getPresThrMSB(uint8_t *thrMSB)
 
 /**
 * @brief  Disable/enable the I2C Interface
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_disI2C(PADS_state_t I2CStatus)
+int8_t PADS_disI2C(WE_sensorInterface_t *sensorInterface, PADS_state_t I2CStatus)
 {
 	PADS_interface_ctrl_t interface_ctrl;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	interface_ctrl.disableI2C = I2CStatus;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1070,14 +1146,15 @@ int8_t PADS_disI2C(PADS_state_t I2CStatus)
 
 /**
 * @brief  Read the I2C interface state [enabled;disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to I2C interface state
 * @retval Error code
 */
-int8_t PADS_getI2CState(PADS_state_t *i2cState)
+int8_t PADS_getI2CState(WE_sensorInterface_t *sensorInterface, PADS_state_t *i2cState)
 {
 	PADS_interface_ctrl_t interface_ctrl;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 	*i2cState = (PADS_state_t)interface_ctrl.disableI2C;
 	return WE_SUCCESS;
@@ -1086,18 +1163,19 @@ int8_t PADS_getI2CState(PADS_state_t *i2cState)
 
 /**
 * @brief  Disable/enable the internal pull-down on Interrupt pin
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_disPullDownIntPin(PADS_state_t pullDownState)
+int8_t PADS_disPullDownIntPin(WE_sensorInterface_t *sensorInterface, PADS_state_t pullDownState)
 {
 	PADS_interface_ctrl_t interface_ctrl;
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	interface_ctrl.disPullDownOnIntPin = pullDownState;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1105,14 +1183,15 @@ int8_t PADS_disPullDownIntPin(PADS_state_t pullDownState)
 
 /**
 * @brief  Read the state of the pull down on the interrupt pin [enabled;disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to state of the pull down on the interrupt pin
 * @retval Error code
 */
-int8_t PADS_getPullDownIntPinState(PADS_state_t *pinState)
+int8_t PADS_getPullDownIntPinState(WE_sensorInterface_t *sensorInterface, PADS_state_t *pinState)
 {
 	PADS_interface_ctrl_t interface_ctrl;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 	*pinState = (PADS_state_t)interface_ctrl.disPullDownOnIntPin;
 
@@ -1122,18 +1201,19 @@ int8_t PADS_getPullDownIntPinState(PADS_state_t *pinState)
 
 /**
 * @brief  Set internal pull-up on the SAO pin
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setSAOPullUp(PADS_state_t SaoStatus)
+int8_t PADS_setSAOPullUp(WE_sensorInterface_t *sensorInterface, PADS_state_t SaoStatus)
 {
 	PADS_interface_ctrl_t interface_ctrl;
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	interface_ctrl.pullUpOnSAOpin = SaoStatus;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1141,14 +1221,15 @@ int8_t PADS_setSAOPullUp(PADS_state_t SaoStatus)
 
 /**
 * @brief  Read the state of the pull up on the SAO pin [enabled;disabled]
+* @param  Pointer to sensor interface
 * @param  pointer to state of the pull up on the SAO pin
 * @retval Error code
 */
-int8_t PADS_getSAOPullUpState(PADS_state_t *saoPinState)
+int8_t PADS_getSAOPullUpState(WE_sensorInterface_t *sensorInterface, PADS_state_t *saoPinState)
 {
 	PADS_interface_ctrl_t interface_ctrl;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 	*saoPinState = (PADS_state_t)interface_ctrl.pullUpOnSAOpin;
 
@@ -1157,18 +1238,19 @@ int8_t PADS_getSAOPullUpState(PADS_state_t *saoPinState)
 }
 /**
 * @brief  Set internal pull-up on the SDA pin
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setSDAPullUp(PADS_state_t SdaStatus)
+int8_t PADS_setSDAPullUp(WE_sensorInterface_t *sensorInterface, PADS_state_t SdaStatus)
 {
 	PADS_interface_ctrl_t interface_ctrl;
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	interface_ctrl.pullUpOnSDApin = SdaStatus;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1176,14 +1258,15 @@ int8_t PADS_setSDAPullUp(PADS_state_t SdaStatus)
 
 /**
 * @brief  Read the state of the pull up on the SDA pin [enabled;disabled]
+* @param  Pointer to sensor interface
 * @param  state of the pull up on the SDA pin
 * @retval Error code
 */
-int8_t PADS_getSDAPullUpState(PADS_state_t *sdaPinState)
+int8_t PADS_getSDAPullUpState(WE_sensorInterface_t *sensorInterface, PADS_state_t *sdaPinState)
 {
 	PADS_interface_ctrl_t interface_ctrl;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 	*sdaPinState = (PADS_state_t)interface_ctrl.pullUpOnSDApin;
 
@@ -1192,19 +1275,20 @@ int8_t PADS_getSDAPullUpState(PADS_state_t *sdaPinState)
 
 /**
 * @brief  Set the Fifo mode
+* @param  Pointer to sensor interface
 * @param  config
 * @retval Error code
 */
-int8_t PADS_setFifoMode(PADS_fifo_mode_t fifoMode)
+int8_t PADS_setFifoMode(WE_sensorInterface_t *sensorInterface, PADS_fifo_mode_t fifoMode)
 {
 	PADS_fifo_ctrl_t fifo_ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	fifo_ctrl_reg.fifoMode = fifoMode;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1212,14 +1296,15 @@ int8_t PADS_setFifoMode(PADS_fifo_mode_t fifoMode)
 
 /**
 * @brief  Read the Fifo mode
+* @param  Pointer to sensor interface
 * @param  Pointer to Fifo mode Configuration
 * @retval Error code
 */
-int8_t PADS_getFifoMode(PADS_fifo_mode_t *fifoMode)
+int8_t PADS_getFifoMode(WE_sensorInterface_t *sensorInterface, PADS_fifo_mode_t *fifoMode)
 {
 	PADS_fifo_ctrl_t fifo_ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 	*fifoMode = (PADS_fifo_mode_t)fifo_ctrl_reg.fifoMode;
 
@@ -1229,19 +1314,20 @@ int8_t PADS_getFifoMode(PADS_fifo_mode_t *fifoMode)
 
 /**
 * @brief  Set stop on user defined fifo threshold level
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setStopOnThr(PADS_state_t state)
+int8_t PADS_setStopOnThr(WE_sensorInterface_t *sensorInterface, PADS_state_t state)
 {
 	PADS_fifo_ctrl_t fifo_ctrl;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl))
 	return WE_FAIL;
 
 	fifo_ctrl.stopOnThreshold = state;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1249,14 +1335,15 @@ int8_t PADS_setStopOnThr(PADS_state_t state)
 
 /**
 * @brief  Read the state of the StopOnThresholLevel State
+* @param  Pointer to sensor interface
 * @param  Pointer to state of the StopOnThresholLevel
 * @retval Error code
 */
-int8_t PADS_getStopOnThrStatus(PADS_state_t *state)
+int8_t PADS_getStopOnThrStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *state)
 {
 	PADS_fifo_ctrl_t fifo_ctrl;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl))
 	return WE_FAIL;
 	*state = (PADS_state_t)fifo_ctrl.stopOnThreshold;
 
@@ -1266,19 +1353,20 @@ int8_t PADS_getStopOnThrStatus(PADS_state_t *state)
 
 /**
 * @brief  Set the fifo threshold level
+* @param  Pointer to sensor interface
 * @param  level
 * @retval Error code
 */
-int8_t PADS_setFifoThr(uint8_t fifoThr)
+int8_t PADS_setFifoThr(WE_sensorInterface_t *sensorInterface, uint8_t fifoThr)
 {
 	PADS_fifo_wtm_t fifo_wtm;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_WTM_REG, 1, (uint8_t *)&fifo_wtm))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_FIFO_WTM_REG, 1, (uint8_t *)&fifo_wtm))
 	return WE_FAIL;
 
 	fifo_wtm.fifoThreshold = fifoThr;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_FIFO_WTM_REG, 1, (uint8_t *)&fifo_wtm))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_FIFO_WTM_REG, 1, (uint8_t *)&fifo_wtm))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1286,14 +1374,15 @@ int8_t PADS_setFifoThr(uint8_t fifoThr)
 
 /**
 * @brief  Read the fifo threshold level
+* @param  Pointer to sensor interface
 * @param  pointer to fifo threshold level
 * @retval Error code
 */
-int8_t PADS_getFifoThr(uint8_t *fifoThr)
+int8_t PADS_getFifoThr(WE_sensorInterface_t *sensorInterface, uint8_t *fifoThr)
 {
 	PADS_fifo_wtm_t fifo_wtm;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_WTM_REG, 1, (uint8_t *)&fifo_wtm))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_FIFO_WTM_REG, 1, (uint8_t *)&fifo_wtm))
 	return WE_FAIL;
 	*fifoThr = (uint8_t)fifo_wtm.fifoThreshold;
 
@@ -1302,14 +1391,15 @@ int8_t PADS_getFifoThr(uint8_t *fifoThr)
 
 /**
 * @brief  Read the fifo fill level
+* @param  Pointer to sensor interface
 * @param  Pointer to fifo filling level
 * @retval Error code
 */
-int8_t PADS_getFifoFillLevel(uint8_t *fifoLevel)
+int8_t PADS_getFifoFillLevel(WE_sensorInterface_t *sensorInterface, uint8_t *fifoLevel)
 {
 	;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_STATUS1_REG, 1, fifoLevel))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_FIFO_STATUS1_REG, 1, fifoLevel))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1317,12 +1407,13 @@ int8_t PADS_getFifoFillLevel(uint8_t *fifoLevel)
 
 /**
 * @brief  Read the LSB of pressure reference value
+* @param  Pointer to sensor interface
 * @param  Pointer to LSB pressure reference value
 * @retval Error code
 */
-int8_t PADS_getPresRefLSB(uint8_t *lowReferenceValue)
+int8_t PADS_getPresRefLSB(WE_sensorInterface_t *sensorInterface, uint8_t *lowReferenceValue)
 {
-	if (WE_FAIL == ReadReg((uint8_t)PADS_REF_P_H_REG, 1, lowReferenceValue))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_REF_P_H_REG, 1, lowReferenceValue))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1330,12 +1421,13 @@ int8_t PADS_getPresRefLSB(uint8_t *lowReferenceValue)
 
 /**
 * @brief  Read the MSB of pressure reference value
+* @param  Pointer to sensor interface
 * @param  Pointer to MSB pressure reference value
 * @retval Error code
 */
-int8_t PADS_getPresRefMSB(uint8_t *highReferenceValue)
+int8_t PADS_getPresRefMSB(WE_sensorInterface_t *sensorInterface, uint8_t *highReferenceValue)
 {
-	if (WE_FAIL == ReadReg((uint8_t)PADS_REF_P_H_REG, 1, highReferenceValue))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_REF_P_H_REG, 1, highReferenceValue))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1344,14 +1436,15 @@ int8_t PADS_getPresRefMSB(uint8_t *highReferenceValue)
 
 /**
 * @brief  Set LSB part of the pressure offset value
+* @param  Pointer to sensor interface
 * @param  a variable,its Type is uint8_t
 * @retval Error code
 */
-int8_t PADS_setPresOffsetLSB(uint8_t offSet)
+int8_t PADS_setPresOffsetLSB(WE_sensorInterface_t *sensorInterface, uint8_t offSet)
 {
 	uint8_t pressureOffsetLsb = offSet;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_OPC_P_L_REG, 1, &pressureOffsetLsb))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_OPC_P_L_REG, 1, &pressureOffsetLsb))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1359,13 +1452,14 @@ int8_t PADS_setPresOffsetLSB(uint8_t offSet)
 
 /**
 * @brief  Read the LSB part of the pressure offset value
+* @param  Pointer to sensor interface
 * @param  Pointer to LSB part of the pressure offset value
 * @retval Error code
 */
-int8_t PADS_getPresOffsetLSB(uint8_t *offSet)
+int8_t PADS_getPresOffsetLSB(WE_sensorInterface_t *sensorInterface, uint8_t *offSet)
 {
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_OPC_P_L_REG, 1, offSet))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_OPC_P_L_REG, 1, offSet))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1373,14 +1467,15 @@ int8_t PADS_getPresOffsetLSB(uint8_t *offSet)
 
 /**
 * @brief  Set MSB part of the pressure offset value
+* @param  Pointer to sensor interface
 * @param  a variable,its Type is uint8_t
 * @retval Error code [Error,NoError]
 */
-int8_t PADS_setPresOffsetMSB(uint8_t highPresureOffsetValue)
+int8_t PADS_setPresOffsetMSB(WE_sensorInterface_t *sensorInterface, uint8_t highPresureOffsetValue)
 {
 	uint8_t pressureOffsetMsb = highPresureOffsetValue;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_OPC_P_H_REG, 1, &pressureOffsetMsb))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)PADS_OPC_P_H_REG, 1, &pressureOffsetMsb))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1388,12 +1483,13 @@ int8_t PADS_setPresOffsetMSB(uint8_t highPresureOffsetValue)
 
 /**
 * @brief  Read the MSB part of the pressure offset value
+* @param  Pointer to sensor interface
 * @param  Pointer to MSB part of the pressure offset value
 * @retval Error code
 */
-int8_t PADS_getPresOffsetMSB(uint8_t *offSet)
+int8_t PADS_getPresOffsetMSB(WE_sensorInterface_t *sensorInterface, uint8_t *offSet)
 {
-	if (WE_FAIL == ReadReg((uint8_t)PADS_OPC_P_H_REG, 1, offSet))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_OPC_P_H_REG, 1, offSet))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1401,14 +1497,15 @@ int8_t PADS_getPresOffsetMSB(uint8_t *offSet)
 
 /**
 * @brief Read the state of the interrupts [Not active , active]
+* @param  Pointer to sensor interface
 * @param  pointer to state of the interrupt generation
 * @retval Error code
 */
-int8_t PADS_getIntStatus(PADS_state_t *intState)
+int8_t PADS_getIntStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *intState)
 {
 	PADS_intSource_t int_source;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source))
 	return WE_FAIL;
 	*intState = (PADS_state_t)int_source.intStatus;
 
@@ -1417,14 +1514,15 @@ int8_t PADS_getIntStatus(PADS_state_t *intState)
 
 /**
 * @brief  Read the state of the differential low pressure interrupt [Not active , active]
+* @param  Pointer to sensor interface
 * @param  Pointer to state of the differential low pressure interrupt
 * @retval Error code
 */
-int8_t PADS_getLowPresIntStatus(PADS_state_t *lpState)
+int8_t PADS_getLowPresIntStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *lpState)
 {
 	PADS_intSource_t int_source;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source))
 	return WE_FAIL;
 	*lpState = (PADS_state_t)int_source.diffPresLowEvent;
 
@@ -1433,14 +1531,15 @@ int8_t PADS_getLowPresIntStatus(PADS_state_t *lpState)
 
 /**
 * @brief  Read the state of the differential  high pressure interrupt [Not active , active]
+* @param  Pointer to sensor interface
 * @param  Pointer to state of the differential high pressure interrupt
 * @retval No error
 */
-int8_t PADS_getHighPresIntStatus(PADS_state_t *hpState)
+int8_t PADS_getHighPresIntStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *hpState)
 {
 	PADS_intSource_t int_source;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source))
 	return WE_FAIL;
 	*hpState = int_source.diffPresHighEvent;
 
@@ -1449,14 +1548,15 @@ int8_t PADS_getHighPresIntStatus(PADS_state_t *hpState)
 
 /**
 * @brief  Read the raw measured pressure value
+* @param  Pointer to sensor interface
 * @param  Pointer to Pressure Measurement
 * @retval Error code
 */
-int8_t PADS_getRAWPressure(uint32_t *rawPres)
+int8_t PADS_getRAWPressure(WE_sensorInterface_t *sensorInterface, uint32_t *rawPres)
 {
 	uint8_t tmp[3] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_DATA_P_XL_REG, 3, tmp))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_DATA_P_XL_REG, 3, tmp))
 	return WE_FAIL;
 
 	*rawPres = (uint32_t)tmp[2] << 16;
@@ -1470,13 +1570,14 @@ int8_t PADS_getRAWPressure(uint32_t *rawPres)
 
 /**
 * @brief  Read the measured pressure value in kPa
+* @param  Pointer to sensor interface
 * @param  pointer to Pressure Measurement
 * @retval Error code
 */
-int8_t PADS_getPressure(float *presskPa)
+int8_t PADS_getPressure(WE_sensorInterface_t *sensorInterface, float *presskPa)
 {
 	uint32_t rawPressure = 0;
-	if(PADS_getRAWPressure(&rawPressure) == WE_SUCCESS)
+	if(PADS_getRAWPressure(sensorInterface, &rawPressure) == WE_SUCCESS)
 	{
 		*presskPa = (float)rawPressure;
 		*presskPa = *presskPa/40960;
@@ -1491,14 +1592,15 @@ int8_t PADS_getPressure(float *presskPa)
 
 /**
 * @brief  Read the raw measured temperature value
+* @param  Pointer to sensor interface
 * @param  pointer to Temperature Measurement
 * @retval Error code
 */
-int8_t PADS_getRAWTemperature(uint16_t *rawTemp)
+int8_t PADS_getRAWTemperature(WE_sensorInterface_t *sensorInterface, uint16_t *rawTemp)
 {
 	uint8_t tmp[2] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_DATA_T_L_REG, 2, tmp))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_DATA_T_L_REG, 2, tmp))
 	return WE_FAIL;
 
 	*rawTemp = (uint16_t)tmp[1] << 8;
@@ -1509,13 +1611,14 @@ int8_t PADS_getRAWTemperature(uint16_t *rawTemp)
 
 /**
 * @brief  Read the measured temperature value in °C
+* @param  Pointer to sensor interface
 * @param  Pointer to Temperature Measurement
 * @retval Error code
 */
-int8_t PADS_getTemperature(float *tempdegC)
+int8_t PADS_getTemperature(WE_sensorInterface_t *sensorInterface, float *tempdegC)
 {
 	uint16_t rawTemp = 0;
-	if(PADS_getRAWTemperature(&rawTemp) == WE_SUCCESS)
+	if(PADS_getRAWTemperature(sensorInterface, &rawTemp) == WE_SUCCESS)
 	{
 		*tempdegC = (float)rawTemp;
 		*tempdegC = *tempdegC / 100;
@@ -1530,14 +1633,15 @@ int8_t PADS_getTemperature(float *tempdegC)
 
 /**
 * @brief  Read the raw pressure value from Fifo
+* @param  Pointer to sensor interface
 * @param  Pointer to Fifo Pressure Measurement
 * @retval Error code
 */
-int8_t PADS_getFifoRAWPressure(uint32_t *rawPres)
+int8_t PADS_getFifoRAWPressure(WE_sensorInterface_t *sensorInterface, uint32_t *rawPres)
 {
 	uint8_t tmp[3] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_DATA_P_XL_REG, 3, tmp))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_FIFO_DATA_P_XL_REG, 3, tmp))
 	return WE_FAIL;
 
 	*rawPres = (uint32_t)tmp[2] << 16;
@@ -1548,13 +1652,14 @@ int8_t PADS_getFifoRAWPressure(uint32_t *rawPres)
 }
 /**
 * @brief  Read the pressure value from Fifo in kPa
+* @param  Pointer to sensor interface
 * @param  Pointer to Fifo Pressure Measurement
 * @retval Error code
 */
-int8_t PADS_getFifoPressure(float *presskPa)
+int8_t PADS_getFifoPressure(WE_sensorInterface_t *sensorInterface, float *presskPa)
 {
 	uint32_t rawPressure = 0;
-	if(PADS_getFifoRAWPressure(&rawPressure) == WE_SUCCESS)
+	if(PADS_getFifoRAWPressure(sensorInterface, &rawPressure) == WE_SUCCESS)
 	{
 		*presskPa = (float)rawPressure;
 		*presskPa = *presskPa/40960;
@@ -1569,14 +1674,15 @@ int8_t PADS_getFifoPressure(float *presskPa)
 
 /**
 * @brief  Read the raw temperature value from fifo
+* @param  Pointer to sensor interface
 * @param  Pointer to Fifo Temperature Measurement
 * @retval Error code
 */
-int8_t PADS_getFifoRAWTemperature(uint16_t *rawTemp)
+int8_t PADS_getFifoRAWTemperature(WE_sensorInterface_t *sensorInterface, uint16_t *rawTemp)
 {
 	uint8_t tmp[2] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_DATA_T_L_REG, 2, tmp))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)PADS_FIFO_DATA_T_L_REG, 2, tmp))
 	return WE_FAIL;
 
 	*rawTemp = (uint16_t)tmp[1] << 8;
@@ -1587,14 +1693,15 @@ int8_t PADS_getFifoRAWTemperature(uint16_t *rawTemp)
 
 /**
 * @brief  Read the temperature value from fifo in °C
+* @param  Pointer to sensor interface
 * @param  Pointer to Fifo Temperature Measurement
 * @retval error code
 */
-int8_t PADS_getFifoTemperature(float *tempdegC)
+int8_t PADS_getFifoTemperature(WE_sensorInterface_t *sensorInterface, float *tempdegC)
 {
 
 	uint16_t rawTemp = 0;
-	if(PADS_getFifoRAWTemperature(&rawTemp) == WE_SUCCESS)
+	if(PADS_getFifoRAWTemperature(sensorInterface, &rawTemp) == WE_SUCCESS)
 	{
 		*tempdegC = (float)rawTemp;
 		*tempdegC = *tempdegC / 100;
@@ -76,6 +76,8 @@ extern "C"
 #define PADS_FIFO_DATA_T_L_REG				(uint8_t)0x7B 		/* Temperature LSB data in FIFO buffer */
 #define PADS_FIFO_DATA_T_H_REG				(uint8_t)0x7C 		/* Temperature MSB data in FIFO buffer */
 
+#define PADS_CACHED_REGISTERS				(uint8_t)11				/* number of registers in PADS_cachedRegisters */
+
 
 
 
@@ -360,140 +362,143 @@ typedef enum {
 	PADS_continuousToFifo = 7
 }PADS_fifo_mode_t;
 
+	/* Registers held in the register cache of the sensor interface */
+	extern const WE_cachedRegister_t PADS_cachedRegisters[PADS_CACHED_REGISTERS];
+
 	/**         Functions definition         */
 
-	int8_t PADS_getDeviceID(uint8_t *devID);
+	int8_t PADS_getDeviceID(WE_sensorInterface_t *sensorInterface, uint8_t *devID);
 
 	/* definition of Interrupt functions  */
-	int8_t PADS_setAutoRefp(PADS_state_t autorep);
-	int8_t PADS_getAutoRefpState(PADS_state_t *autoRefp);
-	int8_t PADS_resetAutoRefp(PADS_state_t autorep);
+	int8_t PADS_setAutoRefp(WE_sensorInterface_t *sensorInterface, PADS_state_t autorep);
+	int8_t PADS_getAutoRefpState(WE_sensorInterface_t *sensorInterface, PADS_state_t *autoRefp);
+	int8_t PADS_resetAutoRefp(WE_sensorInterface_t *sensorInterface, PADS_state_t autorep);
 
-	int8_t PADS_setAutoZeroFunction(PADS_state_t autozero);
-	int8_t PADS_getAutoZeroState(PADS_state_t *autoZero);
-	int8_t PADS_resetAutoZeroFunction(PADS_state_t autozeroRst);
+	int8_t PADS_setAutoZeroFunction(WE_sensorInterface_t *sensorInterface, PADS_state_t autozero);
+	int8_t PADS_getAutoZeroState(WE_sensorInterface_t *sensorInterface, PADS_state_t *autoZero);
+	int8_t PADS_resetAutoZeroFunction(WE_sensorInterface_t *sensorInterface, PADS_state_t autozeroRst);
 
-	int8_t PADS_setDiffPresInt(PADS_state_t diffEn);
-	int8_t PADS_getDiffPresIntState(PADS_state_t *diffIntState);
+	int8_t PADS_setDiffPresInt(WE_sensorInterface_t *sensorInterface, PADS_state_t diffEn);
+	int8_t PADS_getDiffPresIntState(WE_sensorInterface_t *sensorInterface, PADS_state_t *diffIntState);
 
-	int8_t PADS_setLatchInt(PADS_state_t state);
-	int8_t PADS_getLatchIntState(PADS_state_t *latchInt);
+	int8_t PADS_setLatchInt(WE_sensorInterface_t *sensorInterface, PADS_state_t state);
+	int8_t PADS_getLatchIntState(WE_sensorInterface_t *sensorInterface, PADS_state_t *latchInt);
 
-	int8_t PADS_setLowPresInt(PADS_state_t state);
-	int8_t PADS_getLowPresIntState(PADS_state_t *lpint);
-	int8_t PADS_setHighPresInt(PADS_state_t state);
-	int8_t PADS_getHighPresIntState(PADS_state_t *hpint);
+	int8_t PADS_setLowPresInt(WE_sensorInterface_t *sensorInterface, PADS_state_t state);
+	int8_t PADS_getLowPresIntState(WE_sensorInterface_t *sensorInterface, PADS_state_t *lpint);
+	int8_t PADS_setHighPresInt(WE_sensorInterface_t *sensorInterface, PADS_state_t state);
+	int8_t PADS_getHighPresIntState(WE_sensorInterface_t *sensorInterface, PADS_state_t *hpint);
 
-	int8_t PADS_getIntStatus(PADS_state_t *intState);
-	int8_t PADS_getLowPresIntStatus(PADS_state_t *lpState);
-	int8_t PADS_getHighPresIntStatus(PADS_state_t *hpState);
+	int8_t PADS_getIntStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *intState);
+	int8_t PADS_getLowPresIntStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *lpState);
+	int8_t PADS_getHighPresIntStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *hpState);
 
-	int8_t PADS_setFifoFullInt(PADS_state_t fullState);
-	int8_t PADS_setFifoWtmInt(PADS_state_t WtmState);
+	int8_t PADS_setFifoFullInt(WE_sensorInterface_t *sensorInterface, PADS_state_t fullState);
+	int8_t PADS_setFifoWtmInt(WE_sensorInterface_t *sensorInterface, PADS_state_t WtmState);
 	int8_t PADS_setFifoOvrInt(PADS_state_t OvrState);
 
-	int8_t PADS_setFifoOvrInterrupt(PADS_state_t OvrState);
+	int8_t PADS_setFifoOvrInterrupt(WE_sensorInterface_t *sensorInterface, PADS_state_t OvrState);
 
-	int8_t PADS_getFifoFullState(PADS_state_t *fifoFull);
-	int8_t PADS_getFifoWtmState(PADS_state_t *fifoWtm);
-	int8_t PADS_getFifoOvrState(PADS_state_t *fifoOvr);
+	int8_t PADS_getFifoFullState(WE_sensorInterface_t *sensorInterface, PADS_state_t *fifoFull);
+	int8_t PADS_getFifoWtmState(WE_sensorInterface_t *sensorInterface, PADS_state_t *fifoWtm);
+	int8_t PADS_getFifoOvrState(WE_sensorInterface_t *sensorInterface, PADS_state_t *fifoOvr);
 
-	int8_t  PADS_setDrdyInt(PADS_state_t DRDYStatus);
-	int8_t PADS_getDrdyIntState(PADS_state_t *drdy);
+	int8_t  PADS_setDrdyInt(WE_sensorInterface_t *sensorInterface, PADS_state_t DRDYStatus);
+	int8_t PADS_getDrdyIntState(WE_sensorInterface_t *sensorInterface, PADS_state_t *drdy);
 
-	int8_t  PADS_setIntEventCtrl(PADS_interrupt_event_t ctr);
-	int8_t PADS_getIntEventCtrlState(PADS_interrupt_event_t *intEvent);
+	int8_t  PADS_setIntEventCtrl(WE_sensorInterface_t *sensorInterface, PADS_interrupt_event_t ctr);
+	int8_t PADS_getIntEventCtrlState(WE_sensorInterface_t *sensorInterface, PADS_interrupt_event_t *intEvent);
 
-	int8_t  PADS_setPresThrLSB(uint8_t thr);
-	int8_t  PADS_setPresThrMSB(uint8_t thr);
-	int8_t PADS_getPresThrLSB(uint8_t *thrLSB);
-	int8_t PADS_getPresThrMSB(uint8_t *thrMSB);
+	int8_t  PADS_setPresThrLSB(WE_sensorInterface_t *sensorInterface, uint8_t thr);
+	int8_t  PADS_setPresThrMSB(WE_sensorInterface_t *sensorInterface, uint8_t thr);
+	int8_t PADS_getPresThrLSB(WE_sensorInterface_t *sensorInterface, uint8_t *thrLSB);
+	int8_t PADS_getPresThrMSB(WE_sensorInterface_t *sensorInterface, uint8_t *thrMSB);
 
 	/* Standard Configurations */
-	int8_t  PADS_disI2C(PADS_state_t I2CStatus);
-	int8_t PADS_getI2CState(PADS_state_t *i2cState);
-	int8_t  PADS_disPullDownIntPin(PADS_state_t pullDown);
-	int8_t PADS_getPullDownIntPinState(PADS_state_t *pinState);
-	int8_t  PADS_setSAOPullUp(PADS_state_t SaoStatus);
-	int8_t PADS_getSAOPullUpState(PADS_state_t *saoPinState);
-	int8_t  PADS_setSDAPullUp(PADS_state_t SdaStatus);
-	int8_t PADS_getSDAPullUpState(PADS_state_t *sdaPinState);
+	int8_t  PADS_disI2C(WE_sensorInterface_t *sensorInterface, PADS_state_t I2CStatus);
+	int8_t PADS_getI2CState(WE_sensorInterface_t *sensorInterface, PADS_state_t *i2cState);
+	int8_t  PADS_disPullDownIntPin(WE_sensorInterface_t *sensorInterface, PADS_state_t pullDown);
+	int8_t PADS_getPullDownIntPinState(WE_sensorInterface_t *sensorInterface, PADS_state_t *pinState);
+	int8_t  PADS_setSAOPullUp(WE_sensorInterface_t *sensorInterface, PADS_state_t SaoStatus);
+	int8_t PADS_getSAOPullUpState(WE_sensorInterface_t *sensorInterface, PADS_state_t *saoPinState);
+	int8_t  PADS_setSDAPullUp(WE_sensorInterface_t *sensorInterface, PADS_state_t SdaStatus);
+	int8_t PADS_getSDAPullUpState(WE_sensorInterface_t *sensorInterface, PADS_state_t *sdaPinState);
 
 
-	int8_t  PADS_setOutputDataRate(PADS_output_data_rate_t odr);
-	int8_t PADS_getOutputDataRate(PADS_output_data_rate_t* odr);
+	int8_t  PADS_setOutputDataRate(WE_sensorInterface_t *sensorInterface, PADS_output_data_rate_t odr);
+	int8_t PADS_getOutputDataRate(WE_sensorInterface_t *sensorInterface, PADS_output_data_rate_t* odr);
 
-	int8_t  PADS_setLowPassFilter(PADS_state_t filterStatus);
-	int8_t PADS_getLowPassFilterStatus(PADS_state_t *filterStatus);
-	int8_t  PADS_setLowPassFilterConf(PADS_filter_conf_t conf);
-	int8_t PADS_getLowPassFilterConf(PADS_filter_conf_t *conf);
+	int8_t  PADS_setLowPassFilter(WE_sensorInterface_t *sensorInterface, PADS_state_t filterStatus);
+	int8_t PADS_getLowPassFilterStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *filterStatus);
+	int8_t  PADS_setLowPassFilterConf(WE_sensorInterface_t *sensorInterface, PADS_filter_conf_t conf);
+	int8_t PADS_getLowPassFilterConf(WE_sensorInterface_t *sensorInterface, PADS_filter_conf_t *conf);
 
-	int8_t  PADS_setBlockDataUpdate(PADS_state_t bdu);
-	int8_t PADS_getBlockDataUpdateState(PADS_state_t *bdu);
+	int8_t  PADS_setBlockDataUpdate(WE_sensorInterface_t *sensorInterface, PADS_state_t bdu);
+	int8_t PADS_getBlockDataUpdateState(WE_sensorInterface_t *sensorInterface, PADS_state_t *bdu);
 
-	int8_t  PADS_rebootMemory(PADS_state_t reboot);
-	int8_t PADS_getRebootMemoryState(PADS_state_t *reboot);
-	int8_t PADS_getBootStatus(PADS_state_t *boot);
+	int8_t  PADS_rebootMemory(WE_sensorInterface_t *sensorInterface, PADS_state_t reboot);
+	int8_t PADS_getRebootMemoryState(WE_sensorInterface_t *sensorInterface, PADS_state_t *reboot);
+	int8_t PADS_getBootStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *boot);
 
-	int8_t  PADS_setIntActiveLevel(PADS_interrupt_level_t intLvl);
-	int8_t PADS_getIntActiveLevel(PADS_interrupt_level_t *intLvl);
+	int8_t  PADS_setIntActiveLevel(WE_sensorInterface_t *sensorInterface, PADS_interrupt_level_t intLvl);
+	int8_t PADS_getIntActiveLevel(WE_sensorInterface_t *sensorInterface, PADS_interrupt_level_t *intLvl);
 
-	int8_t  PADS_setIntPinType(PADS_interrupt_pin_t intr);
-	int8_t PADS_getIntPinType(PADS_interrupt_pin_t *intr);
+	int8_t  PADS_setIntPinType(WE_sensorInterface_t *sensorInterface, PADS_interrupt_pin_t intr);
+	int8_t PADS_getIntPinType(WE_sensorInterface_t *sensorInterface, PADS_interrupt_pin_t *intr);
 
-	int8_t  PADS_setAutoIncrement(PADS_state_t inc);
-	int8_t PADS_getAutoIncrementState(PADS_state_t *inc);
+	int8_t  PADS_setAutoIncrement(WE_sensorInterface_t *sensorInterface, PADS_state_t inc);
+	int8_t PADS_getAutoIncrementState(WE_sensorInterface_t *sensorInterface, PADS_state_t *inc);
 
-	int8_t  PADS_setSwreset(PADS_state_t mode);
-	int8_t PADS_getSwresetState(PADS_state_t *mode);
+	int8_t  PADS_setSwreset(WE_sensorInterface_t *sensorInterface, PADS_state_t mode);
+	int8_t PADS_getSwresetState(WE_sensorInterface_t *sensorInterface, PADS_state_t *mode);
 
-	int8_t  PADS_setPowerMode(PADS_pwr_mode_t mode);
-	int8_t PADS_getPowerMode(PADS_pwr_mode_t *mode);
+	int8_t  PADS_setPowerMode(WE_sensorInterface_t *sensorInterface, PADS_pwr_mode_t mode);
+	int8_t PADS_getPowerMode(WE_sensorInterface_t *sensorInterface, PADS_pwr_mode_t *mode);
 
-	int8_t  PADS_setSingleConvMode(PADS_state_t mode);
-	int8_t PADS_getSingleConvModeState(PADS_state_t *mode);
+	int8_t  PADS_setSingleConvMode(WE_sensorInterface_t *sensorInterface, PADS_state_t mode);
+	int8_t PADS_getSingleConvModeState(WE_sensorInterface_t *sensorInterface, PADS_state_t *mode);
 
 	/* pressure offset value */
-	int8_t  PADS_setPresOffsetLSB(uint8_t offSet);
-	int8_t PADS_getPresOffsetLSB(uint8_t *offSet);
-	int8_t  PADS_setPresOffsetMSB(uint8_t offSet);
-	int8_t PADS_getPresOffsetMSB(uint8_t *offSet);
+	int8_t  PADS_setPresOffsetLSB(WE_sensorInterface_t *sensorInterface, uint8_t offSet);
+	int8_t PADS_getPresOffsetLSB(WE_sensorInterface_t *sensorInterface, uint8_t *offSet);
+	int8_t  PADS_setPresOffsetMSB(WE_sensorInterface_t *sensorInterface, uint8_t offSet);
+	int8_t PADS_getPresOffsetMSB(WE_sensorInterface_t *sensorInterface, uint8_t *offSet);
 
 	/* SET FIFO CTRL_REG */
-	int8_t  PADS_setFifoMode(PADS_fifo_mode_t fifoMode);
-	int8_t PADS_getFifoMode(PADS_fifo_mode_t *fifoMode);
+	int8_t  PADS_setFifoMode(WE_sensorInterface_t *sensorInterface, PADS_fifo_mode_t fifoMode);
+	int8_t PADS_getFifoMode(WE_sensorInterface_t *sensorInterface, PADS_fifo_mode_t *fifoMode);
 
-	int8_t  PADS_setStopOnThr(PADS_state_t state);
-	int8_t PADS_getStopOnThrStatus(PADS_state_t *state);
+	int8_t  PADS_setStopOnThr(WE_sensorInterface_t *sensorInterface, PADS_state_t state);
+	int8_t PADS_getStopOnThrStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *state);
 
-	int8_t  PADS_setFifoThr(uint8_t fifoThr);
-	int8_t PADS_getFifoThr(uint8_t *fifoThr);
+	int8_t  PADS_setFifoThr(WE_sensorInterface_t *sensorInterface, uint8_t fifoThr);
+	int8_t PADS_getFifoThr(WE_sensorInterface_t *sensorInterface, uint8_t *fifoThr);
 
-	int8_t PADS_getFifoFillLevel(uint8_t *fifoLevel);
+	int8_t PADS_getFifoFillLevel(WE_sensorInterface_t *sensorInterface, uint8_t *fifoLevel);
 
 	/* Getting Reference pressure value */
-	int8_t PADS_getPresRefLSB(uint8_t *lowReferenceValue);
-	int8_t PADS_getPresRefMSB(uint8_t *highReferenceValue);
+	int8_t PADS_getPresRefLSB(WE_sensorInterface_t *sensorInterface, uint8_t *lowReferenceValue);
+	int8_t PADS_getPresRefMSB(WE_sensorInterface_t *sensorInterface, uint8_t *highReferenceValue);
 
 	/* Temperature and Pressure data overrun State */
-	int8_t PADS_getTemperOverrunStatus(PADS_state_t *state);
-	int8_t PADS_getPressureOverrunStatus(PADS_state_t *state);
+	int8_t PADS_getTemperOverrunStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *state);
+	int8_t PADS_getPressureOverrunStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *state);
 	/* Temperature and Pressure data available State */
-	int8_t PADS_getTempStatus(PADS_state_t *state);
-	int8_t PADS_getPresStatus(PADS_state_t *state);	
-	int8_t PADS_getStatusDrdy(PADS_state_t *stateDrdyTemperature, PADS_state_t *stateDrdyPressure);
+	int8_t PADS_getTempStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *state);
+	int8_t PADS_getPresStatus(WE_sensorInterface_t *sensorInterface, PADS_state_t *state);	
+	int8_t PADS_getStatusDrdy(WE_sensorInterface_t *sensorInterface, PADS_state_t *stateDrdyTemperature, PADS_state_t *stateDrdyPressure);
 
 	/* standard Data Out */
-	int8_t PADS_getRAWPressure(uint32_t *rawPres);
-	int8_t PADS_getRAWTemperature(uint16_t *rawTemp);
-	int8_t PADS_getPressure(float *presskPa);     // Pressure Value in kPa
-	int8_t PADS_getTemperature(float *tempdegC);  // Temperature Value in °C
+	int8_t PADS_getRAWPressure(WE_sensorInterface_t *sensorInterface, uint32_t *rawPres);
+	int8_t PADS_getRAWTemperature(WE_sensorInterface_t *sensorInterface, uint16_t *rawTemp);
+	int8_t PADS_getPressure(WE_sensorInterface_t *sensorInterface, float *presskPa);     // Pressure Value in kPa
+	int8_t PADS_getTemperature(WE_sensorInterface_t *sensorInterface, float *tempdegC);  // Temperature Value in °C
 
 	/*Fifo Data Out */
-	int8_t PADS_getFifoRAWTemperature(uint16_t *rawTemp);
-	int8_t PADS_getFifoRAWPressure(uint32_t *rawPres);
-	int8_t PADS_getFifoTemperature(float *tempdegC);  // Temperature Value in °C
-	int8_t PADS_getFifoPressure(float *presskPa);    // Pressure Value in kPa
+	int8_t PADS_getFifoRAWTemperature(WE_sensorInterface_t *sensorInterface, uint16_t *rawTemp);
+	int8_t PADS_getFifoRAWPressure(WE_sensorInterface_t *sensorInterface, uint32_t *rawPres);
+	int8_t PADS_getFifoTemperature(WE_sensorInterface_t *sensorInterface, float *tempdegC);  // Temperature Value in °C
+	int8_t PADS_getFifoPressure(WE_sensorInterface_t *sensorInterface, float *presskPa);    // Pressure Value in kPa
 
 #ifdef __cplusplus
 }
@@ -30,11 +30,25 @@
 /**
 * @brief  Initialize the I2C Interface
 * @param  I2C address
+* @param  Bus instance of the transport, NULL selects the default bus
+* @param  Transport, NULL selects the default transport of the platform
 * @retval Error Code
 */
-int Sensor_PDUS::init(int address)
+int Sensor_PDUS::init(int address, void *handle, const WE_transport_t *transport)
 {
-  return I2CInit(address);
+  sensorInterface.handle = handle;
+  sensorInterface.transport = transport;
+  sensorInterface.cache = NULL;
+  return I2CInit(&sensorInterface, address);
+}
+
+/**
+* @brief  Get the bus interface of the sensor, e.g. to queue asynchronous requests
+* @retval Pointer to sensor interface
+*/
+WE_sensorInterface_t *Sensor_PDUS::get_Interface()
+{
+  return &sensorInterface;
 }
 
 /**
@@ -46,7 +60,7 @@ int Sensor_PDUS::init(int address)
     uint8_t data[4] = {0, 0, 0, 0};
 
 	// bytesToRead = 4, 2 byte pressure followed by 2 byte temperature
-    if (WE_FAIL == I2C_read(data, 4)) 
+    if (WE_FAIL == I2C_read(&sensorInterface, data, 4)) 
 	{
 		return WE_FAIL;
 	}
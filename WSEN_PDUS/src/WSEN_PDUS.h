@@ -48,11 +48,15 @@ class Sensor_PDUS
 {
 
 public:
-   int init(int address);
+   int init(int address, void *handle = NULL, const WE_transport_t *transport = NULL);
+   WE_sensorInterface_t *get_Interface();
 
    int get_RawPresAndTemp(uint16_t *rawPres, uint16_t *rawTemp);
   
    int getPresAndTemp(PDUS_Sensor_Type typ, float *presskPa, float *tempDeg);
+
+private:
+    WE_sensorInterface_t sensorInterface;
 };
 
 #endif
@@ -28,11 +28,26 @@
 /**
    @brief  Initialize the I2C Interface
    @param  I2C address
+   @param  Bus instance of the transport, NULL selects the default bus
+   @param  Transport, NULL selects the default transport of the platform
    @retval Error Code
 */
-int Sensor_TIDS::init(int address)
+int Sensor_TIDS::init(int address, void *handle, const WE_transport_t *transport)
 {
-  return I2CInit(address);
+  sensorInterface.handle = handle;
+  sensorInterface.transport = transport;
+  WE_initRegisterCache(&registerCache, TIDS_cachedRegisters, TIDS_CACHED_REGISTERS, 0, cacheValues);
+  sensorInterface.cache = &registerCache;
+  return I2CInit(&sensorInterface, address);
+}
+
+/**
+   @brief  Get the bus interface of the sensor, e.g. to queue asynchronous requests
+   @retval Pointer to sensor interface
+*/
+WE_sensorInterface_t *Sensor_TIDS::get_Interface()
+{
+  return &sensorInterface;
 }
 
 /**
@@ -43,7 +58,7 @@ int Sensor_TIDS::get_DeviceID()
 {
   uint8_t devID;
 
-  if (WE_SUCCESS == TIDS_getDeviceID(&devID))
+  if (WE_SUCCESS == TIDS_getDeviceID(&sensorInterface, &devID))
   {
     return devID;
   }
@@ -62,11 +77,11 @@ int Sensor_TIDS::Select_ODR()
   {
     case 200:
     {
-      if(WE_FAIL == TIDS_setOutputDataRate(TIDS_ODR_200HZ))
+      if(WE_FAIL == TIDS_setOutputDataRate(&sensorInterface, TIDS_ODR_200HZ))
 	  {
 		return WE_FAIL;
       }
-      if(WE_FAIL == TIDS_setContinuousMode(TIDS_enable))
+      if(WE_FAIL == TIDS_setContinuousMode(&sensorInterface, TIDS_enable))
 	  {
 		return WE_FAIL;
       }
@@ -75,11 +90,11 @@ int Sensor_TIDS::Select_ODR()
 
     case 100:
     {
-      if(WE_FAIL == TIDS_setOutputDataRate(TIDS_ODR_100HZ))
+      if(WE_FAIL == TIDS_setOutputDataRate(&sensorInterface, TIDS_ODR_100HZ))
 	  {
 		return WE_FAIL;
       }
-      if(WE_FAIL == TIDS_setContinuousMode(TIDS_enable))
+      if(WE_FAIL == TIDS_setContinuousMode(&sensorInterface, TIDS_enable))
 	  {
 		return WE_FAIL;
       }
@@ -88,11 +103,11 @@ int Sensor_TIDS::Select_ODR()
 
     case 50:
     {
-      if(WE_FAIL == TIDS_setOutputDataRate(TIDS_ODR_50HZ))
+      if(WE_FAIL == TIDS_setOutputDataRate(&sensorInterface, TIDS_ODR_50HZ))
 	  {
 		return WE_FAIL;
       }
-      if(WE_FAIL == TIDS_setContinuousMode(TIDS_enable))
+      if(WE_FAIL == TIDS_setContinuousMode(&sensorInterface, TIDS_enable))
 	  {
 		return WE_FAIL;
       }
@@ -101,11 +116,11 @@ int Sensor_TIDS::Select_ODR()
 
     case 25:
     {
-      if(WE_FAIL == TIDS_setOutputDataRate(TIDS_ODR_25HZ))
+      if(WE_FAIL == TIDS_setOutputDataRate(&sensorInterface, TIDS_ODR_25HZ))
 	  {
 		return WE_FAIL;
       }
-      if(WE_FAIL == TIDS_setContinuousMode(TIDS_enable))
+      if(WE_FAIL == TIDS_setContinuousMode(&sensorInterface, TIDS_enable))
 	  {
 		return WE_FAIL;
       }
@@ -114,7 +129,7 @@ int Sensor_TIDS::Select_ODR()
 
     case 1:
     {
-      if(WE_FAIL == TIDS_setContinuousMode(TIDS_enable)) // Low ODR bit is enabled, ODR 1 Hz
+      if(WE_FAIL == TIDS_setContinuousMode(&sensorInterface, TIDS_enable)) // Low ODR bit is enabled, ODR 1 Hz
 	  {
 		return WE_FAIL;
 	  }
@@ -138,17 +153,17 @@ int Sensor_TIDS::Select_ODR()
 */
 int Sensor_TIDS::power_down()
 {
-  if(WE_FAIL == TIDS_setBlockDataUpdate(TIDS_enable))
+  if(WE_FAIL == TIDS_setBlockDataUpdate(&sensorInterface, TIDS_enable))
   {
       return WE_FAIL;
   }
 	
-  if(WE_FAIL == TIDS_setAutoIncrement(TIDS_enable))
+  if(WE_FAIL == TIDS_setAutoIncrement(&sensorInterface, TIDS_enable))
   {
       return WE_FAIL;
   }
 	
-  if(WE_FAIL == TIDS_setContinuousMode(TIDS_disable))
+  if(WE_FAIL == TIDS_setContinuousMode(&sensorInterface, TIDS_disable))
   {
       return WE_FAIL;
   }
@@ -162,17 +177,17 @@ int Sensor_TIDS::power_down()
 */
 int Sensor_TIDS::oneshot()
 {
-  if(WE_FAIL == TIDS_setBlockDataUpdate(TIDS_enable))
+  if(WE_FAIL == TIDS_setBlockDataUpdate(&sensorInterface, TIDS_enable))
   {
       return WE_FAIL;
   }
   
-  if(WE_FAIL == TIDS_setAutoIncrement(TIDS_enable))
+  if(WE_FAIL == TIDS_setAutoIncrement(&sensorInterface, TIDS_enable))
   {
       return WE_FAIL;
   }
   
-  if(WE_FAIL == TIDS_setSingleConvMode(TIDS_enable)) // enable one shot bit
+  if(WE_FAIL == TIDS_setSingleConvMode(&sensorInterface, TIDS_enable)) // enable one shot bit
   {
       return WE_FAIL;
   }
@@ -187,13 +202,13 @@ int Sensor_TIDS::oneshot()
 */
 int Sensor_TIDS::SW_RESET()
 {
-  if(WE_FAIL == TIDS_setSwReset(TIDS_enable))
+  if(WE_FAIL == TIDS_setSwReset(&sensorInterface, TIDS_enable))
   {
       return WE_FAIL;
   }
   
   delay(12);
-  if(WE_FAIL == TIDS_setSwReset(TIDS_disable))
+  if(WE_FAIL == TIDS_setSwReset(&sensorInterface, TIDS_disable))
   {
       return WE_FAIL;
   }
@@ -210,7 +225,7 @@ int Sensor_TIDS::SW_RESET()
 int Sensor_TIDS::get_SW_RESET(int *rst)
 {
   TIDS_state_t swRstReg;
-  if(WE_FAIL == TIDS_getSwReset(&swRstReg))
+  if(WE_FAIL == TIDS_getSwReset(&sensorInterface, &swRstReg))
   {
       return WE_FAIL;
   }  
@@ -227,7 +242,7 @@ int Sensor_TIDS::get_SW_RESET(int *rst)
 int Sensor_TIDS::read_temperature(float *temp)
 {
   float float_temp;
-  if(WE_FAIL == TIDS_getRAWTemperature(&rawTemp))
+  if(WE_FAIL == TIDS_getRAWTemperature(&sensorInterface, &rawTemp))
   {
       return WE_FAIL;
   }
@@ -296,7 +311,7 @@ int Sensor_TIDS::set_single_conversion()
 int Sensor_TIDS::is_ready_to_read()
 {
   TIDS_state_t state;
-  int result = TIDS_getBusyStatus(&state);
+  int result = TIDS_getBusyStatus(&sensorInterface, &state);
   
   if(WE_FAIL == result) 
   {	 
@@ -343,7 +358,7 @@ int Sensor_TIDS::set_continuous_mode(int _ODR)
 */
 int Sensor_TIDS::set_Temp_High_Limit(uint8_t T_H_Limit)
 {
-  if(WE_FAIL == TIDS_setTempHighLimit(T_H_Limit))
+  if(WE_FAIL == TIDS_setTempHighLimit(&sensorInterface, T_H_Limit))
   {
       return WE_FAIL;
   }
@@ -359,7 +374,7 @@ int Sensor_TIDS::set_Temp_High_Limit(uint8_t T_H_Limit)
 int Sensor_TIDS::get_Temp_High_Limit(uint8_t *limit)
 {
   uint8_t hLimit;
-  if(WE_FAIL == TIDS_getTempHighLimit(&hLimit))
+  if(WE_FAIL == TIDS_getTempHighLimit(&sensorInterface, &hLimit))
   {
       return WE_FAIL;
   }
@@ -376,7 +391,7 @@ int Sensor_TIDS::get_Temp_High_Limit(uint8_t *limit)
 */
 int Sensor_TIDS::set_Temp_Low_Limit(uint8_t T_L_Limit)
 {
-  if(WE_FAIL == TIDS_setTempLowLimit(T_L_Limit))
+  if(WE_FAIL == TIDS_setTempLowLimit(&sensorInterface, T_L_Limit))
   {
 	  return WE_FAIL;
   }
@@ -392,7 +407,7 @@ int Sensor_TIDS::set_Temp_Low_Limit(uint8_t T_L_Limit)
 int Sensor_TIDS::get_Temp_Low_Limit(uint8_t *limit)
 {
   uint8_t lLimit;
-  if(WE_FAIL == TIDS_getTempLowLimit(&lLimit))
+  if(WE_FAIL == TIDS_getTempLowLimit(&sensorInterface, &lLimit))
   {
 	  return WE_FAIL;
   }
@@ -436,4 +451,5 @@ int Sensor_TIDS::get_Threshold_Low_Limit(float *limit)
   
   float threshold = ((lLimit - 63) * 0.64f);
   *limit = threshold;
+  return WE_SUCCESS;
 }
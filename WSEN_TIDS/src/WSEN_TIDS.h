@@ -32,7 +32,8 @@ class Sensor_TIDS
 {
 
 public:
-    int init(int address);
+    int init(int address, void *handle = NULL, const WE_transport_t *transport = NULL);
+    WE_sensorInterface_t *get_Interface();
     int get_DeviceID();
 
     int power_down();
@@ -59,6 +60,9 @@ public:
     int ODR;
 
 private:
+    WE_sensorInterface_t sensorInterface;
+    WE_registerCache_t registerCache;
+    uint8_t cacheValues[TIDS_CACHED_REGISTERS];
     
     uint16_t rawTemp;
     float T_neg;
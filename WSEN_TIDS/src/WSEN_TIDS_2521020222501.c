@@ -27,14 +27,27 @@
 #include <stdio.h>
 
 
+/**
+* @brief  Registers held in the register cache of the sensor interface:
+*         configuration registers
+*/
+const WE_cachedRegister_t TIDS_cachedRegisters[TIDS_CACHED_REGISTERS] = {
+	{ TIDS_LIMIT_T_H_REG, 0, 0 },
+	{ TIDS_LIMIT_T_L_REG, 0, 0 },
+	{ TIDS_CTRL_REG, 0x01, 0 },       /* ONE_SHOT */
+	{ TIDS_SOFT_RESET_REG, 0, 0x02 }  /* SOFT_RESET */
+};
+
+
 /**
 * @brief  Read the device ID
+* @param  Pointer to sensor interface
 * @param  Pointer to device ID.
 * @retval Error code
 */
-int8_t TIDS_getDeviceID(uint8_t *devID)
+int8_t TIDS_getDeviceID(WE_sensorInterface_t *sensorInterface, uint8_t *devID)
 {
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_DEVICE_ID_REG, 1, devID))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_DEVICE_ID_REG, 1, devID))
 	return WE_FAIL;
 
 	return WE_SUCCESS; /* expected value is TIDS_DEVICE_ID_VALUE */
@@ -43,19 +56,20 @@ int8_t TIDS_getDeviceID(uint8_t *devID)
 
 /**
 * @brief  Set software reset [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t TIDS_setSwReset(TIDS_state_t mode)
+int8_t TIDS_setSwReset(WE_sensorInterface_t *sensorInterface, TIDS_state_t mode)
 {
 	TIDS_soft_reset_t swRstReg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_SOFT_RESET_REG, 1, (uint8_t *)&swRstReg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_SOFT_RESET_REG, 1, (uint8_t *)&swRstReg))
 	return WE_FAIL;
 
 	swRstReg.reset = mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_SOFT_RESET_REG, 1, (uint8_t *)&swRstReg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)TIDS_SOFT_RESET_REG, 1, (uint8_t *)&swRstReg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -63,14 +77,15 @@ int8_t TIDS_setSwReset(TIDS_state_t mode)
 
 /**
 * @brief  Read the software reset state [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to software reset state
 * @retval Error code
 */
-int8_t TIDS_getSwReset(TIDS_state_t *mode)
+int8_t TIDS_getSwReset(WE_sensorInterface_t *sensorInterface, TIDS_state_t *mode)
 {
 	TIDS_soft_reset_t swRstReg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_SOFT_RESET_REG, 1, (uint8_t *)&swRstReg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_SOFT_RESET_REG, 1, (uint8_t *)&swRstReg))
 	return WE_FAIL;
 	
 	*mode = (TIDS_state_t)swRstReg.reset;
@@ -79,33 +94,35 @@ int8_t TIDS_getSwReset(TIDS_state_t *mode)
 
 /**
 * @brief  Set the free run mode[enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  mode
 * @retval Error code
 */
-int8_t TIDS_setContinuousMode(TIDS_state_t mode)
+int8_t TIDS_setContinuousMode(WE_sensorInterface_t *sensorInterface, TIDS_state_t mode)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	ctrl_reg.freeRunBit = mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
 }
 /**
 * @brief  Read the Single Conversion Mode state [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to Single Conversion Mode state
 * @retval Error code
 */
-int8_t TIDS_getContinuousMode(TIDS_state_t *mode)
+int8_t TIDS_getContinuousMode(WE_sensorInterface_t *sensorInterface, TIDS_state_t *mode)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 	
 	*mode = (TIDS_state_t)ctrl_reg.freeRunBit;
@@ -114,19 +131,20 @@ int8_t TIDS_getContinuousMode(TIDS_state_t *mode)
 
 /**
 * @brief  Set the block data update feature
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t TIDS_setBlockDataUpdate(TIDS_state_t bdu)
+int8_t TIDS_setBlockDataUpdate(WE_sensorInterface_t *sensorInterface, TIDS_state_t bdu)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	ctrl_reg.blockDataUpdate = bdu;
 
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -134,14 +152,15 @@ int8_t TIDS_setBlockDataUpdate(TIDS_state_t bdu)
 
 /**
 * @brief  Read the block data update state
+* @param  Pointer to sensor interface
 * @param  pointer to auto Increment state
 * @retval Error code
 */
-int8_t TIDS_getBlockDataUpdate(TIDS_state_t *bdu)
+int8_t TIDS_getBlockDataUpdate(WE_sensorInterface_t *sensorInterface, TIDS_state_t *bdu)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 	
 	*bdu = (TIDS_state_t)ctrl_reg.blockDataUpdate;
@@ -150,19 +169,20 @@ int8_t TIDS_getBlockDataUpdate(TIDS_state_t *bdu)
 
 /**
 * @brief  Set the output data rate of the sensor
+* @param  Pointer to sensor interface
 * @param  output data rate
 * @retval Error code
 */
-int8_t TIDS_setOutputDataRate(TIDS_output_data_rate_t odr)
+int8_t TIDS_setOutputDataRate(WE_sensorInterface_t *sensorInterface, TIDS_output_data_rate_t odr)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	ctrl_reg.outputDataRate = odr;
 
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -170,14 +190,15 @@ int8_t TIDS_setOutputDataRate(TIDS_output_data_rate_t odr)
 
 /**
 * @brief  Read the output data rate of the sensor
+* @param  Pointer to sensor interface
 * @param  Pointer to Output Data Rate
 * @retval Error code
 */
-int8_t TIDS_getOutputDataRate(TIDS_output_data_rate_t* odr)
+int8_t TIDS_getOutputDataRate(WE_sensorInterface_t *sensorInterface, TIDS_output_data_rate_t* odr)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	*odr = (TIDS_output_data_rate_t)ctrl_reg.outputDataRate;
@@ -186,19 +207,20 @@ int8_t TIDS_getOutputDataRate(TIDS_output_data_rate_t* odr)
 
 /**
 * @brief  Set the single conversion mode[enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  mode
 * @retval Error code
 */
-int8_t TIDS_setSingleConvMode(TIDS_state_t mode)
+int8_t TIDS_setSingleConvMode(WE_sensorInterface_t *sensorInterface, TIDS_state_t mode)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	ctrl_reg.oneShotbit = mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -206,14 +228,15 @@ int8_t TIDS_setSingleConvMode(TIDS_state_t mode)
 
 /**
 * @brief  Read the Single Conversion Mode state [enabled,disabled]
+* @param  Pointer to sensor interface
 * @param  Pointer to Single Conversion Mode state
 * @retval Error code
 */
-int8_t TIDS_getSingleConvMode(TIDS_state_t *mode)
+int8_t TIDS_getSingleConvMode(WE_sensorInterface_t *sensorInterface, TIDS_state_t *mode)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 	
 	*mode = (TIDS_state_t)ctrl_reg.oneShotbit;
@@ -222,19 +245,20 @@ int8_t TIDS_getSingleConvMode(TIDS_state_t *mode)
 
 /**
 * @brief  Set the Auto increment feature
+* @param  Pointer to sensor interface
 * @param  state
 * @retval Error code
 */
-int8_t TIDS_setAutoIncrement(TIDS_state_t inc)
+int8_t TIDS_setAutoIncrement(WE_sensorInterface_t *sensorInterface, TIDS_state_t inc)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	ctrl_reg.autoAddIncr = inc;
 
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -242,14 +266,15 @@ int8_t TIDS_setAutoIncrement(TIDS_state_t inc)
 
 /**
 * @brief  Read the auto increment state
+* @param  Pointer to sensor interface
 * @param  pointer to auto Increment state
 * @retval Error code
 */
-int8_t TIDS_getAutoIncrement(TIDS_state_t *inc)
+int8_t TIDS_getAutoIncrement(WE_sensorInterface_t *sensorInterface, TIDS_state_t *inc)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 	
 	*inc = (TIDS_state_t)ctrl_reg.autoAddIncr;
@@ -259,14 +284,15 @@ int8_t TIDS_getAutoIncrement(TIDS_state_t *inc)
 
 /**
 * @brief  Check if the sensor is busy
+* @param  Pointer to sensor interface
 * @param  pointer to busy State
 * @retval error code
 */
-int8_t TIDS_getBusyStatus(TIDS_state_t *state)
+int8_t TIDS_getBusyStatus(WE_sensorInterface_t *sensorInterface, TIDS_state_t *state)
 {
 	TIDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 	
 	*state = (TIDS_state_t)status_reg.busy;
@@ -275,14 +301,15 @@ int8_t TIDS_getBusyStatus(TIDS_state_t *state)
 
 /**
 * @brief  Check if high limit is reached
+* @param  Pointer to sensor interface
 * @param  pointer to State
 * @retval error code
 */
-int8_t TIDS_getOverHighLimStatus(TIDS_state_t *state)
+int8_t TIDS_getOverHighLimStatus(WE_sensorInterface_t *sensorInterface, TIDS_state_t *state)
 {
 	TIDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 	
 	*state = (TIDS_state_t)status_reg.overLimit;
@@ -291,14 +318,15 @@ int8_t TIDS_getOverHighLimStatus(TIDS_state_t *state)
 
 /**
 * @brief  Check if low limit is reached
+* @param  Pointer to sensor interface
 * @param  pointer to State
 * @retval error code
 */
-int8_t TIDS_getUnderLowLimStatus(TIDS_state_t *state)
+int8_t TIDS_getUnderLowLimStatus(WE_sensorInterface_t *sensorInterface, TIDS_state_t *state)
 {
 	TIDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 	
 	*state = (TIDS_state_t)status_reg.underlimit;
@@ -307,17 +335,18 @@ int8_t TIDS_getUnderLowLimStatus(TIDS_state_t *state)
 
 /**
 * @brief  Read the raw measured temperature value
+* @param  Pointer to sensor interface
 * @param  pointer to Temperature Measurement
 * @retval Error code
 */
-int8_t TIDS_getRAWTemperature(uint16_t *rawTemp)
+int8_t TIDS_getRAWTemperature(WE_sensorInterface_t *sensorInterface, uint16_t *rawTemp)
 {
 	uint8_t tmp[2] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_DATA_T_L_REG, 1, &tmp[0]))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_DATA_T_L_REG, 1, &tmp[0]))
 	return WE_FAIL;
 	
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_DATA_T_H_REG, 1, &tmp[1]))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_DATA_T_H_REG, 1, &tmp[1]))
 	return WE_FAIL;
 
 	*rawTemp = (uint16_t)(tmp[1] << 8);
@@ -327,13 +356,14 @@ int8_t TIDS_getRAWTemperature(uint16_t *rawTemp)
 
 /**
 * @brief  Read the measured temperature value in Â°C
+* @param  Pointer to sensor interface
 * @param  Pointer to Temperature Measurement
 * @retval Error code
 */
-int8_t TIDS_getTemperature(float *tempdegC)
+int8_t TIDS_getTemperature(WE_sensorInterface_t *sensorInterface, float *tempdegC)
 {
 	uint16_t rawTemp = 0;
-	if(WE_FAIL == TIDS_getRAWTemperature(&rawTemp))
+	if(WE_FAIL == TIDS_getRAWTemperature(sensorInterface, &rawTemp))
 	return WE_FAIL;
 
 	*tempdegC = (float)rawTemp;
@@ -343,24 +373,26 @@ int8_t TIDS_getTemperature(float *tempdegC)
 
 /**
 * @brief  Set temperature high limit
+* @param  Pointer to sensor interface
 * @param  High limit
 * @retval Error code
 */
-int8_t TIDS_setTempHighLimit(uint8_t hLimit)
+int8_t TIDS_setTempHighLimit(WE_sensorInterface_t *sensorInterface, uint8_t hLimit)
 {
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_LIMIT_T_H_REG, 1, &hLimit))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)TIDS_LIMIT_T_H_REG, 1, &hLimit))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
 }
 /**
 * @brief  Get temperature high limit
+* @param  Pointer to sensor interface
 * @param  pointer to temperature high limit
 * @retval Error code
 */
-int8_t TIDS_getTempHighLimit(uint8_t *hLimit)
+int8_t TIDS_getTempHighLimit(WE_sensorInterface_t *sensorInterface, uint8_t *hLimit)
 {
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_LIMIT_T_H_REG, 1, hLimit))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_LIMIT_T_H_REG, 1, hLimit))
 	return WE_FAIL;
 	
 	return WE_SUCCESS;
@@ -369,12 +401,13 @@ int8_t TIDS_getTempHighLimit(uint8_t *hLimit)
 
 /**
 * @brief  Set temperature low limit
+* @param  Pointer to sensor interface
 * @param  Low limit
 * @retval Error code
 */
-int8_t TIDS_setTempLowLimit(uint8_t lLimit)
+int8_t TIDS_setTempLowLimit(WE_sensorInterface_t *sensorInterface, uint8_t lLimit)
 {
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_LIMIT_T_L_REG, 1, &lLimit))
+	if (WE_FAIL == WriteReg(sensorInterface, (uint8_t)TIDS_LIMIT_T_L_REG, 1, &lLimit))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -383,12 +416,13 @@ int8_t TIDS_setTempLowLimit(uint8_t lLimit)
 
 /**
 * @brief  Get temperature low limit
+* @param  Pointer to sensor interface
 * @param  pointer to temperature low limit
 * @retval Error code
 */
-int8_t TIDS_getTempLowLimit(uint8_t *lLimit)
+int8_t TIDS_getTempLowLimit(WE_sensorInterface_t *sensorInterface, uint8_t *lLimit)
 {
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_LIMIT_T_L_REG, 1, lLimit))
+	if (WE_FAIL == ReadReg(sensorInterface, (uint8_t)TIDS_LIMIT_T_L_REG, 1, lLimit))
 	return WE_FAIL;
 	
 	return WE_SUCCESS;
@@ -60,6 +60,8 @@ extern "C"
 #define TIDS_DATA_T_H_REG					(uint8_t)0x07 		/* Temperature Output MSB value Register */
 #define TIDS_SOFT_RESET_REG					(uint8_t)0x0C    	/* Software reset register */
 
+#define TIDS_CACHED_REGISTERS				(uint8_t)4				/* number of registers in TIDS_cachedRegisters */
+
 /**         Register type definitions         */
 /**
 * Control Register
@@ -125,50 +127,53 @@ typedef enum {
 	TIDS_ODR_200HZ = 3,	/* 200 Hz */
 } TIDS_output_data_rate_t;
 
+	/* Registers held in the register cache of the sensor interface */
+	extern const WE_cachedRegister_t TIDS_cachedRegisters[TIDS_CACHED_REGISTERS];
+
 	/**         Functions definition         */
 
 	/* Device ID */
-	int8_t TIDS_getDeviceID(uint8_t *devID);
+	int8_t TIDS_getDeviceID(WE_sensorInterface_t *sensorInterface, uint8_t *devID);
 
 	/* Temperature limits */
-	int8_t TIDS_setTempHighLimit(uint8_t hLimit);
-	int8_t TIDS_setTempLowLimit(uint8_t lLimit);
+	int8_t TIDS_setTempHighLimit(WE_sensorInterface_t *sensorInterface, uint8_t hLimit);
+	int8_t TIDS_setTempLowLimit(WE_sensorInterface_t *sensorInterface, uint8_t lLimit);
 
-	int8_t TIDS_getTempHighLimit(uint8_t *hLimit);
-	int8_t TIDS_getTempLowLimit(uint8_t *lLimit);
+	int8_t TIDS_getTempHighLimit(WE_sensorInterface_t *sensorInterface, uint8_t *hLimit);
+	int8_t TIDS_getTempLowLimit(WE_sensorInterface_t *sensorInterface, uint8_t *lLimit);
 
 	/* Block data update */
-	int8_t TIDS_setBlockDataUpdate(TIDS_state_t bdu);
-	int8_t TIDS_getBlockDataUpdate(TIDS_state_t *bdu);
+	int8_t TIDS_setBlockDataUpdate(WE_sensorInterface_t *sensorInterface, TIDS_state_t bdu);
+	int8_t TIDS_getBlockDataUpdate(WE_sensorInterface_t *sensorInterface, TIDS_state_t *bdu);
 
 	/* Output data rate */
-	int8_t TIDS_setOutputDataRate(TIDS_output_data_rate_t odr);
-	int8_t TIDS_getOutputDataRate(TIDS_output_data_rate_t* odr);
+	int8_t TIDS_setOutputDataRate(WE_sensorInterface_t *sensorInterface, TIDS_output_data_rate_t odr);
+	int8_t TIDS_getOutputDataRate(WE_sensorInterface_t *sensorInterface, TIDS_output_data_rate_t* odr);
 
 	/* Address auto increment */
-	int8_t TIDS_setAutoIncrement(TIDS_state_t inc);
-	int8_t TIDS_getAutoIncrement(TIDS_state_t *inc);
+	int8_t TIDS_setAutoIncrement(WE_sensorInterface_t *sensorInterface, TIDS_state_t inc);
+	int8_t TIDS_getAutoIncrement(WE_sensorInterface_t *sensorInterface, TIDS_state_t *inc);
 
 	/* Free run mode */
-	int8_t TIDS_setContinuousMode(TIDS_state_t mode);
-	int8_t TIDS_getContinuousMode(TIDS_state_t *mode);
+	int8_t TIDS_setContinuousMode(WE_sensorInterface_t *sensorInterface, TIDS_state_t mode);
+	int8_t TIDS_getContinuousMode(WE_sensorInterface_t *sensorInterface, TIDS_state_t *mode);
 
 	/* One shot mode */
-	int8_t TIDS_setSingleConvMode(TIDS_state_t mode);
-	int8_t TIDS_getSingleConvMode(TIDS_state_t *mode);
+	int8_t TIDS_setSingleConvMode(WE_sensorInterface_t *sensorInterface, TIDS_state_t mode);
+	int8_t TIDS_getSingleConvMode(WE_sensorInterface_t *sensorInterface, TIDS_state_t *mode);
 
 	/* Status */
-	int8_t TIDS_getOverHighLimStatus(TIDS_state_t *state);
-	int8_t TIDS_getUnderLowLimStatus(TIDS_state_t *state);
-	int8_t TIDS_getBusyStatus(TIDS_state_t *state);
+	int8_t TIDS_getOverHighLimStatus(WE_sensorInterface_t *sensorInterface, TIDS_state_t *state);
+	int8_t TIDS_getUnderLowLimStatus(WE_sensorInterface_t *sensorInterface, TIDS_state_t *state);
+	int8_t TIDS_getBusyStatus(WE_sensorInterface_t *sensorInterface, TIDS_state_t *state);
 
 	/* Software reset */
-	int8_t TIDS_setSwReset(TIDS_state_t mode);
-	int8_t TIDS_getSwReset(TIDS_state_t *mode);
+	int8_t TIDS_setSwReset(WE_sensorInterface_t *sensorInterface, TIDS_state_t mode);
+	int8_t TIDS_getSwReset(WE_sensorInterface_t *sensorInterface, TIDS_state_t *mode);
 
 	/* standard Data Out */
-	int8_t TIDS_getRAWTemperature(uint16_t *rawTemp);
-	int8_t TIDS_getTemperature(float *tempdegC);  // Temperature Value in °C
+	int8_t TIDS_getRAWTemperature(WE_sensorInterface_t *sensorInterface, uint16_t *rawTemp);
+	int8_t TIDS_getTemperature(WE_sensorInterface_t *sensorInterface, float *tempdegC);  // Temperature Value in °C
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,337 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+/**
+ * Per-call cost of the public read methods of the sensor classes.
+ *
+ * Every sensor runs on the simulated default bus through the regular Wire
+ * transport, so the numbers reflect what the drivers put on the wire:
+ *
+ *   wall ns  : host time per call (driver, platform layer and simulation)
+ *   transfers: I2C transfers (start ... stop) per call
+ *   bytes    : data bytes per call, without address bytes
+ *   bus us   : time on the wire per call at the bus clock
+ *   accesses : ReadReg()/WriteReg()/I2C_read() calls per call, only if the
+ *              platform layer is built with WE_BUS_STATISTICS
+ *
+ * Usage: wsen_bench [iterations] [filter]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include "Wire.h"
+#include "AsyncPlatform.h"
+#include "SimSensors.h"
+
+#include "WSEN_HIDS.h"
+#include "WSEN_ISDS.h"
+#include "WSEN_ISDS_Fusion.h"
+#include "WSEN_ITDS.h"
+#include "WSEN_PADS.h"
+#include "WSEN_PDUS.h"
+#include "WSEN_TIDS.h"
+
+#define BENCH_DEFAULT_ITERATIONS 10000
+
+struct BenchEntry
+{
+	const char *name;
+	std::function<int()> run;	/* returns WE_FAIL on error */
+};
+
+static void Run(const BenchEntry &entry, long iterations)
+{
+	SimBus &bus = SimBus::defaultBus();
+	long failures = 0;
+
+	/* warm up */
+	entry.run();
+
+	bus.resetStatistics();
+#if defined(WE_BUS_STATISTICS)
+	WE_resetBusStatistics();
+#endif
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	for (long i = 0; i < iterations; i++)
+	{
+		if (WE_FAIL == entry.run())
+		{
+			failures++;
+		}
+	}
+
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	const SimBus::Statistics &stats = bus.statistics();
+	double wallNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+	printf("%-40s %10.1f %10.2f %8.2f %9.1f",
+			entry.name,
+			wallNs / (double)iterations,
+			(double)stats.transfers / (double)iterations,
+			(double)stats.bytes / (double)iterations,
+			(double)stats.busyNs / 1000.0 / (double)iterations);
+
+#if defined(WE_BUS_STATISTICS)
+	WE_busStatistics_t devices[WE_BUS_STATISTICS_DEVICES];
+	int count = WE_getBusStatisticsSnapshot(devices, WE_BUS_STATISTICS_DEVICES);
+	uint32_t accesses = 0;
+	for (int i = 0; i < count; i++)
+	{
+		accesses += devices[i].transactions;
+	}
+	printf(" %9.2f", (double)accesses / (double)iterations);
+#endif
+
+	printf("%s\n", (0 != failures) ? "  FAILED" : "");
+}
+
+/* Queue the raw output reads of three sensors, then run the queue */
+static int AsyncReadAll(Sensor_ITDS &itds, Sensor_PADS &pads, Sensor_HIDS &hids)
+{
+	WE_asyncRequest_t requests[3];
+	uint8_t acceleration[6];
+	uint8_t pressure[3];
+	uint8_t humidity[2];
+
+	WE_asyncReadReg(&requests[0], itds.get_Interface(), ITDS_X_OUT_L_REG, sizeof(acceleration), acceleration, NULL, NULL);
+	WE_asyncReadReg(&requests[1], pads.get_Interface(), PADS_DATA_P_XL_REG, sizeof(pressure), pressure, NULL, NULL);
+	WE_asyncReadReg(&requests[2], hids.get_Interface(), (uint8_t)(HIDS_H_OUT_L_REG | 0x80), sizeof(humidity), humidity, NULL, NULL);
+
+	while (0 != WE_asyncPoll())
+	{
+	}
+
+	for (int n = 0; n < 3; n++)
+	{
+		if (WE_SUCCESS != requests[n].status)
+		{
+			return WE_FAIL;
+		}
+	}
+
+	return WE_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+	long iterations = (argc > 1) ? atol(argv[1]) : BENCH_DEFAULT_ITERATIONS;
+	const char *filter = (argc > 2) ? argv[2] : NULL;
+	SimBus &bus = SimBus::defaultBus();
+
+	if (iterations <= 0)
+	{
+		fprintf(stderr, "usage: %s [iterations] [filter]\n", argv[0]);
+		return 1;
+	}
+
+	/* Simulated sensors with some signal on every channel */
+	SimITDS itdsDevice(ITDS_ADDRESS_I2C_1);
+	SimISDS isdsDevice(ISDS_ADDRESS_I2C_1);
+	SimPADS padsDevice(PADS_ADDRESS_I2C_1);
+	SimHIDS hidsDevice(HIDS_ADDRESS_I2C_0);
+	SimTIDS tidsDevice(TIDS_ADDRESS_I2C_0);
+	SimPDUS pdusDevice(PDUS_ADDRESS_I2C, pdus1);
+
+	itdsDevice.setAcceleration(SimWaveform::sine(0, 500, 2), SimWaveform::sine(0, 500, 2, 90), SimWaveform::constant(1000));
+	isdsDevice.setAcceleration(SimWaveform::sine(0, 500, 2), SimWaveform::sine(0, 500, 2, 90), SimWaveform::constant(1000));
+	isdsDevice.setAngularRate(SimWaveform::sine(0, 30000, 1), SimWaveform::constant(0), SimWaveform::constant(-5000));
+	padsDevice.setPressure(SimWaveform::sine(101.3, 0.2, 0.1));
+	hidsDevice.setHumidity(SimWaveform::ramp(30, 0.1));
+	tidsDevice.setTemperature(SimWaveform::triangle(22, 3, 0.05));
+	pdusDevice.setPressure(SimWaveform::sine(0, 0.5, 5));
+
+	bus.attach(&itdsDevice);
+	bus.attach(&isdsDevice);
+	bus.attach(&padsDevice);
+	bus.attach(&hidsDevice);
+	bus.attach(&tidsDevice);
+	bus.attach(&pdusDevice);
+
+	/* Sensors in continuous mode on Wire, as in the examples */
+	Sensor_ITDS itds;
+	Sensor_ISDS isds;
+	Sensor_PADS pads;
+	Sensor_HIDS hids;
+	Sensor_TIDS tids;
+	Sensor_PDUS pdus;
+
+	Wire.begin();
+
+	itds.init(ITDS_ADDRESS_I2C_1);
+	itds.ODR = 6;
+	itds.set_High_Performance();
+
+	isds.init(ISDS_ADDRESS_I2C_1);
+	isds.set_Mode(2);
+
+	pads.init(PADS_ADDRESS_I2C_1);
+	pads.set_continuous_mode(50);
+
+	hids.init(HIDS_ADDRESS_I2C_0);
+	hids.set_continuous_mode(3);
+
+	tids.init(TIDS_ADDRESS_I2C_0);
+	tids.set_continuous_mode(200);
+
+	pdus.init(PDUS_ADDRESS_I2C);
+
+	delay(100);
+
+	float f;
+	int i;
+	int16_t s16[3];
+	int32_t s32[3];
+	uint8_t u8;
+	ISDS_status_t isdsStatus;
+	ISDS_sample_t isdsSample;
+	PADS_state_t padsState[2];
+	HIDS_state_t hidsState[2];
+	uint16_t u16[2];
+	int16_t fifoRaw[ITDS_FIFO_DEPTH][3] = {};
+	int32_t fifoInt[ITDS_FIFO_DEPTH][3];
+	float fifoFloat[ITDS_FIFO_DEPTH][3];
+	ISDS_fusion_t isdsFusion;
+	ISDS_fifoFrame_t isdsFrames[32] = {};
+	const int16_t isdsGyro[3] = { 300, -200, 100 };
+	const int16_t isdsAcc[3] = { 100, -50, 2048 };
+
+	/* set_Mode(2): 2000 dps, 16 g, 208 Hz */
+	ISDS_initFusion(&isdsFusion, ISDS_gyroFullScale2000dps, ISDS_accFullScaleSixteenG, ISDS_getGyroOutputDataRatePeriodUs(ISDS_gyroOdr208Hz));
+	for (int n = 0; n < 32; n++)
+	{
+		isdsFrames[n].sets = ISDS_FIFO_SET_GYRO | ISDS_FIFO_SET_ACC;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			isdsFrames[n].gyro[axis] = isdsGyro[axis];
+			isdsFrames[n].acc[axis] = isdsAcc[axis];
+		}
+	}
+
+	std::vector<BenchEntry> entries = {
+		{ "Sensor_ITDS::get_DeviceID", [&]() { return itds.get_DeviceID(); } },
+		{ "Sensor_ITDS::is_Ready_To_Read", [&]() { return itds.is_Ready_To_Read(); } },
+		{ "Sensor_ITDS::is_Temp_Ready", [&]() { return itds.is_Temp_Ready(); } },
+		{ "Sensor_ITDS::get_acceleration_X", [&]() { return itds.get_acceleration_X(&f); } },
+		{ "Sensor_ITDS::get_acceleration_Y", [&]() { return itds.get_acceleration_Y(&f); } },
+		{ "Sensor_ITDS::get_acceleration_Z", [&]() { return itds.get_acceleration_Z(&f); } },
+		{ "Sensor_ITDS::get_accelerations", [&]() { float y, z; return itds.get_accelerations(&f, &y, &z, s16); } },
+		{ "Sensor_ITDS::get_accelerations_if_ready", [&]() { float y, z; return itds.get_accelerations_if_ready(&f, &y, &z, s16); } },
+		{ "Sensor_ITDS::get_accelerations_int", [&]() { return itds.get_accelerations_int(&s32[0], &s32[1], &s32[2]); } },
+		{ "Sensor_ITDS::convert_samples (32, int)", [&]() { return itds.convert_samples(fifoRaw, fifoInt, ITDS_FIFO_DEPTH); } },
+		{ "Sensor_ITDS::convert_samples (32, float)", [&]() { return itds.convert_samples(fifoRaw, fifoFloat, ITDS_FIFO_DEPTH); } },
+		{ "Sensor_ITDS::get_temperature", [&]() { return itds.get_temperature(&i); } },
+		{ "Sensor_ITDS::get_temp_Fahrenheit", [&]() { return itds.get_temp_Fahrenheit(&i); } },
+		{ "Sensor_ITDS::get_temperature_centi", [&]() { return itds.get_temperature_centi(&i); } },
+		{ "Sensor_ITDS::get_Operating_Mode", [&]() { return itds.get_Operating_Mode(); } },
+		{ "Sensor_ITDS::get_Power_Mode", [&]() { return itds.get_Power_Mode(); } },
+		{ "Sensor_ITDS::get_FIFO_mode", [&]() { return itds.get_FIFO_mode(&i); } },
+		{ "Sensor_ITDS::get_FIFO_Fill_Level", [&]() { return itds.get_FIFO_Fill_Level(&i); } },
+		{ "Sensor_ITDS::set_High_Performance", [&]() { return itds.set_High_Performance(); } },
+
+		{ "Sensor_ISDS::get_DeviceID", [&]() { return isds.get_DeviceID(); } },
+		{ "Sensor_ISDS::is_ACC_Ready_To_Read", [&]() { return isds.is_ACC_Ready_To_Read(); } },
+		{ "Sensor_ISDS::is_Gyro_Ready_To_Read", [&]() { return isds.is_Gyro_Ready_To_Read(); } },
+		{ "Sensor_ISDS::is_Temp_Ready", [&]() { return isds.is_Temp_Ready(); } },
+		{ "Sensor_ISDS::get_StatusRegister", [&]() { return isds.get_StatusRegister(&isdsStatus); } },
+		{ "Sensor_ISDS::get_acceleration_X", [&]() { return isds.get_acceleration_X(&s16[0]); } },
+		{ "Sensor_ISDS::get_acceleration_Y", [&]() { return isds.get_acceleration_Y(&s16[1]); } },
+		{ "Sensor_ISDS::get_acceleration_Z", [&]() { return isds.get_acceleration_Z(&s16[2]); } },
+		{ "Sensor_ISDS::get_accelerations", [&]() { return isds.get_accelerations(&s16[0], &s16[1], &s16[2]); } },
+		{ "Sensor_ISDS::get_angular_rate_X", [&]() { return isds.get_angular_rate_X(&s32[0]); } },
+		{ "Sensor_ISDS::get_angular_rate_Y", [&]() { return isds.get_angular_rate_Y(&s32[1]); } },
+		{ "Sensor_ISDS::get_angular_rate_Z", [&]() { return isds.get_angular_rate_Z(&s32[2]); } },
+		{ "Sensor_ISDS::get_angular_rates", [&]() { return isds.get_angular_rates(&s32[0], &s32[1], &s32[2]); } },
+		{ "Sensor_ISDS::get_temperature", [&]() { return isds.get_temperature(&f); } },
+		{ "Sensor_ISDS::get_Sample", [&]() { return isds.get_Sample(&isdsSample); } },
+		{ "Sensor_ISDS::sync_Timestamps", [&]() { return isds.sync_Timestamps(); } },
+		{ "ISDS_updateFusion", [&]() { ISDS_updateFusion(&isdsFusion, isdsGyro, isdsAcc); return WE_SUCCESS; } },
+		{ "ISDS_updateFusionFrames (32)", [&]() { ISDS_updateFusionFrames(&isdsFusion, isdsFrames, 32); return WE_SUCCESS; } },
+		{ "Sensor_ISDS::set_Mode", [&]() { return isds.set_Mode(2); } },
+
+		{ "Sensor_PADS::get_DeviceID", [&]() { return pads.get_DeviceID(); } },
+		{ "Sensor_PADS::ready_to_read", [&]() { return pads.ready_to_read(&padsState[0], &padsState[1]); } },
+		{ "Sensor_PADS::temp_ready_to_read", [&]() { return pads.temp_ready_to_read(); } },
+		{ "Sensor_PADS::pressure_ready_to_read", [&]() { return pads.pressure_ready_to_read(); } },
+		{ "Sensor_PADS::read_temperature", [&]() { return pads.read_temperature(&f); } },
+		{ "Sensor_PADS::read_pressure", [&]() { return pads.read_pressure(&f); } },
+		{ "Sensor_PADS::get_FIFO_mode", [&]() { return pads.get_FIFO_mode(&i); } },
+		{ "Sensor_PADS::get_FIFO_fill_level", [&]() { return pads.get_FIFO_fill_level(&i); } },
+		{ "Sensor_PADS::read_FIFO_temperature", [&]() { return pads.read_FIFO_temperature(&f); } },
+		{ "Sensor_PADS::read_FIFO_pressure", [&]() { return pads.read_FIFO_pressure(&f); } },
+
+		{ "Sensor_HIDS::get_DeviceID", [&]() { return hids.get_DeviceID(); } },
+		{ "Sensor_HIDS::get_StatusDrdy", [&]() { return hids.get_StatusDrdy(&hidsState[0], &hidsState[1]); } },
+		{ "Sensor_HIDS::get_TempStatus", [&]() { return hids.get_TempStatus(); } },
+		{ "Sensor_HIDS::get_HumStatus", [&]() { return hids.get_HumStatus(); } },
+		{ "Sensor_HIDS::get_H_T_out", [&]() { u16[0] = hids.get_H_T_out(); return WE_SUCCESS; } },
+		{ "Sensor_HIDS::get_T_OUT", [&]() { u16[0] = hids.get_T_OUT(); return WE_SUCCESS; } },
+		{ "Sensor_HIDS::get_H0_T0_out", [&]() { u16[0] = hids.get_H0_T0_out(); return WE_SUCCESS; } },
+		{ "Sensor_HIDS::get_H1_T0_out", [&]() { u16[0] = hids.get_H1_T0_out(); return WE_SUCCESS; } },
+		{ "Sensor_HIDS::get_H0_rh", [&]() { u16[0] = hids.get_H0_rh(); return WE_SUCCESS; } },
+		{ "Sensor_HIDS::get_H1_rh", [&]() { u16[0] = hids.get_H1_rh(); return WE_SUCCESS; } },
+		{ "Sensor_HIDS::get_T0_OUT", [&]() { u16[0] = hids.get_T0_OUT(); return WE_SUCCESS; } },
+		{ "Sensor_HIDS::get_T1_OUT", [&]() { u16[0] = hids.get_T1_OUT(); return WE_SUCCESS; } },
+		{ "Sensor_HIDS::get_Humidity", [&]() { return hids.get_Humidity(&f); } },
+		{ "Sensor_HIDS::get_Temperature", [&]() { return hids.get_Temperature(&f); } },
+
+		{ "Sensor_TIDS::get_DeviceID", [&]() { return tids.get_DeviceID(); } },
+		{ "Sensor_TIDS::get_SW_RESET", [&]() { return tids.get_SW_RESET(&i); } },
+		{ "Sensor_TIDS::is_ready_to_read", [&]() { return tids.is_ready_to_read(); } },
+		{ "Sensor_TIDS::read_temperature", [&]() { return tids.read_temperature(&f); } },
+		{ "Sensor_TIDS::read_temp_fahrenheit", [&]() { return tids.read_temp_fahrenheit(&f); } },
+		{ "Sensor_TIDS::get_Temp_High_Limit", [&]() { return tids.get_Temp_High_Limit(&u8); } },
+		{ "Sensor_TIDS::get_Temp_Low_Limit", [&]() { return tids.get_Temp_Low_Limit(&u8); } },
+		{ "Sensor_TIDS::get_Threshold_High_Limit", [&]() { return tids.get_Threshold_High_Limit(&f); } },
+		{ "Sensor_TIDS::get_Threshold_Low_Limit", [&]() { return tids.get_Threshold_Low_Limit(&f); } },
+
+		{ "Sensor_PDUS::get_RawPresAndTemp", [&]() { return pdus.get_RawPresAndTemp(&u16[0], &u16[1]); } },
+		{ "Sensor_PDUS::getPresAndTemp", [&]() { float t; return pdus.getPresAndTemp(pdus1, &f, &t); } },
+
+		{ "WE_asyncPoll (ITDS, PADS, HIDS)", [&]() { return AsyncReadAll(itds, pads, hids); } },
+	};
+
+	printf("%d Hz bus, %ld iterations\n\n", (int)bus.clock(), iterations);
+	printf("%-40s %10s %10s %8s %9s", "method", "wall ns", "transfers", "bytes", "bus us");
+#if defined(WE_BUS_STATISTICS)
+	printf(" %9s", "accesses");
+#endif
+	printf("\n");
+
+	for (size_t n = 0; n < entries.size(); n++)
+	{
+		if ((NULL == filter) || (NULL != strstr(entries[n].name, filter)))
+		{
+			Run(entries[n], iterations);
+		}
+	}
+
+	return 0;
+}
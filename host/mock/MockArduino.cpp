@@ -0,0 +1,197 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "Arduino.h"
+#include "Wire.h"
+
+/**         Arduino core         **/
+
+extern "C" void delay(unsigned long ms)
+{
+	SimClock::advanceMs(ms);
+}
+
+extern "C" void delayMicroseconds(unsigned int us)
+{
+	SimClock::advanceUs(us);
+}
+
+extern "C" unsigned long millis(void)
+{
+	return (unsigned long)(SimClock::nowNs() / 1000000ULL);
+}
+
+extern "C" unsigned long micros(void)
+{
+	return (unsigned long)(SimClock::nowNs() / 1000ULL);
+}
+
+/**         Wire         **/
+
+TwoWire Wire;
+
+TwoWire::TwoWire(SimBus *bus)
+	: wireBus(bus), txAddress(0), txLength(0), transmitting(false), pendingWrite(false), rxLength(0), rxIndex(0)
+{
+}
+
+SimBus *TwoWire::simBus()
+{
+	return (NULL != wireBus) ? wireBus : &SimBus::defaultBus();
+}
+
+void TwoWire::begin()
+{
+	txLength = 0;
+	transmitting = false;
+	pendingWrite = false;
+	rxLength = 0;
+	rxIndex = 0;
+}
+
+void TwoWire::end()
+{
+}
+
+void TwoWire::setClock(uint32_t clockHz)
+{
+	simBus()->setClock(clockHz);
+}
+
+void TwoWire::setWireTimeout(uint32_t timeout, bool resetWithTimeout)
+{
+	/* the simulated bus never hangs */
+	(void)timeout;
+	(void)resetWithTimeout;
+}
+
+void TwoWire::beginTransmission(uint8_t address)
+{
+	txAddress = address;
+	txLength = 0;
+	transmitting = true;
+	pendingWrite = false;
+}
+
+/**
+ * @brief  Send the buffered bytes
+ * @param  sendStop : false keeps the bus for a repeated start by requestFrom()
+ * @retval 0: success, 2: address NACK, 3: data NACK
+ */
+
+uint8_t TwoWire::endTransmission(bool sendStop)
+{
+	SimBus *bus = simBus();
+
+	transmitting = false;
+
+	if (NULL == bus->device(txAddress))
+	{
+		/* only the address phase goes out on the wire */
+		bus->write(txAddress, txBuffer, 0);
+		return 2;
+	}
+
+	if (!sendStop)
+	{
+		pendingWrite = true;
+		return 0;
+	}
+
+	return bus->write(txAddress, txBuffer, txLength) ? 0 : 3;
+}
+
+size_t TwoWire::write(uint8_t data)
+{
+	if (!transmitting || (txLength >= WIRE_BUFFER_LENGTH))
+	{
+		return 0;
+	}
+	txBuffer[txLength++] = data;
+	return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t quantity)
+{
+	size_t written = 0;
+
+	while ((written < quantity) && (1 == write(data[written])))
+	{
+		written++;
+	}
+	return written;
+}
+
+/**
+ * @brief  Read bytes from a device, after a held write with a repeated start
+ * @param  -address : I2C address
+ *         -quantity : number of bytes, limited to the buffer size
+ *         -sendStop : ignored, the simulated bus is released after every read
+ * @retval Number of bytes received, 0 on NACK
+ */
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity, bool sendStop)
+{
+	SimBus *bus = simBus();
+	bool ack;
+
+	(void)sendStop;
+
+	if (quantity > WIRE_BUFFER_LENGTH)
+	{
+		quantity = WIRE_BUFFER_LENGTH;
+	}
+
+	if (pendingWrite && (address == txAddress))
+	{
+		ack = bus->writeRead(address, txBuffer, txLength, rxBuffer, quantity);
+	}
+	else
+	{
+		ack = bus->read(address, rxBuffer, quantity);
+	}
+
+	pendingWrite = false;
+	transmitting = false;
+	rxIndex = 0;
+	rxLength = ack ? quantity : 0;
+
+	return rxLength;
+}
+
+int TwoWire::available()
+{
+	return rxLength - rxIndex;
+}
+
+int TwoWire::read()
+{
+	return (rxIndex < rxLength) ? rxBuffer[rxIndex++] : -1;
+}
+
+int TwoWire::peek()
+{
+	return (rxIndex < rxLength) ? rxBuffer[rxIndex] : -1;
+}
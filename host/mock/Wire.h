@@ -1,64 +1,84 @@
-/**
- ***************************************************************************************************
- * This file is part of WE Sensors SDK:
- * https://www.we-online.com/sensors
- *
- * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
- * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
- * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
- * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
- * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
- * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
- * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
- * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
- * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
- * THEREOF
- *
- * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
- * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
- * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
- *
- * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
- *
- ***************************************************************************************************
- **/
-
-#ifndef ARDUINOPLATFORM_H
-#define ARDUINOPLATFORM_H
-
-#define TIMEOUT_MS (uint16_t)100		/* 100ms */
-
-/**         Includes         **/
-
-#include <stdint.h>
-#include <stdlib.h>
-
-#include <Arduino.h>
-#include <stdbool.h>
-
-#define WE_SUCCESS 0
-#define WE_FAIL -1
-
-//Use SDA1 and SCL1 on Arduino Due
-#if defined(__SAM3X8E__)
-#define Wire Wire1
-#endif
-
-/**         Functions definition         **/
-
-#ifdef __cplusplus
-extern "C"
-{
-#endif
-
-void I2CSetAddress(int address);
-int I2CInit(int address);
-int ReadReg(uint8_t RegAdr, int NumByteToRead, uint8_t *Data);
-int WriteReg(uint8_t RegAdr, int NumByteToWrite, uint8_t *Data);
-int I2C_read(uint8_t *data, int bytesToRead);
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* ARDUINOPLATFORM_H */
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#ifndef WIRE_H
+#define WIRE_H
+
+/**         Includes         **/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "SimBus.h"
+
+#define WIRE_BUFFER_LENGTH 32	/* same as the AVR Wire library */
+
+/**
+ * @brief Wire library of the host build.
+ *
+ * Transfers go to a simulated I2C bus (SimBus::defaultBus() for the global
+ * Wire instance). Buffer sizes and return codes follow the AVR Wire
+ * library, so drivers see the same limits as on a board.
+ */
+class TwoWire
+{
+public:
+	explicit TwoWire(SimBus *bus = NULL);
+
+	void begin();
+	void end();
+	void setClock(uint32_t clockHz);
+	void setWireTimeout(uint32_t timeout = 25000, bool resetWithTimeout = false);
+
+	void beginTransmission(uint8_t address);
+	void beginTransmission(int address) { beginTransmission((uint8_t)address); }
+	uint8_t endTransmission(bool sendStop = true);
+
+	size_t write(uint8_t data);
+	size_t write(const uint8_t *data, size_t quantity);
+
+	uint8_t requestFrom(uint8_t address, uint8_t quantity, bool sendStop = true);
+	uint8_t requestFrom(int address, int quantity) { return requestFrom((uint8_t)address, (uint8_t)quantity, true); }
+	int available();
+	int read();
+	int peek();
+
+private:
+	SimBus *simBus();
+
+	SimBus *wireBus;
+	uint8_t txAddress;
+	uint8_t txBuffer[WIRE_BUFFER_LENGTH];
+	uint8_t txLength;
+	bool transmitting;
+	bool pendingWrite;		/* write held back for a repeated start */
+	uint8_t rxBuffer[WIRE_BUFFER_LENGTH];
+	uint8_t rxLength;
+	uint8_t rxIndex;
+};
+
+extern TwoWire Wire;
+
+#endif /* WIRE_H */
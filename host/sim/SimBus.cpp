@@ -0,0 +1,655 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "SimBus.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_PI 3.14159265358979323846
+
+static uint64_t simTimeNs = 0;
+
+/**         SimClock         **/
+
+uint64_t SimClock::nowNs()
+{
+	return simTimeNs;
+}
+
+void SimClock::advanceNs(uint64_t ns)
+{
+	simTimeNs += ns;
+}
+
+void SimClock::reset()
+{
+	simTimeNs = 0;
+}
+
+/**         SimWaveform         **/
+
+SimWaveform::SimWaveform()
+	: shape(shapeConstant), offset(0.0), amplitude(0.0), param1(0.0), param2(0.0), noise(0.0), seed(1)
+{
+}
+
+SimWaveform SimWaveform::constant(double value)
+{
+	SimWaveform w;
+	w.offset = value;
+	return w;
+}
+
+SimWaveform SimWaveform::sine(double offset, double amplitude, double frequencyHz, double phaseDeg)
+{
+	SimWaveform w;
+	w.shape = shapeSine;
+	w.offset = offset;
+	w.amplitude = amplitude;
+	w.param1 = frequencyHz;
+	w.param2 = phaseDeg * SIM_PI / 180.0;
+	return w;
+}
+
+SimWaveform SimWaveform::square(double offset, double amplitude, double frequencyHz)
+{
+	SimWaveform w;
+	w.shape = shapeSquare;
+	w.offset = offset;
+	w.amplitude = amplitude;
+	w.param1 = frequencyHz;
+	return w;
+}
+
+SimWaveform SimWaveform::triangle(double offset, double amplitude, double frequencyHz)
+{
+	SimWaveform w;
+	w.shape = shapeTriangle;
+	w.offset = offset;
+	w.amplitude = amplitude;
+	w.param1 = frequencyHz;
+	return w;
+}
+
+SimWaveform SimWaveform::ramp(double start, double slopePerSecond)
+{
+	SimWaveform w;
+	w.shape = shapeRamp;
+	w.offset = start;
+	w.param1 = slopePerSecond;
+	return w;
+}
+
+SimWaveform SimWaveform::pulse(double offset, double amplitude, double startS, double widthS)
+{
+	SimWaveform w;
+	w.shape = shapePulse;
+	w.offset = offset;
+	w.amplitude = amplitude;
+	w.param1 = startS;
+	w.param2 = widthS;
+	return w;
+}
+
+SimWaveform SimWaveform::custom(const std::function<double(double)> &function)
+{
+	SimWaveform w;
+	w.shape = shapeCustom;
+	w.function = function;
+	return w;
+}
+
+/**
+ * @brief  Add uniform noise to the waveform
+ * @param  -noiseAmplitude : peak noise amplitude
+ *         -noiseSeed : noise sequence
+ * @retval The waveform
+ */
+
+SimWaveform &SimWaveform::withNoise(double noiseAmplitude, uint32_t noiseSeed)
+{
+	noise = noiseAmplitude;
+	seed = noiseSeed;
+	return *this;
+}
+
+/**
+ * @brief  Evaluate the waveform
+ * @param  Time in s
+ * @retval Value in the unit of the channel
+ */
+
+double SimWaveform::at(double seconds) const
+{
+	double value = offset;
+	double phase;
+
+	switch (shape)
+	{
+	case shapeSine:
+		value += amplitude * sin(2.0 * SIM_PI * param1 * seconds + param2);
+		break;
+
+	case shapeSquare:
+		phase = param1 * seconds - floor(param1 * seconds);
+		value += (phase < 0.5) ? amplitude : -amplitude;
+		break;
+
+	case shapeTriangle:
+		phase = param1 * seconds - floor(param1 * seconds);
+		value += amplitude * ((phase < 0.5) ? (4.0 * phase - 1.0) : (3.0 - 4.0 * phase));
+		break;
+
+	case shapeRamp:
+		value += param1 * seconds;
+		break;
+
+	case shapePulse:
+		if ((seconds >= param1) && (seconds < param1 + param2))
+		{
+			value += amplitude;
+		}
+		break;
+
+	case shapeCustom:
+		value = function ? function(seconds) : 0.0;
+		break;
+
+	default:
+		break;
+	}
+
+	if (0.0 != noise)
+	{
+		/* integer hash of seed and sample time, mapped to [-1, 1) */
+		uint64_t x = (uint64_t)(seconds * 1e9) ^ ((uint64_t)seed * 0x9E3779B97F4A7C15ULL);
+		x ^= x >> 33;
+		x *= 0xFF51AFD7ED558CCDULL;
+		x ^= x >> 33;
+		x *= 0xC4CEB9FE1A85EC53ULL;
+		x ^= x >> 33;
+		value += noise * (((double)(x >> 11) / (double)(1ULL << 52)) - 1.0);
+	}
+
+	return value;
+}
+
+int32_t SimSaturate(double value, int32_t min, int32_t max)
+{
+	double rounded = floor(value + 0.5);
+
+	if (rounded < (double)min)
+	{
+		return min;
+	}
+	if (rounded > (double)max)
+	{
+		return max;
+	}
+	return (int32_t)rounded;
+}
+
+/**         SimTimer         **/
+
+SimTimer::SimTimer()
+	: periodNs(0), nextNs(0)
+{
+}
+
+/**
+ * @brief  Start the timer, the first tick is one period after nowNs
+ * @param  -nowNs : current time
+ *         -frequencyHz : tick rate, 0 stops the timer
+ */
+
+void SimTimer::start(uint64_t nowNs, double frequencyHz)
+{
+	if (frequencyHz <= 0.0)
+	{
+		stop();
+		return;
+	}
+
+	periodNs = (uint64_t)llround(1e9 / frequencyHz);
+	nextNs = nowNs + periodNs;
+}
+
+void SimTimer::stop()
+{
+	periodNs = 0;
+}
+
+uint32_t SimTimer::catchUp(uint64_t nowNs, uint32_t keep)
+{
+	if (!running() || (nowNs < nextNs))
+	{
+		return 0;
+	}
+
+	uint64_t pending = (nowNs - nextNs) / periodNs + 1;
+	if (pending <= keep)
+	{
+		return 0;
+	}
+
+	nextNs += (pending - keep) * periodNs;
+	return (uint32_t)(pending - keep);
+}
+
+bool SimTimer::tick(uint64_t nowNs, uint64_t *tickNs)
+{
+	if (!running() || (nextNs > nowNs))
+	{
+		return false;
+	}
+
+	*tickNs = nextNs;
+	nextNs += periodNs;
+	return true;
+}
+
+/**         SimDevice         **/
+
+SimDevice::SimDevice(uint8_t address)
+	: pointer(0), increment(true), devAddress(address), devPresent(true), outputCount(0)
+{
+	memset(regs, 0, sizeof(regs));
+	memset(readOnly, 0, sizeof(readOnly));
+	memset(outputs, 0, sizeof(outputs));
+}
+
+SimDevice::~SimDevice()
+{
+}
+
+void SimDevice::reset()
+{
+	memset(regs, 0, sizeof(regs));
+	clearOutputLocks();
+	pointer = 0;
+	defaults();
+}
+
+/**
+ * @brief  I2C write: sub-address followed by the data
+ * @param  -data : bytes on the bus after the address byte
+ *         -count : number of bytes
+ * @retval true if acknowledged
+ */
+
+bool SimDevice::i2cWrite(const uint8_t *data, int count)
+{
+	update(SimClock::nowNs());
+
+	if (count <= 0)
+	{
+		return true;
+	}
+
+	pointer = selectRegister(data[0]);
+	for (int i = 1; i < count; i++)
+	{
+		writeRegister(pointer, data[i]);
+		if (increment)
+		{
+			pointer = nextRegister(pointer);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief  I2C read from the current register pointer
+ * @param  -data : read bytes
+ *         -count : number of bytes
+ * @retval true if acknowledged
+ */
+
+bool SimDevice::i2cRead(uint8_t *data, int count)
+{
+	update(SimClock::nowNs());
+
+	for (int i = 0; i < count; i++)
+	{
+		data[i] = readRegister(pointer);
+		if (increment)
+		{
+			pointer = nextRegister(pointer);
+		}
+	}
+
+	return true;
+}
+
+uint8_t SimDevice::selectRegister(uint8_t subAddress)
+{
+	increment = autoIncrement();
+	return subAddress;
+}
+
+/**
+ * @brief  Read a register as seen from the bus
+ * @param  Register address
+ * @retval Register value
+ */
+
+uint8_t SimDevice::readRegister(uint8_t reg)
+{
+	Output *output = findOutput(reg);
+	uint8_t value = regs[reg];
+
+	if ((NULL != output) && blockDataUpdate())
+	{
+		uint8_t all = (uint8_t)((1 << (output->last - output->first + 1)) - 1);
+
+		output->locked = true;
+		output->readMask |= (uint8_t)(1 << (reg - output->first));
+		if (output->readMask == all)
+		{
+			output->locked = false;
+			output->readMask = 0;
+			if (output->pending)
+			{
+				output->pending = false;
+				memcpy(&regs[output->first], output->data, output->last - output->first + 1);
+			}
+		}
+	}
+
+	return value;
+}
+
+/**
+ * @brief  Write a register from the bus, read-only registers are not changed
+ * @param  -reg : register address
+ *         -value : new value
+ */
+
+void SimDevice::writeRegister(uint8_t reg, uint8_t value)
+{
+	if (!isReadOnly(reg))
+	{
+		regs[reg] = value;
+	}
+}
+
+void SimDevice::setReadOnly(uint8_t first, uint8_t last)
+{
+	for (int reg = first; reg <= last; reg++)
+	{
+		readOnly[reg >> 3] |= (uint8_t)(1 << (reg & 7));
+	}
+}
+
+bool SimDevice::isReadOnly(uint8_t reg) const
+{
+	return 0 != (readOnly[reg >> 3] & (1 << (reg & 7)));
+}
+
+void SimDevice::addOutput(uint8_t first, uint8_t last)
+{
+	/* a model error, not a bus condition, also stops release builds */
+	if ((outputCount >= SIM_MAX_OUTPUTS) || (last < first) || (last - first >= (int)sizeof(outputs[0].data)))
+	{
+		fprintf(stderr, "SimDevice 0x%02X: invalid output 0x%02X ... 0x%02X\n", devAddress, first, last);
+		abort();
+	}
+
+	Output *output = &outputs[outputCount++];
+
+	output->first = first;
+	output->last = last;
+	output->locked = false;
+	output->pending = false;
+	output->readMask = 0;
+}
+
+/**
+ * @brief  Publish a new value in output registers
+ *
+ * While block data update is enabled and only part of the output has been
+ * read, the new value is held back until the remaining bytes have been read.
+ *
+ * @param  -first : LSB register of the output
+ *         -data : new register contents
+ */
+
+void SimDevice::setOutput(uint8_t first, const uint8_t *data)
+{
+	Output *output = findOutput(first);
+	int length = output->last - output->first + 1;
+
+	if (output->locked && blockDataUpdate())
+	{
+		memcpy(output->data, data, length);
+		output->pending = true;
+		return;
+	}
+
+	memcpy(&regs[first], data, length);
+}
+
+void SimDevice::setOutput16(uint8_t first, int16_t value)
+{
+	uint8_t data[2];
+
+	data[0] = (uint8_t)((uint16_t)value & 0xFF);
+	data[1] = (uint8_t)((uint16_t)value >> 8);
+	setOutput(first, data);
+}
+
+void SimDevice::clearOutputLocks()
+{
+	for (int i = 0; i < outputCount; i++)
+	{
+		outputs[i].locked = false;
+		outputs[i].pending = false;
+		outputs[i].readMask = 0;
+	}
+}
+
+SimDevice::Output *SimDevice::findOutput(uint8_t reg)
+{
+	for (int i = 0; i < outputCount; i++)
+	{
+		if ((reg >= outputs[i].first) && (reg <= outputs[i].last))
+		{
+			return &outputs[i];
+		}
+	}
+	return NULL;
+}
+
+/**         SimBus         **/
+
+SimBus::SimBus(uint32_t clockHz)
+	: busClockHz(clockHz)
+{
+	memset(devices, 0, sizeof(devices));
+	resetStatistics();
+}
+
+void SimBus::attach(SimDevice *device)
+{
+	devices[device->address() & 0x7F] = device;
+}
+
+void SimBus::detach(SimDevice *device)
+{
+	if (devices[device->address() & 0x7F] == device)
+	{
+		devices[device->address() & 0x7F] = NULL;
+	}
+}
+
+SimDevice *SimBus::device(uint8_t address) const
+{
+	SimDevice *device = devices[address & 0x7F];
+	return ((NULL != device) && device->isPresent()) ? device : NULL;
+}
+
+void SimBus::resetStatistics()
+{
+	memset(&stats, 0, sizeof(stats));
+}
+
+/**
+ * @brief  Account a transfer and advance the clock by its duration
+ * @param  -conditions : number of start, repeated start and stop conditions
+ *         -addressBytes : number of address bytes
+ *         -dataBytes : number of data bytes
+ *         -ack : false if the address was not acknowledged
+ */
+
+void SimBus::transfer(int conditions, int addressBytes, int dataBytes, bool ack)
+{
+	uint64_t bits = (uint64_t)conditions + 9ULL * (uint64_t)(addressBytes + dataBytes);
+	uint64_t ns = bits * 1000000000ULL / busClockHz;
+
+	stats.transfers++;
+	stats.bytes += (uint32_t)dataBytes;
+	stats.busyNs += ns;
+	if (!ack)
+	{
+		stats.nacks++;
+	}
+
+	SimClock::advanceNs(ns);
+}
+
+bool SimBus::write(uint8_t address, const uint8_t *data, int count)
+{
+	SimDevice *target = device(address);
+
+	if (NULL == target)
+	{
+		transfer(2, 1, 0, false);
+		return false;
+	}
+
+	transfer(2, 1, count, true);
+	return target->i2cWrite(data, count);
+}
+
+bool SimBus::read(uint8_t address, uint8_t *data, int count)
+{
+	SimDevice *target = device(address);
+
+	if (NULL == target)
+	{
+		transfer(2, 1, 0, false);
+		return false;
+	}
+
+	transfer(2, 1, count, true);
+	return target->i2cRead(data, count);
+}
+
+bool SimBus::writeRead(uint8_t address, const uint8_t *wData, int wCount, uint8_t *rData, int rCount)
+{
+	SimDevice *target = device(address);
+
+	if (NULL == target)
+	{
+		transfer(2, 1, 0, false);
+		return false;
+	}
+
+	transfer(3, 2, wCount + rCount, true);
+	return target->i2cWrite(wData, wCount) && target->i2cRead(rData, rCount);
+}
+
+SimBus &SimBus::defaultBus()
+{
+	static SimBus bus;
+	return bus;
+}
+
+/**         Transport         **/
+
+/**
+ * @brief  Get the simulated bus a sensor is attached to
+ * @param  Pointer to sensor interface
+ * @retval Bus, the default bus if no handle is set
+ */
+
+static SimBus *Bus(WE_sensorInterface_t *sensorInterface)
+{
+	return (NULL != sensorInterface->handle) ? (SimBus *)sensorInterface->handle : &SimBus::defaultBus();
+}
+
+static int SimInit(WE_sensorInterface_t *sensorInterface)
+{
+	(void)sensorInterface;
+	return WE_SUCCESS;
+}
+
+static int SimReadReg(WE_sensorInterface_t *sensorInterface, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+{
+	if (!Bus(sensorInterface)->writeRead(sensorInterface->address, &RegAdr, 1, Data, NumByteToRead))
+	{
+		return WE_FAIL;
+	}
+	return WE_SUCCESS;
+}
+
+static int SimWriteReg(WE_sensorInterface_t *sensorInterface, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data)
+{
+	uint8_t buffer[257];
+
+	if (NumByteToWrite > 256)
+	{
+		return WE_FAIL;
+	}
+
+	buffer[0] = RegAdr;
+	memcpy(&buffer[1], Data, NumByteToWrite);
+
+	if (!Bus(sensorInterface)->write(sensorInterface->address, buffer, NumByteToWrite + 1))
+	{
+		return WE_FAIL;
+	}
+	return WE_SUCCESS;
+}
+
+static int SimRead(WE_sensorInterface_t *sensorInterface, uint8_t *data, int bytesToRead)
+{
+	if (!Bus(sensorInterface)->read(sensorInterface->address, data, bytesToRead))
+	{
+		return WE_FAIL;
+	}
+	return WE_SUCCESS;
+}
+
+const WE_transport_t WE_simTransport = {
+	SimInit,
+	SimReadReg,
+	SimWriteReg,
+	SimRead
+};
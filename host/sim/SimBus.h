@@ -0,0 +1,271 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#ifndef SIMBUS_H
+#define SIMBUS_H
+
+/**         Includes         **/
+
+#include <stdint.h>
+#include <functional>
+
+#include "ArduinoPlatform.h"
+
+#define SIM_BUS_DEFAULT_CLOCK (uint32_t)100000	/* 100kHz, same as the Wire default */
+#define SIM_MAX_OUTPUTS 8						/* output registers with block data update per device */
+
+/**
+ * @brief Virtual time of the simulation.
+ *
+ * All simulated buses and devices share one clock. It only moves when a bus
+ * transfer is made or when it is advanced explicitly (e.g. by delay() of the
+ * host layer), so drivers run at full host speed while the devices still see
+ * realistic ODR and conversion timing.
+ */
+class SimClock
+{
+public:
+	static uint64_t nowNs();
+	static void advanceNs(uint64_t ns);
+	static void advanceUs(uint64_t us) { advanceNs(us * 1000); }
+	static void advanceMs(uint64_t ms) { advanceNs(ms * 1000000); }
+	static void reset();
+};
+
+/**
+ * @brief Synthetic signal of a simulated sensor channel.
+ *
+ * Evaluated at the sample time of the device, in the physical unit of the
+ * channel (e.g. mg, mdps, °C, kPa, %RH). Noise is a deterministic function of
+ * the sample time, so runs are reproducible.
+ */
+class SimWaveform
+{
+public:
+	SimWaveform();
+
+	static SimWaveform constant(double value);
+	static SimWaveform sine(double offset, double amplitude, double frequencyHz, double phaseDeg = 0.0);
+	static SimWaveform square(double offset, double amplitude, double frequencyHz);
+	static SimWaveform triangle(double offset, double amplitude, double frequencyHz);
+	static SimWaveform ramp(double start, double slopePerSecond);
+	static SimWaveform pulse(double offset, double amplitude, double startS, double widthS);
+	static SimWaveform custom(const std::function<double(double)> &function);
+
+	SimWaveform &withNoise(double noiseAmplitude, uint32_t noiseSeed = 1);
+
+	double at(double seconds) const;
+
+private:
+	enum Shape
+	{
+		shapeConstant,
+		shapeSine,
+		shapeSquare,
+		shapeTriangle,
+		shapeRamp,
+		shapePulse,
+		shapeCustom
+	};
+
+	Shape shape;
+	double offset;
+	double amplitude;
+	double param1;		/* frequency [Hz], slope [1/s] or pulse start [s] */
+	double param2;		/* phase [rad] or pulse width [s] */
+	double noise;
+	uint32_t seed;
+	std::function<double(double)> function;
+};
+
+/* Round a value to the nearest integer within [min, max] */
+int32_t SimSaturate(double value, int32_t min, int32_t max);
+
+/**
+ * @brief Periodic sample clock of a simulated device (e.g. ODR).
+ */
+class SimTimer
+{
+public:
+	SimTimer();
+
+	void start(uint64_t nowNs, double frequencyHz);
+	void stop();
+	bool running() const { return (0 != periodNs); }
+	uint64_t period() const { return periodNs; }
+
+	/* Drop all but the last "keep" pending ticks, returns the number dropped */
+	uint32_t catchUp(uint64_t nowNs, uint32_t keep);
+	/* Get the next pending tick up to nowNs */
+	bool tick(uint64_t nowNs, uint64_t *tickNs);
+
+private:
+	uint64_t periodNs;
+	uint64_t nextNs;
+};
+
+/**
+ * @brief Register-file model of an I2C device on a simulated bus.
+ *
+ * The first byte of an I2C write selects the register (sub-address), the
+ * following bytes are written from there; reads continue at the current
+ * register pointer. After every byte the pointer moves on according to the
+ * auto-increment rules of the device. Devices generate their samples lazily:
+ * update() is called with the current time before every access.
+ */
+class SimDevice
+{
+public:
+	explicit SimDevice(uint8_t address);
+	virtual ~SimDevice();
+
+	uint8_t address() const { return devAddress; }
+
+	/* An absent device does not acknowledge its address */
+	void setPresent(bool present) { devPresent = present; }
+	bool isPresent() const { return devPresent; }
+
+	/* Power-on reset */
+	virtual void reset();
+
+	/* Bus side, return false on NACK */
+	virtual bool i2cWrite(const uint8_t *data, int count);
+	virtual bool i2cRead(uint8_t *data, int count);
+
+	/* Backdoor register access without side effects */
+	uint8_t peek(uint8_t reg) const { return regs[reg]; }
+	void poke(uint8_t reg, uint8_t value) { regs[reg] = value; }
+
+protected:
+	/* Load the register reset values */
+	virtual void defaults() = 0;
+	/* Generate everything due up to nowNs */
+	virtual void update(uint64_t nowNs) = 0;
+
+	virtual uint8_t readRegister(uint8_t reg);
+	virtual void writeRegister(uint8_t reg, uint8_t value);
+
+	virtual bool autoIncrement() const { return true; }
+	virtual bool blockDataUpdate() const { return false; }
+	/* Register addressed by a sub-address byte, also decides on auto-increment */
+	virtual uint8_t selectRegister(uint8_t subAddress);
+	/* Register following reg in a multi-byte access */
+	virtual uint8_t nextRegister(uint8_t reg) const { return (uint8_t)(reg + 1); }
+
+	void setReadOnly(uint8_t first, uint8_t last);
+	bool isReadOnly(uint8_t reg) const;
+
+	/* Output registers with block data update, first is the LSB, last the MSB.
+	 * Reading any byte locks the output until all of its bytes have been read.
+	 * At most SIM_MAX_OUTPUTS outputs of up to 4 bytes each, anything else aborts. */
+	void addOutput(uint8_t first, uint8_t last);
+	void setOutput(uint8_t first, const uint8_t *data);
+	void setOutput16(uint8_t first, int16_t value);
+	void clearOutputLocks();
+
+	uint8_t regs[256];
+	uint8_t pointer;		/* register pointer */
+	bool increment;			/* auto-increment of the current transfer */
+
+private:
+	struct Output
+	{
+		uint8_t first;
+		uint8_t last;
+		bool locked;
+		bool pending;
+		uint8_t readMask;	/* bytes read since the output was locked */
+		uint8_t data[4];
+	};
+
+	Output *findOutput(uint8_t reg);
+
+	uint8_t devAddress;
+	bool devPresent;
+	uint8_t readOnly[32];
+	Output outputs[SIM_MAX_OUTPUTS];
+	int outputCount;
+};
+
+/**
+ * @brief Simulated I2C bus.
+ *
+ * Every transfer advances the clock by its duration on the wire (9 bit times
+ * per byte plus start/stop conditions) before the device sees it.
+ */
+class SimBus
+{
+public:
+	explicit SimBus(uint32_t clockHz = SIM_BUS_DEFAULT_CLOCK);
+
+	void attach(SimDevice *device);
+	void detach(SimDevice *device);
+	SimDevice *device(uint8_t address) const;
+
+	void setClock(uint32_t clockHz) { busClockHz = clockHz; }
+	uint32_t clock() const { return busClockHz; }
+
+	/* Raw transfers, return false on NACK */
+	bool write(uint8_t address, const uint8_t *data, int count);
+	bool read(uint8_t address, uint8_t *data, int count);
+	/* Write followed by a read with repeated start */
+	bool writeRead(uint8_t address, const uint8_t *wData, int wCount, uint8_t *rData, int rCount);
+
+	/* Traffic since construction or the last resetStatistics() */
+	struct Statistics
+	{
+		uint32_t transfers;		/* start ... stop sequences, a repeated start does not count */
+		uint32_t bytes;			/* data bytes, without address bytes */
+		uint32_t nacks;			/* transfers to an absent device */
+		uint64_t busyNs;		/* time on the wire */
+	};
+
+	const Statistics &statistics() const { return stats; }
+	void resetStatistics();
+
+	/* Bus used by sensors without handle */
+	static SimBus &defaultBus();
+
+private:
+	void transfer(int conditions, int addressBytes, int dataBytes, bool ack);
+
+	uint32_t busClockHz;
+	SimDevice *devices[128];
+	Statistics stats;
+};
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Transport on a simulated bus, handle is a SimBus (SimBus::defaultBus() if NULL) */
+extern const WE_transport_t WE_simTransport;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIMBUS_H */
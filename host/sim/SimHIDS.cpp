@@ -0,0 +1,229 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "SimSensors.h"
+
+#include "WSEN_HIDS_2523020210001.h"
+
+#define HIDS_CONVERSION_TIME_NS (uint64_t)4000000	/* one-shot conversion */
+
+/* ODR[1:0] in Hz, see HIDS_output_data_rate_t */
+static const double odrTable[4] = { 0, 1, 7, 12.5 };
+
+/* Calibration points stored in the factory calibration block */
+#define HIDS_CAL_H0_RH     20.0
+#define HIDS_CAL_H1_RH     80.0
+#define HIDS_CAL_H0_T0_OUT (int16_t)-4000
+#define HIDS_CAL_H1_T0_OUT (int16_t)8000
+#define HIDS_CAL_T0_DEGC   15.0
+#define HIDS_CAL_T1_DEGC   40.0
+#define HIDS_CAL_T0_OUT    (int16_t)-320
+#define HIDS_CAL_T1_OUT    (int16_t)1280
+
+SimHIDS::SimHIDS(uint8_t address)
+	: SimDevice(address)
+{
+	hum = SimWaveform::constant(50.0);
+	temp = SimWaveform::constant(25.0);
+
+	setReadOnly(HIDS_DEVICE_ID_REG, HIDS_DEVICE_ID_REG);
+	setReadOnly(HIDS_STATUS_REG, HIDS_T_OUT_H_REG);
+	setReadOnly(HIDS_H0_RH_X2, HIDS_T1_OUT_H);
+
+	addOutput(HIDS_H_OUT_L_REG, HIDS_H_OUT_H_REG);
+	addOutput(HIDS_T_OUT_L_REG, HIDS_T_OUT_H_REG);
+
+	reset();
+}
+
+void SimHIDS::setHumidity(const SimWaveform &humidity)
+{
+	hum = humidity;
+}
+
+void SimHIDS::setTemperature(const SimWaveform &temperature)
+{
+	temp = temperature;
+}
+
+void SimHIDS::reset()
+{
+	SimDevice::reset();
+	timer.stop();
+	humDataReady = false;
+	tempDataReady = false;
+	conversionPending = false;
+	conversionDoneNs = 0;
+}
+
+void SimHIDS::defaults()
+{
+	uint16_t t0x8 = (uint16_t)(HIDS_CAL_T0_DEGC * 8);
+	uint16_t t1x8 = (uint16_t)(HIDS_CAL_T1_DEGC * 8);
+
+	regs[HIDS_DEVICE_ID_REG] = HIDS_DEVICE_ID_VALUE;
+	regs[HIDS_Average_REG] = 0x1B;
+
+	regs[HIDS_H0_RH_X2] = (uint8_t)(HIDS_CAL_H0_RH * 2);
+	regs[HIDS_H1_RH_X2] = (uint8_t)(HIDS_CAL_H1_RH * 2);
+	regs[HIDS_T0_DEGC_X8] = (uint8_t)(t0x8 & 0xFF);
+	regs[HIDS_T1_DEGC_X8] = (uint8_t)(t1x8 & 0xFF);
+	regs[HIDS_T0_T1_DEGC_H2] = (uint8_t)(((t0x8 >> 8) & 0x03) | (((t1x8 >> 8) & 0x03) << 2));
+	regs[HIDS_H0_T0_OUT_L] = (uint8_t)((uint16_t)HIDS_CAL_H0_T0_OUT & 0xFF);
+	regs[HIDS_H0_T0_OUT_H] = (uint8_t)((uint16_t)HIDS_CAL_H0_T0_OUT >> 8);
+	regs[HIDS_H1_T0_OUT_L] = (uint8_t)((uint16_t)HIDS_CAL_H1_T0_OUT & 0xFF);
+	regs[HIDS_H1_T0_OUT_H] = (uint8_t)((uint16_t)HIDS_CAL_H1_T0_OUT >> 8);
+	regs[HIDS_T0_OUT_L] = (uint8_t)((uint16_t)HIDS_CAL_T0_OUT & 0xFF);
+	regs[HIDS_T0_OUT_H] = (uint8_t)((uint16_t)HIDS_CAL_T0_OUT >> 8);
+	regs[HIDS_T1_OUT_L] = (uint8_t)((uint16_t)HIDS_CAL_T1_OUT & 0xFF);
+	regs[HIDS_T1_OUT_H] = (uint8_t)((uint16_t)HIDS_CAL_T1_OUT >> 8);
+}
+
+/**
+ * @brief  Current output data rate, 0 in power-down and one-shot mode
+ */
+
+double SimHIDS::outputDataRate() const
+{
+	uint8_t ctrl1 = regs[HIDS_CTRL_REG_1];
+
+	if (0 == (ctrl1 & 0x80))
+	{
+		return 0;
+	}
+	return odrTable[ctrl1 & 0x03];
+}
+
+bool SimHIDS::blockDataUpdate() const
+{
+	return 0 != (regs[HIDS_CTRL_REG_1] & 0x04);
+}
+
+/**
+ * @brief  Bit 7 of the sub-address enables auto-increment of a multi-byte access
+ */
+
+uint8_t SimHIDS::selectRegister(uint8_t subAddress)
+{
+	increment = (0 != (subAddress & 0x80));
+	return (uint8_t)(subAddress & 0x7F);
+}
+
+void SimHIDS::configure(uint64_t nowNs)
+{
+	timer.start(nowNs, outputDataRate());
+}
+
+/**
+ * @brief  Take one sample: code the waveforms with the calibration block
+ * @param  Sample time in ns
+ */
+
+void SimHIDS::sample(uint64_t tNs)
+{
+	double t = (double)tNs * 1e-9;
+	double rh = hum.at(t);
+	double celsius = temp.at(t);
+	double hOut;
+	double tOut;
+
+	hOut = HIDS_CAL_H0_T0_OUT + (rh - HIDS_CAL_H0_RH) * (HIDS_CAL_H1_T0_OUT - HIDS_CAL_H0_T0_OUT) / (HIDS_CAL_H1_RH - HIDS_CAL_H0_RH);
+	tOut = HIDS_CAL_T0_OUT + (celsius - HIDS_CAL_T0_DEGC) * (HIDS_CAL_T1_OUT - HIDS_CAL_T0_OUT) / (HIDS_CAL_T1_DEGC - HIDS_CAL_T0_DEGC);
+
+	setOutput16(HIDS_H_OUT_L_REG, (int16_t)SimSaturate(hOut, -32768, 32767));
+	setOutput16(HIDS_T_OUT_L_REG, (int16_t)SimSaturate(tOut, -32768, 32767));
+	humDataReady = true;
+	tempDataReady = true;
+}
+
+void SimHIDS::update(uint64_t nowNs)
+{
+	uint64_t tNs;
+
+	if (conversionPending && (nowNs >= conversionDoneNs))
+	{
+		conversionPending = false;
+		regs[HIDS_CTRL_REG_2] &= (uint8_t)~0x01;	/* ONE_SHOT self-clears */
+		sample(conversionDoneNs);
+	}
+
+	timer.catchUp(nowNs, 1);
+	while (timer.tick(nowNs, &tNs))
+	{
+		sample(tNs);
+	}
+}
+
+uint8_t SimHIDS::readRegister(uint8_t reg)
+{
+	switch (reg)
+	{
+	case HIDS_STATUS_REG:
+		return (uint8_t)((humDataReady ? 0x01 : 0x00) | (tempDataReady ? 0x02 : 0x00));
+
+	case HIDS_H_OUT_H_REG:
+		humDataReady = false;
+		return SimDevice::readRegister(reg);
+
+	case HIDS_T_OUT_H_REG:
+		tempDataReady = false;
+		return SimDevice::readRegister(reg);
+
+	default:
+		return SimDevice::readRegister(reg);
+	}
+}
+
+void SimHIDS::writeRegister(uint8_t reg, uint8_t value)
+{
+	uint64_t nowNs = SimClock::nowNs();
+
+	switch (reg)
+	{
+	case HIDS_CTRL_REG_1:
+		regs[reg] = value;
+		configure(nowNs);
+		break;
+
+	case HIDS_CTRL_REG_2:
+		if (value & 0x80)
+		{
+			/* BOOT reloads the calibration block */
+			defaults();
+		}
+		regs[reg] = (uint8_t)(value & 0x7F);
+		/* one-shot needs the device active (PD = 1) with ODR = one-shot */
+		if ((value & 0x01) && (regs[HIDS_CTRL_REG_1] & 0x80) && (0 == (regs[HIDS_CTRL_REG_1] & 0x03)) && !conversionPending)
+		{
+			conversionPending = true;
+			conversionDoneNs = nowNs + HIDS_CONVERSION_TIME_NS;
+		}
+		break;
+
+	default:
+		SimDevice::writeRegister(reg, value);
+		break;
+	}
+}
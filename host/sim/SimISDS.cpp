@@ -0,0 +1,587 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "SimSensors.h"
+
+#include <string.h>
+
+#include "WSEN_ISDS_2536030320001.h"
+
+/* ODR[3:0] in Hz, code 11 is the 1.6 Hz low-power rate of the accelerometer */
+static const double odrTable[12] = { 0, 12.5, 26, 52, 104, 208, 416, 833, 1660, 3330, 6660, 1.6 };
+
+/* FIFO decimation codes, 0 means the data set is not stored */
+static const uint8_t decimationFactor[8] = { 0, 1, 2, 3, 4, 8, 16, 32 };
+
+/* Sensitivities of the full scale codes */
+static const double accSensitivity[4] = { 0.061, 0.488, 0.122, 0.244 };	/* mg/digit */
+
+static double GyroSensitivity(uint8_t fullScaleCode)
+{
+	/* FS_125 overrides FS_G */
+	if (fullScaleCode & 0x01)
+	{
+		return 4.375;
+	}
+
+	switch (fullScaleCode >> 1)
+	{
+	case 0:
+		return 8.75;
+	case 1:
+		return 17.5;
+	case 2:
+		return 35.0;
+	default:
+		return 70.0;
+	}
+}
+
+static uint32_t Gcd(uint32_t a, uint32_t b)
+{
+	while (0 != b)
+	{
+		uint32_t t = a % b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
+
+SimISDS::SimISDS(uint8_t address)
+	: SimDevice(address)
+{
+	temp = SimWaveform::constant(25.0);
+	acc[2] = SimWaveform::constant(1000.0);
+
+	setReadOnly(ISDS_DEVICE_ID_REG, ISDS_DEVICE_ID_REG);
+	setReadOnly(ISDS_WAKE_UP_EVENT_REG, ISDS_Z_OUT_H_ACC_REG);
+	setReadOnly(ISDS_FIFO_STATUS_1_REG, ISDS_TIMESTAMP1_REG);
+	setReadOnly(ISDS_FUNC_SRC_1_REG, ISDS_FUNC_SRC_1_REG);
+
+	addOutput(ISDS_OUT_TEMP_L_REG, ISDS_OUT_TEMP_H_REG);
+	addOutput(ISDS_X_OUT_L_GYRO_REG, ISDS_X_OUT_H_GYRO_REG);
+	addOutput(ISDS_Y_OUT_L_GYRO_REG, ISDS_Y_OUT_H_GYRO_REG);
+	addOutput(ISDS_Z_OUT_L_GYRO_REG, ISDS_Z_OUT_H_GYRO_REG);
+	addOutput(ISDS_X_OUT_L_ACC_REG, ISDS_X_OUT_H_ACC_REG);
+	addOutput(ISDS_Y_OUT_L_ACC_REG, ISDS_Y_OUT_H_ACC_REG);
+	addOutput(ISDS_Z_OUT_L_ACC_REG, ISDS_Z_OUT_H_ACC_REG);
+
+	reset();
+}
+
+void SimISDS::setAcceleration(const SimWaveform &x, const SimWaveform &y, const SimWaveform &z)
+{
+	acc[0] = x;
+	acc[1] = y;
+	acc[2] = z;
+}
+
+void SimISDS::setAngularRate(const SimWaveform &x, const SimWaveform &y, const SimWaveform &z)
+{
+	gyro[0] = x;
+	gyro[1] = y;
+	gyro[2] = z;
+}
+
+void SimISDS::setTemperature(const SimWaveform &temperature)
+{
+	temp = temperature;
+}
+
+void SimISDS::reset()
+{
+	SimDevice::reset();
+	accTimer.stop();
+	gyroTimer.stop();
+	fifoTimer.stop();
+	accDataReady = false;
+	gyroDataReady = false;
+	tempDataReady = false;
+	timestampStartNs = SimClock::nowNs();
+	fifoReset();
+}
+
+void SimISDS::defaults()
+{
+	regs[ISDS_DEVICE_ID_REG] = ISDS_DEVICE_ID_VALUE;
+	regs[ISDS_CTRL_3_REG] = 0x04;	/* IF_INC */
+	regs[ISDS_CTRL_9_REG] = 0xE0;
+}
+
+double SimISDS::accOutputDataRate() const
+{
+	uint8_t odr = regs[ISDS_CTRL_1_REG] >> 4;
+	return (odr < 12) ? odrTable[odr] : 0;
+}
+
+double SimISDS::gyroOutputDataRate() const
+{
+	uint8_t odr = regs[ISDS_CTRL_2_REG] >> 4;
+	return (odr < 11) ? odrTable[odr] : 0;
+}
+
+double SimISDS::fifoOutputDataRate() const
+{
+	uint8_t odr = (regs[ISDS_FIFO_CTRL_5_REG] >> 3) & 0x0F;
+	return (odr < 11) ? odrTable[odr] : 0;
+}
+
+bool SimISDS::autoIncrement() const
+{
+	return 0 != (regs[ISDS_CTRL_3_REG] & 0x04);
+}
+
+bool SimISDS::blockDataUpdate() const
+{
+	return 0 != (regs[ISDS_CTRL_3_REG] & 0x40);
+}
+
+/**
+ * @brief  Register address following reg: FIFO data output and rounding (circular burst) wrap-around
+ */
+
+uint8_t SimISDS::nextRegister(uint8_t reg) const
+{
+	uint8_t rounding = regs[ISDS_CTRL_5_REG] >> 5;
+
+	if (ISDS_FIFO_DATA_OUT_H_REG == reg)
+	{
+		return ISDS_FIFO_DATA_OUT_L_REG;
+	}
+	if ((ISDS_Z_OUT_H_ACC_REG == reg) && (ISDS_roundingPatternAccOnly == rounding))
+	{
+		return ISDS_X_OUT_L_ACC_REG;
+	}
+	if ((ISDS_Z_OUT_H_GYRO_REG == reg) && (ISDS_roundingPatternGyroOnly == rounding))
+	{
+		return ISDS_X_OUT_L_GYRO_REG;
+	}
+	if ((ISDS_Z_OUT_H_ACC_REG == reg) && (ISDS_roundingPatternGyroAndAcc == rounding))
+	{
+		return ISDS_X_OUT_L_GYRO_REG;
+	}
+	return (uint8_t)(reg + 1);
+}
+
+int16_t SimISDS::accRaw(int axis, uint64_t tNs) const
+{
+	double mg = acc[axis].at((double)tNs * 1e-9);
+	double offsetWeight = (regs[ISDS_CTRL_6_REG] & 0x08) ? 15.625 : 0.9765625;	/* 2^-6 g or 2^-10 g */
+
+	mg -= (double)(int8_t)regs[ISDS_X_OFS_USR_REG + axis] * offsetWeight;
+
+	return (int16_t)SimSaturate(mg / accSensitivity[(regs[ISDS_CTRL_1_REG] >> 2) & 0x03], -32768, 32767);
+}
+
+int16_t SimISDS::gyroRaw(int axis, uint64_t tNs) const
+{
+	double mdps = gyro[axis].at((double)tNs * 1e-9);
+	return (int16_t)SimSaturate(mdps / GyroSensitivity((regs[ISDS_CTRL_2_REG] >> 1) & 0x07), -32768, 32767);
+}
+
+int16_t SimISDS::tempRaw(uint64_t tNs) const
+{
+	double celsius = temp.at((double)tNs * 1e-9);
+	return (int16_t)SimSaturate((celsius - 25.0) * 256.0, -32768, 32767);
+}
+
+uint32_t SimISDS::timestamp(uint64_t nowNs) const
+{
+	uint64_t resolutionNs = (regs[ISDS_WAKE_UP_DUR_REG] & 0x10) ? 25000 : 6400000;
+
+	if (0 == (regs[ISDS_CTRL_10_REG] & 0x20))
+	{
+		return 0;
+	}
+	return (uint32_t)(((nowNs - timestampStartNs) / resolutionNs) & 0xFFFFFF);
+}
+
+void SimISDS::sampleAcc(uint64_t tNs)
+{
+	for (int axis = 0; axis < 3; axis++)
+	{
+		setOutput16((uint8_t)(ISDS_X_OUT_L_ACC_REG + 2 * axis), accRaw(axis, tNs));
+	}
+	accDataReady = true;
+}
+
+void SimISDS::sampleGyro(uint64_t tNs)
+{
+	for (int axis = 0; axis < 3; axis++)
+	{
+		setOutput16((uint8_t)(ISDS_X_OUT_L_GYRO_REG + 2 * axis), gyroRaw(axis, tNs));
+	}
+	gyroDataReady = true;
+}
+
+void SimISDS::sampleTemp(uint64_t tNs)
+{
+	setOutput16(ISDS_OUT_TEMP_L_REG, tempRaw(tNs));
+	tempDataReady = true;
+}
+
+void SimISDS::fifoReset()
+{
+	uint8_t factors[4];
+	uint32_t lcm = 1;
+	uint32_t words = 0;
+
+	fifoHead = 0;
+	fifoCount = 0;
+	fifoOverrun = false;
+	fifoCycle = 0;
+	fifoPatternWord = 0;
+
+	factors[0] = decimationFactor[(regs[ISDS_FIFO_CTRL_3_REG] >> 3) & 0x07];
+	factors[1] = decimationFactor[regs[ISDS_FIFO_CTRL_3_REG] & 0x07];
+	factors[2] = decimationFactor[regs[ISDS_FIFO_CTRL_4_REG] & 0x07];
+	factors[3] = decimationFactor[(regs[ISDS_FIFO_CTRL_4_REG] >> 3) & 0x07];
+
+	for (int i = 0; i < 4; i++)
+	{
+		if (0 != factors[i])
+		{
+			lcm = lcm / Gcd(lcm, factors[i]) * factors[i];
+		}
+	}
+	for (int i = 0; i < 4; i++)
+	{
+		if (0 != factors[i])
+		{
+			words += 3 * (lcm / factors[i]);
+		}
+	}
+	fifoPatternLength = (uint16_t)words;
+}
+
+int SimISDS::fifoCapacity() const
+{
+	uint16_t threshold = (uint16_t)(regs[ISDS_FIFO_CTRL_1_REG] | ((regs[ISDS_FIFO_CTRL_2_REG] & 0x07) << 8));
+
+	if ((regs[ISDS_FIFO_CTRL_4_REG] & 0x80) && (threshold < fifoWords))
+	{
+		/* STOP_ON_FTH */
+		return threshold;
+	}
+	return fifoWords;
+}
+
+/**
+ * @brief  Store one data set (3 words) in the FIFO
+ * @param  -words : data set
+ *         -pattern : pattern index of the first word
+ */
+
+void SimISDS::fifoPush(const int16_t *words, uint16_t pattern)
+{
+	uint8_t mode = regs[ISDS_FIFO_CTRL_5_REG] & 0x07;
+
+	if (fifoCount + 3 > fifoCapacity())
+	{
+		if ((ISDS_fifoEnabled == mode) || (fifoCount < 3))
+		{
+			/* FIFO mode stops collecting when full */
+			fifoOverrun = true;
+			return;
+		}
+		fifoHead = (fifoHead + 3) % fifoWords;
+		fifoCount -= 3;
+		fifoOverrun = true;
+	}
+
+	for (int i = 0; i < 3; i++)
+	{
+		FifoWord *entry = &fifo[(fifoHead + fifoCount) % fifoWords];
+		entry->word = (uint16_t)words[i];
+		entry->pattern = (uint16_t)(pattern + i);
+		fifoCount++;
+	}
+}
+
+/**
+ * @brief  One FIFO write cycle: store the data sets due in this cycle
+ *
+ * Order of the data sets: gyroscope, accelerometer, third (empty, no
+ * external sensor) and fourth (timestamp and step counter).
+ *
+ * @param  Cycle time in ns
+ */
+
+void SimISDS::fifoWrite(uint64_t tNs)
+{
+	uint8_t mode = regs[ISDS_FIFO_CTRL_5_REG] & 0x07;
+	uint8_t factors[4];
+	int16_t words[3];
+
+	/* no trigger events are simulated: bypass-to-continuous stays in bypass,
+	 * continuous-to-FIFO stays continuous */
+	if ((ISDS_fifoEnabled != mode) && (ISDS_continuousToFifo != mode) && (ISDS_continuousMode != mode))
+	{
+		return;
+	}
+
+	factors[0] = decimationFactor[(regs[ISDS_FIFO_CTRL_3_REG] >> 3) & 0x07];
+	factors[1] = decimationFactor[regs[ISDS_FIFO_CTRL_3_REG] & 0x07];
+	factors[2] = decimationFactor[regs[ISDS_FIFO_CTRL_4_REG] & 0x07];
+	factors[3] = decimationFactor[(regs[ISDS_FIFO_CTRL_4_REG] >> 3) & 0x07];
+
+	for (int set = 0; set < 4; set++)
+	{
+		if ((0 == factors[set]) || (0 != (fifoCycle % factors[set])))
+		{
+			continue;
+		}
+
+		switch (set)
+		{
+		case 0:
+			for (int axis = 0; axis < 3; axis++)
+			{
+				words[axis] = gyroRaw(axis, tNs);
+			}
+			break;
+
+		case 1:
+			for (int axis = 0; axis < 3; axis++)
+			{
+				words[axis] = accRaw(axis, tNs);
+			}
+			break;
+
+		case 3:
+			if (regs[ISDS_FIFO_CTRL_2_REG] & 0x08)
+			{
+				/* FIFO_TEMP_EN: temperature, two unused words */
+				words[0] = tempRaw(tNs);
+				words[1] = 0;
+				words[2] = 0;
+				break;
+			}
+			if (regs[ISDS_FIFO_CTRL_2_REG] & 0x80)
+			{
+				/* TIMESTAMP[15:8], TIMESTAMP[23:16], unused, TIMESTAMP[7:0], step counter */
+				uint32_t ts = timestamp(tNs);
+				words[0] = (int16_t)(((ts >> 8) & 0xFF) | (((ts >> 16) & 0xFF) << 8));
+				words[1] = (int16_t)((ts & 0xFF) << 8);
+				words[2] = 0;
+				break;
+			}
+			/* fall through */
+
+		default:
+			words[0] = 0;
+			words[1] = 0;
+			words[2] = 0;
+			break;
+		}
+
+		fifoPush(words, fifoPatternWord);
+		fifoPatternWord = (uint16_t)((fifoPatternWord + 3) % fifoPatternLength);
+	}
+
+	fifoCycle++;
+}
+
+void SimISDS::update(uint64_t nowNs)
+{
+	uint64_t tNs;
+
+	accTimer.catchUp(nowNs, 1);
+	while (accTimer.tick(nowNs, &tNs))
+	{
+		sampleAcc(tNs);
+		sampleTemp(tNs);
+	}
+
+	gyroTimer.catchUp(nowNs, 1);
+	while (gyroTimer.tick(nowNs, &tNs))
+	{
+		sampleGyro(tNs);
+		if (!accTimer.running())
+		{
+			sampleTemp(tNs);
+		}
+	}
+
+	if (fifoTimer.catchUp(nowNs, fifoWords + 1))
+	{
+		fifoOverrun = true;
+	}
+	while (fifoTimer.tick(nowNs, &tNs))
+	{
+		fifoWrite(tNs);
+	}
+}
+
+uint8_t SimISDS::readRegister(uint8_t reg)
+{
+	uint16_t threshold;
+	uint16_t pattern;
+	uint8_t value;
+	uint32_t ts;
+
+	switch (reg)
+	{
+	case ISDS_STATUS_REG:
+		return (uint8_t)((accDataReady ? 0x01 : 0x00) | (gyroDataReady ? 0x02 : 0x00) | (tempDataReady ? 0x04 : 0x00));
+
+	case ISDS_OUT_TEMP_H_REG:
+		tempDataReady = false;
+		return SimDevice::readRegister(reg);
+
+	case ISDS_X_OUT_H_GYRO_REG:
+	case ISDS_Y_OUT_H_GYRO_REG:
+	case ISDS_Z_OUT_H_GYRO_REG:
+		gyroDataReady = false;
+		return SimDevice::readRegister(reg);
+
+	case ISDS_X_OUT_H_ACC_REG:
+	case ISDS_Y_OUT_H_ACC_REG:
+	case ISDS_Z_OUT_H_ACC_REG:
+		accDataReady = false;
+		return SimDevice::readRegister(reg);
+
+	case ISDS_FIFO_STATUS_1_REG:
+		return (uint8_t)(fifoCount & 0xFF);
+
+	case ISDS_FIFO_STATUS_2_REG:
+		threshold = (uint16_t)(regs[ISDS_FIFO_CTRL_1_REG] | ((regs[ISDS_FIFO_CTRL_2_REG] & 0x07) << 8));
+		return (uint8_t)(((fifoCount >> 8) & 0x07) |
+				((0 == fifoCount) ? 0x10 : 0x00) |
+				((fifoCount + 3 > fifoCapacity()) ? 0x20 : 0x00) |
+				(fifoOverrun ? 0x40 : 0x00) |
+				((fifoCount >= threshold) ? 0x80 : 0x00));
+
+	case ISDS_FIFO_STATUS_3_REG:
+	case ISDS_FIFO_STATUS_4_REG:
+		pattern = (fifoCount > 0) ? fifo[fifoHead].pattern : fifoPatternWord;
+		return (uint8_t)((ISDS_FIFO_STATUS_3_REG == reg) ? (pattern & 0xFF) : ((pattern >> 8) & 0x03));
+
+	case ISDS_FIFO_DATA_OUT_L_REG:
+		if (0 == fifoCount)
+		{
+			return 0;
+		}
+		return (uint8_t)(fifo[fifoHead].word & 0xFF);
+
+	case ISDS_FIFO_DATA_OUT_H_REG:
+		if (0 == fifoCount)
+		{
+			return 0;
+		}
+		value = (uint8_t)(fifo[fifoHead].word >> 8);
+		/* a word has been read, advance the FIFO */
+		fifoHead = (fifoHead + 1) % fifoWords;
+		fifoCount--;
+		fifoOverrun = false;
+		return value;
+
+	case ISDS_TIMESTAMP0_REG:
+	case ISDS_TIMESTAMP1_REG:
+	case ISDS_TIMESTAMP2_REG:
+		ts = timestamp(SimClock::nowNs());
+		return (uint8_t)(ts >> (8 * (reg - ISDS_TIMESTAMP0_REG)));
+
+	default:
+		return SimDevice::readRegister(reg);
+	}
+}
+
+void SimISDS::writeRegister(uint8_t reg, uint8_t value)
+{
+	uint64_t nowNs = SimClock::nowNs();
+	uint8_t old = regs[reg];
+
+	switch (reg)
+	{
+	case ISDS_CTRL_1_REG:
+		regs[reg] = value;
+		if ((old >> 4) != (value >> 4))
+		{
+			accTimer.start(nowNs, accOutputDataRate());
+		}
+		break;
+
+	case ISDS_CTRL_2_REG:
+		regs[reg] = value;
+		if ((old >> 4) != (value >> 4))
+		{
+			gyroTimer.start(nowNs, gyroOutputDataRate());
+		}
+		break;
+
+	case ISDS_CTRL_3_REG:
+		if (value & 0x01)
+		{
+			/* SW_RESET, self-clearing */
+			reset();
+			break;
+		}
+		regs[reg] = (uint8_t)(value & 0x7F);	/* BOOT self-clears immediately */
+		break;
+
+	case ISDS_CTRL_10_REG:
+		regs[reg] = value;
+		if ((value & 0x20) && !(old & 0x20))
+		{
+			timestampStartNs = nowNs;
+		}
+		break;
+
+	case ISDS_TIMESTAMP2_REG:
+		if (0xAA == value)
+		{
+			timestampStartNs = nowNs;
+		}
+		break;
+
+	case ISDS_FIFO_CTRL_3_REG:
+	case ISDS_FIFO_CTRL_4_REG:
+		regs[reg] = value;
+		if (old != value)
+		{
+			fifoReset();
+		}
+		break;
+
+	case ISDS_FIFO_CTRL_5_REG:
+		regs[reg] = value;
+		if ((ISDS_bypassMode == (value & 0x07)) || ((old & 0x07) != (value & 0x07)))
+		{
+			/* bypass empties the FIFO, a mode change restarts collection */
+			fifoReset();
+		}
+		if ((old & 0x78) != (value & 0x78))
+		{
+			fifoTimer.start(nowNs, fifoOutputDataRate());
+		}
+		break;
+
+	default:
+		SimDevice::writeRegister(reg, value);
+		break;
+	}
+}
@@ -0,0 +1,400 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "SimSensors.h"
+
+#include <string.h>
+
+#include "WSEN_ITDS_2533020201601.h"
+
+#define ITDS_CONVERSION_TIME_NS (uint64_t)1250000	/* single conversion on demand */
+
+/* ODR[3:0] in Hz per operating mode, see ITDS_ctrl_1_t */
+static const double odrHighPerformance[10] = { 0, 12.5, 12.5, 25, 50, 100, 200, 400, 800, 1600 };
+static const double odrNormal[10] = { 0, 12.5, 12.5, 25, 50, 100, 200, 200, 800, 1600 };
+static const double odrLowPower[10] = { 0, 1.6, 12.5, 25, 50, 100, 200, 200, 200, 200 };
+
+SimITDS::SimITDS(uint8_t address)
+	: SimDevice(address)
+{
+	temp = SimWaveform::constant(25.0);
+	acc[2] = SimWaveform::constant(1000.0);
+
+	setReadOnly(ITDS_T_OUT_L_REG, ITDS_DEVICE_ID_REG);
+	setReadOnly(ITDS_T_OUT_REG, ITDS_Z_OUT_H_REG);
+	setReadOnly(ITDS_FIFO_SAMPLES_REG, ITDS_FIFO_SAMPLES_REG);
+	setReadOnly(ITDS_STATUS_DETECT_REG, ITDS_ALL_INT_EVENT_REG);
+
+	addOutput(ITDS_T_OUT_L_REG, ITDS_T_OUT_H_REG);
+	addOutput(ITDS_X_OUT_L_REG, ITDS_X_OUT_H_REG);
+	addOutput(ITDS_Y_OUT_L_REG, ITDS_Y_OUT_H_REG);
+	addOutput(ITDS_Z_OUT_L_REG, ITDS_Z_OUT_H_REG);
+
+	reset();
+}
+
+void SimITDS::setAcceleration(const SimWaveform &x, const SimWaveform &y, const SimWaveform &z)
+{
+	acc[0] = x;
+	acc[1] = y;
+	acc[2] = z;
+}
+
+void SimITDS::setTemperature(const SimWaveform &temperature)
+{
+	temp = temperature;
+}
+
+void SimITDS::reset()
+{
+	SimDevice::reset();
+	timer.stop();
+	dataReady = false;
+	tempDataReady = false;
+	conversionPending = false;
+	conversionDoneNs = 0;
+	fifoHead = 0;
+	fifoCount = 0;
+	fifoOverrun = false;
+	fifoTriggered = false;
+	fifoStopped = false;
+}
+
+void SimITDS::defaults()
+{
+	regs[ITDS_DEVICE_ID_REG] = ITDS_DEVICE_ID_VALUE;
+	regs[ITDS_CTRL_2_REG] = 0x04;	/* IF_ADD_INC */
+}
+
+double SimITDS::outputDataRate() const
+{
+	uint8_t ctrl1 = regs[ITDS_CTRL_1_REG];
+	uint8_t odr = ctrl1 >> 4;
+	uint8_t mode = (ctrl1 >> 2) & 0x03;
+
+	if (odr > 9)
+	{
+		odr = 9;
+	}
+
+	switch (mode)
+	{
+	case 0:
+		return (0 == (ctrl1 & 0x03)) ? odrLowPower[odr] : odrNormal[odr];
+	case 1:
+		return odrHighPerformance[odr];
+	default:
+		/* single conversion on demand */
+		return 0;
+	}
+}
+
+bool SimITDS::autoIncrement() const
+{
+	return 0 != (regs[ITDS_CTRL_2_REG] & 0x04);
+}
+
+bool SimITDS::blockDataUpdate() const
+{
+	return 0 != (regs[ITDS_CTRL_2_REG] & 0x08);
+}
+
+/**
+ * @brief  Mode the FIFO currently runs in, the trigger modes switch on an interrupt event
+ */
+uint8_t SimITDS::fifoMode() const
+{
+	uint8_t mode = regs[ITDS_FIFO_CTRL_REG] >> 5;
+
+	switch (mode)
+	{
+	case ITDS_continuousToFifo:
+		return fifoTriggered ? (uint8_t)ITDS_fifoModes : (uint8_t)ITDS_continuousMode;
+	case ITDS_bypassToContinuous:
+		return fifoTriggered ? (uint8_t)ITDS_continuousMode : (uint8_t)ITDS_bypassMode;
+	default:
+		return mode;
+	}
+}
+
+bool SimITDS::fifoActive() const
+{
+	uint8_t mode = fifoMode();
+
+	return (ITDS_fifoModes == mode) || (ITDS_continuousMode == mode);
+}
+
+uint8_t SimITDS::fifoThreshold() const
+{
+	return regs[ITDS_FIFO_CTRL_REG] & 0x1F;
+}
+
+/**
+ * @brief  Register address following reg, the output registers wrap while the FIFO is read
+ */
+
+uint8_t SimITDS::nextRegister(uint8_t reg) const
+{
+	if ((ITDS_Z_OUT_H_REG == reg) && fifoActive())
+	{
+		return ITDS_X_OUT_L_REG;
+	}
+	return (uint8_t)(reg + 1);
+}
+
+void SimITDS::configure(uint64_t nowNs)
+{
+	timer.start(nowNs, outputDataRate());
+}
+
+/**
+ * @brief  Take one sample: code the waveforms and publish them in the output registers / FIFO
+ * @param  Sample time in ns
+ */
+
+void SimITDS::sample(uint64_t tNs)
+{
+	double t = (double)tNs * 1e-9;
+	uint8_t ctrl1 = regs[ITDS_CTRL_1_REG];
+	uint8_t ctrl7 = regs[ITDS_CTRL_7_REG];
+	uint8_t fullScale = (regs[ITDS_CTRL_6_REG] >> 4) & 0x03;
+	double sensitivity = 0.061 * (double)(1 << fullScale);	/* mg/digit, left-aligned */
+	bool lowPower = (0 == (ctrl1 & 0x0C)) && (0 == (ctrl1 & 0x03));
+	uint16_t resolutionMask = lowPower ? 0xFFF0 : 0xFFFC;	/* 12 or 14 bit */
+	double offsetWeight = (ctrl7 & 0x04) ? 15.6 : 0.977;	/* mg/LSB */
+	uint8_t xyz[6];
+
+	for (int axis = 0; axis < 3; axis++)
+	{
+		double mg = acc[axis].at(t);
+
+		if (ctrl7 & 0x10)
+		{
+			/* USR_OFF_ON_OUT */
+			mg -= (double)(int8_t)regs[ITDS_X_OFS_USR_REG + axis] * offsetWeight;
+		}
+
+		uint16_t raw = (uint16_t)SimSaturate(mg / sensitivity, -32768, 32767) & resolutionMask;
+		xyz[2 * axis] = (uint8_t)(raw & 0xFF);
+		xyz[2 * axis + 1] = (uint8_t)(raw >> 8);
+	}
+
+	double celsius = temp.at(t);
+	int16_t temp12 = (int16_t)SimSaturate((celsius - 25.0) * 16.0, -2048, 2047);
+	setOutput16(ITDS_T_OUT_L_REG, (int16_t)(temp12 * 16));
+	regs[ITDS_T_OUT_REG] = (uint8_t)(int8_t)SimSaturate(celsius - 25.0, -128, 127);
+	tempDataReady = true;
+
+	if (fifoActive())
+	{
+		if (fifoStopped)
+		{
+			return;
+		}
+		if (fifoCount == fifoDepth)
+		{
+			if (ITDS_fifoModes == fifoMode())
+			{
+				/* FIFO mode stops collecting when full, reading does not restart it,
+				 * only a mode change does */
+				fifoStopped = true;
+				return;
+			}
+			fifoHead = (fifoHead + 1) % fifoDepth;
+			fifoCount--;
+			fifoOverrun = true;
+		}
+		memcpy(fifo[(fifoHead + fifoCount) % fifoDepth], xyz, 6);
+		fifoCount++;
+		memcpy(&regs[ITDS_X_OUT_L_REG], fifo[fifoHead], 6);
+	}
+	else
+	{
+		setOutput(ITDS_X_OUT_L_REG, &xyz[0]);
+		setOutput(ITDS_Y_OUT_L_REG, &xyz[2]);
+		setOutput(ITDS_Z_OUT_L_REG, &xyz[4]);
+	}
+
+	dataReady = true;
+}
+
+void SimITDS::update(uint64_t nowNs)
+{
+	uint64_t tNs;
+
+	if (conversionPending && (nowNs >= conversionDoneNs))
+	{
+		conversionPending = false;
+		regs[ITDS_CTRL_3_REG] &= (uint8_t)~0x01;	/* SLP_MODE_1 self-clears */
+		sample(conversionDoneNs);
+	}
+
+	if (timer.catchUp(nowNs, fifoDepth + 1) && fifoActive())
+	{
+		fifoOverrun = true;
+	}
+	while (timer.tick(nowNs, &tNs))
+	{
+		sample(tNs);
+	}
+}
+
+void SimITDS::triggerSingleConversion()
+{
+	uint64_t nowNs = SimClock::nowNs();
+
+	update(nowNs);
+
+	/* SLP_MODE_SEL = 0: single conversion started by INT_1 */
+	if ((2 == ((regs[ITDS_CTRL_1_REG] >> 2) & 0x03)) && (0 == (regs[ITDS_CTRL_3_REG] & 0x02)) && !conversionPending)
+	{
+		conversionPending = true;
+		conversionDoneNs = nowNs + ITDS_CONVERSION_TIME_NS;
+	}
+}
+
+void SimITDS::triggerEvent()
+{
+	update(SimClock::nowNs());
+
+	if ((ITDS_continuousToFifo == (regs[ITDS_FIFO_CTRL_REG] >> 5)) ||
+		(ITDS_bypassToContinuous == (regs[ITDS_FIFO_CTRL_REG] >> 5)))
+	{
+		fifoTriggered = true;
+	}
+}
+
+uint8_t SimITDS::readRegister(uint8_t reg)
+{
+	uint8_t value;
+	uint8_t fth;
+
+	switch (reg)
+	{
+	case ITDS_STATUS_REG:
+		fth = (fifoActive() && (fifoCount >= fifoThreshold())) ? 0x80 : 0x00;
+		return (uint8_t)((regs[reg] & 0x7E) | fth | (dataReady ? 0x01 : 0x00));
+
+	case ITDS_STATUS_DETECT_REG:
+		return (uint8_t)((regs[reg] & 0x3E) | (dataReady ? 0x01 : 0x00) |
+				(tempDataReady ? 0x40 : 0x00) | (fifoOverrun ? 0x80 : 0x00));
+
+	case ITDS_FIFO_SAMPLES_REG:
+		return (uint8_t)(fifoCount | (fifoOverrun ? 0x40 : 0x00) |
+				((fifoActive() && (fifoCount >= fifoThreshold())) ? 0x80 : 0x00));
+
+	case ITDS_T_OUT_H_REG:
+	case ITDS_T_OUT_REG:
+		tempDataReady = false;
+		return SimDevice::readRegister(reg);
+
+	case ITDS_X_OUT_L_REG:
+	case ITDS_X_OUT_H_REG:
+	case ITDS_Y_OUT_L_REG:
+	case ITDS_Y_OUT_H_REG:
+	case ITDS_Z_OUT_L_REG:
+	case ITDS_Z_OUT_H_REG:
+		if (reg & 0x01)
+		{
+			dataReady = false;
+		}
+		if (!fifoActive())
+		{
+			return SimDevice::readRegister(reg);
+		}
+
+		value = regs[reg];
+		if ((ITDS_Z_OUT_H_REG == reg) && (fifoCount > 0))
+		{
+			/* a complete sample has been read, advance the FIFO */
+			fifoHead = (fifoHead + 1) % fifoDepth;
+			fifoCount--;
+			fifoOverrun = false;
+			if (fifoCount > 0)
+			{
+				memcpy(&regs[ITDS_X_OUT_L_REG], fifo[fifoHead], 6);
+			}
+		}
+		return value;
+
+	default:
+		return SimDevice::readRegister(reg);
+	}
+}
+
+void SimITDS::writeRegister(uint8_t reg, uint8_t value)
+{
+	uint64_t nowNs = SimClock::nowNs();
+	uint8_t oldMode;
+
+	switch (reg)
+	{
+	case ITDS_CTRL_1_REG:
+		regs[reg] = value;
+		configure(nowNs);
+		break;
+
+	case ITDS_CTRL_2_REG:
+		if (value & 0x40)
+		{
+			/* SOFT_RESET, self-clearing */
+			reset();
+			break;
+		}
+		regs[reg] = (uint8_t)(value & 0x7F);	/* BOOT self-clears immediately */
+		break;
+
+	case ITDS_CTRL_3_REG:
+		regs[reg] = value;
+		if ((value & 0x03) == 0x03)
+		{
+			/* SLP_MODE_SEL = 1: single conversion started by writing SLP_MODE_1 */
+			if ((2 == ((regs[ITDS_CTRL_1_REG] >> 2) & 0x03)) && !conversionPending)
+			{
+				conversionPending = true;
+				conversionDoneNs = nowNs + ITDS_CONVERSION_TIME_NS;
+			}
+		}
+		break;
+
+	case ITDS_FIFO_CTRL_REG:
+		oldMode = regs[reg] >> 5;
+		regs[reg] = value;
+		if ((ITDS_bypassMode == (value >> 5)) || (oldMode != (value >> 5)))
+		{
+			/* bypass empties the FIFO, a mode change restarts collection */
+			fifoHead = 0;
+			fifoCount = 0;
+			fifoOverrun = false;
+			fifoTriggered = false;
+			fifoStopped = false;
+		}
+		break;
+
+	default:
+		SimDevice::writeRegister(reg, value);
+		break;
+	}
+}
@@ -0,0 +1,304 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "SimSensors.h"
+
+#include <string.h>
+
+#include "WSEN_PADS_2511020213301.h"
+
+/* single conversion time in low-power and low-noise mode */
+#define PADS_CONVERSION_TIME_LP_NS (uint64_t)2000000
+#define PADS_CONVERSION_TIME_LN_NS (uint64_t)4000000
+
+/* ODR[2:0] in Hz, see PADS_output_data_rate_t */
+static const double odrTable[8] = { 0, 1, 10, 25, 50, 75, 100, 200 };
+
+SimPADS::SimPADS(uint8_t address)
+	: SimDevice(address)
+{
+	pres = SimWaveform::constant(101.325);
+	temp = SimWaveform::constant(25.0);
+
+	setReadOnly(PADS_DEVICE_ID_REG, PADS_DEVICE_ID_REG);
+	setReadOnly(PADS_INT_SOURCE_REG, PADS_DATA_T_H_REG);
+	setReadOnly(PADS_FIFO_DATA_P_XL_REG, PADS_FIFO_DATA_T_H_REG);
+
+	addOutput(PADS_DATA_P_XL_REG, PADS_DATA_P_H_REG);
+	addOutput(PADS_DATA_T_L_REG, PADS_DATA_T_H_REG);
+
+	reset();
+}
+
+void SimPADS::setPressure(const SimWaveform &pressure)
+{
+	pres = pressure;
+}
+
+void SimPADS::setTemperature(const SimWaveform &temperature)
+{
+	temp = temperature;
+}
+
+void SimPADS::reset()
+{
+	SimDevice::reset();
+	timer.stop();
+	presDataReady = false;
+	tempDataReady = false;
+	presOverrun = false;
+	tempOverrun = false;
+	conversionPending = false;
+	conversionDoneNs = 0;
+	fifoHead = 0;
+	fifoCount = 0;
+	fifoOverrun = false;
+}
+
+void SimPADS::defaults()
+{
+	regs[PADS_DEVICE_ID_REG] = PADS_DEVICE_ID_VALUE;
+	regs[PADS_CTRL_2_REG] = 0x10;	/* IF_ADD_INC */
+}
+
+double SimPADS::outputDataRate() const
+{
+	return odrTable[(regs[PADS_CTRL_1_REG] >> 4) & 0x07];
+}
+
+bool SimPADS::autoIncrement() const
+{
+	return 0 != (regs[PADS_CTRL_2_REG] & 0x10);
+}
+
+bool SimPADS::blockDataUpdate() const
+{
+	return 0 != (regs[PADS_CTRL_1_REG] & 0x02);
+}
+
+bool SimPADS::fifoActive() const
+{
+	uint8_t mode = regs[PADS_FIFO_CTRL_REG] & 0x07;
+
+	/* no trigger events are simulated: bypass-to-* stays in bypass,
+	 * continuous-to-FIFO stays continuous */
+	return (PADS_fifoModes == mode) || (PADS_ContinuousMode == (mode & 0x06)) || (PADS_continuousToFifo == mode);
+}
+
+/**
+ * @brief  Number of samples the FIFO can hold, the watermark if STOP_ON_WTM is set
+ */
+
+int SimPADS::fifoLimit() const
+{
+	uint8_t wtm = regs[PADS_FIFO_WTM_REG] & 0x7F;
+
+	if ((regs[PADS_FIFO_CTRL_REG] & 0x08) && (0 != wtm))
+	{
+		return wtm;
+	}
+	return fifoDepth;
+}
+
+/**
+ * @brief  Register address following reg, the FIFO output registers wrap around
+ */
+
+uint8_t SimPADS::nextRegister(uint8_t reg) const
+{
+	if (PADS_FIFO_DATA_T_H_REG == reg)
+	{
+		return PADS_FIFO_DATA_P_XL_REG;
+	}
+	return (uint8_t)(reg + 1);
+}
+
+void SimPADS::configure(uint64_t nowNs)
+{
+	timer.start(nowNs, outputDataRate());
+}
+
+/**
+ * @brief  Take one sample: code the waveforms and publish them in the output registers / FIFO
+ * @param  Sample time in ns
+ */
+
+void SimPADS::sample(uint64_t tNs)
+{
+	double t = (double)tNs * 1e-9;
+	int32_t rawPres = SimSaturate(pres.at(t) * 40960.0, -8388608, 8388607);
+	int16_t rawTemp = (int16_t)SimSaturate(temp.at(t) * 100.0, -32768, 32767);
+	uint8_t data[5];
+
+	data[0] = (uint8_t)(rawPres & 0xFF);
+	data[1] = (uint8_t)((rawPres >> 8) & 0xFF);
+	data[2] = (uint8_t)((rawPres >> 16) & 0xFF);
+	data[3] = (uint8_t)((uint16_t)rawTemp & 0xFF);
+	data[4] = (uint8_t)((uint16_t)rawTemp >> 8);
+
+	setOutput(PADS_DATA_P_XL_REG, &data[0]);
+	setOutput(PADS_DATA_T_L_REG, &data[3]);
+
+	presOverrun = presOverrun || presDataReady;
+	tempOverrun = tempOverrun || tempDataReady;
+	presDataReady = true;
+	tempDataReady = true;
+
+	if (fifoActive())
+	{
+		uint8_t mode = regs[PADS_FIFO_CTRL_REG] & 0x07;
+
+		if (fifoCount >= fifoLimit())
+		{
+			if ((PADS_fifoModes == mode) || (fifoLimit() < fifoDepth))
+			{
+				/* FIFO mode and STOP_ON_WTM stop collecting when full */
+				fifoOverrun = true;
+				return;
+			}
+			fifoHead = (fifoHead + 1) % fifoDepth;
+			fifoCount--;
+			fifoOverrun = true;
+		}
+		memcpy(fifo[(fifoHead + fifoCount) % fifoDepth], data, 5);
+		fifoCount++;
+		memcpy(&regs[PADS_FIFO_DATA_P_XL_REG], fifo[fifoHead], 5);
+	}
+}
+
+void SimPADS::update(uint64_t nowNs)
+{
+	uint64_t tNs;
+
+	if (conversionPending && (nowNs >= conversionDoneNs))
+	{
+		conversionPending = false;
+		regs[PADS_CTRL_2_REG] &= (uint8_t)~0x01;	/* ONE_SHOT self-clears */
+		sample(conversionDoneNs);
+	}
+
+	if (timer.catchUp(nowNs, fifoDepth + 1) && fifoActive())
+	{
+		fifoOverrun = true;
+	}
+	while (timer.tick(nowNs, &tNs))
+	{
+		sample(tNs);
+	}
+}
+
+uint8_t SimPADS::readRegister(uint8_t reg)
+{
+	uint8_t value;
+	uint8_t wtm;
+
+	switch (reg)
+	{
+	case PADS_STATUS_REG:
+		return (uint8_t)((presDataReady ? 0x01 : 0x00) | (tempDataReady ? 0x02 : 0x00) |
+				(presOverrun ? 0x10 : 0x00) | (tempOverrun ? 0x20 : 0x00));
+
+	case PADS_FIFO_STATUS1_REG:
+		return (uint8_t)fifoCount;
+
+	case PADS_FIFO_STATUS2_REG:
+		wtm = regs[PADS_FIFO_WTM_REG] & 0x7F;
+		return (uint8_t)((((0 != wtm) && (fifoCount >= wtm)) ? 0x80 : 0x00) |
+				(fifoOverrun ? 0x40 : 0x00) | ((fifoCount >= fifoLimit()) ? 0x20 : 0x00));
+
+	case PADS_DATA_P_H_REG:
+		presDataReady = false;
+		presOverrun = false;
+		return SimDevice::readRegister(reg);
+
+	case PADS_DATA_T_H_REG:
+		tempDataReady = false;
+		tempOverrun = false;
+		return SimDevice::readRegister(reg);
+
+	case PADS_FIFO_DATA_T_H_REG:
+		value = regs[reg];
+		if (fifoCount > 0)
+		{
+			/* a complete sample has been read, advance the FIFO */
+			fifoHead = (fifoHead + 1) % fifoDepth;
+			fifoCount--;
+			fifoOverrun = false;
+			if (fifoCount > 0)
+			{
+				memcpy(&regs[PADS_FIFO_DATA_P_XL_REG], fifo[fifoHead], 5);
+			}
+		}
+		return value;
+
+	default:
+		return SimDevice::readRegister(reg);
+	}
+}
+
+void SimPADS::writeRegister(uint8_t reg, uint8_t value)
+{
+	uint64_t nowNs = SimClock::nowNs();
+	uint8_t oldMode;
+
+	switch (reg)
+	{
+	case PADS_CTRL_1_REG:
+		regs[reg] = value;
+		configure(nowNs);
+		break;
+
+	case PADS_CTRL_2_REG:
+		if (value & 0x04)
+		{
+			/* SWRESET, self-clearing */
+			reset();
+			break;
+		}
+		regs[reg] = (uint8_t)(value & 0x7F);	/* BOOT self-clears immediately */
+		if ((value & 0x01) && (0 == outputDataRate()) && !conversionPending)
+		{
+			conversionPending = true;
+			conversionDoneNs = nowNs + ((value & 0x02) ? PADS_CONVERSION_TIME_LN_NS : PADS_CONVERSION_TIME_LP_NS);
+		}
+		break;
+
+	case PADS_FIFO_CTRL_REG:
+		oldMode = regs[reg] & 0x07;
+		regs[reg] = value;
+		if ((PADS_bypassMode == (value & 0x07)) || (oldMode != (value & 0x07)))
+		{
+			/* bypass empties the FIFO, a mode change restarts collection */
+			fifoHead = 0;
+			fifoCount = 0;
+			fifoOverrun = false;
+		}
+		break;
+
+	default:
+		SimDevice::writeRegister(reg, value);
+		break;
+	}
+}
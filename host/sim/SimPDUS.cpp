@@ -0,0 +1,104 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "SimSensors.h"
+
+#include "WSEN_PDUS.h"
+
+/* Pressure transfer function per sensor type: kPa = (raw - P_MIN_VAL_PDUS) * scale + offset */
+static const double presScale[5] = { 7.63e-6, 7.63e-5, 7.63e-4, 3.815e-3, 4.196e-2 };
+static const double presOffset[5] = { -0.1, -1.0, -10.0, 0.0, -100.0 };
+
+SimPDUS::SimPDUS(uint8_t address, int type)
+	: SimDevice(address), pdusType(type)
+{
+	if ((pdusType < pdus0) || (pdusType > pdus4))
+	{
+		pdusType = pdus0;
+	}
+	pres = SimWaveform::constant((pdus3 == pdusType) ? 50.0 : 0.0);
+	temp = SimWaveform::constant(25.0);
+
+	reset();
+}
+
+void SimPDUS::setPressure(const SimWaveform &pressure)
+{
+	pres = pressure;
+}
+
+void SimPDUS::setTemperature(const SimWaveform &temperature)
+{
+	temp = temperature;
+}
+
+void SimPDUS::defaults()
+{
+}
+
+/**
+ * @brief  Sample the waveforms into the output frame
+ * @param  Current time in ns
+ */
+
+void SimPDUS::update(uint64_t nowNs)
+{
+	double t = (double)nowNs * 1e-9;
+	double rawPres = (pres.at(t) - presOffset[pdusType]) / presScale[pdusType] + P_MIN_VAL_PDUS;
+	double rawTemp = temp.at(t) * 1000.0 / 4.272 + T_MIN_VAL_PDUS;
+	uint16_t p = (uint16_t)SimSaturate(rawPres, 0, 0x7FFF);
+	uint16_t tc = (uint16_t)SimSaturate(rawTemp, 0, 0x7FFF);
+
+	frame[0] = (uint8_t)(p >> 8);
+	frame[1] = (uint8_t)(p & 0xFF);
+	frame[2] = (uint8_t)(tc >> 8);
+	frame[3] = (uint8_t)(tc & 0xFF);
+}
+
+/**
+ * @brief  The sensor has no registers, writes are not acknowledged
+ */
+
+bool SimPDUS::i2cWrite(const uint8_t *data, int count)
+{
+	(void)data;
+	(void)count;
+	return false;
+}
+
+/**
+ * @brief  Every read returns the current frame, bytes beyond it read as 0xFF
+ */
+
+bool SimPDUS::i2cRead(uint8_t *data, int count)
+{
+	update(SimClock::nowNs());
+
+	for (int i = 0; i < count; i++)
+	{
+		data[i] = (i < 4) ? frame[i] : 0xFF;
+	}
+	return true;
+}
@@ -0,0 +1,326 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#ifndef SIMSENSORS_H
+#define SIMSENSORS_H
+
+/**         Includes         **/
+
+#include "SimBus.h"
+
+/**
+ * Register models of the WE sensors. Only the behaviour the drivers can
+ * observe is modelled: register map and reset values, auto-increment and
+ * address wrap-around, block data update, data-ready flags, ODR and
+ * conversion timing, FIFOs and the output data coding. Filters, self-test
+ * and the embedded event engines are not modelled, their registers are
+ * plain storage.
+ */
+
+/**
+ * @brief WSEN-ITDS acceleration sensor (registers 0x0D - 0x3F)
+ *
+ * Acceleration in mg, temperature in °C.
+ */
+class SimITDS : public SimDevice
+{
+public:
+	explicit SimITDS(uint8_t address);
+
+	void setAcceleration(const SimWaveform &x, const SimWaveform &y, const SimWaveform &z);
+	void setTemperature(const SimWaveform &temperature);
+
+	/* Rising edge on INT_1, starts a single conversion if triggered by pin */
+	void triggerSingleConversion();
+
+	/* Interrupt event routed to INT_0, switches continuous-to-FIFO to FIFO mode and
+	 * bypass-to-continuous to continuous mode */
+	void triggerEvent();
+
+	/* Current output data rate in Hz, 0 if not sampling */
+	double outputDataRate() const;
+
+	void reset();
+
+protected:
+	void defaults();
+	void update(uint64_t nowNs);
+	uint8_t readRegister(uint8_t reg);
+	void writeRegister(uint8_t reg, uint8_t value);
+	bool autoIncrement() const;
+	bool blockDataUpdate() const;
+	uint8_t nextRegister(uint8_t reg) const;
+
+private:
+	enum { fifoDepth = 32 };
+
+	void configure(uint64_t nowNs);
+	void sample(uint64_t tNs);
+	uint8_t fifoMode() const;
+	bool fifoActive() const;
+	uint8_t fifoThreshold() const;
+
+	SimWaveform acc[3];
+	SimWaveform temp;
+	SimTimer timer;
+	bool dataReady;
+	bool tempDataReady;
+	bool conversionPending;
+	uint64_t conversionDoneNs;
+
+	uint8_t fifo[fifoDepth][6];
+	int fifoHead;
+	int fifoCount;
+	bool fifoOverrun;
+	bool fifoTriggered;
+	bool fifoStopped;
+};
+
+/**
+ * @brief WSEN-ISDS 6-axis IMU (registers 0x00 - 0x75)
+ *
+ * Acceleration in mg, angular rate in mdps, temperature in °C. The FIFO
+ * stores the gyroscope, accelerometer, (empty) third and timestamp data
+ * sets with their decimation factors and reports the pattern index.
+ */
+class SimISDS : public SimDevice
+{
+public:
+	explicit SimISDS(uint8_t address);
+
+	void setAcceleration(const SimWaveform &x, const SimWaveform &y, const SimWaveform &z);
+	void setAngularRate(const SimWaveform &x, const SimWaveform &y, const SimWaveform &z);
+	void setTemperature(const SimWaveform &temperature);
+
+	double accOutputDataRate() const;
+	double gyroOutputDataRate() const;
+	double fifoOutputDataRate() const;
+
+	void reset();
+
+protected:
+	void defaults();
+	void update(uint64_t nowNs);
+	uint8_t readRegister(uint8_t reg);
+	void writeRegister(uint8_t reg, uint8_t value);
+	bool autoIncrement() const;
+	bool blockDataUpdate() const;
+	uint8_t nextRegister(uint8_t reg) const;
+
+private:
+	enum { fifoWords = 2046 };
+
+	void sampleAcc(uint64_t tNs);
+	void sampleGyro(uint64_t tNs);
+	void sampleTemp(uint64_t tNs);
+	void fifoWrite(uint64_t tNs);
+	void fifoReset();
+	void fifoPush(const int16_t *words, uint16_t pattern);
+	int fifoCapacity() const;
+	int16_t accRaw(int axis, uint64_t tNs) const;
+	int16_t gyroRaw(int axis, uint64_t tNs) const;
+	int16_t tempRaw(uint64_t tNs) const;
+	uint32_t timestamp(uint64_t nowNs) const;
+
+	SimWaveform acc[3];
+	SimWaveform gyro[3];
+	SimWaveform temp;
+	SimTimer accTimer;
+	SimTimer gyroTimer;
+	SimTimer fifoTimer;
+	bool accDataReady;
+	bool gyroDataReady;
+	bool tempDataReady;
+	uint64_t timestampStartNs;
+
+	struct FifoWord
+	{
+		uint16_t word;
+		uint16_t pattern;
+	};
+
+	FifoWord fifo[fifoWords];
+	int fifoHead;
+	int fifoCount;
+	bool fifoOverrun;
+	uint32_t fifoCycle;
+	uint16_t fifoPatternLength;
+	uint16_t fifoPatternWord;
+};
+
+/**
+ * @brief WSEN-PADS absolute pressure sensor (registers 0x0B - 0x2C, FIFO 0x78 - 0x7C)
+ *
+ * Pressure in kPa, temperature in °C.
+ */
+class SimPADS : public SimDevice
+{
+public:
+	explicit SimPADS(uint8_t address);
+
+	void setPressure(const SimWaveform &pressure);
+	void setTemperature(const SimWaveform &temperature);
+
+	double outputDataRate() const;
+
+	void reset();
+
+protected:
+	void defaults();
+	void update(uint64_t nowNs);
+	uint8_t readRegister(uint8_t reg);
+	void writeRegister(uint8_t reg, uint8_t value);
+	bool autoIncrement() const;
+	bool blockDataUpdate() const;
+	uint8_t nextRegister(uint8_t reg) const;
+
+private:
+	enum { fifoDepth = 128 };
+
+	void configure(uint64_t nowNs);
+	void sample(uint64_t tNs);
+	bool fifoActive() const;
+	int fifoLimit() const;
+
+	SimWaveform pres;
+	SimWaveform temp;
+	SimTimer timer;
+	bool presDataReady;
+	bool tempDataReady;
+	bool presOverrun;
+	bool tempOverrun;
+	bool conversionPending;
+	uint64_t conversionDoneNs;
+
+	uint8_t fifo[fifoDepth][5];
+	int fifoHead;
+	int fifoCount;
+	bool fifoOverrun;
+};
+
+/**
+ * @brief WSEN-HIDS humidity sensor (registers 0x0F - 0x2B, calibration 0x30 - 0x3F)
+ *
+ * Relative humidity in %RH, temperature in °C. Outputs are coded with the
+ * calibration block, multi-byte accesses need bit 7 of the sub-address set.
+ */
+class SimHIDS : public SimDevice
+{
+public:
+	explicit SimHIDS(uint8_t address);
+
+	void setHumidity(const SimWaveform &humidity);
+	void setTemperature(const SimWaveform &temperature);
+
+	double outputDataRate() const;
+
+	void reset();
+
+protected:
+	void defaults();
+	void update(uint64_t nowNs);
+	uint8_t readRegister(uint8_t reg);
+	void writeRegister(uint8_t reg, uint8_t value);
+	bool blockDataUpdate() const;
+	uint8_t selectRegister(uint8_t subAddress);
+
+private:
+	void configure(uint64_t nowNs);
+	void sample(uint64_t tNs);
+
+	SimWaveform hum;
+	SimWaveform temp;
+	SimTimer timer;
+	bool humDataReady;
+	bool tempDataReady;
+	bool conversionPending;
+	uint64_t conversionDoneNs;
+};
+
+/**
+ * @brief WSEN-TIDS temperature sensor (registers 0x01 - 0x0C)
+ *
+ * Temperature in °C.
+ */
+class SimTIDS : public SimDevice
+{
+public:
+	explicit SimTIDS(uint8_t address);
+
+	void setTemperature(const SimWaveform &temperature);
+
+	double outputDataRate() const;
+
+	void reset();
+
+protected:
+	void defaults();
+	void update(uint64_t nowNs);
+	uint8_t readRegister(uint8_t reg);
+	void writeRegister(uint8_t reg, uint8_t value);
+	bool autoIncrement() const;
+	bool blockDataUpdate() const;
+
+private:
+	void configure(uint64_t nowNs);
+	void sample(uint64_t tNs);
+
+	SimWaveform temp;
+	SimTimer timer;
+	bool conversionPending;
+	uint64_t conversionDoneNs;
+	bool overHighLimit;
+	bool underLowLimit;
+};
+
+/**
+ * @brief WSEN-PDUS differential pressure sensor
+ *
+ * Register-less: every read returns the 4-byte pressure/temperature frame.
+ * Pressure in kPa (coded for the given PDUS type), temperature in °C.
+ */
+class SimPDUS : public SimDevice
+{
+public:
+	SimPDUS(uint8_t address, int type);
+
+	void setPressure(const SimWaveform &pressure);
+	void setTemperature(const SimWaveform &temperature);
+
+	bool i2cWrite(const uint8_t *data, int count);
+	bool i2cRead(uint8_t *data, int count);
+
+protected:
+	void defaults();
+	void update(uint64_t nowNs);
+
+private:
+	int pdusType;
+	SimWaveform pres;
+	SimWaveform temp;
+	uint8_t frame[4];
+};
+
+#endif /* SIMSENSORS_H */
@@ -0,0 +1,193 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "SimSensors.h"
+
+#include "WSEN_TIDS_2521020222501.h"
+
+#define TIDS_CONVERSION_TIME_NS (uint64_t)4000000	/* one-shot conversion */
+
+/* AVG[1:0] in Hz, see TIDS_output_data_rate_t */
+static const double odrTable[4] = { 25, 50, 100, 200 };
+
+/* Temperature of a limit register value, 0 disables the limit */
+static double LimitToCelsius(uint8_t limit)
+{
+	return ((double)limit - 63.0) * 0.64;
+}
+
+SimTIDS::SimTIDS(uint8_t address)
+	: SimDevice(address)
+{
+	temp = SimWaveform::constant(25.0);
+
+	setReadOnly(TIDS_DEVICE_ID_REG, TIDS_DEVICE_ID_REG);
+	setReadOnly(TIDS_STATUS_REG, TIDS_DATA_T_H_REG);
+
+	addOutput(TIDS_DATA_T_L_REG, TIDS_DATA_T_H_REG);
+
+	reset();
+}
+
+void SimTIDS::setTemperature(const SimWaveform &temperature)
+{
+	temp = temperature;
+}
+
+void SimTIDS::reset()
+{
+	SimDevice::reset();
+	timer.stop();
+	conversionPending = false;
+	conversionDoneNs = 0;
+	overHighLimit = false;
+	underLowLimit = false;
+}
+
+void SimTIDS::defaults()
+{
+	regs[TIDS_DEVICE_ID_REG] = TIDS_DEVICE_ID_VALUE;
+	regs[TIDS_CTRL_REG] = 0x08;	/* IF_ADD_INC */
+}
+
+/**
+ * @brief  Current output data rate, 0 if not in free-run mode
+ */
+
+double SimTIDS::outputDataRate() const
+{
+	uint8_t ctrl = regs[TIDS_CTRL_REG];
+
+	if (0 == (ctrl & 0x04))
+	{
+		return 0;
+	}
+	return odrTable[(ctrl >> 4) & 0x03];
+}
+
+bool SimTIDS::autoIncrement() const
+{
+	return 0 != (regs[TIDS_CTRL_REG] & 0x08);
+}
+
+bool SimTIDS::blockDataUpdate() const
+{
+	return 0 != (regs[TIDS_CTRL_REG] & 0x40);
+}
+
+void SimTIDS::configure(uint64_t nowNs)
+{
+	timer.start(nowNs, outputDataRate());
+}
+
+/**
+ * @brief  Take one sample and check it against the limits
+ * @param  Sample time in ns
+ */
+
+void SimTIDS::sample(uint64_t tNs)
+{
+	double celsius = temp.at((double)tNs * 1e-9);
+	uint8_t highLimit = regs[TIDS_LIMIT_T_H_REG];
+	uint8_t lowLimit = regs[TIDS_LIMIT_T_L_REG];
+
+	setOutput16(TIDS_DATA_T_L_REG, (int16_t)SimSaturate(celsius * 100.0, -32768, 32767));
+
+	if ((0 != highLimit) && (celsius > LimitToCelsius(highLimit)))
+	{
+		overHighLimit = true;
+	}
+	if ((0 != lowLimit) && (celsius < LimitToCelsius(lowLimit)))
+	{
+		underLowLimit = true;
+	}
+}
+
+void SimTIDS::update(uint64_t nowNs)
+{
+	uint64_t tNs;
+
+	if (conversionPending && (nowNs >= conversionDoneNs))
+	{
+		conversionPending = false;
+		regs[TIDS_CTRL_REG] &= (uint8_t)~0x01;	/* ONE_SHOT self-clears */
+		sample(conversionDoneNs);
+	}
+
+	timer.catchUp(nowNs, 1);
+	while (timer.tick(nowNs, &tNs))
+	{
+		sample(tNs);
+	}
+}
+
+uint8_t SimTIDS::readRegister(uint8_t reg)
+{
+	uint8_t value;
+
+	switch (reg)
+	{
+	case TIDS_STATUS_REG:
+		/* limit flags are cleared on read */
+		value = (uint8_t)((conversionPending ? 0x01 : 0x00) | (overHighLimit ? 0x02 : 0x00) | (underLowLimit ? 0x04 : 0x00));
+		overHighLimit = false;
+		underLowLimit = false;
+		return value;
+
+	default:
+		return SimDevice::readRegister(reg);
+	}
+}
+
+void SimTIDS::writeRegister(uint8_t reg, uint8_t value)
+{
+	uint64_t nowNs = SimClock::nowNs();
+
+	switch (reg)
+	{
+	case TIDS_CTRL_REG:
+		regs[reg] = value;
+		configure(nowNs);
+		if ((value & 0x01) && (0 == (value & 0x04)) && !conversionPending)
+		{
+			conversionPending = true;
+			conversionDoneNs = nowNs + TIDS_CONVERSION_TIME_NS;
+		}
+		break;
+
+	case TIDS_SOFT_RESET_REG:
+		if (value & 0x02)
+		{
+			/* SOFT_RESET, the digital block is held in reset while the bit is set */
+			reset();
+		}
+		regs[reg] = value;
+		break;
+
+	default:
+		SimDevice::writeRegister(reg, value);
+		break;
+	}
+}
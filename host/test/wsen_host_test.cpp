@@ -0,0 +1,1146 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE Sensors SDK:
+ * https://www.we-online.com/sensors
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2023 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+/**
+ * Host tests of the sensor libraries on the simulated bus.
+ *
+ * Each test drives a sensor class or driver against the register models in
+ * host/sim and checks the register contents, the bus traffic and the values
+ * returned. Each test runs its own simulated devices on its own bus.
+ *
+ * Usage: wsen_host_test, exits non-zero if a check fails
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "SimSensors.h"
+
+#include "AsyncPlatform.h"
+#include "WSEN_HIDS.h"
+#include "WSEN_ISDS.h"
+#include "WSEN_ISDS_Fusion.h"
+#include "WSEN_ITDS.h"
+#include "WSEN_PADS.h"
+#include "WSEN_TIDS.h"
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do \
+	{ \
+		if (!(condition)) \
+		{ \
+			printf("  FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+			failures++; \
+		} \
+	} while (0)
+
+#define CHECK_NEAR(value, expected, tolerance) \
+	CHECK(fabs((double)(value) - (double)(expected)) <= (double)(tolerance))
+
+/* Sensor interface of a driver without a sensor class */
+static void InitInterface(WE_sensorInterface_t *sensorInterface, SimBus *bus, uint8_t address)
+{
+	memset(sensorInterface, 0, sizeof(*sensorInterface));
+	sensorInterface->handle = bus;
+	sensorInterface->transport = &WE_simTransport;
+	I2CInit(sensorInterface, address);
+}
+
+/* ITDS at 200 Hz in high performance mode */
+static void StartItds(SimBus &bus, SimITDS &device, Sensor_ITDS &itds)
+{
+	bus.attach(&device);
+	device.setAcceleration(SimWaveform::constant(100), SimWaveform::constant(-250), SimWaveform::constant(1000));
+	CHECK(WE_SUCCESS == itds.init(ITDS_ADDRESS_I2C_1, &bus, &WE_simTransport));
+	itds.ODR = 6;
+	CHECK(WE_SUCCESS == itds.set_High_Performance());
+	delay(20);
+}
+
+/* Device IDs and readings of the sensor classes on one bus */
+static void TestSensors()
+{
+	SimBus bus;
+	SimITDS itdsDevice(ITDS_ADDRESS_I2C_1);
+	SimISDS isdsDevice(ISDS_ADDRESS_I2C_1);
+	SimHIDS hidsDevice(HIDS_ADDRESS_I2C_0);
+	SimTIDS tidsDevice(TIDS_ADDRESS_I2C_0);
+	SimPADS padsDevice(PADS_ADDRESS_I2C_1);
+	Sensor_ITDS itds;
+	Sensor_ISDS isds;
+	Sensor_HIDS hids;
+	Sensor_TIDS tids;
+	Sensor_PADS pads;
+	float x, y, z;
+	int16_t acc[3];
+	int32_t rate[3];
+	float temperature;
+	float pressure;
+
+	bus.attach(&itdsDevice);
+	bus.attach(&isdsDevice);
+	bus.attach(&hidsDevice);
+	bus.attach(&tidsDevice);
+	bus.attach(&padsDevice);
+
+	CHECK(WE_SUCCESS == itds.init(ITDS_ADDRESS_I2C_1, &bus, &WE_simTransport));
+	CHECK(WE_SUCCESS == isds.init(ISDS_ADDRESS_I2C_1, &bus, &WE_simTransport));
+	CHECK(WE_SUCCESS == hids.init(HIDS_ADDRESS_I2C_0, &bus, &WE_simTransport));
+	CHECK(WE_SUCCESS == tids.init(TIDS_ADDRESS_I2C_0, &bus, &WE_simTransport));
+	CHECK(WE_SUCCESS == pads.init(PADS_ADDRESS_I2C_1, &bus, &WE_simTransport));
+	CHECK(ITDS_DEVICE_ID_VALUE == itds.get_DeviceID());
+	CHECK(ISDS_DEVICE_ID_VALUE == isds.get_DeviceID());
+	CHECK(HIDS_DEVICE_ID_VALUE == hids.get_DeviceID());
+	CHECK(TIDS_DEVICE_ID_VALUE == tids.get_DeviceID());
+	CHECK(PADS_DEVICE_ID_VALUE == pads.get_DeviceID());
+
+	itdsDevice.setAcceleration(SimWaveform::constant(100), SimWaveform::constant(-250), SimWaveform::constant(1000));
+	itds.ODR = 6;
+	CHECK(WE_SUCCESS == itds.set_High_Performance());
+	delay(20);
+	CHECK(1 == itds.is_Ready_To_Read());
+	CHECK(WE_SUCCESS == itds.get_acceleration_X(&x));
+	CHECK(WE_SUCCESS == itds.get_acceleration_Y(&y));
+	CHECK(WE_SUCCESS == itds.get_acceleration_Z(&z));
+	CHECK_NEAR(x, 100, 1);
+	CHECK_NEAR(y, -250, 1);
+	CHECK_NEAR(z, 1000, 1);
+
+	isdsDevice.setAcceleration(SimWaveform::constant(10), SimWaveform::constant(20), SimWaveform::constant(-980));
+	isdsDevice.setAngularRate(SimWaveform::constant(1000), SimWaveform::constant(-5000), SimWaveform::constant(0));
+	isdsDevice.setTemperature(SimWaveform::constant(27.5));
+	CHECK(WE_SUCCESS == isds.set_Mode(2));
+	delay(50);
+	CHECK(WE_SUCCESS == isds.get_accelerations(&acc[0], &acc[1], &acc[2]));
+	CHECK(WE_SUCCESS == isds.get_angular_rates(&rate[0], &rate[1], &rate[2]));
+	CHECK(WE_SUCCESS == isds.get_temperature(&temperature));
+	CHECK_NEAR(acc[2], -980, 1);
+	/* 70 mdps per LSB at 2000 dps */
+	CHECK_NEAR(rate[1], -5000, 70);
+	CHECK_NEAR(temperature, 27.5, 0.01);
+
+	tidsDevice.setTemperature(SimWaveform::constant(23.45));
+	CHECK(WE_SUCCESS == tids.set_continuous_mode(25));
+	delay(100);
+	CHECK(WE_SUCCESS == tids.read_temperature(&temperature));
+	CHECK_NEAR(temperature, 23.45, 0.01);
+
+	padsDevice.setPressure(SimWaveform::constant(98.7));
+	padsDevice.setTemperature(SimWaveform::constant(19.5));
+	CHECK(WE_SUCCESS == pads.oneshot());
+	CHECK(WE_SUCCESS == pads.read_pressure(&pressure));
+	CHECK(WE_SUCCESS == pads.read_temperature(&temperature));
+	CHECK_NEAR(pressure, 98.7, 0.001);
+	CHECK_NEAR(temperature, 19.5, 0.01);
+}
+
+/* Two ISDS parts with different full scales convert their own samples */
+static void TestFullScales()
+{
+	SimBus bus;
+	SimISDS deviceA(ISDS_ADDRESS_I2C_0);
+	SimISDS deviceB(ISDS_ADDRESS_I2C_1);
+	WE_sensorInterface_t sensorA;
+	WE_sensorInterface_t sensorB;
+	int16_t accA[3], accB[3];
+	int32_t rateA[3], rateB[3];
+
+	bus.attach(&deviceA);
+	bus.attach(&deviceB);
+	deviceA.setAcceleration(SimWaveform::constant(10), SimWaveform::constant(20), SimWaveform::constant(-980));
+	deviceA.setAngularRate(SimWaveform::constant(1000), SimWaveform::constant(-5000), SimWaveform::constant(0));
+	deviceB.setAcceleration(SimWaveform::constant(10), SimWaveform::constant(20), SimWaveform::constant(-980));
+	deviceB.setAngularRate(SimWaveform::constant(1000), SimWaveform::constant(-5000), SimWaveform::constant(0));
+	InitInterface(&sensorA, &bus, ISDS_ADDRESS_I2C_0);
+	InitInterface(&sensorB, &bus, ISDS_ADDRESS_I2C_1);
+
+	CHECK(WE_SUCCESS == ISDS_setAccOutputDataRate(&sensorA, ISDS_accOdr104Hz));
+	CHECK(WE_SUCCESS == ISDS_setGyroOutputDataRate(&sensorA, ISDS_gyroOdr104Hz));
+	CHECK(WE_SUCCESS == ISDS_setAccOutputDataRate(&sensorB, ISDS_accOdr104Hz));
+	CHECK(WE_SUCCESS == ISDS_setGyroOutputDataRate(&sensorB, ISDS_gyroOdr104Hz));
+	CHECK(WE_SUCCESS == ISDS_setAccFullScale(&sensorA, ISDS_accFullScaleSixteenG));
+	CHECK(WE_SUCCESS == ISDS_setGyroFullScale(&sensorA, ISDS_gyroFullScale2000dps));
+	CHECK(WE_SUCCESS == ISDS_setAccFullScale(&sensorB, ISDS_accFullScaleTwoG));
+	CHECK(WE_SUCCESS == ISDS_setGyroFullScale(&sensorB, ISDS_gyroFullScale250dps));
+	delay(100);
+
+	CHECK(WE_SUCCESS == ISDS_getAccelerations_int(&sensorA, &accA[0], &accA[1], &accA[2]));
+	CHECK(WE_SUCCESS == ISDS_getAngularRates_int(&sensorA, &rateA[0], &rateA[1], &rateA[2]));
+	CHECK(WE_SUCCESS == ISDS_getAccelerations_int(&sensorB, &accB[0], &accB[1], &accB[2]));
+	CHECK(WE_SUCCESS == ISDS_getAngularRates_int(&sensorB, &rateB[0], &rateB[1], &rateB[2]));
+	CHECK_NEAR(accA[2], -980, 2);
+	CHECK_NEAR(accB[2], -980, 2);
+	CHECK_NEAR(rateA[1], -5000, 80);
+	CHECK_NEAR(rateB[1], -5000, 10);
+}
+
+/* The four output bytes of HIDS_getRAWValues() come from four registers */
+static void TestHidsRawValues()
+{
+	SimBus bus;
+	SimHIDS device(HIDS_ADDRESS_I2C_0);
+	Sensor_HIDS hids;
+	WE_sensorInterface_t sensorInterface;
+	int16_t rawHumidity = 0;
+	int16_t rawTemperature = 0;
+
+	bus.attach(&device);
+	device.setHumidity(SimWaveform::constant(42.5));
+	device.setTemperature(SimWaveform::constant(22.25));
+	CHECK(WE_SUCCESS == hids.init(HIDS_ADDRESS_I2C_0, &bus, &WE_simTransport));
+	CHECK(WE_SUCCESS == hids.set_continuous_mode(3));
+	delay(200);
+
+	InitInterface(&sensorInterface, &bus, HIDS_ADDRESS_I2C_0);
+	CHECK(WE_SUCCESS == HIDS_getRAWValues(&sensorInterface, &rawHumidity, &rawTemperature));
+	CHECK(500 == rawHumidity);
+	CHECK(144 == rawTemperature);
+}
+
+static WE_asyncRequest_t *asyncCompleted[2 * WE_ASYNC_QUEUE_LENGTH];
+static int asyncCompletedCount;
+
+static void AsyncDone(WE_asyncRequest_t *request)
+{
+	asyncCompleted[asyncCompletedCount++] = request;
+}
+
+/* Queues the request passed as context from within WE_asyncPoll() */
+static void AsyncQueueNext(WE_asyncRequest_t *request)
+{
+	AsyncDone(request);
+	CHECK(WE_SUCCESS == WE_asyncSubmit((WE_asyncRequest_t *)request->context));
+}
+
+/* Queued requests on the blocking path of the async engine */
+static void TestAsync()
+{
+	SimBus bus;
+	SimITDS device(ITDS_ADDRESS_I2C_1);
+	Sensor_ITDS itds;
+	WE_sensorInterface_t absent;
+	WE_asyncRequest_t requests[WE_ASYNC_QUEUE_LENGTH + 1];
+	WE_asyncRequest_t next;
+	uint8_t ids[WE_ASYNC_QUEUE_LENGTH];
+	uint8_t ctrl1 = 0x64;
+	uint8_t value;
+	uint32_t transfers;
+	int polls;
+
+	bus.attach(&device);
+	CHECK(WE_SUCCESS == itds.init(ITDS_ADDRESS_I2C_1, &bus, &WE_simTransport));
+	InitInterface(&absent, &bus, ITDS_ADDRESS_I2C_0);
+	asyncCompletedCount = 0;
+	CHECK(0 == WE_asyncPending());
+	CHECK(0 == WE_asyncPoll());
+
+	/* nothing goes on the bus until polled, a full queue rejects */
+	transfers = bus.statistics().transfers;
+	CHECK(WE_SUCCESS == WE_asyncWriteReg(&requests[0], itds.get_Interface(), ITDS_CTRL_1_REG, 1, &ctrl1, AsyncDone, NULL));
+	for (int i = 1; i < WE_ASYNC_QUEUE_LENGTH; i++)
+	{
+		ids[i] = 0;
+		CHECK(WE_SUCCESS == WE_asyncReadReg(&requests[i], itds.get_Interface(), ITDS_DEVICE_ID_REG, 1, &ids[i], AsyncDone, NULL));
+		CHECK(WE_ASYNC_PENDING == requests[i].status);
+	}
+	CHECK(WE_FAIL == WE_asyncReadReg(&requests[WE_ASYNC_QUEUE_LENGTH], itds.get_Interface(), ITDS_DEVICE_ID_REG, 1, &value, AsyncDone, NULL));
+	CHECK(WE_ASYNC_QUEUE_LENGTH == WE_asyncPending());
+	CHECK(0 == bus.statistics().transfers - transfers);
+
+	/* completed in submission order, status and callback on completion */
+	for (polls = 0; (WE_asyncPending() > 0) && (polls < 100); polls++)
+	{
+		WE_asyncPoll();
+	}
+	CHECK(WE_ASYNC_QUEUE_LENGTH == asyncCompletedCount);
+	for (int i = 0; i < asyncCompletedCount; i++)
+	{
+		CHECK(&requests[i] == asyncCompleted[i]);
+		CHECK(WE_SUCCESS == requests[i].status);
+		CHECK((0 == i) || (ITDS_DEVICE_ID_VALUE == ids[i]));
+	}
+	CHECK(0x64 == device.peek(ITDS_CTRL_1_REG));
+
+	/* a callback re-queues into the slot its request has just left */
+	asyncCompletedCount = 0;
+	CHECK(WE_SUCCESS == WE_asyncReadReg(&requests[0], itds.get_Interface(), ITDS_DEVICE_ID_REG, 1, &ids[0], AsyncQueueNext, &next));
+	for (int i = 1; i < WE_ASYNC_QUEUE_LENGTH; i++)
+	{
+		CHECK(WE_SUCCESS == WE_asyncReadReg(&requests[i], itds.get_Interface(), ITDS_DEVICE_ID_REG, 1, &ids[i], AsyncDone, NULL));
+	}
+	memset(&next, 0, sizeof(next));
+	next.sensorInterface = &absent;
+	next.operation = WE_asyncReadRegister;
+	next.reg = ITDS_DEVICE_ID_REG;
+	next.count = 1;
+	next.data = &value;
+	next.callback = AsyncDone;
+	for (polls = 0; (WE_asyncPending() > 0) && (polls < 100); polls++)
+	{
+		WE_asyncPoll();
+	}
+	CHECK(WE_ASYNC_QUEUE_LENGTH + 1 == asyncCompletedCount);
+	CHECK(&next == asyncCompleted[WE_ASYNC_QUEUE_LENGTH]);
+	/* no device at the address */
+	CHECK(WE_FAIL == next.status);
+}
+
+/* Setters served by the register cache, dropped on a failed write */
+static void TestRegisterCache()
+{
+	SimBus bus;
+	SimITDS device(ITDS_ADDRESS_I2C_1);
+	Sensor_ITDS itds;
+	WE_sensorInterface_t *sensorInterface;
+	uint32_t transfers;
+	uint8_t odr = 0;
+
+	bus.attach(&device);
+	CHECK(WE_SUCCESS == itds.init(ITDS_ADDRESS_I2C_1, &bus, &WE_simTransport));
+	sensorInterface = itds.get_Interface();
+	CHECK(WE_SUCCESS == WE_resyncRegisterCache(sensorInterface));
+
+	/* read-modify-write is one write, reading back is free */
+	transfers = bus.statistics().transfers;
+	CHECK(WE_SUCCESS == ITDS_setOutputDataRate(sensorInterface, ITDS_odr6));
+	CHECK(1 == bus.statistics().transfers - transfers);
+	CHECK(ITDS_odr6 == (device.peek(ITDS_CTRL_1_REG) >> 4));
+	transfers = bus.statistics().transfers;
+	CHECK(WE_SUCCESS == ITDS_getOutputDataRate(sensorInterface, &odr));
+	CHECK(ITDS_odr6 == odr);
+	CHECK(0 == bus.statistics().transfers - transfers);
+
+	/* after a failed write the sensor is read again */
+	device.setPresent(false);
+	CHECK(WE_FAIL == ITDS_setOutputDataRate(sensorInterface, ITDS_odr3));
+	device.setPresent(true);
+	device.poke(ITDS_CTRL_1_REG, (uint8_t)(ITDS_odr3 << 4));
+	transfers = bus.statistics().transfers;
+	CHECK(WE_SUCCESS == ITDS_getOutputDataRate(sensorInterface, &odr));
+	CHECK(ITDS_odr3 == odr);
+	CHECK(1 == bus.statistics().transfers - transfers);
+
+	/* a reset the driver does not see needs a resync */
+	device.poke(ITDS_CTRL_1_REG, 0);
+	CHECK(WE_SUCCESS == ITDS_getOutputDataRate(sensorInterface, &odr));
+	CHECK(ITDS_odr3 == odr);
+	CHECK(WE_SUCCESS == WE_resyncRegisterCache(sensorInterface));
+	CHECK(WE_SUCCESS == ITDS_getOutputDataRate(sensorInterface, &odr));
+	CHECK(0 == odr);
+}
+
+/* Writes collected by a configuration go out as bursts on commit */
+static void TestConfiguration()
+{
+	SimBus bus;
+	SimITDS itdsDevice(ITDS_ADDRESS_I2C_1);
+	SimISDS isdsDevice(ISDS_ADDRESS_I2C_1);
+	Sensor_ITDS itds;
+	Sensor_ISDS isds;
+	WE_sensorInterface_t *sensorInterface;
+	uint32_t transfers;
+	uint8_t odr = 0;
+
+	bus.attach(&itdsDevice);
+	bus.attach(&isdsDevice);
+	CHECK(WE_SUCCESS == itds.init(ITDS_ADDRESS_I2C_1, &bus, &WE_simTransport));
+	sensorInterface = itds.get_Interface();
+	CHECK(WE_SUCCESS == WE_resyncRegisterCache(sensorInterface));
+
+	transfers = bus.statistics().transfers;
+	CHECK(WE_SUCCESS == WE_beginConfiguration(sensorInterface));
+	CHECK(WE_SUCCESS == ITDS_setOutputDataRate(sensorInterface, ITDS_odr6));
+	CHECK(WE_SUCCESS == ITDS_setOperatingMode(sensorInterface, highPerformance));
+	CHECK(WE_SUCCESS == ITDS_setFullScale(sensorInterface, sixteenG));
+	CHECK(0 == bus.statistics().transfers - transfers);
+	CHECK(0 == itdsDevice.peek(ITDS_CTRL_1_REG));
+	CHECK(WE_SUCCESS == WE_commitConfiguration(sensorInterface));
+	/* CTRL_1 ... CTRL_6 in one burst */
+	CHECK(1 == bus.statistics().transfers - transfers);
+	CHECK(0x64 == itdsDevice.peek(ITDS_CTRL_1_REG));
+	CHECK(sixteenG == ((itdsDevice.peek(ITDS_CTRL_6_REG) >> 4) & 0x03));
+
+	/* an aborted configuration leaves the sensor alone */
+	transfers = bus.statistics().transfers;
+	CHECK(WE_SUCCESS == WE_beginConfiguration(sensorInterface));
+	CHECK(WE_SUCCESS == ITDS_setOutputDataRate(sensorInterface, ITDS_odr2));
+	WE_abortConfiguration(sensorInterface);
+	CHECK(0 == bus.statistics().transfers - transfers);
+	CHECK(0x64 == itdsDevice.peek(ITDS_CTRL_1_REG));
+	CHECK(WE_SUCCESS == ITDS_getOutputDataRate(sensorInterface, &odr));
+	CHECK(ITDS_odr6 == odr);
+
+	/* ISDS mode switch: CTRL_1 ... CTRL_3 and CTRL_6 ... CTRL_7 */
+	CHECK(WE_SUCCESS == isds.init(ISDS_ADDRESS_I2C_1, &bus, &WE_simTransport));
+	CHECK(WE_SUCCESS == isds.set_Mode(0));
+	transfers = bus.statistics().transfers;
+	CHECK(WE_SUCCESS == isds.set_Mode(2));
+	CHECK(2 == bus.statistics().transfers - transfers);
+	CHECK(0x54 == isdsDevice.peek(ISDS_CTRL_1_REG));
+	CHECK(0x5C == isdsDevice.peek(ISDS_CTRL_2_REG));
+}
+
+/* Samples drained on watermark interrupts into the stream ring */
+static void TestStreaming()
+{
+	SimBus bus;
+	SimITDS device(ITDS_ADDRESS_I2C_1);
+	Sensor_ITDS itds;
+	static ITDS_streamSample_t ring[64];
+	static ITDS_streamSample_t samples[64];
+	int drained[5];
+	int total = 0;
+	int batch = 0;
+
+	StartItds(bus, device, itds);
+	/* rising X-axis acceleration shows the sample order */
+	device.setAcceleration(SimWaveform::ramp(0, 1000), SimWaveform::constant(-250), SimWaveform::constant(1000));
+
+	CHECK(WE_FAIL == itds.start_Streaming(ring, 48, 16));
+	CHECK(WE_SUCCESS == itds.start_Streaming(ring, 64, 16));
+	CHECK(ITDS_continuousMode == (device.peek(ITDS_FIFO_CTRL_REG) >> 5));
+	CHECK(16 == (device.peek(ITDS_FIFO_CTRL_REG) & 0x1F));
+	CHECK(0 == itds.service_Streaming());
+
+	for (int i = 0; i < 5; i++)
+	{
+		delay(80);
+		itds.watermark_ISR();
+		drained[i] = itds.service_Streaming();
+		CHECK((drained[i] >= 16) && (drained[i] <= 19));
+		total += drained[i];
+	}
+
+	/* a full ring keeps its samples, the newer ones are counted as lost */
+	CHECK(64 == itds.get_Stream_Available());
+	CHECK((uint32_t)(total - 64) == itds.get_Stream_Lost());
+	CHECK(64 == itds.read_Stream(samples, 64));
+	CHECK(0 == itds.get_Stream_Available());
+	CHECK(0 == itds.read_Stream(samples, 64));
+	for (int i = 1; i < 64; i++)
+	{
+		uint32_t interval = samples[i].timestamp - samples[i - 1].timestamp;
+		if (i == drained[batch])
+		{
+			/* the next drain starts from the time of its late watermark interrupt */
+			CHECK(interval >= 5000);
+			drained[batch + 1] += i;
+			batch++;
+		}
+		else
+		{
+			CHECK(5000 == interval);
+		}
+		CHECK(samples[i].raw[0] > samples[i - 1].raw[0]);
+	}
+	CHECK(batch >= 3);
+	/* 1 g at 2 g full scale */
+	CHECK_NEAR(samples[63].raw[2], 16393, 4);
+
+	CHECK(WE_SUCCESS == itds.stop_Streaming());
+	CHECK(ITDS_bypassMode == (device.peek(ITDS_FIFO_CTRL_REG) >> 5));
+}
+
+static void CountEvent(ITDS_event_Type type, const ITDS_events_t *events, void *context)
+{
+	(void)type;
+	(void)events;
+	(*(int *)context)++;
+}
+
+/* Event registers decoded from one read */
+static void TestEvents()
+{
+	SimBus bus;
+	SimITDS device(ITDS_ADDRESS_I2C_1);
+	Sensor_ITDS itds;
+	ITDS_events_t events;
+	uint32_t transfers;
+	int doubleTaps = 0;
+
+	StartItds(bus, device, itds);
+	CHECK(WE_SUCCESS == itds.set_Event_Handler(ITDS_eventDoubleTap, CountEvent, &doubleTaps));
+
+	/* sleeping, X-axis wake-up, positive double-tap on X, 6D position XL */
+	device.poke(ITDS_STATUS_DETECT_REG, 0x00);
+	device.poke(ITDS_WAKE_UP_EVENT_REG, 0x10 | 0x04);
+	device.poke(ITDS_TAP_EVENT_REG, 0x40 | 0x10 | 0x04);
+	device.poke(ITDS_6D_EVENT_REG, 0x40 | 0x01);
+	device.poke(ITDS_ALL_INT_EVENT_REG, 0x10 | 0x08);
+
+	transfers = bus.statistics().transfers;
+	CHECK(((1 << ITDS_eventDoubleTap) | (1 << ITDS_event6D)) == itds.service_Events(&events));
+	CHECK(1 == bus.statistics().transfers - transfers);
+	CHECK(events.sleeping);
+	CHECK(ITDS_AXIS_X == events.wakeUpAxes);
+	CHECK(ITDS_AXIS_X == events.tapAxes);
+	CHECK(!events.tapNegative);
+	CHECK(0x01 == events.position6D);
+	CHECK(1 == doubleTaps);
+
+	device.poke(ITDS_TAP_EVENT_REG, 0x00);
+	device.poke(ITDS_6D_EVENT_REG, 0x00);
+	device.poke(ITDS_ALL_INT_EVENT_REG, 0x00);
+	CHECK(0 == itds.service_Events(&events));
+	CHECK(1 == doubleTaps);
+}
+
+/* Single conversion on demand at the bandwidth of ODR */
+static void TestSingleConversion()
+{
+	SimBus bus;
+	SimITDS device(ITDS_ADDRESS_I2C_1);
+	Sensor_ITDS itds;
+	float x, y, z;
+
+	bus.attach(&device);
+	device.setAcceleration(SimWaveform::constant(100), SimWaveform::constant(-250), SimWaveform::constant(1000));
+	CHECK(WE_SUCCESS == itds.init(ITDS_ADDRESS_I2C_1, &bus, &WE_simTransport));
+
+	/* 12.5 Hz bandwidth without ODR */
+	itds.ODR = 0;
+	CHECK(WE_SUCCESS == itds.set_Single_Conversion(I2C));
+	CHECK(0 == itds.ODR);
+	CHECK(ITDS_odr2 == (device.peek(ITDS_CTRL_1_REG) >> 4));
+	CHECK(WE_SUCCESS == itds.get_Single_Conversion(&x, &y, &z));
+	CHECK_NEAR(x, 100, 1);
+	CHECK_NEAR(z, 1000, 1);
+
+	itds.ODR = 5;
+	CHECK(WE_SUCCESS == itds.set_Single_Conversion(I2C));
+	CHECK(ITDS_odr5 == (device.peek(ITDS_CTRL_1_REG) >> 4));
+
+	/* the external trigger is not waited for */
+	CHECK(WE_SUCCESS == itds.set_Single_Conversion(externalTrigger));
+	uint32_t before = micros();
+	CHECK(WE_FAIL == itds.get_Single_Conversion(&x, &y, &z));
+	CHECK(micros() - before < 1000);
+	device.triggerSingleConversion();
+	delay(ITDS_SINGLE_CONVERSION_MS);
+	CHECK(1 == itds.read_Single_Conversion(&x, &y, &z));
+	CHECK_NEAR(y, -250, 1);
+}
+
+/* Offset calibration into X/Y/Z_OFS_USR */
+static void TestOffsetCalibration()
+{
+	SimBus bus;
+	SimITDS device(ITDS_ADDRESS_I2C_1);
+	Sensor_ITDS itds;
+	ITDS_user_Offset_t offset;
+	ITDS_user_Offset_t readBack;
+	const ITDS_user_Offset_t noOffset = { { 0, 0, 0 }, ITDS_disable };
+	int32_t x, y, z;
+	int fifoMode = -1;
+
+	StartItds(bus, device, itds);
+	device.setAcceleration(SimWaveform::constant(40).withNoise(3), SimWaveform::constant(-25), SimWaveform::constant(1060));
+	delay(20);
+
+	/* 15.6 mg per LSB */
+	CHECK(WE_SUCCESS == itds.calibrate_Offset(&offset));
+	CHECK(ITDS_disable == offset.weight);
+	CHECK((offset.offset[0] >= 39) && (offset.offset[0] <= 43));
+	CHECK(-26 == offset.offset[1]);
+	CHECK(61 == offset.offset[2]);
+	CHECK(offset.offset[0] == (int8_t)device.peek(ITDS_X_OFS_USR_REG));
+	CHECK(offset.offset[1] == (int8_t)device.peek(ITDS_Y_OFS_USR_REG));
+	CHECK(offset.offset[2] == (int8_t)device.peek(ITDS_Z_OFS_USR_REG));
+	CHECK(WE_SUCCESS == itds.get_FIFO_mode(&fifoMode));
+	CHECK(ITDS_bypassMode == fifoMode);
+
+	delay(20);
+	CHECK(WE_SUCCESS == itds.get_accelerations_int(&x, &y, &z));
+	CHECK_NEAR(x, 0, 6);
+	CHECK_NEAR(y, 0, 2);
+	CHECK_NEAR(z, 1000, 2);
+	CHECK(WE_SUCCESS == itds.get_Offset(&readBack));
+	CHECK(0 == memcmp(readBack.offset, offset.offset, sizeof(offset.offset)));
+
+	/* beyond the range of the fine weight */
+	device.setAcceleration(SimWaveform::constant(600), SimWaveform::constant(0), SimWaveform::constant(1000));
+	delay(20);
+	CHECK(WE_SUCCESS == itds.calibrate_Offset(&offset));
+	CHECK(ITDS_enable == offset.weight);
+	CHECK_NEAR(offset.offset[0], 38, 1);
+	CHECK(WE_SUCCESS == itds.set_Offset(&noOffset));
+	CHECK(0 == device.peek(ITDS_X_OFS_USR_REG));
+}
+
+static constexpr ITDS_detection_Profile_t tapProfile = {
+	{ 9, 9, 9, ITDS_enable, ITDS_enable, ITDS_enable, Z_Y_X, 2, 1, 7, ITDS_enable },
+	{ 2, 1, ITDS_enable, ITDS_disable, 3 },
+	{ ten, 33 },
+	sixtyDeg,
+	ITDS_disable
+};
+static_assert(ITDS_isValidDetectionProfile(tapProfile), "tap profile out of range");
+
+static constexpr ITDS_detection_Profile_t invalidProfile = {
+	{ 32, 9, 9, ITDS_enable, ITDS_enable, ITDS_enable, Z_Y_X, 2, 1, 7, ITDS_enable },
+	{ 2, 1, ITDS_enable, ITDS_disable, 3 },
+	{ ten, 33 },
+	sixtyDeg,
+	ITDS_disable
+};
+static_assert(!ITDS_isValidDetectionProfile(invalidProfile), "tap threshold not checked");
+
+/* Detection profile written in one transfer */
+static void TestDetectionProfile()
+{
+	SimBus bus;
+	SimITDS device(ITDS_ADDRESS_I2C_1);
+	Sensor_ITDS itds;
+	uint32_t transfers;
+	uint8_t threshold = 0;
+
+	StartItds(bus, device, itds);
+
+	transfers = bus.statistics().transfers;
+	CHECK(WE_SUCCESS == itds.set_Detection_Profile(&tapProfile));
+	CHECK(1 == bus.statistics().transfers - transfers);
+	CHECK(0x49 == device.peek(ITDS_TAP_X_TH_REG));
+	CHECK(0x69 == device.peek(ITDS_TAP_Y_TH_REG));
+	CHECK(0xE9 == device.peek(ITDS_TAP_Z_TH_REG));
+	CHECK(0x76 == device.peek(ITDS_INT_DUR_REG));
+	CHECK(0xC2 == device.peek(ITDS_WAKE_UP_TH_REG));
+	CHECK(0xA3 == device.peek(ITDS_WAKE_UP_DUR_REG));
+	CHECK(0x0B == device.peek(ITDS_FREE_FALL_REG));
+
+	/* the registers are cached */
+	transfers = bus.statistics().transfers;
+	CHECK(WE_SUCCESS == ITDS_getWakeupThreshold(itds.get_Interface(), &threshold));
+	CHECK(2 == threshold);
+	CHECK(0 == bus.statistics().transfers - transfers);
+
+	CHECK(WE_FAIL == itds.set_Detection_Profile(&invalidProfile));
+	CHECK(0x49 == device.peek(ITDS_TAP_X_TH_REG));
+}
+
+/* Frames decoded from a FIFO with decimated data sets, read from mid-frame */
+static void TestFifoDecoder()
+{
+	SimBus bus;
+	SimISDS device(ISDS_ADDRESS_I2C_1);
+	Sensor_ISDS isds;
+	WE_sensorInterface_t *sensorInterface;
+	ISDS_fifoFrame_t frames[40];
+	uint32_t times[40];
+	int16_t gyro[3];
+	int16_t acc[3];
+	uint16_t words[4];
+	uint32_t lastTimestamp = 0;
+	int lastCycle;
+	int count;
+
+	bus.attach(&device);
+	device.setAcceleration(SimWaveform::constant(10), SimWaveform::constant(20), SimWaveform::constant(-980));
+	device.setAngularRate(SimWaveform::constant(1000), SimWaveform::constant(-5000), SimWaveform::constant(0));
+	device.setTemperature(SimWaveform::constant(27.5));
+	CHECK(WE_SUCCESS == isds.init(ISDS_ADDRESS_I2C_1, &bus, &WE_simTransport));
+	sensorInterface = isds.get_Interface();
+
+	ISDS_setAccOutputDataRate(sensorInterface, ISDS_accOdr104Hz);
+	ISDS_setGyroOutputDataRate(sensorInterface, ISDS_gyroOdr104Hz);
+	ISDS_enableTimestampCount(sensorInterface, ISDS_enable);
+	ISDS_enableFifoTimestamp(sensorInterface, ISDS_enable);
+	ISDS_setFifoGyroDecimation(sensorInterface, ISDS_fifoDecimationDisabled);
+	ISDS_setFifoAccDecimation(sensorInterface, ISDS_fifoDecimationFactor2);
+	ISDS_setFifoDataset4Decimation(sensorInterface, ISDS_fifoDecimationFactor4);
+	ISDS_setFifoOutputDataRate(sensorInterface, ISDS_fifoOdr104Hz);
+	ISDS_setFifoMode(sensorInterface, ISDS_continuousMode);
+	delay(200);
+
+	ISDS_getRawAngularRates(sensorInterface, &gyro[0], &gyro[1], &gyro[2]);
+	ISDS_getRawAccelerations(sensorInterface, &acc[0], &acc[1], &acc[2]);
+	/* leave the FIFO in the middle of a frame */
+	ISDS_getFifoData(sensorInterface, 4, words);
+
+	count = isds.read_FIFO_frames(frames, 40);
+	CHECK((count >= 15) && (count <= 20));
+	CHECK(1 == frames[0].cycle);
+	for (int i = 0; i < count; i++)
+	{
+		uint8_t sets = ISDS_FIFO_SET_GYRO;
+		sets |= (0 == frames[i].cycle % 2) ? ISDS_FIFO_SET_ACC : 0;
+		sets |= (0 == frames[i].cycle) ? ISDS_FIFO_SET_FOURTH : 0;
+		CHECK(sets == frames[i].sets);
+		CHECK((gyro[0] == frames[i].gyro[0]) && (gyro[1] == frames[i].gyro[1]));
+		if (frames[i].sets & ISDS_FIFO_SET_ACC)
+		{
+			CHECK(acc[2] == frames[i].acc[2]);
+		}
+		if (i > 0)
+		{
+			CHECK(frames[i].cycle == (frames[i - 1].cycle + 1) % 4);
+		}
+		if (frames[i].sets & ISDS_FIFO_SET_FOURTH)
+		{
+			CHECK(frames[i].timestamp > lastTimestamp);
+			lastTimestamp = frames[i].timestamp;
+		}
+	}
+
+	/* a partial read continues with the next frame */
+	lastCycle = frames[count - 1].cycle;
+	delay(60);
+	CHECK(3 == isds.read_FIFO_frames(frames, 3));
+	CHECK(frames[0].cycle == (lastCycle + 1) % 4);
+	lastCycle = frames[2].cycle;
+	delay(100);
+	count = isds.read_FIFO_frames(frames, 40);
+	CHECK((count >= 13) && (count <= 18));
+	CHECK(frames[0].cycle == (lastCycle + 1) % 4);
+
+	/* temperature instead of timestamp and step counter in the fourth data set */
+	ISDS_setFifoMode(sensorInterface, ISDS_bypassMode);
+	ISDS_enableFifoTemperature(sensorInterface, ISDS_enable);
+	ISDS_setFifoMode(sensorInterface, ISDS_continuousMode);
+	delay(100);
+	count = isds.read_FIFO_frames(frames, times, 40);
+	CHECK(count >= 8);
+	int temperatures = 0;
+	for (int i = 0; i < count; i++)
+	{
+		if (frames[i].sets & ISDS_FIFO_SET_FOURTH)
+		{
+			CHECK(frames[i].sets & ISDS_FIFO_SET_TEMP);
+			/* 2.5 °C above 25 °C at 256 LSB/°C */
+			CHECK(640 == frames[i].temperature);
+			temperatures++;
+		}
+		else
+		{
+			CHECK(0 == (frames[i].sets & ISDS_FIFO_SET_TEMP));
+		}
+		/* no timestamps to place the frames */
+		CHECK(0 == times[i]);
+	}
+	CHECK(temperatures >= 2);
+}
+
+/* Status, temperature, angular rate and acceleration of one sample */
+static void TestIsdsSample()
+{
+	SimBus bus;
+	SimISDS device(ISDS_ADDRESS_I2C_1);
+	Sensor_ISDS isds;
+	WE_sensorInterface_t *sensorInterface;
+	ISDS_sample_t sample;
+	uint32_t transfers;
+	int16_t acc[3];
+	int32_t rate[3];
+	float temperature;
+
+	bus.attach(&device);
+	device.setAcceleration(SimWaveform::constant(10), SimWaveform::constant(20), SimWaveform::constant(-980));
+	device.setAngularRate(SimWaveform::constant(1000), SimWaveform::constant(-5000), SimWaveform::constant(0));
+	device.setTemperature(SimWaveform::constant(27.5));
+	CHECK(WE_SUCCESS == isds.init(ISDS_ADDRESS_I2C_1, &bus, &WE_simTransport));
+	sensorInterface = isds.get_Interface();
+	CHECK(WE_SUCCESS == ISDS_setAccOutputDataRate(sensorInterface, ISDS_accOdr104Hz));
+	CHECK(WE_SUCCESS == ISDS_setGyroOutputDataRate(sensorInterface, ISDS_gyroOdr104Hz));
+	CHECK(WE_SUCCESS == ISDS_enableBlockDataUpdate(sensorInterface, ISDS_enable));
+	delay(100);
+
+	transfers = bus.statistics().transfers;
+	CHECK(WE_SUCCESS == isds.get_Sample(&sample));
+	CHECK(1 == bus.statistics().transfers - transfers);
+	CHECK(sample.status.accDataReady && sample.status.gyroDataReady && sample.status.tempDataReady);
+
+	/* the same sample as the single reads */
+	CHECK(WE_SUCCESS == isds.get_accelerations(&acc[0], &acc[1], &acc[2]));
+	CHECK(WE_SUCCESS == isds.get_angular_rates(&rate[0], &rate[1], &rate[2]));
+	CHECK(WE_SUCCESS == isds.get_temperature(&temperature));
+	for (int i = 0; i < 3; i++)
+	{
+		CHECK(acc[i] == sample.acc[i]);
+		CHECK(rate[i] == sample.gyro[i]);
+	}
+	CHECK_NEAR(sample.temperature / 100.0, temperature, 0.01);
+	CHECK_NEAR(sample.acc[2], -980, 1);
+	CHECK_NEAR(sample.gyro[1], -5000, 10);
+	CHECK_NEAR(sample.temperature, 2750, 1);
+}
+
+/* Rate plan of the gyroscope at 833 Hz and the accelerometer at 104 Hz */
+static void TestRatePlan()
+{
+	SimBus bus;
+	SimISDS device(ISDS_ADDRESS_I2C_1);
+	Sensor_ISDS isds;
+	uint32_t transfers;
+	ISDS_ratePlan_t plan = { ISDS_accOdr104Hz, ISDS_accFullScaleFourG, ISDS_disable,
+							 ISDS_gyroOdr833Hz, ISDS_gyroFullScale500dps, ISDS_enable,
+							 ISDS_fifoOdr833Hz, ISDS_fifoDecimationNoFifo, ISDS_fifoDecimationNoFifo };
+	ISDS_ratePlan_t other;
+
+	bus.attach(&device);
+	CHECK(WE_SUCCESS == isds.init(ISDS_ADDRESS_I2C_1, &bus, &WE_simTransport));
+	CHECK(WE_SUCCESS == WE_resyncRegisterCache(isds.get_Interface()));
+
+	/* FIFO_CTRL3 ... FIFO_CTRL5 and CTRL1 ... CTRL7 */
+	transfers = bus.statistics().transfers;
+	CHECK(WE_SUCCESS == isds.set_Rates(&plan));
+	CHECK(2 == bus.statistics().transfers - transfers);
+	/* every 8th FIFO cycle carries an accelerometer sample */
+	CHECK(ISDS_fifoDecimationFactor8 == plan.accDecimation);
+	CHECK(ISDS_fifoDecimationDisabled == plan.gyroDecimation);
+	CHECK(0x48 == device.peek(ISDS_CTRL_1_REG));
+	CHECK(0x74 == device.peek(ISDS_CTRL_2_REG));
+	CHECK(device.peek(ISDS_CTRL_6_REG) & 0x10);
+	CHECK(0 == (device.peek(ISDS_CTRL_7_REG) & 0x80));
+	CHECK(0x0D == device.peek(ISDS_FIFO_CTRL_3_REG));
+	CHECK(ISDS_fifoOdr833Hz == (device.peek(ISDS_FIFO_CTRL_5_REG) >> 3));
+
+	/* the FIFO cannot run faster than the fastest sensor */
+	other = plan;
+	other.fifoOdr = ISDS_fifoOdr1k66Hz;
+	CHECK(WE_FAIL == isds.set_Rates(&other));
+	other = plan;
+	other.gyroOdr = ISDS_gyroOdrOff;
+	other.accOdr = ISDS_accOdr12Hz5;
+	CHECK(WE_FAIL == isds.set_Rates(&other));
+
+	other = plan;
+	other.fifoOdr = ISDS_fifoOdr208Hz;
+	CHECK(WE_SUCCESS == ISDS_planRates(&other));
+	CHECK(ISDS_fifoDecimationFactor2 == other.accDecimation);
+	CHECK(ISDS_fifoDecimationDisabled == other.gyroDecimation);
+	other = plan;
+	other.accOdr = ISDS_accOdr1Hz6;
+	other.gyroOdr = ISDS_gyroOdr12Hz5;
+	other.fifoOdr = ISDS_fifoOdr12Hz5;
+	CHECK(WE_SUCCESS == ISDS_planRates(&other));
+	CHECK(ISDS_fifoDecimationFactor8 == other.accDecimation);
+	other = plan;
+	other.fifoOdr = ISDS_fifoOdrOff;
+	CHECK(WE_SUCCESS == ISDS_planRates(&other));
+	CHECK(ISDS_fifoDecimationNoFifo == other.accDecimation);
+}
+
+/* Unwrap and drift tracking of the timestamp counter, then frame times on the simulated part */
+static void TestTimestampClock()
+{
+	ISDS_timestampClock_t clock;
+	const double rate = 1.0 + 300e-6;   /* sensor clock 300 ppm fast */
+	uint32_t seed = 7;
+	double worst = 0;
+
+	/* 10 minutes of syncs every 10 ms, the 24 bit counter wraps after 419 s */
+	ISDS_initTimestampClock(&clock, ISDS_timestampResolution25mus);
+	for (int i = 0; i < 60000; i++)
+	{
+		double hostUs = 1000.0 + i * 10000.0;
+		uint32_t ticks = (uint32_t)(hostUs * rate / 25.0) & 0xFFFFFF;
+
+		/* read latency of 100 ... 2100 µs */
+		seed = seed * 1103515245 + 12345;
+		ISDS_syncTimestampClock(&clock, ticks, (uint32_t)(uint64_t)(hostUs + 100 + (seed >> 16) % 2000));
+
+		if ((i > 30000) && (0 == i % 97))
+		{
+			double sampleUs = hostUs - 5000;
+			uint32_t sampleTicks = (uint32_t)(sampleUs * rate / 25.0) & 0xFFFFFF;
+			double error = (double)(int32_t)(ISDS_getHostTime(&clock, sampleTicks) - (uint32_t)(uint64_t)(sampleUs + 100));
+			worst = (fabs(error) > worst) ? fabs(error) : worst;
+		}
+	}
+	CHECK_NEAR(clock.driftPpm, -300, 20);
+	CHECK(worst < 150);
+
+	SimBus bus;
+	SimISDS device(ISDS_ADDRESS_I2C_1);
+	Sensor_ISDS isds;
+	ISDS_fifoFrame_t frames[40];
+	uint32_t times[40];
+	ISDS_ratePlan_t plan = { ISDS_accOdr104Hz, ISDS_accFullScaleFourG, ISDS_disable,
+							 ISDS_gyroOdr833Hz, ISDS_gyroFullScale500dps, ISDS_enable,
+							 ISDS_fifoOdr833Hz, ISDS_fifoDecimationNoFifo, ISDS_fifoDecimationNoFifo };
+
+	bus.attach(&device);
+	CHECK(WE_SUCCESS == isds.init(ISDS_ADDRESS_I2C_1, &bus, &WE_simTransport));
+	CHECK(WE_SUCCESS == isds.set_Rates(&plan));
+	CHECK(WE_SUCCESS == isds.start_Timestamps());
+	ISDS_setFifoMode(isds.get_Interface(), ISDS_continuousMode);
+	delay(30);
+
+	uint32_t before = micros();
+	int count = isds.read_FIFO_frames(frames, times, 40);
+	uint32_t after = micros();
+	CHECK(count > 20);
+	for (int i = 0; i < count; i++)
+	{
+		CHECK(frames[i].sets & ISDS_FIFO_SET_FOURTH);
+		if (i > 0)
+		{
+			/* 1.2 ms at 833 Hz */
+			CHECK_NEAR((int32_t)(times[i] - times[i - 1]), 1200, 100);
+		}
+	}
+	CHECK((int32_t)(after - times[count - 1]) >= 0);
+	CHECK((int32_t)(times[count - 1] - before) > -1500);
+}
+
+/* Orientation estimator on synthetic samples and on the FIFO of the simulated part */
+static void TestFusion()
+{
+	ISDS_fusion_t fusion;
+	float q[4];
+	const int16_t still[3] = { 0, 0, 0 };
+	const int16_t level[3] = { 0, 0, 16384 };   /* 1 g at 2 g full scale */
+
+	CHECK(625000 == ISDS_getAccOutputDataRatePeriodUs(ISDS_accOdr1Hz6));
+	CHECK(150 == ISDS_getGyroOutputDataRatePeriodUs(ISDS_gyroOdr6k66Hz));
+	CHECK(0 == ISDS_getGyroOutputDataRatePeriodUs((ISDS_gyroOutputDataRate_t)11));
+	CHECK(1200 == ISDS_getGyroOutputDataRatePeriodUs(ISDS_gyroOdr833Hz));
+
+	CHECK(WE_FAIL == ISDS_initFusion(&fusion, ISDS_gyroFullScale2000dps, ISDS_accFullScaleTwoG, 0));
+	CHECK(WE_SUCCESS == ISDS_initFusion(&fusion, ISDS_gyroFullScale2000dps, ISDS_accFullScaleTwoG, 1200));
+	for (int i = 0; i < 1000; i++)
+	{
+		ISDS_updateFusion(&fusion, still, level);
+	}
+	ISDS_getFusionQuaternion_float(&fusion, q);
+	CHECK_NEAR(q[0], 1, 1e-6);
+	CHECK_NEAR(q[1], 0, 1e-6);
+
+	/* yaw at 90 dps (1286 LSB of 70 mdps) for 833 samples of 1.2 ms */
+	const int16_t yaw[3] = { 0, 0, 1286 };
+	for (int i = 0; i < 833; i++)
+	{
+		ISDS_updateFusion(&fusion, yaw, level);
+	}
+	ISDS_getFusionQuaternion_float(&fusion, q);
+	CHECK_NEAR(2 * atan2(q[3], q[0]) * 180 / M_PI, 0.9996 * 1286 * 70 / 1000, 0.05);
+
+	/* roll of 30° from the accelerometer only */
+	const int16_t tilted[3] = { 0, (int16_t)(16384 * 0.5), (int16_t)(16384 * 0.8660254) };
+	ISDS_resetFusion(&fusion);
+	CHECK(WE_SUCCESS == ISDS_setFusionGains(&fusion, 5 * ISDS_FUSION_GAIN_ONE, 0));
+	for (int i = 0; i < 5000; i++)
+	{
+		ISDS_updateFusion(&fusion, still, tilted);
+	}
+	ISDS_getFusionQuaternion_float(&fusion, q);
+	CHECK_NEAR(2 * atan2(q[1], q[0]) * 180 / M_PI, 30, 0.05);
+
+	/* an acceleration outside 0.75 ... 1.25 g does not correct */
+	const int16_t shock[3] = { 0, 16384, 16384 };
+	ISDS_fusion_t shocked = fusion;
+	ISDS_updateFusion(&shocked, still, shock);
+	CHECK_NEAR(shocked.q[1], fusion.q[1], 2);
+
+	/* a gyroscope bias of 1 dps is integrated out */
+	const int16_t biased[3] = { 14, 0, 0 };
+	ISDS_resetFusion(&fusion);
+	CHECK(WE_SUCCESS == ISDS_setFusionGains(&fusion, 2 * ISDS_FUSION_GAIN_ONE, ISDS_FUSION_GAIN_ONE / 2));
+	for (int i = 0; i < 20000; i++)
+	{
+		ISDS_updateFusion(&fusion, biased, level);
+	}
+	ISDS_getFusionQuaternion_float(&fusion, q);
+	CHECK_NEAR(2 * atan2(q[1], q[0]) * 180 / M_PI, 0, 0.01);
+	CHECK_NEAR(fusion.integral[0] / 1073741824.0, -14 * 70e-6 * M_PI / 180 * 1000, 1e-4);
+
+	/* frames match single updates, acceleration with every 8th frame */
+	ISDS_fusion_t batch;
+	ISDS_fusion_t single;
+	ISDS_fifoFrame_t frames[32];
+	memset(frames, 0, sizeof(frames));
+	for (int i = 0; i < 32; i++)
+	{
+		frames[i].sets = ISDS_FIFO_SET_GYRO | ((0 == i % 8) ? ISDS_FIFO_SET_ACC : 0);
+		frames[i].gyro[0] = 500;
+		frames[i].gyro[1] = -300;
+		frames[i].gyro[2] = 1000;
+		frames[i].acc[0] = 1000;
+		frames[i].acc[2] = 8000;
+	}
+	ISDS_initFusion(&batch, ISDS_gyroFullScale2000dps, ISDS_accFullScaleFourG, 1200);
+	single = batch;
+	CHECK(32 == ISDS_updateFusionFrames(&batch, frames, 32));
+	for (int i = 0; i < 32; i++)
+	{
+		ISDS_updateFusion(&single, frames[i].gyro, (0 == i % 8) ? frames[i].acc : NULL);
+	}
+	for (int k = 0; k < 4; k++)
+	{
+		CHECK_NEAR(batch.q[k], single.q[k], 2000);
+	}
+
+	/* one second of yaw at 90 dps from the FIFO */
+	SimBus bus;
+	SimISDS device(ISDS_ADDRESS_I2C_1);
+	Sensor_ISDS isds;
+	ISDS_ratePlan_t plan = { ISDS_accOdr104Hz, ISDS_accFullScaleFourG, ISDS_disable,
+							 ISDS_gyroOdr833Hz, ISDS_gyroFullScale2000dps, ISDS_enable,
+							 ISDS_fifoOdr833Hz, ISDS_fifoDecimationNoFifo, ISDS_fifoDecimationNoFifo };
+	int steps = 0;
+
+	bus.attach(&device);
+	device.setAngularRate(SimWaveform::constant(0), SimWaveform::constant(0), SimWaveform::constant(90000));
+	device.setAcceleration(SimWaveform::constant(0), SimWaveform::constant(0), SimWaveform::constant(1000));
+	CHECK(WE_SUCCESS == isds.init(ISDS_ADDRESS_I2C_1, &bus, &WE_simTransport));
+	CHECK(WE_SUCCESS == isds.set_Rates(&plan));
+	CHECK(WE_SUCCESS == ISDS_initFusion(&fusion, plan.gyroFullScale, plan.accFullScale,
+										ISDS_getGyroOutputDataRatePeriodUs(plan.gyroOdr)));
+	ISDS_setFifoMode(isds.get_Interface(), ISDS_continuousMode);
+	while (steps < 833)
+	{
+		delay(10);
+		int count = isds.read_FIFO_frames(frames, (833 - steps < 32) ? (833 - steps) : 32);
+		CHECK(count >= 0);
+		if (count < 0)
+		{
+			break;
+		}
+		steps += ISDS_updateFusionFrames(&fusion, frames, (uint16_t)count);
+	}
+	ISDS_getFusionQuaternion_float(&fusion, q);
+	CHECK_NEAR(2 * atan2(q[3], q[0]) * 180 / M_PI, 90 * 0.9996, 0.3);
+	CHECK_NEAR(q[1], 0, 1e-3);
+}
+
+/* Raw ITDS acceleration at 2 g full scale */
+#define ITDS_RAW_LOW    3000    /* above 100 mg */
+#define ITDS_RAW_HIGH   5000    /* below 500 mg */
+
+static void SetItdsX(SimITDS &device, double mg)
+{
+	device.setAcceleration(SimWaveform::constant(mg), SimWaveform::constant(-250), SimWaveform::constant(1000));
+}
+
+/* Pre-/post-trigger capture across the freeze of the FIFO in FIFO mode */
+static void TestCapture()
+{
+	SimBus bus;
+	SimITDS device(ITDS_ADDRESS_I2C_1);
+	Sensor_ITDS itds;
+	static int16_t samples[68][3];
+	ITDS_shockRecord_t record;
+
+	StartItds(bus, device, itds);
+	CHECK(WE_FAIL == itds.arm_Capture(ITDS_captureWakeUp, samples, ITDS_FIFO_DEPTH + 1, 0));
+
+	/* FIFO full at the trigger: no post-trigger samples in it, restarted right away */
+	CHECK(WE_SUCCESS == itds.arm_Capture(ITDS_captureWakeUp, samples, 24, 16));
+	CHECK(ITDS_continuousToFifo == (device.peek(ITDS_FIFO_CTRL_REG) >> 5));
+	delay(300);
+	CHECK(0 == itds.service_Capture(&record));
+	device.triggerEvent();
+	itds.trigger_ISR();
+	SetItdsX(device, 500);
+	delay(20);
+	CHECK(0 == itds.service_Capture(&record));
+	CHECK(ITDS_continuousMode == (device.peek(ITDS_FIFO_CTRL_REG) >> 5));
+	delay(100);
+	CHECK(1 == itds.service_Capture(&record));
+	CHECK(24 == record.preSamples);
+	CHECK(16 == record.postSamples);
+	CHECK(0 == record.contiguousPost);
+	CHECK(5000 == record.samplePeriod);
+	CHECK((int32_t)(record.postTimestamp - record.timestamp) >= 20000);
+	CHECK((samples[0][0] < ITDS_RAW_LOW) && (samples[23][0] < ITDS_RAW_LOW));
+	CHECK((samples[24][0] > ITDS_RAW_HIGH) && (samples[39][0] > ITDS_RAW_HIGH));
+	CHECK(ITDS_bypassMode == (device.peek(ITDS_FIFO_CTRL_REG) >> 5));
+	CHECK(0 == itds.service_Capture(&record));
+
+	/* FIFO filling up after the trigger: split at the fill level, restarted once full */
+	SetItdsX(device, 100);
+	CHECK(WE_SUCCESS == itds.arm_Capture(ITDS_captureWakeUp, samples, 8, 60));
+	delay(50);
+	device.triggerEvent();
+	itds.trigger_ISR();
+	SetItdsX(device, 500);
+	delay(60);
+	CHECK(0 == itds.service_Capture(&record));
+	CHECK(ITDS_continuousToFifo == (device.peek(ITDS_FIFO_CTRL_REG) >> 5));
+	delay(200);
+	CHECK(0 == itds.service_Capture(&record));
+	CHECK(ITDS_continuousMode == (device.peek(ITDS_FIFO_CTRL_REG) >> 5));
+	delay(100);
+	CHECK(1 == itds.service_Capture(&record));
+	CHECK(8 == record.preSamples);
+	CHECK(60 == record.postSamples);
+	CHECK(record.contiguousPost > ITDS_FIFO_DEPTH);
+	/* the split is accurate to one sample */
+	CHECK((samples[0][0] < ITDS_RAW_LOW) && (samples[6][0] < ITDS_RAW_LOW));
+	CHECK((samples[9][0] > ITDS_RAW_HIGH) && (samples[67][0] > ITDS_RAW_HIGH));
+
+	/* no samples after the restart: delivered short at the deadline */
+	SetItdsX(device, 100);
+	CHECK(WE_SUCCESS == itds.arm_Capture(ITDS_captureWakeUp, samples, 24, 16));
+	delay(300);
+	device.triggerEvent();
+	itds.trigger_ISR();
+	CHECK(0 == itds.service_Capture(&record));
+	CHECK(WE_SUCCESS == ITDS_setOutputDataRate(itds.get_Interface(), ITDS_odr0));
+	delay(100);
+	CHECK(0 == itds.service_Capture(&record));
+	delay(100);
+	CHECK(1 == itds.service_Capture(&record));
+	CHECK(24 == record.preSamples);
+	CHECK(record.postSamples < 2);
+}
+
+int main()
+{
+	struct
+	{
+		const char *name;
+		void (*run)();
+	} tests[] = {
+		{ "sensor classes", TestSensors },
+		{ "ISDS full scales", TestFullScales },
+		{ "HIDS raw values", TestHidsRawValues },
+		{ "async requests", TestAsync },
+		{ "register cache", TestRegisterCache },
+		{ "configuration", TestConfiguration },
+		{ "ITDS streaming", TestStreaming },
+		{ "ITDS capture", TestCapture },
+		{ "ITDS events", TestEvents },
+		{ "ITDS single conversion", TestSingleConversion },
+		{ "ITDS offset calibration", TestOffsetCalibration },
+		{ "ITDS detection profile", TestDetectionProfile },
+		{ "ISDS FIFO decoder", TestFifoDecoder },
+		{ "ISDS sample", TestIsdsSample },
+		{ "ISDS rate plan", TestRatePlan },
+		{ "ISDS timestamp clock", TestTimestampClock },
+		{ "ISDS fusion", TestFusion },
+	};
+
+	for (size_t n = 0; n < sizeof(tests) / sizeof(tests[0]); n++)
+	{
+		int before = failures;
+		tests[n].run();
+		printf("%-30s %s\n", tests[n].name, (before == failures) ? "ok" : "FAILED");
+	}
+
+	return (0 == failures) ? 0 : 1;
+}